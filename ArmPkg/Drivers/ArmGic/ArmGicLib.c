@@ -343,6 +343,109 @@ ArmGicDisableInterrupt (
   }
 }
 
+VOID
+EFIAPI
+ArmGicDisableAllInterrupts (
+  IN UINTN  GicDistributorBase,
+  IN UINTN  GicRedistributorBase,
+  IN UINTN  GicNumInterrupts
+  )
+{
+  UINT32                 RegOffset;
+  ARM_GIC_ARCH_REVISION  Revision;
+  UINTN                  GicCpuRedistributorBase;
+  UINT32                 FirstSpiRegOffset;
+
+  Revision          = ArmGicGetSupportedArchRevision ();
+  FirstSpiRegOffset = 0;
+
+  if ((Revision == ARM_GIC_ARCH_REVISION_3) &&
+      !FeaturePcdGet (PcdArmGicV3WithV2Legacy))
+  {
+    // With Affinity Routing enabled, SGIs and PPIs are controlled through
+    // the redistributor of the current CPU
+    GicCpuRedistributorBase = GicGetCpuRedistributorBase (
+                                GicRedistributorBase,
+                                Revision
+                                );
+    if (GicCpuRedistributorBase != 0) {
+      MmioWrite32 (
+        ICENABLER_ADDRESS (GicCpuRedistributorBase, 0),
+        0xffffffff
+        );
+    }
+
+    FirstSpiRegOffset = 1;
+  }
+
+  // Write clear-enable registers, 32 interrupts per access
+  for (RegOffset = FirstSpiRegOffset;
+       RegOffset < GicNumInterrupts / 32;
+       RegOffset++)
+  {
+    MmioWrite32 (
+      GicDistributorBase + ARM_GIC_ICDICER + (4 * RegOffset),
+      0xffffffff
+      );
+  }
+}
+
+VOID
+EFIAPI
+ArmGicSetAllInterruptPriorities (
+  IN UINTN  GicDistributorBase,
+  IN UINTN  GicRedistributorBase,
+  IN UINTN  GicNumInterrupts,
+  IN UINTN  Priority
+  )
+{
+  UINT32                 RegOffset;
+  UINT32                 PriorityValue;
+  ARM_GIC_ARCH_REVISION  Revision;
+  UINTN                  GicCpuRedistributorBase;
+  UINT32                 FirstSpiRegOffset;
+
+  // Replicate the priority byte across the whole register
+  PriorityValue  = (UINT32)(Priority & 0xff);
+  PriorityValue |= PriorityValue << 8;
+  PriorityValue |= PriorityValue << 16;
+
+  Revision          = ArmGicGetSupportedArchRevision ();
+  FirstSpiRegOffset = 0;
+
+  if ((Revision == ARM_GIC_ARCH_REVISION_3) &&
+      !FeaturePcdGet (PcdArmGicV3WithV2Legacy))
+  {
+    // With Affinity Routing enabled, SGIs and PPIs are controlled through
+    // the redistributor of the current CPU
+    GicCpuRedistributorBase = GicGetCpuRedistributorBase (
+                                GicRedistributorBase,
+                                Revision
+                                );
+    if (GicCpuRedistributorBase != 0) {
+      for (RegOffset = 0; RegOffset < 8; RegOffset++) {
+        MmioWrite32 (
+          IPRIORITY_ADDRESS (GicCpuRedistributorBase, RegOffset),
+          PriorityValue
+          );
+      }
+    }
+
+    FirstSpiRegOffset = 8;
+  }
+
+  // Write priority registers, 4 interrupts per access
+  for (RegOffset = FirstSpiRegOffset;
+       RegOffset < GicNumInterrupts / 4;
+       RegOffset++)
+  {
+    MmioWrite32 (
+      GicDistributorBase + ARM_GIC_ICDIPR + (4 * RegOffset),
+      PriorityValue
+      );
+  }
+}
+
 BOOLEAN
 EFIAPI
 ArmGicIsInterruptEnabled (
@@ -341,12 +341,12 @@ GicV3ExitBootServicesEvent (
   IN VOID       *Context
   )
 {
-  UINTN  Index;
-
-  // Acknowledge all pending interrupts
-  for (Index = 0; Index < mGicNumInterrupts; Index++) {
-    GicV3DisableInterruptSource (&gHardwareInterruptV3Protocol, Index);
-  }
+  // Disable all the interrupt sources
+  ArmGicDisableAllInterrupts (
+    mGicDistributorBase,
+    mGicRedistributorsBase,
+    mGicNumInterrupts
+    );
 
   // Disable Gic Interface
   ArmGicV3DisableInterruptInterface ();
@@ -391,17 +391,24 @@ GicV3DxeInitialize (
     MmioOr32 (mGicDistributorBase + ARM_GIC_ICDDCR, ARM_GIC_ICDDCR_ARE);
   }
 
-  for (Index = 0; Index < mGicNumInterrupts; Index++) {
-    GicV3DisableInterruptSource (&gHardwareInterruptV3Protocol, Index);
-
-    // Set Priority
-    ArmGicSetInterruptPriority (
-      mGicDistributorBase,
-      mGicRedistributorsBase,
-      Index,
-      ARM_GIC_DEFAULT_PRIORITY
-      );
-  }
+  //
+  // Disable all the interrupts and set them all to the default priority,
+  // a register's worth of interrupts at a time. Going through the
+  // single-interrupt accessors here would rediscover the redistributor of
+  // the boot CPU for every SGI and PPI, which gets expensive on high core
+  // count platforms.
+  //
+  ArmGicDisableAllInterrupts (
+    mGicDistributorBase,
+    mGicRedistributorsBase,
+    mGicNumInterrupts
+    );
+  ArmGicSetAllInterruptPriorities (
+    mGicDistributorBase,
+    mGicRedistributorsBase,
+    mGicNumInterrupts,
+    ARM_GIC_DEFAULT_PRIORITY
+    );
 
   // Targets the interrupts to the Primary Cpu
 
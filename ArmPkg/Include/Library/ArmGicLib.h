@@ -232,6 +232,23 @@ ArmGicDisableInterrupt (
   IN UINTN  Source
   );
 
+VOID
+EFIAPI
+ArmGicDisableAllInterrupts (
+  IN UINTN  GicDistributorBase,
+  IN UINTN  GicRedistributorBase,
+  IN UINTN  GicNumInterrupts
+  );
+
+VOID
+EFIAPI
+ArmGicSetAllInterruptPriorities (
+  IN UINTN  GicDistributorBase,
+  IN UINTN  GicRedistributorBase,
+  IN UINTN  GicNumInterrupts,
+  IN UINTN  Priority
+  );
+
 BOOLEAN
 EFIAPI
 ArmGicIsInterruptEnabled (
@@ -363,6 +363,18 @@ ArmUpdateTranslationTableEntry (
   IN  VOID  *Mva
   );
 
+/**
+ * Invalidate all TLB entries covering a virtual address range, with a single
+ * barrier sequence ordering the preceding translation table updates against
+ * the whole batch of invalidations.
+ */
+VOID
+EFIAPI
+ArmInvalidateTlbRange (
+  IN  VOID   *Mva,
+  IN  UINTN  Length
+  );
+
 VOID
 EFIAPI
 ArmSetDomainAccessControl (
@@ -769,6 +781,31 @@ ArmHasCcidx (
   VOID
   );
 
+/** Checks if the instruction caches fetch coherently with data cache
+    cleaning to the Point of Unification.
+
+   @retval TRUE  No data cache clean is needed for instruction/data coherence.
+   @retval FALSE Data caches must be cleaned to the Point of Unification.
+**/
+BOOLEAN
+EFIAPI
+ArmHasIdc (
+  VOID
+  );
+
+/** Checks if instruction cache invalidation is not required for
+    instruction/data coherence to the Point of Unification.
+
+   @retval TRUE  No instruction cache invalidation is needed.
+   @retval FALSE Instruction caches must be invalidated to the Point of
+                 Unification.
+**/
+BOOLEAN
+EFIAPI
+ArmHasDic (
+  VOID
+  );
+
 #ifdef MDE_CPU_ARM
 ///
 /// AArch32-only ID Register Helper functions
@@ -63,18 +63,35 @@ InvalidateInstructionCacheRange (
   IN      UINTN  Length
   )
 {
-  CacheRangeOperation (
-    Address,
-    Length,
-    ArmCleanDataCacheEntryToPoUByMVA,
-    ArmDataCacheLineLength ()
-    );
-  CacheRangeOperation (
-    Address,
-    Length,
-    ArmInvalidateInstructionCacheEntryToPoUByMVA,
-    ArmInstructionCacheLineLength ()
-    );
+  if (ArmHasIdc ()) {
+    //
+    // Instruction fetches are coherent with data cache cleaning to the Point
+    // of Unification, so the clean loop can be elided entirely. The stores
+    // that modified the range must still be completed before the instruction
+    // cache maintenance (or the fetch itself) can observe them.
+    //
+    ArmDataSynchronizationBarrier ();
+  } else {
+    CacheRangeOperation (
+      Address,
+      Length,
+      ArmCleanDataCacheEntryToPoUByMVA,
+      ArmDataCacheLineLength ()
+      );
+  }
+
+  //
+  // Likewise, instruction cache invalidation to the Point of Unification is
+  // not needed on cores that advertise DIC.
+  //
+  if (!ArmHasDic ()) {
+    CacheRangeOperation (
+      Address,
+      Length,
+      ArmInvalidateInstructionCacheEntryToPoUByMVA,
+      ArmInstructionCacheLineLength ()
+      );
+  }
 
   ArmInstructionSynchronizationBarrier ();
 
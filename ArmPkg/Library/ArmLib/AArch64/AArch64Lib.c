@@ -104,3 +104,34 @@ ArmHasCcidx (
   Mmfr2 = ArmReadIdAA64Mmfr2 ();
   return (((Mmfr2 >> 20) & 0xF) == 1) ? TRUE : FALSE;
 }
+
+/** Checks if the instruction caches fetch coherently with data cache
+    cleaning to the Point of Unification.
+
+   @retval TRUE  No data cache clean is needed for instruction/data coherence.
+   @retval FALSE Data caches must be cleaned to the Point of Unification.
+**/
+BOOLEAN
+EFIAPI
+ArmHasIdc (
+  VOID
+  )
+{
+  return (((ArmCacheInfo () >> 28) & 0x1) == 1) ? TRUE : FALSE; // CTR_EL0.IDC
+}
+
+/** Checks if instruction cache invalidation is not required for
+    instruction/data coherence to the Point of Unification.
+
+   @retval TRUE  No instruction cache invalidation is needed.
+   @retval FALSE Instruction caches must be invalidated to the Point of
+                 Unification.
+**/
+BOOLEAN
+EFIAPI
+ArmHasDic (
+  VOID
+  )
+{
+  return (((ArmCacheInfo () >> 29) & 0x1) == 1) ? TRUE : FALSE; // CTR_EL0.DIC
+}
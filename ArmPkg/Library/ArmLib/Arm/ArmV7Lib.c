@@ -119,3 +119,33 @@ ArmHasCcidx (
   Mmfr4 = ArmReadIdMmfr4 ();
   return (((Mmfr4 >> 24) & 0xF) == 1) ? TRUE : FALSE;
 }
+
+/** Checks if the instruction caches fetch coherently with data cache
+    cleaning to the Point of Unification.
+
+   @retval FALSE Data caches must be cleaned to the Point of Unification;
+                 the AArch32 CTR carries no IDC field.
+**/
+BOOLEAN
+EFIAPI
+ArmHasIdc (
+  VOID
+  )
+{
+  return FALSE;
+}
+
+/** Checks if instruction cache invalidation is not required for
+    instruction/data coherence to the Point of Unification.
+
+   @retval FALSE Instruction caches must be invalidated to the Point of
+                 Unification; the AArch32 CTR carries no DIC field.
+**/
+BOOLEAN
+EFIAPI
+ArmHasDic (
+  VOID
+  )
+{
+  return FALSE;
+}
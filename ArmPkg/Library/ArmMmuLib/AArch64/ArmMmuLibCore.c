@@ -305,6 +305,16 @@ UpdateRegionMappingRecursive (
         TranslationTable = (VOID *)(UINTN)(*Entry & TT_ADDRESS_MASK_BLOCK_ENTRY);
         ReplaceTableEntry (Entry, EntryValue, RegionStart, TRUE);
         FreePageTablesRecursive (TranslationTable, Level + 1);
+      } else if (ArmMmuEnabled ()) {
+        //
+        // Update the block or page entry in place, and defer the TLB
+        // maintenance: no break-before-make is required for changing the
+        // attributes of a valid entry (or for making an invalid entry
+        // valid), so UpdateRegionMapping () can invalidate the whole
+        // region with a single barrier sequence once all the entries have
+        // been written.
+        //
+        *Entry = EntryValue;
       } else {
         ReplaceTableEntry (Entry, EntryValue, RegionStart, FALSE);
       }
@@ -323,7 +333,8 @@ UpdateRegionMapping (
   IN  UINT64  AttributeClearMask
   )
 {
-  UINTN  T0SZ;
+  UINTN       T0SZ;
+  EFI_STATUS  Status;
 
   if (((RegionStart | RegionLength) & EFI_PAGE_MASK) != 0) {
     return EFI_INVALID_PARAMETER;
@@ -331,14 +342,31 @@ UpdateRegionMapping (
 
   T0SZ = ArmGetTCR () & TCR_T0SZ_MASK;
 
-  return UpdateRegionMappingRecursive (
-           RegionStart,
-           RegionStart + RegionLength,
-           AttributeSetMask,
-           AttributeClearMask,
-           ArmGetTTBR0BaseAddress (),
-           GetRootTableLevel (T0SZ)
-           );
+  Status = UpdateRegionMappingRecursive (
+             RegionStart,
+             RegionStart + RegionLength,
+             AttributeSetMask,
+             AttributeClearMask,
+             ArmGetTTBR0BaseAddress (),
+             GetRootTableLevel (T0SZ)
+             );
+
+  if (ArmMmuEnabled ()) {
+    //
+    // Block and page entries may have been updated in place with their TLB
+    // maintenance deferred (even on failure, some updates may have landed),
+    // so invalidate the whole region with one barrier sequence now. Beyond
+    // a certain region size, invalidating the entire TLB is cheaper than
+    // walking the region page by page.
+    //
+    if (RegionLength < SIZE_16MB) {
+      ArmInvalidateTlbRange ((VOID *)(UINTN)RegionStart, RegionLength);
+    } else {
+      ArmInvalidateTlb ();
+    }
+  }
+
+  return Status;
 }
 
 STATIC
@@ -240,10 +240,10 @@ NorFlashWriteSingleWord (
  * This function presumes that both the TargetAddress and the TargetAddress+BufferSize
  * exist entirely within the NOR Flash. Therefore these conditions will not be checked here.
  *
- * In buffered programming, if the target address not at the beginning of a 32-bit word boundary,
- * then programming time is doubled and power consumption is increased.
- * Therefore, it is a requirement to align buffer writes to 32-bit word boundaries.
- * i.e. the last 4 bits of the target start address must be zero: 0x......00
+ * In buffered programming the target address must be aligned to a 32-bit word
+ * boundary, and the programmed range must not cross the 32-word boundary the
+ * target address belongs to, because the on-chip buffer only spans a single
+ * 32-word region.
  */
 EFI_STATUS
 NorFlashWriteBuffer (
@@ -264,8 +264,8 @@ NorFlashWriteBuffer (
   WaitForBuffer   = MAX_BUFFERED_PROG_ITERATIONS;
   BufferAvailable = FALSE;
 
-  // Check that the target address does not cross a 32-word boundary.
-  if ((TargetAddress & BOUNDARY_OF_32_WORDS) != 0) {
+  // Check that the target address is aligned to a 32-bit word boundary.
+  if ((TargetAddress & 0x3) != 0) {
     return EFI_INVALID_PARAMETER;
   }
 
@@ -284,6 +284,14 @@ NorFlashWriteBuffer (
     return EFI_BAD_BUFFER_SIZE;
   }
 
+  // Check that the programmed range does not cross a 32-word boundary, as the
+  // on-chip buffer cannot span more than one 32-word region.
+  if ((TargetAddress & ~(UINTN)BOUNDARY_OF_32_WORDS) !=
+      ((TargetAddress + BufferSizeInBytes - 1) & ~(UINTN)BOUNDARY_OF_32_WORDS))
+  {
+    return EFI_INVALID_PARAMETER;
+  }
+
   // Pre-programming conditions checked, now start the algorithm.
 
   // Prepare the data destination address
@@ -618,9 +626,13 @@ NorFlashWriteSingleBlock (
   UINTN       WordAddr;
   UINTN       BlockSize;
   UINTN       BlockAddress;
-  UINTN       PrevBlockAddress;
-
-  PrevBlockAddress = 0;
+  UINTN       FirstWordAddr;
+  UINTN       WordCount;
+  UINTN       WordIndex;
+  UINTN       ChunkWords;
+  // An unaligned write touches one extra word on top of the 32 words that fit
+  // in the 128 byte fast path below.
+  UINT32      WordBuffer[P30_MAX_BUFFER_SIZE_IN_WORDS + 1];
 
   DEBUG ((DEBUG_BLKIO, "NorFlashWriteSingleBlock(Parameters: Lba=%ld, Offset=0x%x, *NumBytes=0x%x, Buffer @ 0x%08x)\n", Lba, Offset, *NumBytes, Buffer));
 
@@ -658,9 +670,11 @@ NorFlashWriteSingleBlock (
     // If the destination bits are only changing from 1s to 0s we can just write.
     // After a block is erased all bits in the block is set to 1.
     // If any byte requires us to erase we just give up and rewrite all of it.
-    DoErase      = FALSE;
-    BytesToWrite = *NumBytes;
-    CurOffset    = Offset;
+    DoErase       = FALSE;
+    BytesToWrite  = *NumBytes;
+    CurOffset     = Offset;
+    FirstWordAddr = 0;
+    WordCount     = 0;
 
     while (BytesToWrite > 0) {
       // Read full word from NOR, splice as required. A word is the smallest
@@ -755,28 +769,62 @@ NorFlashWriteSingleBlock (
       }
 
       //
-      // Write the word to NOR.
+      // Stage the merged word. The words visited by this loop are
+      // consecutive, so the staged words form a single run starting at
+      // FirstWordAddr. Programming is deferred until the whole request has
+      // been checked, so that adjacent words can share one buffered program
+      // operation instead of paying a status poll per word.
       //
+      if (WordCount == 0) {
+        FirstWordAddr = WordAddr;
+      }
 
+      WordBuffer[WordCount] = WordToWrite;
+      WordCount++;
+    }
+
+    // Program the staged words and exit if we got here and could write all
+    // the data. Otherwise do the Erase-Write cycle.
+    if (!DoErase) {
+      // The write cannot span block boundaries (checked above), so a single
+      // unlock covers the whole run.
       BlockAddress = GET_NOR_BLOCK_ADDRESS (Instance->RegionBaseAddress, Lba, BlockSize);
-      if (BlockAddress != PrevBlockAddress) {
-        TempStatus = NorFlashUnlockSingleBlockIfNecessary (Instance, BlockAddress);
+
+      TempStatus = NorFlashUnlockSingleBlockIfNecessary (Instance, BlockAddress);
+      if (EFI_ERROR (TempStatus)) {
+        return EFI_DEVICE_ERROR;
+      }
+
+      WordIndex = 0;
+      while (WordIndex < WordCount) {
+        WordAddr = FirstWordAddr + (WordIndex * sizeof (UINT32));
+
+        // Program as many consecutive words as possible in one buffered
+        // operation. A buffered program must not cross a 32-word boundary,
+        // so clamp the chunk to the end of the current 32-word region.
+        ChunkWords = (((WordAddr | BOUNDARY_OF_32_WORDS) + 1) - WordAddr) / sizeof (UINT32);
+        if (ChunkWords > (WordCount - WordIndex)) {
+          ChunkWords = WordCount - WordIndex;
+        }
+
+        if (ChunkWords > 1) {
+          TempStatus = NorFlashWriteBuffer (
+                         Instance,
+                         WordAddr,
+                         ChunkWords * sizeof (UINT32),
+                         &WordBuffer[WordIndex]
+                         );
+        } else {
+          TempStatus = NorFlashWriteSingleWord (Instance, WordAddr, WordBuffer[WordIndex]);
+        }
+
         if (EFI_ERROR (TempStatus)) {
           return EFI_DEVICE_ERROR;
         }
 
-        PrevBlockAddress = BlockAddress;
+        WordIndex += ChunkWords;
       }
 
-      TempStatus = NorFlashWriteSingleWord (Instance, WordAddr, WordToWrite);
-      if (EFI_ERROR (TempStatus)) {
-        return EFI_DEVICE_ERROR;
-      }
-    }
-
-    // Exit if we got here and could write all the data. Otherwise do the
-    // Erase-Write cycle.
-    if (!DoErase) {
       return EFI_SUCCESS;
     }
   }
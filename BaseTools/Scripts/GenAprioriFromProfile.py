@@ -0,0 +1,104 @@
+## @file
+# Generate an optimized PEI APRIORI file list from a dispatch profile log.
+#
+# The PEI dispatcher prints one "PeiDispatchProfile:" line per dispatched
+# PEIM, recording the dispatch order, the dispatcher pass the PEIM was
+# dispatched on, and the number of depex evaluations that returned FALSE
+# before the PEIM could run.  Feeding a boot log containing those lines to
+# this script produces an APRIORI PEI block, in FDF syntax, that lists the
+# modules in their observed dispatch order.  Dispatching modules in that
+# order satisfies each depex on the first evaluation, so the dispatcher
+# completes in a single pass.
+#
+# Copyright (c) 2026, Intel Corporation. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-2-Clause-Patent
+#
+
+'''
+GenAprioriFromProfile
+'''
+import re
+import sys
+import argparse
+
+#
+# Globals for help information
+#
+__prog__ = 'GenAprioriFromProfile'
+__version__ = '%s Version %s' % (__prog__, '0.1')
+__copyright__ = 'Copyright (c) 2026, Intel Corporation. All rights reserved.'
+__description__ = "Generate an APRIORI PEI block from PeiDispatchProfile boot log lines.\n"
+
+#
+# PeiDispatchProfile: Order=12 Pass=3 Waits=2 File=9B3ADA4F-AE56-4C24-8DEA-F03B7558AE50
+#
+ProfileLinePattern = re.compile(
+    r'PeiDispatchProfile:\s*Order=(\d+)\s+Pass=(\d+)\s+Waits=(\d+)\s+'
+    r'File=([0-9A-Fa-f]{8}-[0-9A-Fa-f]{4}-[0-9A-Fa-f]{4}-[0-9A-Fa-f]{4}-[0-9A-Fa-f]{12})')
+
+
+def ParseProfile(LogFile):
+    Modules = []
+    SeenGuids = set()
+    for Line in LogFile:
+        Match = ProfileLinePattern.search(Line)
+        if Match is None:
+            continue
+        Order, Pass, Waits = (int(Match.group(Index)) for Index in (1, 2, 3))
+        Guid = Match.group(4).upper()
+        #
+        # A warm reboot captured in the same log repeats the profile; keep
+        # the first occurrence of each module only.
+        #
+        if Guid in SeenGuids:
+            continue
+        SeenGuids.add(Guid)
+        Modules.append((Order, Pass, Waits, Guid))
+    Modules.sort()
+    return Modules
+
+
+def EmitApriori(Modules, Output):
+    Output.write("APRIORI PEI {\n")
+    for Order, Pass, Waits, Guid in Modules:
+        Comment = ""
+        if Waits > 0:
+            Comment = "  # was dispatched on pass %d after %d depex waits" % (Pass, Waits)
+        Output.write("  FILE PEIM = %s%s\n" % (Guid, Comment))
+    Output.write("}\n")
+
+
+def main():
+    Parser = argparse.ArgumentParser(prog=__prog__,
+                                     description=__description__ + __copyright__,
+                                     conflict_handler='resolve')
+    Parser.add_argument('-i', '--input', dest='LogPath', required=True,
+                        help="Boot log containing PeiDispatchProfile lines.")
+    Parser.add_argument('-o', '--output', dest='OutputPath',
+                        help="Output file for the APRIORI block, stdout when absent.")
+    Parser.add_argument('--version', action='version', version=__version__)
+    Args = Parser.parse_args()
+
+    with open(Args.LogPath) as LogFile:
+        Modules = ParseProfile(LogFile)
+    if not Modules:
+        print("error: no PeiDispatchProfile lines found in %s" % Args.LogPath,
+              file=sys.stderr)
+        return 1
+
+    MaxPass = max(Pass for _, Pass, _, _ in Modules)
+    TotalWaits = sum(Waits for _, _, Waits, _ in Modules)
+    print("%d modules, %d dispatcher passes, %d wasted depex evaluations" %
+          (len(Modules), MaxPass, TotalWaits), file=sys.stderr)
+
+    if Args.OutputPath:
+        with open(Args.OutputPath, 'w') as Output:
+            EmitApriori(Modules, Output)
+    else:
+        EmitApriori(Modules, sys.stdout)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -308,9 +308,19 @@ int DecompressFile(char *InputFile, uint8_t *InputBuffer, char *OutputFile, uint
   Output = OutputBuffer;
   IsOk = BROTLI_TRUE;
 
-  IsOk = OpenFiles(InputFile, &InputFileHandle, OutputFile, &OutputFileHandle);
-  if (!IsOk) {
-        return IsOk;
+  if (OutputFile != NULL) {
+    IsOk = OpenFiles(InputFile, &InputFileHandle, OutputFile, &OutputFileHandle);
+    if (!IsOk) {
+          return IsOk;
+    }
+  } else {
+    /* Scratch size measuring pass: decode the stream without materializing the output. */
+    OutputFileHandle = NULL;
+    InputFileHandle = fopen(InputFile, "rb");
+    if (InputFileHandle == NULL) {
+      printf("Failed to open input file [%s]\n", InputFile);
+      return BROTLI_FALSE;
+    }
   }
   fseek(InputFileHandle, DECODE_HEADER_SIZE, SEEK_SET);
 
@@ -346,7 +356,7 @@ int DecompressFile(char *InputFile, uint8_t *InputBuffer, char *OutputFile, uint
       }
     } else if (Result == BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT) {
       OutSize = (size_t) (NextOut - Output);
-      if (OutSize > 0) {
+      if (OutSize > 0 && OutputFileHandle != NULL) {
         fwrite(Output, 1, OutSize, OutputFileHandle);
         if (ferror(OutputFileHandle)) {
           printf("Failed to write output [%s]\n", OutputFile);
@@ -358,7 +368,7 @@ int DecompressFile(char *InputFile, uint8_t *InputBuffer, char *OutputFile, uint
       NextOut = Output;
     } else if (Result == BROTLI_DECODER_RESULT_SUCCESS) {
       OutSize = (size_t) (NextOut - Output);
-      if (OutSize > 0) {
+      if (OutSize > 0 && OutputFileHandle != NULL) {
         fwrite(Output, 1, OutSize, OutputFileHandle);
         if (ferror(OutputFileHandle)) {
           printf("Failed to write output [%s]\n", OutputFile);
@@ -400,7 +410,6 @@ int main(int argc, char** argv) {
   BROTLI_BOOL DecompressBool;
   char *OutputFile;
   char *InputFile;
-  char OutputTmpFile[_MAX_PATH];
   FILE *OutputHandle;
   int Quality;
   int Gap;
@@ -538,23 +547,15 @@ int main(int argc, char** argv) {
       goto Finish;
     }
     //
-    // Decompress file for get Outputfile size
+    // Decompress file for get decoder scratch buffer size, no output file is
+    // written back for this measuring pass
     //
-    strcpy (OutputTmpFile, OutputFile);
-    if (strlen(InputFile) + strlen(".tmp") < _MAX_PATH) {
-      strcat(OutputTmpFile, ".tmp");
-    } else {
-      printf ("Output file path is too long[%s]\n", OutputFile);
-      Ret = BROTLI_FALSE;
-      goto Finish;
-    }
     memset(Buffer, 0, kFileBufferSize*2);
-    Ret = DecompressFile(OutputFile, InputBuffer, OutputTmpFile, OutputBuffer, Quality, Gap);
+    Ret = DecompressFile(OutputFile, InputBuffer, NULL, OutputBuffer, Quality, Gap);
     if (!Ret) {
       printf ("Failed to decompress file [%s]\n", OutputFile);
       goto Finish;
     }
-    remove (OutputTmpFile);
 
     //
     // fill decoder header
@@ -49,12 +49,7 @@ Returns:
 
 --*/
 {
-  INT8  *Ptr;
-
-  Ptr = Buffer;
-  while (Size--) {
-    *(Ptr++) = 0;
-  }
+  memset (Buffer, 0, Size);
 }
 
 VOID
@@ -83,14 +78,10 @@ Returns:
 
 --*/
 {
-  CHAR8 *Destination8;
-  CHAR8 *Source8;
-
-  Destination8  = Destination;
-  Source8       = Source;
-  while (Length--) {
-    *(Destination8++) = *(Source8++);
-  }
+  //
+  // memmove handles overlapping buffers, which callers of CopyMem rely on.
+  //
+  memmove (Destination, Source, Length);
 }
 
 VOID
@@ -3374,16 +3374,7 @@ Returns:
 
 --*/
 {
-  CHAR8   *Destination8;
-  CHAR8   *Source8;
-  UINT32  Length;
-
-  Destination8  = Buffer;
-  Source8       = (CHAR8 *) ((UINTN) FileHandle + FileOffset);
-  Length        = *ReadSize;
-  while (Length--) {
-    *(Destination8++) = *(Source8++);
-  }
+  memcpy (Buffer, (VOID *) ((UINTN) FileHandle + FileOffset), *ReadSize);
 
   return EFI_SUCCESS;
 }
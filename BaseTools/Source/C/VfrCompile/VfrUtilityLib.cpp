@@ -3439,7 +3439,9 @@ CVfrQuestionDB::FindQuestion (
 
 CVfrStringDB::CVfrStringDB ()
 {
-  mStringFileName = NULL;
+  mStringFileName    = NULL;
+  mStringFileContent = NULL;
+  mStringFileLength  = 0;
 }
 
 CVfrStringDB::~CVfrStringDB ()
@@ -3448,6 +3450,11 @@ CVfrStringDB::~CVfrStringDB ()
     delete[] mStringFileName;
   }
   mStringFileName = NULL;
+  if (mStringFileContent != NULL) {
+    delete[] mStringFileContent;
+  }
+  mStringFileContent = NULL;
+  mStringFileLength  = 0;
 }
 
 
@@ -3464,6 +3471,15 @@ CVfrStringDB::SetStringFileName(IN CHAR8 *StringFileName)
     delete[] mStringFileName;
   }
 
+  //
+  // Drop any cached string package data, it may belong to another file.
+  //
+  if (mStringFileContent != NULL) {
+    delete[] mStringFileContent;
+    mStringFileContent = NULL;
+  }
+  mStringFileLength = 0;
+
   FileLen = strlen (StringFileName) + 1;
   mStringFileName = new CHAR8[FileLen];
   if (mStringFileName == NULL) {
@@ -3574,34 +3590,44 @@ CVfrStringDB::GetVarStoreNameFormStringId (
     return NULL;
   }
 
-  if ((pInFile = fopen (LongFilePath (mStringFileName), "rb")) == NULL) {
-    return NULL;
-  }
-
   //
-  // Get file length.
+  // Read the string package file on the first query and keep the data
+  // cached, so that every following varstore name lookup works on the
+  // in-memory copy instead of re-reading the whole file from disk.
   //
-  fseek (pInFile, 0, SEEK_END);
-  Length = ftell (pInFile);
-  fseek (pInFile, 0, SEEK_SET);
+  if (mStringFileContent == NULL) {
+    if ((pInFile = fopen (LongFilePath (mStringFileName), "rb")) == NULL) {
+      return NULL;
+    }
 
-  //
-  // Get file data.
-  //
-  StringPtr = new UINT8[Length];
-  if (StringPtr == NULL) {
+    //
+    // Get file length.
+    //
+    fseek (pInFile, 0, SEEK_END);
+    mStringFileLength = ftell (pInFile);
+    fseek (pInFile, 0, SEEK_SET);
+
+    //
+    // Get file data.
+    //
+    mStringFileContent = new UINT8[mStringFileLength];
+    if (mStringFileContent == NULL) {
+      mStringFileLength = 0;
+      fclose (pInFile);
+      return NULL;
+    }
+    fread ((char *)mStringFileContent, sizeof (UINT8), mStringFileLength, pInFile);
     fclose (pInFile);
-    return NULL;
   }
-  fread ((char *)StringPtr, sizeof (UINT8), Length, pInFile);
-  fclose (pInFile);
+
+  StringPtr = mStringFileContent;
+  Length    = mStringFileLength;
 
   PkgHeader = (EFI_HII_STRING_PACKAGE_HDR *) StringPtr;
   //
   // Check the String package.
   //
   if (PkgHeader->Header.Type != EFI_HII_PACKAGE_STRINGS) {
-    delete[] StringPtr;
     return NULL;
   }
 
@@ -3628,7 +3654,6 @@ CVfrStringDB::GetVarStoreNameFormStringId (
   //
   Status = FindStringBlock(Current, StringId, &NameOffset, &BlockType);
   if (Status != EFI_SUCCESS) {
-    delete[] StringPtr;
     return NULL;
   }
 
@@ -3661,8 +3686,6 @@ CVfrStringDB::GetVarStoreNameFormStringId (
     break;
   }
 
-  delete[] StringPtr;
-
   return VarStoreName;
 }
 
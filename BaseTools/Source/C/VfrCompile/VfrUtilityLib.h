@@ -501,6 +501,8 @@ private:
 class CVfrStringDB {
 private:
   CHAR8   *mStringFileName;
+  UINT8   *mStringFileContent;
+  UINT32  mStringFileLength;
 
   EFI_STATUS FindStringBlock (
     IN  UINT8            *StringData,
@@ -11,6 +11,72 @@
 #include <Library/DebugLib.h>
 #include <Library/PeiServicesLib.h>
 #include <Ppi/Crypto.h>
+#include <Ppi/MemoryDiscovered.h>
+
+//
+// Cached pointer to the EDK II Crypto PPI, maintained by the notification
+// callback below. NULL while this module runs XIP (the store in the callback
+// is silently dropped) or before permanent memory is installed, in which
+// cases every crypto service call falls back to locating the PPI.
+//
+EDKII_CRYPTO_PPI  *mCryptoPpi = NULL;
+
+/**
+  Notification callback invoked when the EDK II Crypto PPI is installed or
+  re-installed, for example when the crypto PEIM shadows itself to permanent
+  memory.
+
+  @param[in] PeiServices       Pointer to the PEI Services Table.
+  @param[in] NotifyDescriptor  Address of the notification descriptor data structure.
+  @param[in] Ppi               Address of the PPI that was installed.
+
+  @retval EFI_SUCCESS          The notification was processed.
+
+**/
+EFI_STATUS
+EFIAPI
+PeiCryptLibOnCryptoPpiInstalled (
+  IN EFI_PEI_SERVICES           **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  )
+{
+  EFI_STATUS        Status;
+  EDKII_CRYPTO_PPI  *CryptoPpi;
+  VOID              *MemoryDiscovered;
+
+  //
+  // Only cache the PPI pointer once permanent memory is installed. Before
+  // the temporary RAM migration this module's globals either are not
+  // writable (XIP) or would hold a pointer that does not survive the
+  // migration, so the locate-per-call path in GetCryptoServices() stays in
+  // effect until then.
+  //
+  Status = PeiServicesLocatePpi (
+             &gEfiPeiMemoryDiscoveredPpiGuid,
+             0,
+             NULL,
+             (VOID **)&MemoryDiscovered
+             );
+  if (EFI_ERROR (Status)) {
+    return EFI_SUCCESS;
+  }
+
+  CryptoPpi = (EDKII_CRYPTO_PPI *)Ppi;
+  if ((CryptoPpi == NULL) || (CryptoPpi->GetVersion () < EDKII_CRYPTO_VERSION)) {
+    return EFI_SUCCESS;
+  }
+
+  mCryptoPpi = CryptoPpi;
+
+  return EFI_SUCCESS;
+}
+
+CONST EFI_PEI_NOTIFY_DESCRIPTOR  mCryptoPpiNotifyList = {
+  (EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK | EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST),
+  &gEdkiiCryptoPpiGuid,
+  PeiCryptLibOnCryptoPpiInstalled
+};
 
 /**
   Internal worker function that returns the pointer to an EDK II Crypto
@@ -19,9 +85,10 @@
   call through a Protocol/PPI to be shared for the PEI, DXE, and SMM
   implementations.
 
-  This PEI implementation looks up the EDK II Crypto PPI and verifies the
-  version each time a crypto service is called, so it is compatible with XIP
-  PEIMs.
+  This PEI implementation serves the lookup from the pointer cached by the
+  PPI notification callback when it can, and otherwise looks up the EDK II
+  Crypto PPI and verifies the version each time a crypto service is called,
+  so it is compatible with XIP PEIMs.
 **/
 VOID *
 GetCryptoServices (
@@ -32,6 +99,10 @@ GetCryptoServices (
   EDKII_CRYPTO_PPI  *CryptoPpi;
   UINTN             Version;
 
+  if (mCryptoPpi != NULL) {
+    return (VOID *)mCryptoPpi;
+  }
+
   CryptoPpi = NULL;
   Status    = PeiServicesLocatePpi (
                 &gEdkiiCryptoPpiGuid,
@@ -55,3 +126,30 @@ GetCryptoServices (
 
   return (VOID *)CryptoPpi;
 }
+
+/**
+  The constructor function of PeiCryptLib.
+
+  Registers for notification of the EDK II Crypto PPI so its location can be
+  cached instead of looked up on every crypto service call.
+
+  @param  FileHandle   Handle of the file being invoked.
+  @param  PeiServices  Describes the list of possible PEI Services.
+
+  @retval EFI_SUCCESS  The constructor executed correctly.
+
+**/
+EFI_STATUS
+EFIAPI
+PeiCryptLibConstructor (
+  IN EFI_PEI_FILE_HANDLE     FileHandle,
+  IN CONST EFI_PEI_SERVICES  **PeiServices
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = PeiServicesNotifyPpi (&mCryptoPpiNotifyList);
+  ASSERT_EFI_ERROR (Status);
+
+  return EFI_SUCCESS;
+}
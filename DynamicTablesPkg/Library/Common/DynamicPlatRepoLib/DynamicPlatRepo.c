@@ -350,6 +350,16 @@ DynamicPlatRepoFinalise (
     }
   } // for
 
+  // Sort the token mapper so that token lookups can use a binary search.
+  Status = TokenMapperSort (&This->TokenMapper);
+  if (EFI_ERROR (Status)) {
+    ASSERT (0);
+    // Free the TokenMapper.
+    // Ignore the returned Status since we already failed.
+    TokenMapperShutdown (&This->TokenMapper);
+    return Status;
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -78,6 +78,66 @@ TokenMapperAddObject (
   return EFI_SUCCESS;
 }
 
+/** Sort the TokenMapper by Token/ObjectId.
+
+  Sorting allows TokenMapperGetObject to use a binary search.
+  This must be done once all the objects have been added, i.e. when
+  the dynamic repository is finalised.
+
+  @param [in] TokenMapper   The TokenMapper instance.
+
+  @retval EFI_SUCCESS             The function completed successfully.
+  @retval EFI_INVALID_PARAMETER   A parameter is invalid.
+**/
+EFI_STATUS
+EFIAPI
+TokenMapperSort (
+  IN  TOKEN_MAPPER  *TokenMapper
+  )
+{
+  UINTN                 Index;
+  UINTN                 Pos;
+  TOKEN_MAP_DESCRIPTOR  TempDesc;
+  TOKEN_MAP_DESCRIPTOR  *TokenDescArray;
+
+  // Nothing to do.
+  if ((TokenMapper != NULL) && (TokenMapper->MaxTokenDescCount == 0)) {
+    return EFI_SUCCESS;
+  }
+
+  if ((TokenMapper == NULL) ||
+      (TokenMapper->TokenDescArray == NULL))
+  {
+    ASSERT (0);
+    return EFI_INVALID_PARAMETER;
+  }
+
+  // Insertion sort: the number of bindings is small and the array
+  // is only sorted once.
+  TokenDescArray = TokenMapper->TokenDescArray;
+  for (Index = 1; Index < TokenMapper->ItemCount; Index++) {
+    CopyMem (&TempDesc, &TokenDescArray[Index], sizeof (TOKEN_MAP_DESCRIPTOR));
+
+    Pos = Index;
+    while ((Pos > 0) &&
+           ((TokenDescArray[Pos - 1].Token > TempDesc.Token) ||
+            ((TokenDescArray[Pos - 1].Token == TempDesc.Token) &&
+             (TokenDescArray[Pos - 1].CmObjDesc.ObjectId > TempDesc.CmObjDesc.ObjectId))))
+    {
+      CopyMem (
+        &TokenDescArray[Pos],
+        &TokenDescArray[Pos - 1],
+        sizeof (TOKEN_MAP_DESCRIPTOR)
+        );
+      Pos--;
+    }
+
+    CopyMem (&TokenDescArray[Pos], &TempDesc, sizeof (TOKEN_MAP_DESCRIPTOR));
+  } // for
+
+  return EFI_SUCCESS;
+}
+
 /** Get a CmObjDesc from a ObjectId/Token couple.
 
   The Token parameter is not optional. An existing token must be provided.
@@ -100,8 +160,9 @@ TokenMapperGetObject (
   OUT CM_OBJ_DESCRIPTOR  *CmObjDesc
   )
 {
-  UINTN                 Index;
-  UINTN                 MaxCount;
+  UINTN                 Low;
+  UINTN                 High;
+  UINTN                 Mid;
   TOKEN_MAP_DESCRIPTOR  *TokenMapDesc;
 
   // Nothing to do.
@@ -118,11 +179,16 @@ TokenMapperGetObject (
     return EFI_INVALID_PARAMETER;
   }
 
-  TokenMapDesc = TokenMapper->TokenDescArray;
-  MaxCount     = TokenMapper->MaxTokenDescCount;
-  for (Index = 0; Index < MaxCount; Index++) {
-    if ((TokenMapDesc->CmObjDesc.ObjectId == ObjectId)  &&
-        (TokenMapDesc->Token == Token))
+  // Binary search over the bindings, sorted by Token/ObjectId when the
+  // dynamic repository was finalised.
+  Low  = 0;
+  High = TokenMapper->ItemCount;
+  while (Low < High) {
+    Mid          = Low + ((High - Low) / 2);
+    TokenMapDesc = &TokenMapper->TokenDescArray[Mid];
+
+    if ((TokenMapDesc->Token == Token) &&
+        (TokenMapDesc->CmObjDesc.ObjectId == ObjectId))
     {
       CopyMem (
         CmObjDesc,
@@ -132,8 +198,15 @@ TokenMapperGetObject (
       return EFI_SUCCESS;
     }
 
-    TokenMapDesc++;
-  } // for
+    if ((TokenMapDesc->Token < Token) ||
+        ((TokenMapDesc->Token == Token) &&
+         (TokenMapDesc->CmObjDesc.ObjectId < ObjectId)))
+    {
+      Low = Mid + 1;
+    } else {
+      High = Mid;
+    }
+  } // while
 
 exit_handler:
   DEBUG ((
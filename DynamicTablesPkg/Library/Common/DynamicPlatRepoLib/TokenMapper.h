@@ -69,6 +69,23 @@ TokenMapperAddObject (
   IN  VOID             *Data
   );
 
+/** Sort the TokenMapper by Token/ObjectId.
+
+  Sorting allows TokenMapperGetObject to use a binary search.
+  This must be done once all the objects have been added, i.e. when
+  the dynamic repository is finalised.
+
+  @param [in] TokenMapper   The TokenMapper instance.
+
+  @retval EFI_SUCCESS             The function completed successfully.
+  @retval EFI_INVALID_PARAMETER   A parameter is invalid.
+**/
+EFI_STATUS
+EFIAPI
+TokenMapperSort (
+  IN  TOKEN_MAPPER  *TokenMapper
+  );
+
 /** Get a CmObjDesc from a ObjectId/Token couple.
 
   The Token parameter is not optional. An existing token must be provided.
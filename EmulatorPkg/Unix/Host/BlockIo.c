@@ -19,6 +19,15 @@ typedef struct {
 
   int                      fd;
 
+  //
+  // Regular file backed images are mapped into the host address space, so
+  // that reads and writes are memcpy's against the host page cache instead
+  // of seek+read/write syscall pairs. NULL when the backing store is a raw
+  // device, or when the mapping failed; the fd based path is used then.
+  //
+  void                     *Mapping;
+  UINT64                   MappingSize;
+
   BOOLEAN                  RemovableMedia;
   BOOLEAN                  WriteProtected;
 
@@ -153,6 +162,26 @@ EmuBlockIoOpenDevice (
     Private->NumberOfBlocks   = DivU64x32 (FileSize, Private->Media->BlockSize);
     Private->Media->LastBlock = Private->NumberOfBlocks - 1;
 
+    //
+    // Map the image and warm the host page cache up front, so the many tiny
+    // block reads that follow are resolved without further syscalls.
+    //
+    Private->Mapping = mmap (
+                         NULL,
+                         FileSize,
+                         Private->WriteProtected ? PROT_READ
+                                                 : PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         Private->fd,
+                         0
+                         );
+    if (Private->Mapping == MAP_FAILED) {
+      Private->Mapping = NULL;
+    } else {
+      Private->MappingSize = FileSize;
+      (void)posix_madvise (Private->Mapping, FileSize, POSIX_MADV_WILLNEED);
+    }
+
     if (fstatfs (Private->fd, &buf) == 0) {
  #if __APPLE__
       Private->Media->OptimalTransferLengthGranularity = buf.f_iosize/buf.f_bsize;
@@ -304,6 +333,13 @@ EmuBlockIoReadWriteCommon (
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // The mapped path does not use the file offset
+  //
+  if (Private->Mapping != NULL) {
+    return EFI_SUCCESS;
+  }
+
   //
   // Seek to End of File
   //
@@ -372,11 +408,20 @@ EmuBlockIoReadBlocks (
     goto Done;
   }
 
-  len = read (Private->fd, Buffer, BufferSize);
-  if (len != BufferSize) {
-    DEBUG ((DEBUG_INIT, "ReadBlocks: ReadFile failed.\n"));
-    Status = EmuBlockIoError (Private);
-    goto Done;
+  if (Private->Mapping != NULL) {
+    CopyMem (
+      Buffer,
+      (UINT8 *)Private->Mapping +
+      MultU64x32 (LBA, Private->Media->BlockSize),
+      BufferSize
+      );
+  } else {
+    len = read (Private->fd, Buffer, BufferSize);
+    if (len != BufferSize) {
+      DEBUG ((DEBUG_INIT, "ReadBlocks: ReadFile failed.\n"));
+      Status = EmuBlockIoError (Private);
+      goto Done;
+    }
   }
 
   //
@@ -449,11 +494,20 @@ EmuBlockIoWriteBlocks (
     goto Done;
   }
 
-  len = write (Private->fd, Buffer, BufferSize);
-  if (len != BufferSize) {
-    DEBUG ((DEBUG_INIT, "ReadBlocks: WriteFile failed.\n"));
-    Status = EmuBlockIoError (Private);
-    goto Done;
+  if (Private->Mapping != NULL) {
+    CopyMem (
+      (UINT8 *)Private->Mapping +
+      MultU64x32 (LBA, Private->Media->BlockSize),
+      Buffer,
+      BufferSize
+      );
+  } else {
+    len = write (Private->fd, Buffer, BufferSize);
+    if (len != BufferSize) {
+      DEBUG ((DEBUG_INIT, "ReadBlocks: WriteFile failed.\n"));
+      Status = EmuBlockIoError (Private);
+      goto Done;
+    }
   }
 
   //
@@ -508,6 +562,10 @@ EmuBlockIoFlushBlocks (
   Private = EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS (This);
 
   if (Private->fd >= 0) {
+    if (Private->Mapping != NULL) {
+      msync (Private->Mapping, Private->MappingSize, MS_SYNC);
+    }
+
     fsync (Private->fd);
  #if __APPLE__
     fcntl (Private->fd, F_FULLFSYNC);
@@ -548,6 +606,12 @@ EmuBlockIoReset (
 
   Private = EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS (This);
 
+  if (Private->Mapping != NULL) {
+    munmap (Private->Mapping, Private->MappingSize);
+    Private->Mapping     = NULL;
+    Private->MappingSize = 0;
+  }
+
   if (Private->fd >= 0) {
     close (Private->fd);
     Private->fd = -1;
@@ -612,8 +676,10 @@ EmuBlockIoThunkOpen (
   Private->Signature = EMU_BLOCK_IO_PRIVATE_SIGNATURE;
   Private->Thunk     = This;
   CopyMem (&Private->EmuBlockIo, &gEmuBlockIoProtocol, sizeof (gEmuBlockIoProtocol));
-  Private->fd        = -1;
-  Private->BlockSize = 512;
+  Private->fd          = -1;
+  Private->Mapping     = NULL;
+  Private->MappingSize = 0;
+  Private->BlockSize   = 512;
 
   Private->Filename = StdDupUnicodeToAscii (This->ConfigString);
   if (Private->Filename == NULL) {
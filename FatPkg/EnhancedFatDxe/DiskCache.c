@@ -380,6 +380,76 @@ FatAccessCache (
   return Status;
 }
 
+/**
+
+  Write a run of dirty cache pages back to the disk as one disk access.
+
+  The caller guarantees that the pages hold consecutive page numbers and
+  that every page of the run except the last one is a full page, so the
+  pages cover a contiguous disk range and occupy contiguous cache memory.
+
+  @param  Volume                - FAT file system volume.
+  @param  DataType              - Indicate the cache type.
+  @param  GroupNo               - First group number of the run.
+  @param  PageCount             - The number of cache pages in the run.
+  @param  Task                    point to task instance.
+
+  @retval EFI_SUCCESS           - The run was written back successfully.
+  @return Others                - An error occurred when writing the run to disk.
+
+**/
+STATIC
+EFI_STATUS
+FatFlushCachePages (
+  IN FAT_VOLUME       *Volume,
+  IN CACHE_DATA_TYPE  DataType,
+  IN UINTN            GroupNo,
+  IN UINTN            PageCount,
+  IN FAT_TASK         *Task
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Index;
+  UINTN       WriteCount;
+  UINTN       WriteSize;
+  UINT64      EntryPos;
+  DISK_CACHE  *DiskCache;
+  CACHE_TAG   *CacheTag;
+  VOID        *PageAddress;
+
+  DiskCache   = &Volume->DiskCache[DataType];
+  CacheTag    = &DiskCache->CacheTag[GroupNo];
+  PageAddress = DiskCache->CacheBase + (GroupNo << DiskCache->PageAlignment);
+  EntryPos    = DiskCache->BaseAddress + LShiftU64 (CacheTag->PageNo, DiskCache->PageAlignment);
+  WriteSize   = 0;
+  for (Index = 0; Index < PageCount; Index++) {
+    WriteSize += CacheTag[Index].RealSize;
+  }
+
+  WriteCount = 1;
+  if (DataType == CacheFat) {
+    WriteCount = Volume->NumFats;
+  }
+
+  do {
+    //
+    // Only fat table writing will execute more than once
+    //
+    Status = FatDiskIo (Volume, WriteDisk, EntryPos, WriteSize, PageAddress, Task);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    EntryPos += Volume->FatSize;
+  } while (--WriteCount > 0);
+
+  for (Index = 0; Index < PageCount; Index++) {
+    CacheTag[Index].Dirty = FALSE;
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
 
   Flush all the dirty cache back, include the FAT cache and the Data cache.
@@ -401,6 +471,7 @@ FatVolumeFlushCache (
   CACHE_DATA_TYPE  CacheDataType;
   UINTN            GroupIndex;
   UINTN            GroupMask;
+  UINTN            PageCount;
   DISK_CACHE       *DiskCache;
   CACHE_TAG        *CacheTag;
 
@@ -411,13 +482,29 @@ FatVolumeFlushCache (
       // Data cache or fat cache is dirty, write the dirty data back
       //
       GroupMask = DiskCache->GroupMask;
-      for (GroupIndex = 0; GroupIndex <= GroupMask; GroupIndex++) {
-        CacheTag = &DiskCache->CacheTag[GroupIndex];
+      for (GroupIndex = 0; GroupIndex <= GroupMask; GroupIndex += PageCount) {
+        CacheTag  = &DiskCache->CacheTag[GroupIndex];
+        PageCount = 1;
         if ((CacheTag->RealSize > 0) && CacheTag->Dirty) {
           //
-          // Write back all Dirty Data Cache Page to disk
+          // Coalesce the successive dirty pages into this write as long as
+          // they hold consecutive page numbers. The cache is direct mapped,
+          // so such pages always occupy consecutive groups, cover a
+          // contiguous disk range and occupy contiguous cache memory.
+          //
+          while ((GroupIndex + PageCount <= GroupMask) &&
+                 (CacheTag[PageCount - 1].RealSize == ((UINTN)1 << DiskCache->PageAlignment)) &&
+                 (CacheTag[PageCount].RealSize > 0) &&
+                 CacheTag[PageCount].Dirty &&
+                 (CacheTag[PageCount].PageNo == CacheTag->PageNo + PageCount))
+          {
+            PageCount++;
+          }
+
+          //
+          // Write back the run of Dirty Cache Pages to disk
           //
-          Status = FatExchangeCachePage (Volume, CacheDataType, WriteDisk, CacheTag, Task);
+          Status = FatFlushCachePages (Volume, CacheDataType, GroupIndex, PageCount, Task);
           if (EFI_ERROR (Status)) {
             return Status;
           }
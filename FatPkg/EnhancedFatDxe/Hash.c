@@ -12,6 +12,10 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
   Get hash value for long name.
 
+  The full 32-bit hash value is returned so that callers can remember it in
+  the directory entry and reject hash chain collisions without invoking the
+  Unicode collation protocol for a string compare.
+
   @param  LongNameString        - The long name string to be hashed.
 
   @return HashValue.
@@ -34,7 +38,7 @@ FatHashLongName (
     );
   FatStrUpr (UpCasedLongFileName);
   gBS->CalculateCrc32 (UpCasedLongFileName, StrSize (UpCasedLongFileName), &HashValue);
-  return (HashValue & HASH_TABLE_MASK);
+  return HashValue;
 }
 
 /**
@@ -75,13 +79,21 @@ FatLongNameHashSearch (
   )
 {
   FAT_DIRENT  **PreviousHashNode;
+  UINT32      HashValue;
 
-  for (PreviousHashNode   = &ODir->LongNameHashTable[FatHashLongName (LongNameString)];
+  HashValue = FatHashLongName (LongNameString);
+  for (PreviousHashNode   = &ODir->LongNameHashTable[HashValue & HASH_TABLE_MASK];
        *PreviousHashNode != NULL;
        PreviousHashNode   = &(*PreviousHashNode)->LongNameForwardLink
        )
   {
-    if (FatStriCmp (LongNameString, (*PreviousHashNode)->FileString) == 0) {
+    //
+    // Compare the remembered full hash value first: it filters out hash
+    // chain collisions without a Unicode collation protocol call per node.
+    //
+    if (((*PreviousHashNode)->LongNameHash == HashValue) &&
+        (FatStriCmp (LongNameString, (*PreviousHashNode)->FileString) == 0))
+    {
       break;
     }
   }
@@ -145,9 +157,11 @@ FatInsertToHashTable (
   DirEnt->ShortNameForwardLink = HashTable[HashTableIndex];
   HashTable[HashTableIndex]    = DirEnt;
   //
-  // Insert hash table index for long name
+  // Insert hash table index for long name, remembering the full hash value
+  // for cheap collision rejection during lookups
   //
-  HashTableIndex              = FatHashLongName (DirEnt->FileString);
+  DirEnt->LongNameHash        = FatHashLongName (DirEnt->FileString);
+  HashTableIndex              = DirEnt->LongNameHash & HASH_TABLE_MASK;
   HashTable                   = ODir->LongNameHashTable;
   DirEnt->LongNameForwardLink = HashTable[HashTableIndex];
   HashTable[HashTableIndex]   = DirEnt;
@@ -260,21 +260,25 @@ TcgPpiNotify (
   FspMeasureMask = PcdGet32 (PcdFspMeasurementConfig);
 
   if ((FspMeasureMask & FSP_MEASURE_FSPT) != 0) {
+    PERF_INMODULE_BEGIN ("MeasureFsptBlob");
     MeasureFspFirmwareBlob (
       0,
       "FSPT",
       PcdGet32 (PcdFsptBaseAddress),
       (UINT32)((EFI_FIRMWARE_VOLUME_HEADER *)(UINTN)PcdGet32 (PcdFsptBaseAddress))->FvLength
       );
+    PERF_INMODULE_END ("MeasureFsptBlob");
   }
 
   if ((FspMeasureMask & FSP_MEASURE_FSPM) != 0) {
+    PERF_INMODULE_BEGIN ("MeasureFspmBlob");
     MeasureFspFirmwareBlob (
       0,
       "FSPM",
       PcdGet32 (PcdFspmBaseAddress),
       (UINT32)((EFI_FIRMWARE_VOLUME_HEADER *)(UINTN)PcdGet32 (PcdFspmBaseAddress))->FvLength
       );
+    PERF_INMODULE_END ("MeasureFspmBlob");
   }
 
   return EFI_SUCCESS;
@@ -487,12 +487,14 @@ TcgPpiNotify (
   FspMeasureMask = PcdGet32 (PcdFspMeasurementConfig);
 
   if ((FspMeasureMask & FSP_MEASURE_FSPS) != 0) {
+    PERF_INMODULE_BEGIN ("MeasureFspsBlob");
     MeasureFspFirmwareBlob (
       0,
       "FSPS",
       PcdGet32 (PcdFspsBaseAddress),
       (UINT32)((EFI_FIRMWARE_VOLUME_HEADER *)(UINTN)PcdGet32 (PcdFspsBaseAddress))->FvLength
       );
+    PERF_INMODULE_END ("MeasureFspsBlob");
   }
 
   return EFI_SUCCESS;
@@ -1069,6 +1069,606 @@ AhciPioTransfer (
   return Status;
 }
 
+/**
+  Build a command FIS for a queued (NCQ) read or write.
+
+  For READ/WRITE FPDMA QUEUED the sector count of the original command moves
+  into the Features fields and bits 7:3 of the Sector Count field carry the
+  tag of the command slot, as defined by the Serial ATA specification.
+
+  @param[in, out] CmdFis            A pointer to the EFI_AHCI_COMMAND_FIS data structure.
+  @param[in]      AtaCommandBlock   A pointer to the EFI_ATA_COMMAND_BLOCK data structure.
+  @param[in]      Read              The transfer direction.
+  @param[in]      CommandSlot       The command slot whose tag is placed into the FIS.
+
+**/
+VOID
+AhciBuildQueuedCommandFis (
+  IN OUT EFI_AHCI_COMMAND_FIS   *CmdFis,
+  IN     EFI_ATA_COMMAND_BLOCK  *AtaCommandBlock,
+  IN     BOOLEAN                Read,
+  IN     UINT8                  CommandSlot
+  )
+{
+  ZeroMem (CmdFis, sizeof (EFI_AHCI_COMMAND_FIS));
+
+  CmdFis->AhciCFisType = EFI_AHCI_FIS_REGISTER_H2D;
+  //
+  // Indicator it's a command
+  //
+  CmdFis->AhciCFisCmdInd = 0x1;
+  CmdFis->AhciCFisCmd    = Read ? ATA_CMD_READ_FPDMA_QUEUED : ATA_CMD_WRITE_FPDMA_QUEUED;
+
+  CmdFis->AhciCFisFeature    = AtaCommandBlock->AtaSectorCount;
+  CmdFis->AhciCFisFeatureExp = AtaCommandBlock->AtaSectorCountExp;
+
+  CmdFis->AhciCFisSecNum    = AtaCommandBlock->AtaSectorNumber;
+  CmdFis->AhciCFisSecNumExp = AtaCommandBlock->AtaSectorNumberExp;
+
+  CmdFis->AhciCFisClyLow    = AtaCommandBlock->AtaCylinderLow;
+  CmdFis->AhciCFisClyLowExp = AtaCommandBlock->AtaCylinderLowExp;
+
+  CmdFis->AhciCFisClyHigh    = AtaCommandBlock->AtaCylinderHigh;
+  CmdFis->AhciCFisClyHighExp = AtaCommandBlock->AtaCylinderHighExp;
+
+  CmdFis->AhciCFisSecCount = (UINT8)(CommandSlot << 3);
+
+  //
+  // Queued commands require LBA addressing. FUA (BIT7 of the device field)
+  // is deliberately left clear.
+  //
+  CmdFis->AhciCFisDevHead = BIT6;
+}
+
+/**
+  Get the NCQ queue depth usable for a device.
+
+  @param[in] Instance        The ATA_ATAPI_PASS_THRU_INSTANCE protocol instance.
+  @param[in] Port            The number of port.
+  @param[in] PortMultiplier  The number of port multiplier.
+
+  @retval 0        The device does not support Native Command Queuing.
+  @retval Others   Maximum number of queued commands the device and the HBA
+                   can have in flight at a time.
+
+**/
+UINT8
+AhciNcqQueueDepth (
+  IN ATA_ATAPI_PASS_THRU_INSTANCE  *Instance,
+  IN UINT8                         Port,
+  IN UINT8                         PortMultiplier
+  )
+{
+  LIST_ENTRY           *Node;
+  EFI_ATA_DEVICE_INFO  *DeviceInfo;
+  ATA_IDENTIFY_DATA    *IdentifyData;
+  UINT8                QueueDepth;
+
+  //
+  // Queued commands are only used for devices directly attached to a SATA
+  // port. 0xFF is the 8bit form of the 0xFFFF port multiplier value that is
+  // recorded in the device info list for such devices.
+  //
+  if (PortMultiplier != 0xFF) {
+    return 0;
+  }
+
+  Node = SearchDeviceInfoList (Instance, Port, 0xFFFF, EfiIdeHarddisk);
+  if (Node == NULL) {
+    return 0;
+  }
+
+  DeviceInfo = ATA_ATAPI_DEVICE_INFO_FROM_THIS (Node);
+  if (DeviceInfo->IdentifyData == NULL) {
+    return 0;
+  }
+
+  //
+  // Word 76 BIT8 reports NCQ support, word 75 bits 4:0 report the maximum
+  // queue depth minus one.
+  //
+  IdentifyData = &DeviceInfo->IdentifyData->AtaData;
+  if ((IdentifyData->serial_ata_capabilities & BIT8) == 0) {
+    return 0;
+  }
+
+  QueueDepth = (UINT8)((IdentifyData->queue_depth & 0x1F) + 1);
+  if (QueueDepth > Instance->AhciRegisters.MaxCommandSlotNumber) {
+    QueueDepth = Instance->AhciRegisters.MaxCommandSlotNumber;
+  }
+
+  return QueueDepth;
+}
+
+/**
+  Check whether a non-blocking task can be issued as a queued command.
+
+  @param[in] Task   The ATA_NONBLOCK_TASK to check.
+
+  @retval TRUE     The task carries a READ/WRITE DMA EXT command that fits
+                   into an NCQ command slot.
+  @retval FALSE    The task must go through the regular single slot path.
+
+**/
+BOOLEAN
+AhciNcqTaskEligible (
+  IN ATA_NONBLOCK_TASK  *Task
+  )
+{
+  EFI_ATA_PASS_THRU_COMMAND_PACKET  *Packet;
+  UINT8                             AtaCommand;
+  UINT32                            DataCount;
+
+  Packet = Task->Packet;
+  if ((Packet == NULL) || (Packet->Acb == NULL)) {
+    return FALSE;
+  }
+
+  if (Packet->Protocol == EFI_ATA_PASS_THRU_PROTOCOL_UDMA_DATA_IN) {
+    AtaCommand = ATA_CMD_READ_DMA_EXT;
+    DataCount  = Packet->InTransferLength;
+  } else if (Packet->Protocol == EFI_ATA_PASS_THRU_PROTOCOL_UDMA_DATA_OUT) {
+    AtaCommand = ATA_CMD_WRITE_DMA_EXT;
+    DataCount  = Packet->OutTransferLength;
+  } else {
+    return FALSE;
+  }
+
+  if (Packet->Acb->AtaCommand != AtaCommand) {
+    return FALSE;
+  }
+
+  //
+  // The transfer must fit into the reduced PRDT of an NCQ command slot.
+  //
+  if (DataCount > EFI_AHCI_MAX_NCQ_PRDT_NUMBER * EFI_AHCI_MAX_DATA_PER_PRDT) {
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+  Take all outstanding queued commands on a port out of the started state.
+
+  Used on the error paths. When Unmap is FALSE the data buffer mappings are
+  kept so that the commands can be rebuilt and reissued from scratch by the
+  following polls; when Unmap is TRUE the mappings are released because the
+  tasks are about to be destroyed.
+
+  @param[in] Instance        The ATA_ATAPI_PASS_THRU_INSTANCE protocol instance.
+  @param[in] AhciRegisters   The pointer to the EFI_AHCI_REGISTERS.
+  @param[in] Port            The number of port.
+  @param[in] Unmap           Release the data buffer mappings of the tasks.
+
+**/
+VOID
+AhciNcqResetOutstanding (
+  IN ATA_ATAPI_PASS_THRU_INSTANCE  *Instance,
+  IN EFI_AHCI_REGISTERS            *AhciRegisters,
+  IN UINT8                         Port,
+  IN BOOLEAN                       Unmap
+  )
+{
+  LIST_ENTRY         *Entry;
+  ATA_NONBLOCK_TASK  *Task;
+
+  Entry = GetFirstNode (&Instance->NonBlockingTaskList);
+  while (!IsNull (&Instance->NonBlockingTaskList, Entry)) {
+    Task = ATA_NON_BLOCK_TASK_FROM_ENTRY (Entry);
+
+    if ((Task->Port == Port) && Task->IsNcq && Task->IsStart) {
+      if (Unmap && (Task->Map != NULL)) {
+        Instance->PciIo->Unmap (Instance->PciIo, Task->Map);
+        Task->Map = NULL;
+      }
+
+      Task->IsStart = FALSE;
+      Task->IsNcq   = FALSE;
+    }
+
+    Entry = GetNextNode (&Instance->NonBlockingTaskList, Entry);
+  }
+
+  AhciRegisters->NcqSlotBusyMask = 0;
+}
+
+/**
+  Issue a non-blocking task as a queued command on a free command slot.
+
+  @param[in] Instance        The ATA_ATAPI_PASS_THRU_INSTANCE protocol instance.
+  @param[in] AhciRegisters   The pointer to the EFI_AHCI_REGISTERS.
+  @param[in] Port            The number of port.
+  @param[in] PortMultiplier  The number of port multiplier.
+  @param[in] Task            The ATA_NONBLOCK_TASK to issue.
+
+  @retval EFI_SUCCESS          The command has been issued to the device.
+  @retval EFI_NOT_READY        No free command slot is available.
+  @retval EFI_BAD_BUFFER_SIZE  The data buffer could not be mapped for DMA.
+  @retval Others               Failed to bring up the port DMA engine.
+
+**/
+EFI_STATUS
+AhciNcqIssueTask (
+  IN ATA_ATAPI_PASS_THRU_INSTANCE  *Instance,
+  IN EFI_AHCI_REGISTERS            *AhciRegisters,
+  IN UINT8                         Port,
+  IN UINT8                         PortMultiplier,
+  IN ATA_NONBLOCK_TASK             *Task
+  )
+{
+  EFI_STATUS                        Status;
+  EFI_PCI_IO_PROTOCOL               *PciIo;
+  EFI_ATA_PASS_THRU_COMMAND_PACKET  *Packet;
+  EFI_AHCI_NCQ_COMMAND_TABLE        *CommandTable;
+  EFI_AHCI_COMMAND_LIST             CmdList;
+  EFI_PCI_IO_PROTOCOL_OPERATION     Flag;
+  EFI_PHYSICAL_ADDRESS              PhyAddr;
+  VOID                              *MemoryAddr;
+  VOID                              *Map;
+  UINTN                             MapLength;
+  UINT32                            DataCount;
+  UINT32                            PrdtNumber;
+  UINT32                            PrdtIndex;
+  UINTN                             RemainedData;
+  UINTN                             MemAddr;
+  DATA_64                           Data64;
+  UINT32                            Offset;
+  UINT32                            PortStatus;
+  UINT32                            StartCmd;
+  BOOLEAN                           Read;
+  UINT8                             Slot;
+
+  PciIo  = Instance->PciIo;
+  Packet = Task->Packet;
+  Read   = (BOOLEAN)(Packet->Protocol == EFI_ATA_PASS_THRU_PROTOCOL_UDMA_DATA_IN);
+
+  if (Read) {
+    MemoryAddr = Packet->InDataBuffer;
+    DataCount  = Packet->InTransferLength;
+    Flag       = EfiPciIoOperationBusMasterWrite;
+  } else {
+    MemoryAddr = Packet->OutDataBuffer;
+    DataCount  = Packet->OutTransferLength;
+    Flag       = EfiPciIoOperationBusMasterRead;
+  }
+
+  for (Slot = 0; Slot < AhciRegisters->MaxCommandSlotNumber; Slot++) {
+    if ((AhciRegisters->NcqSlotBusyMask & (UINT32)(1 << Slot)) == 0) {
+      break;
+    }
+  }
+
+  if (Slot == AhciRegisters->MaxCommandSlotNumber) {
+    return EFI_NOT_READY;
+  }
+
+  //
+  // The buffer is mapped only once; on a reissue after error recovery the
+  // bus master address recorded in the task is reused.
+  //
+  if (Task->Map == NULL) {
+    MapLength = DataCount;
+    Status    = PciIo->Map (
+                         PciIo,
+                         Flag,
+                         MemoryAddr,
+                         &MapLength,
+                         &PhyAddr,
+                         &Map
+                         );
+
+    if (EFI_ERROR (Status) || (DataCount != MapLength)) {
+      return EFI_BAD_BUFFER_SIZE;
+    }
+
+    Task->Map         = Map;
+    Task->DataPhyAddr = PhyAddr;
+  }
+
+  PrdtNumber = (UINT32)DivU64x32 (((UINT64)DataCount + EFI_AHCI_MAX_DATA_PER_PRDT - 1), EFI_AHCI_MAX_DATA_PER_PRDT);
+  ASSERT (PrdtNumber <= EFI_AHCI_MAX_NCQ_PRDT_NUMBER);
+
+  CommandTable = &AhciRegisters->AhciNcqCommandTable[Slot];
+  ZeroMem (CommandTable, sizeof (EFI_AHCI_NCQ_COMMAND_TABLE));
+
+  AhciBuildQueuedCommandFis (&CommandTable->CommandFis, Packet->Acb, Read, Slot);
+  CommandTable->CommandFis.AhciCFisPmNum = PortMultiplier;
+
+  ZeroMem (&CmdList, sizeof (EFI_AHCI_COMMAND_LIST));
+  CmdList.AhciCmdCfl   = EFI_AHCI_FIS_REGISTER_H2D_LENGTH / 4;
+  CmdList.AhciCmdW     = Read ? 0 : 1;
+  CmdList.AhciCmdPmp   = PortMultiplier;
+  CmdList.AhciCmdPrdtl = PrdtNumber;
+
+  RemainedData = (UINTN)DataCount;
+  MemAddr      = (UINTN)Task->DataPhyAddr;
+
+  for (PrdtIndex = 0; PrdtIndex < PrdtNumber; PrdtIndex++) {
+    if (RemainedData < EFI_AHCI_MAX_DATA_PER_PRDT) {
+      CommandTable->PrdtTable[PrdtIndex].AhciPrdtDbc = (UINT32)RemainedData - 1;
+    } else {
+      CommandTable->PrdtTable[PrdtIndex].AhciPrdtDbc = EFI_AHCI_MAX_DATA_PER_PRDT - 1;
+    }
+
+    Data64.Uint64                                   = (UINT64)MemAddr;
+    CommandTable->PrdtTable[PrdtIndex].AhciPrdtDba  = Data64.Uint32.Lower32;
+    CommandTable->PrdtTable[PrdtIndex].AhciPrdtDbau = Data64.Uint32.Upper32;
+    RemainedData                                   -= EFI_AHCI_MAX_DATA_PER_PRDT;
+    MemAddr                                        += EFI_AHCI_MAX_DATA_PER_PRDT;
+  }
+
+  //
+  // Set the last PRDT to Interrupt On Complete
+  //
+  if (PrdtNumber > 0) {
+    CommandTable->PrdtTable[PrdtNumber - 1].AhciPrdtIoc = 1;
+  }
+
+  CopyMem (
+    (VOID *)((UINTN)AhciRegisters->AhciCmdList + (UINTN)Slot * sizeof (EFI_AHCI_COMMAND_LIST)),
+    &CmdList,
+    sizeof (EFI_AHCI_COMMAND_LIST)
+    );
+
+  Data64.Uint64 = (UINT64)(UINTN)AhciRegisters->AhciNcqCommandTablePciAddr +
+                  (UINT64)Slot * sizeof (EFI_AHCI_NCQ_COMMAND_TABLE);
+  AhciRegisters->AhciCmdList[Slot].AhciCmdCtba  = Data64.Uint32.Lower32;
+  AhciRegisters->AhciCmdList[Slot].AhciCmdCtbau = Data64.Uint32.Upper32;
+
+  if (AhciRegisters->NcqSlotBusyMask == 0) {
+    //
+    // No queued command is in flight yet, so the port DMA engine has to be
+    // brought up first. This mirrors AhciStartCommand, except that the SActive
+    // bit of the slot has to be set before the Command Issue bit.
+    //
+    ZeroMem (
+      (VOID *)((UINTN)AhciRegisters->AhciRFis + sizeof (EFI_AHCI_RECEIVED_FIS) * Port),
+      sizeof (EFI_AHCI_RECEIVED_FIS)
+      );
+
+    AhciClearPortStatus (PciIo, Port);
+
+    Status = AhciEnableFisReceive (
+               PciIo,
+               Port,
+               Packet->Timeout
+               );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Offset     = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_CMD;
+    PortStatus = AhciReadReg (PciIo, Offset);
+
+    StartCmd = 0;
+    if ((PortStatus & EFI_AHCI_PORT_CMD_ALPE) != 0) {
+      StartCmd  = AhciReadReg (PciIo, Offset);
+      StartCmd &= ~EFI_AHCI_PORT_CMD_ICC_MASK;
+      StartCmd |= EFI_AHCI_PORT_CMD_ACTIVE;
+    }
+
+    AhciOrReg (PciIo, Offset, EFI_AHCI_PORT_CMD_ST | StartCmd);
+  }
+
+  DEBUG ((DEBUG_VERBOSE, "Starting command for NCQ transfer on slot %d:\n", Slot));
+  AhciPrintCommandBlock (Packet->Acb, DEBUG_VERBOSE);
+
+  //
+  // Writes of '0' to PxSACT and PxCI have no effect, so only the bit of the
+  // new slot is written. PxSACT has to be set before PxCI.
+  //
+  Offset = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_SACT;
+  AhciWriteReg (PciIo, Offset, (UINT32)(1 << Slot));
+
+  Offset = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_CI;
+  AhciWriteReg (PciIo, Offset, (UINT32)(1 << Slot));
+
+  AhciRegisters->NcqSlotBusyMask |= (UINT32)(1 << Slot);
+
+  Task->IsStart     = TRUE;
+  Task->IsNcq       = TRUE;
+  Task->CommandSlot = Slot;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Start a queued (NCQ) DMA data transfer for a non-blocking task.
+
+  Besides driving the head task of the non-blocking task list, this function
+  opportunistically issues the eligible tasks that follow it into free command
+  slots so that the device can work on several requests at once. Tasks are
+  still retired strictly in list order; a task whose command completed early
+  simply reports EFI_SUCCESS once it reaches the head of the list.
+
+  @param[in]       Instance            The ATA_ATAPI_PASS_THRU_INSTANCE protocol instance.
+  @param[in]       AhciRegisters       The pointer to the EFI_AHCI_REGISTERS.
+  @param[in]       Port                The number of port.
+  @param[in]       PortMultiplier      The number of port multiplier.
+  @param[in]       QueueDepth          Maximum number of commands to keep in flight.
+  @param[in, out]  AtaStatusBlock      The EFI_ATA_STATUS_BLOCK data.
+  @param[in]       Timeout             The timeout value of the transfer, uses 100ns as a unit.
+  @param[in]       Task                Pointer to the ATA_NONBLOCK_TASK at the head of the
+                                       non-blocking task list.
+
+  @retval EFI_DEVICE_ERROR    The DMA data transfer abort with error occurs.
+  @retval EFI_TIMEOUT         The operation is time out.
+  @retval EFI_NOT_READY       The transfer is not finished yet.
+  @retval EFI_SUCCESS         The DMA data transfer executes successfully.
+
+**/
+EFI_STATUS
+AhciNcqDmaTransfer (
+  IN     ATA_ATAPI_PASS_THRU_INSTANCE  *Instance,
+  IN     EFI_AHCI_REGISTERS            *AhciRegisters,
+  IN     UINT8                         Port,
+  IN     UINT8                         PortMultiplier,
+  IN     UINT8                         QueueDepth,
+  IN OUT EFI_ATA_STATUS_BLOCK          *AtaStatusBlock,
+  IN     UINT64                        Timeout,
+  IN     ATA_NONBLOCK_TASK             *Task
+  )
+{
+  EFI_STATUS           Status;
+  EFI_PCI_IO_PROTOCOL  *PciIo;
+  LIST_ENTRY           *Entry;
+  ATA_NONBLOCK_TASK    *ExtraTask;
+  UINT32               Offset;
+  UINT32               PortInterrupt;
+  UINT32               SActive;
+  UINT8                Busy;
+  UINT8                Slot;
+
+  PciIo = Instance->PciIo;
+
+  if (!Task->IsStart) {
+    //
+    // An unissued head task implies that every previously issued queued
+    // command has already been retired, so a free slot is available.
+    //
+    Status = AhciNcqIssueTask (Instance, AhciRegisters, Port, PortMultiplier, Task);
+    if (EFI_ERROR (Status)) {
+      if (Task->Map != NULL) {
+        PciIo->Unmap (PciIo, Task->Map);
+        Task->Map = NULL;
+      }
+
+      Task->Packet->Asb->AtaStatus = 0x01;
+      AhciDumpPortStatus (PciIo, AhciRegisters, Port, AtaStatusBlock);
+      return Status;
+    }
+  }
+
+  //
+  // Issue the contiguous run of eligible tasks that follows the head task
+  // into the remaining free slots. Scanning stops at the first task that has
+  // to use the single slot path to avoid reordering across it.
+  //
+  Busy = 0;
+  for (Slot = 0; Slot < AhciRegisters->MaxCommandSlotNumber; Slot++) {
+    if ((AhciRegisters->NcqSlotBusyMask & (UINT32)(1 << Slot)) != 0) {
+      Busy++;
+    }
+  }
+
+  Entry = GetFirstNode (&Instance->NonBlockingTaskList);
+  while (!IsNull (&Instance->NonBlockingTaskList, Entry)) {
+    ExtraTask = ATA_NON_BLOCK_TASK_FROM_ENTRY (Entry);
+
+    if ((ExtraTask->Port != Task->Port) ||
+        (ExtraTask->PortMultiplier != Task->PortMultiplier) ||
+        !AhciNcqTaskEligible (ExtraTask))
+    {
+      break;
+    }
+
+    if (!ExtraTask->IsStart) {
+      if (Busy >= QueueDepth) {
+        break;
+      }
+
+      Status = AhciNcqIssueTask (Instance, AhciRegisters, Port, PortMultiplier, ExtraTask);
+      if (EFI_ERROR (Status)) {
+        //
+        // Not fatal; the task is issued by one of the following polls.
+        //
+        break;
+      }
+
+      Busy++;
+    }
+
+    Entry = GetNextNode (&Instance->NonBlockingTaskList, Entry);
+  }
+
+  Offset        = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_IS;
+  PortInterrupt = AhciReadReg (PciIo, Offset);
+  if ((PortInterrupt & EFI_AHCI_PORT_IS_ERROR_MASK) != 0) {
+    DEBUG ((DEBUG_ERROR, "AHCI: Error interrupt reported PxIS: %X during NCQ transfer\n", PortInterrupt));
+    //
+    // A port reset takes the device out of the queued error state, which a
+    // plain error recovery would not. Afterwards every outstanding queued
+    // command is reissued from scratch by the following polls.
+    //
+    AhciStopCommand (PciIo, Port, Timeout);
+    Status = AhciResetPort (PciIo, Port);
+    if (EFI_ERROR (Status)) {
+      Status = EFI_DEVICE_ERROR;
+    } else {
+      AhciNcqResetOutstanding (Instance, AhciRegisters, Port, FALSE);
+      Status = EFI_NOT_READY;
+    }
+  } else {
+    //
+    // The device clears the SActive bit of a slot once its command has
+    // completed successfully.
+    //
+    Offset  = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_SACT;
+    SActive = AhciReadReg (PciIo, Offset);
+    if ((SActive & (UINT32)(1 << Task->CommandSlot)) == 0) {
+      AhciRegisters->NcqSlotBusyMask &= ~(UINT32)(1 << Task->CommandSlot);
+      Status = EFI_SUCCESS;
+    } else {
+      Status = EFI_NOT_READY;
+    }
+  }
+
+  if (Status == EFI_NOT_READY) {
+    if (!Task->InfiniteWait && (Task->RetryTimes == 0)) {
+      Status = EFI_TIMEOUT;
+    } else {
+      Task->RetryTimes--;
+    }
+  }
+
+  //
+  // On an error the whole queue is torn down as the higher level destroys
+  // every task of the chain. On success only the head task is retired; the
+  // port DMA engine keeps running until the last outstanding queued command
+  // has been retired.
+  //
+  if (Status != EFI_NOT_READY) {
+    if (EFI_ERROR (Status)) {
+      AhciNcqResetOutstanding (Instance, AhciRegisters, Port, TRUE);
+    } else {
+      PciIo->Unmap (PciIo, Task->Map);
+    }
+
+    if (AhciRegisters->NcqSlotBusyMask == 0) {
+      AhciStopCommand (
+        PciIo,
+        Port,
+        Timeout
+        );
+
+      AhciDisableFisReceive (
+        PciIo,
+        Port,
+        Timeout
+        );
+    }
+
+    Task->Packet->Asb->AtaStatus = 0x01;
+  }
+
+  AhciDumpPortStatus (PciIo, AhciRegisters, Port, AtaStatusBlock);
+
+  if (Status == EFI_DEVICE_ERROR) {
+    DEBUG ((DEBUG_ERROR, "Failed to execute command for NCQ transfer:\n"));
+    //
+    // Repeat command block here to make sure it is printed on
+    // device error debug level.
+    //
+    AhciPrintCommandBlock (Task->Packet->Acb, DEBUG_ERROR);
+    AhciPrintStatusBlock (AtaStatusBlock, DEBUG_ERROR);
+  } else {
+    AhciPrintStatusBlock (AtaStatusBlock, DEBUG_VERBOSE);
+  }
+
+  return Status;
+}
+
 /**
   Start a DMA data transfer on specific port
 
@@ -1122,6 +1722,7 @@ AhciDmaTransfer (
   EFI_PCI_IO_PROTOCOL            *PciIo;
   EFI_TPL                        OldTpl;
   UINT32                         Retry;
+  UINT8                          QueueDepth;
 
   Map   = NULL;
   PciIo = Instance->PciIo;
@@ -1130,6 +1731,27 @@ AhciDmaTransfer (
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // Non-blocking transfers for devices that support Native Command Queuing
+  // take the queued path, which keeps several command slots in flight at a
+  // time instead of serializing every command on slot 0.
+  //
+  if ((Task != NULL) && (AtapiCommand == NULL) && AhciNcqTaskEligible (Task)) {
+    QueueDepth = AhciNcqQueueDepth (Instance, Port, PortMultiplier);
+    if (QueueDepth > 1) {
+      return AhciNcqDmaTransfer (
+               Instance,
+               AhciRegisters,
+               Port,
+               PortMultiplier,
+               QueueDepth,
+               AtaStatusBlock,
+               Timeout,
+               Task
+               );
+    }
+  }
+
   //
   // Set Status to suppress incorrect compiler/analyzer warnings
   //
@@ -2160,9 +2782,11 @@ AhciCreateTransferDescriptor (
   UINT64                MaxReceiveFisSize;
   UINT64                MaxCommandListSize;
   UINT64                MaxCommandTableSize;
+  UINT64                MaxNcqCommandTableSize;
   EFI_PHYSICAL_ADDRESS  AhciRFisPciAddr;
   EFI_PHYSICAL_ADDRESS  AhciCmdListPciAddr;
   EFI_PHYSICAL_ADDRESS  AhciCommandTablePciAddr;
+  EFI_PHYSICAL_ADDRESS  AhciNcqCommandTablePciAddr;
 
   Buffer = NULL;
   //
@@ -2175,6 +2799,8 @@ AhciCreateTransferDescriptor (
   MaxCommandSlotNumber = (UINT8)(((Capability & 0x1F00) >> 8) + 1);
   Support64Bit         = (BOOLEAN)(((Capability & BIT31) != 0) ? TRUE : FALSE);
 
+  AhciRegisters->MaxCommandSlotNumber = MaxCommandSlotNumber;
+
   PortImplementBitMap = AhciReadReg (PciIo, EFI_AHCI_PI_OFFSET);
   //
   // Get the highest bit of implemented ports which decides how many bytes are allocated for received FIS.
@@ -2218,7 +2844,7 @@ AhciCreateTransferDescriptor (
     // Map error or unable to map the whole RFis buffer into a contiguous region.
     //
     Status = EFI_OUT_OF_RESOURCES;
-    goto Error6;
+    goto Error8;
   }
 
   if ((!Support64Bit) && (AhciRFisPciAddr > 0x100000000ULL)) {
@@ -2226,7 +2852,7 @@ AhciCreateTransferDescriptor (
     // The AHCI HBA doesn't support 64bit addressing, so should not get a >4G pci bus master address.
     //
     Status = EFI_DEVICE_ERROR;
-    goto Error5;
+    goto Error7;
   }
 
   AhciRegisters->AhciRFisPciAddr = (EFI_AHCI_RECEIVED_FIS *)(UINTN)AhciRFisPciAddr;
@@ -2251,7 +2877,7 @@ AhciCreateTransferDescriptor (
     // Free mapped resource.
     //
     Status = EFI_OUT_OF_RESOURCES;
-    goto Error5;
+    goto Error7;
   }
 
   ZeroMem (Buffer, (UINTN)MaxCommandListSize);
@@ -2274,7 +2900,7 @@ AhciCreateTransferDescriptor (
     // Map error or unable to map the whole cmd list buffer into a contiguous region.
     //
     Status = EFI_OUT_OF_RESOURCES;
-    goto Error4;
+    goto Error6;
   }
 
   if ((!Support64Bit) && (AhciCmdListPciAddr > 0x100000000ULL)) {
@@ -2282,7 +2908,7 @@ AhciCreateTransferDescriptor (
     // The AHCI HBA doesn't support 64bit addressing, so should not get a >4G pci bus master address.
     //
     Status = EFI_DEVICE_ERROR;
-    goto Error3;
+    goto Error5;
   }
 
   AhciRegisters->AhciCmdListPciAddr = (EFI_AHCI_COMMAND_LIST *)(UINTN)AhciCmdListPciAddr;
@@ -2308,7 +2934,7 @@ AhciCreateTransferDescriptor (
     // Free mapped resource.
     //
     Status = EFI_OUT_OF_RESOURCES;
-    goto Error3;
+    goto Error5;
   }
 
   ZeroMem (Buffer, (UINTN)MaxCommandTableSize);
@@ -2331,7 +2957,7 @@ AhciCreateTransferDescriptor (
     // Map error or unable to map the whole cmd list buffer into a contiguous region.
     //
     Status = EFI_OUT_OF_RESOURCES;
-    goto Error2;
+    goto Error4;
   }
 
   if ((!Support64Bit) && (AhciCommandTablePciAddr > 0x100000000ULL)) {
@@ -2339,11 +2965,68 @@ AhciCreateTransferDescriptor (
     // The AHCI HBA doesn't support 64bit addressing, so should not get a >4G pci bus master address.
     //
     Status = EFI_DEVICE_ERROR;
-    goto Error1;
+    goto Error3;
   }
 
   AhciRegisters->AhciCommandTablePciAddr = (EFI_AHCI_COMMAND_TABLE *)(UINTN)AhciCommandTablePciAddr;
 
+  //
+  // Allocate memory for the NCQ command tables, one table per command slot.
+  // Queued commands use a reduced PRDT so that the whole array stays small.
+  //
+  Buffer                 = NULL;
+  MaxNcqCommandTableSize = MaxCommandSlotNumber * sizeof (EFI_AHCI_NCQ_COMMAND_TABLE);
+
+  Status = PciIo->AllocateBuffer (
+                    PciIo,
+                    AllocateAnyPages,
+                    EfiBootServicesData,
+                    EFI_SIZE_TO_PAGES ((UINTN)MaxNcqCommandTableSize),
+                    &Buffer,
+                    0
+                    );
+
+  if (EFI_ERROR (Status)) {
+    //
+    // Free mapped resource.
+    //
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Error3;
+  }
+
+  ZeroMem (Buffer, (UINTN)MaxNcqCommandTableSize);
+
+  AhciRegisters->AhciNcqCommandTable    = Buffer;
+  AhciRegisters->MaxNcqCommandTableSize = MaxNcqCommandTableSize;
+  Bytes                                 = (UINTN)MaxNcqCommandTableSize;
+
+  Status = PciIo->Map (
+                    PciIo,
+                    EfiPciIoOperationBusMasterCommonBuffer,
+                    Buffer,
+                    &Bytes,
+                    &AhciNcqCommandTablePciAddr,
+                    &AhciRegisters->MapNcqCommandTable
+                    );
+
+  if (EFI_ERROR (Status) || (Bytes != MaxNcqCommandTableSize)) {
+    //
+    // Map error or unable to map the whole NCQ cmd table buffer into a contiguous region.
+    //
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Error2;
+  }
+
+  if ((!Support64Bit) && (AhciNcqCommandTablePciAddr > 0x100000000ULL)) {
+    //
+    // The AHCI HBA doesn't support 64bit addressing, so should not get a >4G pci bus master address.
+    //
+    Status = EFI_DEVICE_ERROR;
+    goto Error1;
+  }
+
+  AhciRegisters->AhciNcqCommandTablePciAddr = (EFI_AHCI_NCQ_COMMAND_TABLE *)(UINTN)AhciNcqCommandTablePciAddr;
+
   return EFI_SUCCESS;
   //
   // Map error or unable to map the whole CmdList buffer into a contiguous region.
@@ -2351,31 +3034,42 @@ AhciCreateTransferDescriptor (
 Error1:
   PciIo->Unmap (
            PciIo,
-           AhciRegisters->MapCommandTable
+           AhciRegisters->MapNcqCommandTable
            );
 Error2:
+  PciIo->FreeBuffer (
+           PciIo,
+           EFI_SIZE_TO_PAGES ((UINTN)MaxNcqCommandTableSize),
+           AhciRegisters->AhciNcqCommandTable
+           );
+Error3:
+  PciIo->Unmap (
+           PciIo,
+           AhciRegisters->MapCommandTable
+           );
+Error4:
   PciIo->FreeBuffer (
            PciIo,
            EFI_SIZE_TO_PAGES ((UINTN)MaxCommandTableSize),
            AhciRegisters->AhciCommandTable
            );
-Error3:
+Error5:
   PciIo->Unmap (
            PciIo,
            AhciRegisters->MapCmdList
            );
-Error4:
+Error6:
   PciIo->FreeBuffer (
            PciIo,
            EFI_SIZE_TO_PAGES ((UINTN)MaxCommandListSize),
            AhciRegisters->AhciCmdList
            );
-Error5:
+Error7:
   PciIo->Unmap (
            PciIo,
            AhciRegisters->MapRFis
            );
-Error6:
+Error8:
   PciIo->FreeBuffer (
            PciIo,
            EFI_SIZE_TO_PAGES ((UINTN)MaxReceiveFisSize),
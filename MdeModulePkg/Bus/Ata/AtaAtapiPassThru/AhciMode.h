@@ -62,6 +62,13 @@ typedef union {
 //
 #define EFI_AHCI_MAX_DATA_PER_PRDT  0x400000
 
+//
+// PRDT entries reserved for each NCQ command slot. One slot can therefore
+// describe a transfer of up to 512M byte, which covers the largest request
+// the ATA bus driver will ever queue.
+//
+#define EFI_AHCI_MAX_NCQ_PRDT_NUMBER  128
+
 #define EFI_AHCI_FIS_REGISTER_H2D           0x27         // Register FIS - Host to Device
 #define   EFI_AHCI_FIS_REGISTER_H2D_LENGTH  20
 #define EFI_AHCI_FIS_REGISTER_D2H           0x34         // Register FIS - Device to Host
@@ -285,6 +292,18 @@ typedef struct {
   EFI_AHCI_COMMAND_PRDT     PrdtTable[65535];     // The scatter/gather list for data transfer
 } EFI_AHCI_COMMAND_TABLE;
 
+//
+// Command table used for queued (NCQ) commands. It has the same layout as
+// EFI_AHCI_COMMAND_TABLE but carries a reduced PRDT so that one table per
+// command slot can be allocated up front.
+//
+typedef struct {
+  EFI_AHCI_COMMAND_FIS      CommandFis;       // A software constructed FIS.
+  EFI_AHCI_ATAPI_COMMAND    AtapiCmd;         // Not used by queued commands.
+  UINT8                     Reserved[0x30];
+  EFI_AHCI_COMMAND_PRDT     PrdtTable[EFI_AHCI_MAX_NCQ_PRDT_NUMBER];     // The scatter/gather list for data transfer
+} EFI_AHCI_NCQ_COMMAND_TABLE;
+
 //
 // Received FIS structure
 //
@@ -312,18 +331,31 @@ typedef struct {
 #pragma pack()
 
 typedef struct {
-  EFI_AHCI_RECEIVED_FIS     *AhciRFis;
-  EFI_AHCI_COMMAND_LIST     *AhciCmdList;
-  EFI_AHCI_COMMAND_TABLE    *AhciCommandTable;
-  EFI_AHCI_RECEIVED_FIS     *AhciRFisPciAddr;
-  EFI_AHCI_COMMAND_LIST     *AhciCmdListPciAddr;
-  EFI_AHCI_COMMAND_TABLE    *AhciCommandTablePciAddr;
-  UINT64                    MaxCommandListSize;
-  UINT64                    MaxCommandTableSize;
-  UINT64                    MaxReceiveFisSize;
-  VOID                      *MapRFis;
-  VOID                      *MapCmdList;
-  VOID                      *MapCommandTable;
+  EFI_AHCI_RECEIVED_FIS         *AhciRFis;
+  EFI_AHCI_COMMAND_LIST         *AhciCmdList;
+  EFI_AHCI_COMMAND_TABLE        *AhciCommandTable;
+  EFI_AHCI_NCQ_COMMAND_TABLE    *AhciNcqCommandTable;
+  EFI_AHCI_RECEIVED_FIS         *AhciRFisPciAddr;
+  EFI_AHCI_COMMAND_LIST         *AhciCmdListPciAddr;
+  EFI_AHCI_COMMAND_TABLE        *AhciCommandTablePciAddr;
+  EFI_AHCI_NCQ_COMMAND_TABLE    *AhciNcqCommandTablePciAddr;
+  UINT64                        MaxCommandListSize;
+  UINT64                        MaxCommandTableSize;
+  UINT64                        MaxNcqCommandTableSize;
+  UINT64                        MaxReceiveFisSize;
+  VOID                          *MapRFis;
+  VOID                          *MapCmdList;
+  VOID                          *MapCommandTable;
+  VOID                          *MapNcqCommandTable;
+  //
+  // Number of command slots per port supported by the HBA.
+  //
+  UINT8                         MaxCommandSlotNumber;
+  //
+  // Bit mask of the command slots that carry a queued command which has not
+  // been retired by the non-blocking task list yet.
+  //
+  UINT32                        NcqSlotBusyMask;
 } EFI_AHCI_REGISTERS;
 
 /**
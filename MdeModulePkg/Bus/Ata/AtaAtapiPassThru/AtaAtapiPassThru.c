@@ -952,6 +952,15 @@ AtaAtapiPassThruStop (
   //
   if (Instance->Mode == EfiAtaAhciMode) {
     AhciRegisters = &Instance->AhciRegisters;
+    PciIo->Unmap (
+             PciIo,
+             AhciRegisters->MapNcqCommandTable
+             );
+    PciIo->FreeBuffer (
+             PciIo,
+             EFI_SIZE_TO_PAGES ((UINTN)AhciRegisters->MaxNcqCommandTableSize),
+             AhciRegisters->AhciNcqCommandTable
+             );
     PciIo->Unmap (
              PciIo,
              AhciRegisters->MapCommandTable
@@ -132,6 +132,9 @@ struct _ATA_NONBLOCK_TASK {
   UINT16                              PortMultiplier;
   EFI_ATA_PASS_THRU_COMMAND_PACKET    *Packet;
   BOOLEAN                             IsStart;
+  BOOLEAN                             IsNcq;           // Issued as a queued (FPDMA) command.
+  UINT8                               CommandSlot;     // Command slot carrying the queued command.
+  EFI_PHYSICAL_ADDRESS                DataPhyAddr;     // Bus master address of the mapped data buffer.
   EFI_EVENT                           Event;
   UINT64                              RetryTimes;
   BOOLEAN                             InfiniteWait;
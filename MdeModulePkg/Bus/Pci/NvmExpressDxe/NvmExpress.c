@@ -554,168 +554,216 @@ ProcessAsyncTaskList (
   NVME_BLKIO2_REQUEST           *BlkIo2Request;
   EFI_BLOCK_IO2_TOKEN           *Token;
   BOOLEAN                       HasNewItem;
+  BOOLEAN                       AnyCompleted;
   EFI_STATUS                    Status;
 
-  Private    = (NVME_CONTROLLER_PRIVATE_DATA *)Context;
-  QueueId    = 2;
-  Cq         = Private->CqBuffer[QueueId] + Private->CqHdbl[QueueId].Cqh;
-  HasNewItem = FALSE;
-  PciIo      = Private->PciIo;
+  Private = (NVME_CONTROLLER_PRIVATE_DATA *)Context;
+  PciIo   = Private->PciIo;
 
   //
-  // Submit asynchronous subtasks to the NVMe Submission Queue
+  // Keep making submit and complete passes while completions free submission
+  // queue slots for waiting subtasks, so that chained requests stream back to
+  // back instead of waiting for the next timer tick.
   //
-  for (Link = GetFirstNode (&Private->UnsubmittedSubtasks);
-       !IsNull (&Private->UnsubmittedSubtasks, Link);
-       Link = NextLink)
-  {
-    NextLink      = GetNextNode (&Private->UnsubmittedSubtasks, Link);
-    Subtask       = NVME_BLKIO2_SUBTASK_FROM_LINK (Link);
-    BlkIo2Request = Subtask->BlockIo2Request;
-    Token         = BlkIo2Request->Token;
-    RemoveEntryList (Link);
-    BlkIo2Request->UnsubmittedSubtaskNum--;
+  do {
+    AnyCompleted = FALSE;
 
     //
-    // If any previous subtask fails, do not process subsequent ones.
+    // Submit asynchronous subtasks to the NVMe Submission Queue, deferring the
+    // submission queue doorbell writes so that each queue is rung only once
+    // per pass no matter how many commands were queued.
     //
-    if (Token->TransactionStatus != EFI_SUCCESS) {
-      if (IsListEmpty (&BlkIo2Request->SubtasksQueue) &&
-          BlkIo2Request->LastSubtaskSubmitted &&
-          (BlkIo2Request->UnsubmittedSubtaskNum == 0))
-      {
-        //
-        // Remove the BlockIo2 request from the device asynchronous queue.
-        //
-        RemoveEntryList (&BlkIo2Request->Link);
-        FreePool (BlkIo2Request);
-        gBS->SignalEvent (Token->Event);
-      }
-
-      FreePool (Subtask->CommandPacket->NvmeCmd);
-      FreePool (Subtask->CommandPacket->NvmeCompletion);
-      FreePool (Subtask->CommandPacket);
-      FreePool (Subtask);
+    Private->DeferAsyncDoorbell = TRUE;
+    for (Link = GetFirstNode (&Private->UnsubmittedSubtasks);
+         !IsNull (&Private->UnsubmittedSubtasks, Link);
+         Link = NextLink)
+    {
+      NextLink      = GetNextNode (&Private->UnsubmittedSubtasks, Link);
+      Subtask       = NVME_BLKIO2_SUBTASK_FROM_LINK (Link);
+      BlkIo2Request = Subtask->BlockIo2Request;
+      Token         = BlkIo2Request->Token;
+      RemoveEntryList (Link);
+      BlkIo2Request->UnsubmittedSubtaskNum--;
 
-      continue;
-    }
+      //
+      // If any previous subtask fails, do not process subsequent ones.
+      //
+      if (Token->TransactionStatus != EFI_SUCCESS) {
+        if (IsListEmpty (&BlkIo2Request->SubtasksQueue) &&
+            BlkIo2Request->LastSubtaskSubmitted &&
+            (BlkIo2Request->UnsubmittedSubtaskNum == 0))
+        {
+          //
+          // Remove the BlockIo2 request from the device asynchronous queue.
+          //
+          RemoveEntryList (&BlkIo2Request->Link);
+          FreePool (BlkIo2Request);
+          gBS->SignalEvent (Token->Event);
+        }
 
-    Status = Private->Passthru.PassThru (
-                                 &Private->Passthru,
-                                 Subtask->NamespaceId,
-                                 Subtask->CommandPacket,
-                                 Subtask->Event
-                                 );
-    if (Status == EFI_NOT_READY) {
-      InsertHeadList (&Private->UnsubmittedSubtasks, Link);
-      BlkIo2Request->UnsubmittedSubtaskNum++;
-      break;
-    } else if (EFI_ERROR (Status)) {
-      Token->TransactionStatus = EFI_DEVICE_ERROR;
+        FreePool (Subtask->CommandPacket->NvmeCmd);
+        FreePool (Subtask->CommandPacket->NvmeCompletion);
+        FreePool (Subtask->CommandPacket);
+        FreePool (Subtask);
 
-      if (IsListEmpty (&BlkIo2Request->SubtasksQueue) &&
-          Subtask->IsLast)
-      {
-        //
-        // Remove the BlockIo2 request from the device asynchronous queue.
-        //
-        RemoveEntryList (&BlkIo2Request->Link);
-        FreePool (BlkIo2Request);
-        gBS->SignalEvent (Token->Event);
+        continue;
       }
 
-      FreePool (Subtask->CommandPacket->NvmeCmd);
-      FreePool (Subtask->CommandPacket->NvmeCompletion);
-      FreePool (Subtask->CommandPacket);
-      FreePool (Subtask);
-    } else {
-      InsertTailList (&BlkIo2Request->SubtasksQueue, Link);
-      if (Subtask->IsLast) {
-        BlkIo2Request->LastSubtaskSubmitted = TRUE;
+      Status = Private->Passthru.PassThru (
+                                   &Private->Passthru,
+                                   Subtask->NamespaceId,
+                                   Subtask->CommandPacket,
+                                   Subtask->Event
+                                   );
+      if (Status == EFI_NOT_READY) {
+        InsertHeadList (&Private->UnsubmittedSubtasks, Link);
+        BlkIo2Request->UnsubmittedSubtaskNum++;
+        break;
+      } else if (EFI_ERROR (Status)) {
+        Token->TransactionStatus = EFI_DEVICE_ERROR;
+
+        if (IsListEmpty (&BlkIo2Request->SubtasksQueue) &&
+            Subtask->IsLast)
+        {
+          //
+          // Remove the BlockIo2 request from the device asynchronous queue.
+          //
+          RemoveEntryList (&BlkIo2Request->Link);
+          FreePool (BlkIo2Request);
+          gBS->SignalEvent (Token->Event);
+        }
+
+        FreePool (Subtask->CommandPacket->NvmeCmd);
+        FreePool (Subtask->CommandPacket->NvmeCompletion);
+        FreePool (Subtask->CommandPacket);
+        FreePool (Subtask);
+      } else {
+        InsertTailList (&BlkIo2Request->SubtasksQueue, Link);
+        if (Subtask->IsLast) {
+          BlkIo2Request->LastSubtaskSubmitted = TRUE;
+        }
       }
     }
-  }
 
-  while (Cq->Pt != Private->Pt[QueueId]) {
-    ASSERT (Cq->Sqid == QueueId);
+    Private->DeferAsyncDoorbell = FALSE;
 
-    HasNewItem = TRUE;
+    //
+    // Ring the submission queue doorbells deferred during the submit pass.
+    //
+    for (QueueId = NVME_ASYNC_QUEUE_START;
+         QueueId < NVME_ASYNC_QUEUE_START + Private->AsyncQueueNum;
+         QueueId++)
+    {
+      if (Private->AsyncDoorbellPending[QueueId]) {
+        Private->AsyncDoorbellPending[QueueId] = FALSE;
+        Data                                   = ReadUnaligned32 ((UINT32 *)&Private->SqTdbl[QueueId]);
+        PciIo->Mem.Write (
+                     PciIo,
+                     EfiPciIoWidthUint32,
+                     NVME_BAR,
+                     NVME_SQTDBL_OFFSET (QueueId, Private->Cap.Dstrd),
+                     1,
+                     &Data
+                     );
+      }
+    }
 
     //
-    // Find the command with given Command Id.
+    // Process the completions of every asynchronous I/O queue pair.
     //
-    for (Link = GetFirstNode (&Private->AsyncPassThruQueue);
-         !IsNull (&Private->AsyncPassThruQueue, Link);
-         Link = NextLink)
+    for (QueueId = NVME_ASYNC_QUEUE_START;
+         QueueId < NVME_ASYNC_QUEUE_START + Private->AsyncQueueNum;
+         QueueId++)
     {
-      NextLink     = GetNextNode (&Private->AsyncPassThruQueue, Link);
-      AsyncRequest = NVME_PASS_THRU_ASYNC_REQ_FROM_THIS (Link);
-      if (AsyncRequest->CommandId == Cq->Cid) {
-        //
-        // Copy the Respose Queue entry for this command to the callers
-        // response buffer.
-        //
-        CopyMem (
-          AsyncRequest->Packet->NvmeCompletion,
-          Cq,
-          sizeof (EFI_NVM_EXPRESS_COMPLETION)
-          );
+      Cq         = Private->CqBuffer[QueueId] + Private->CqHdbl[QueueId].Cqh;
+      HasNewItem = FALSE;
 
-        //
-        // Free the resources allocated before cmd submission
-        //
-        if (AsyncRequest->MapData != NULL) {
-          PciIo->Unmap (PciIo, AsyncRequest->MapData);
-        }
+      while (Cq->Pt != Private->Pt[QueueId]) {
+        ASSERT (Cq->Sqid == QueueId);
 
-        if (AsyncRequest->MapMeta != NULL) {
-          PciIo->Unmap (PciIo, AsyncRequest->MapMeta);
-        }
+        HasNewItem = TRUE;
 
-        if (AsyncRequest->MapPrpList != NULL) {
-          PciIo->Unmap (PciIo, AsyncRequest->MapPrpList);
+        //
+        // Find the command with given Command Id.
+        //
+        for (Link = GetFirstNode (&Private->AsyncPassThruQueue);
+             !IsNull (&Private->AsyncPassThruQueue, Link);
+             Link = NextLink)
+        {
+          NextLink     = GetNextNode (&Private->AsyncPassThruQueue, Link);
+          AsyncRequest = NVME_PASS_THRU_ASYNC_REQ_FROM_THIS (Link);
+          if ((AsyncRequest->CommandId == Cq->Cid) &&
+              (AsyncRequest->QueueId == Cq->Sqid))
+          {
+            //
+            // Copy the Respose Queue entry for this command to the callers
+            // response buffer.
+            //
+            CopyMem (
+              AsyncRequest->Packet->NvmeCompletion,
+              Cq,
+              sizeof (EFI_NVM_EXPRESS_COMPLETION)
+              );
+
+            //
+            // Free the resources allocated before cmd submission
+            //
+            if (AsyncRequest->MapData != NULL) {
+              PciIo->Unmap (PciIo, AsyncRequest->MapData);
+            }
+
+            if (AsyncRequest->MapMeta != NULL) {
+              PciIo->Unmap (PciIo, AsyncRequest->MapMeta);
+            }
+
+            if (AsyncRequest->MapPrpList != NULL) {
+              PciIo->Unmap (PciIo, AsyncRequest->MapPrpList);
+            }
+
+            if (AsyncRequest->PrpListHost != NULL) {
+              PciIo->FreeBuffer (
+                       PciIo,
+                       AsyncRequest->PrpListNo,
+                       AsyncRequest->PrpListHost
+                       );
+            }
+
+            RemoveEntryList (Link);
+            gBS->SignalEvent (AsyncRequest->CallerEvent);
+            FreePool (AsyncRequest);
+
+            //
+            // Update submission queue head.
+            //
+            Private->AsyncSqHead[QueueId] = Cq->Sqhd;
+            break;
+          }
         }
 
-        if (AsyncRequest->PrpListHost != NULL) {
-          PciIo->FreeBuffer (
-                   PciIo,
-                   AsyncRequest->PrpListNo,
-                   AsyncRequest->PrpListHost
-                   );
+        Private->CqHdbl[QueueId].Cqh++;
+        if (Private->CqHdbl[QueueId].Cqh > MIN (NVME_ASYNC_CCQ_SIZE, Private->Cap.Mqes)) {
+          Private->CqHdbl[QueueId].Cqh = 0;
+          Private->Pt[QueueId]        ^= 1;
         }
 
-        RemoveEntryList (Link);
-        gBS->SignalEvent (AsyncRequest->CallerEvent);
-        FreePool (AsyncRequest);
-
-        //
-        // Update submission queue head.
-        //
-        Private->AsyncSqHead = Cq->Sqhd;
-        break;
+        Cq = Private->CqBuffer[QueueId] + Private->CqHdbl[QueueId].Cqh;
       }
-    }
 
-    Private->CqHdbl[QueueId].Cqh++;
-    if (Private->CqHdbl[QueueId].Cqh > MIN (NVME_ASYNC_CCQ_SIZE, Private->Cap.Mqes)) {
-      Private->CqHdbl[QueueId].Cqh = 0;
-      Private->Pt[QueueId]        ^= 1;
+      if (HasNewItem) {
+        AnyCompleted = TRUE;
+
+        Data = ReadUnaligned32 ((UINT32 *)&Private->CqHdbl[QueueId]);
+        PciIo->Mem.Write (
+                     PciIo,
+                     EfiPciIoWidthUint32,
+                     NVME_BAR,
+                     NVME_CQHDBL_OFFSET (QueueId, Private->Cap.Dstrd),
+                     1,
+                     &Data
+                     );
+      }
     }
-
-    Cq = Private->CqBuffer[QueueId] + Private->CqHdbl[QueueId].Cqh;
-  }
-
-  if (HasNewItem) {
-    Data = ReadUnaligned32 ((UINT32 *)&Private->CqHdbl[QueueId]);
-    PciIo->Mem.Write (
-                 PciIo,
-                 EfiPciIoWidthUint32,
-                 NVME_BAR,
-                 NVME_CQHDBL_OFFSET (QueueId, Private->Cap.Dstrd),
-                 1,
-                 &Data
-                 );
-  }
+  } while (AnyCompleted && !IsListEmpty (&Private->UnsubmittedSubtasks));
 }
 
 /**
@@ -1002,21 +1050,20 @@ NvmExpressDriverBindingStart (
     }
 
     //
-    // 6 x 4kB aligned buffers will be carved out of this buffer.
+    // NVME_QUEUE_PAGE_NUM x 4kB aligned buffers will be carved out of this buffer.
     // 1st 4kB boundary is the start of the admin submission queue.
     // 2nd 4kB boundary is the start of the admin completion queue.
-    // 3rd 4kB boundary is the start of I/O submission queue #1.
-    // 4th 4kB boundary is the start of I/O completion queue #1.
-    // 5th 4kB boundary is the start of I/O submission queue #2.
-    // 6th 4kB boundary is the start of I/O completion queue #2.
+    // The subsequent 4kB boundaries are the start of the I/O submission and
+    // completion queues, one pair for blocking I/O and the remaining pairs
+    // for non-blocking I/O.
     //
-    // Allocate 6 pages of memory, then map it for bus master read and write.
+    // Allocate NVME_QUEUE_PAGE_NUM pages of memory, then map it for bus master read and write.
     //
     Status = PciIo->AllocateBuffer (
                       PciIo,
                       AllocateAnyPages,
                       EfiBootServicesData,
-                      6,
+                      NVME_QUEUE_PAGE_NUM,
                       (VOID **)&Private->Buffer,
                       0
                       );
@@ -1024,7 +1071,7 @@ NvmExpressDriverBindingStart (
       goto Exit;
     }
 
-    Bytes  = EFI_PAGES_TO_SIZE (6);
+    Bytes  = EFI_PAGES_TO_SIZE (NVME_QUEUE_PAGE_NUM);
     Status = PciIo->Map (
                       PciIo,
                       EfiPciIoOperationBusMasterCommonBuffer,
@@ -1034,7 +1081,7 @@ NvmExpressDriverBindingStart (
                       &Private->Mapping
                       );
 
-    if (EFI_ERROR (Status) || (Bytes != EFI_PAGES_TO_SIZE (6))) {
+    if (EFI_ERROR (Status) || (Bytes != EFI_PAGES_TO_SIZE (NVME_QUEUE_PAGE_NUM))) {
       goto Exit;
     }
 
@@ -1144,7 +1191,7 @@ Exit:
   }
 
   if ((Private != NULL) && (Private->Buffer != NULL)) {
-    PciIo->FreeBuffer (PciIo, 6, Private->Buffer);
+    PciIo->FreeBuffer (PciIo, NVME_QUEUE_PAGE_NUM, Private->Buffer);
   }
 
   if ((Private != NULL) && (Private->ControllerData != NULL)) {
@@ -1266,7 +1313,7 @@ NvmExpressDriverBindingStop (
       }
 
       if (Private->Buffer != NULL) {
-        Private->PciIo->FreeBuffer (Private->PciIo, 6, Private->Buffer);
+        Private->PciIo->FreeBuffer (Private->PciIo, NVME_QUEUE_PAGE_NUM, Private->Buffer);
       }
 
       FreePool (Private->ControllerData);
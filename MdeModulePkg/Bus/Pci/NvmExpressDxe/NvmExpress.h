@@ -73,7 +73,24 @@ extern EFI_DRIVER_SUPPORTED_EFI_VERSION_PROTOCOL  gNvmExpressDriverSupportedEfiV
 //
 #define NVME_ASYNC_CCQ_SIZE  255
 
-#define NVME_MAX_QUEUES  3                              // Number of queues supported by the driver
+//
+// Number of asynchronous I/O queue pairs created by the driver. Requests
+// submitted through BlockIo2 are spread across the pairs in round-robin
+// order to exploit the queue level parallelism of the controller.
+//
+#define NVME_ASYNC_QUEUE_NUM  2
+//
+// Queue identifier of the first asynchronous I/O queue pair.
+//
+#define NVME_ASYNC_QUEUE_START  2
+
+#define NVME_MAX_QUEUES  (2 + NVME_ASYNC_QUEUE_NUM)     // Number of queues supported by the driver
+
+//
+// Number of 4kB pages carved out of one buffer for all submission and
+// completion queues.
+//
+#define NVME_QUEUE_PAGE_NUM  (2 * NVME_MAX_QUEUES)
 
 #define NVME_CONTROLLER_ID  0
 
@@ -116,13 +133,12 @@ struct _NVME_CONTROLLER_PRIVATE_DATA {
   NVME_ADMIN_CONTROLLER_DATA            *ControllerData;
 
   //
-  // 6 x 4kB aligned buffers will be carved out of this buffer.
+  // NVME_QUEUE_PAGE_NUM x 4kB aligned buffers will be carved out of this buffer.
   // 1st 4kB boundary is the start of the admin submission queue.
   // 2nd 4kB boundary is the start of the admin completion queue.
-  // 3rd 4kB boundary is the start of I/O submission queue #1.
-  // 4th 4kB boundary is the start of I/O completion queue #1.
-  // 5th 4kB boundary is the start of I/O submission queue #2.
-  // 6th 4kB boundary is the start of I/O completion queue #2.
+  // The 2n+1st/2n+2nd 4kB boundaries are the start of I/O submission/completion
+  // queue #n, where queue #1 serves blocking I/O and queues #2 and up serve
+  // non-blocking I/O.
   //
   UINT8          *Buffer;
   UINT8          *BufferPciAddr;
@@ -140,7 +156,22 @@ struct _NVME_CONTROLLER_PRIVATE_DATA {
   //
   NVME_SQTDBL    SqTdbl[NVME_MAX_QUEUES];
   NVME_CQHDBL    CqHdbl[NVME_MAX_QUEUES];
-  UINT16         AsyncSqHead;
+  UINT16         AsyncSqHead[NVME_MAX_QUEUES];
+
+  //
+  // Number of asynchronous I/O queue pairs actually created on the controller
+  // and the round-robin cursor for the next asynchronous submission.
+  //
+  UINT16         AsyncQueueNum;
+  UINT16         NextAsyncQueue;
+
+  //
+  // When TRUE, asynchronous submissions defer the submission queue doorbell
+  // write and only mark the queue as pending; the async task timer rings each
+  // pending queue once per submit pass instead of once per command.
+  //
+  BOOLEAN        DeferAsyncDoorbell;
+  BOOLEAN        AsyncDoorbellPending[NVME_MAX_QUEUES];
 
   //
   // Flag to indicate internal IO queue creation.
@@ -292,6 +323,7 @@ typedef struct {
 
   EFI_NVM_EXPRESS_PASS_THRU_COMMAND_PACKET    *Packet;
   UINT16                                      CommandId;
+  UINT16                                      QueueId;
   VOID                                        *MapPrpList;
   UINTN                                       PrpListNo;
   VOID                                        *PrpListHost;
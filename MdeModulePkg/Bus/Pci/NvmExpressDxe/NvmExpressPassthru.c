@@ -462,6 +462,8 @@ NvmExpressPassThru (
   NVME_SQ                        *Sq;
   NVME_CQ                        *Cq;
   UINT16                         QueueId;
+  UINT16                         CandidateQueue;
+  UINT16                         Index;
   UINT16                         QueueSize;
   UINT32                         Bytes;
   UINT16                         Offset;
@@ -561,16 +563,32 @@ NvmExpressPassThru (
     if (Event == NULL) {
       QueueId = 1;
     } else {
-      QueueId = 2;
+      //
+      // Spread asynchronous requests across the asynchronous I/O queue pairs
+      // in round-robin order, skipping any pair whose submission queue is
+      // currently full.
+      //
+      QueueId = 0;
+      for (Index = 0; Index < Private->AsyncQueueNum; Index++) {
+        CandidateQueue = (UINT16)(NVME_ASYNC_QUEUE_START +
+                                  (Private->NextAsyncQueue + Index) % Private->AsyncQueueNum);
+        if ((Private->SqTdbl[CandidateQueue].Sqt + 1) % QueueSize !=
+            Private->AsyncSqHead[CandidateQueue])
+        {
+          QueueId = CandidateQueue;
+          break;
+        }
+      }
 
       //
-      // Submission queue full check.
+      // All submission queues are full.
       //
-      if ((Private->SqTdbl[QueueId].Sqt + 1) % QueueSize ==
-          Private->AsyncSqHead)
-      {
+      if (QueueId == 0) {
         return EFI_NOT_READY;
       }
+
+      Private->NextAsyncQueue =
+        (UINT16)((QueueId - NVME_ASYNC_QUEUE_START + 1) % Private->AsyncQueueNum);
     }
   }
 
@@ -733,18 +751,26 @@ NvmExpressPassThru (
     Private->SqTdbl[QueueId].Sqt ^= 1;
   }
 
-  Data   = ReadUnaligned32 ((UINT32 *)&Private->SqTdbl[QueueId]);
-  Status = PciIo->Mem.Write (
-                        PciIo,
-                        EfiPciIoWidthUint32,
-                        NVME_BAR,
-                        NVME_SQTDBL_OFFSET (QueueId, Private->Cap.Dstrd),
-                        1,
-                        &Data
-                        );
+  if ((Event != NULL) && (QueueId != 0) && Private->DeferAsyncDoorbell) {
+    //
+    // The async task timer batches doorbell writes: mark the queue as pending
+    // and let the timer ring it once after queuing all waiting commands.
+    //
+    Private->AsyncDoorbellPending[QueueId] = TRUE;
+  } else {
+    Data   = ReadUnaligned32 ((UINT32 *)&Private->SqTdbl[QueueId]);
+    Status = PciIo->Mem.Write (
+                          PciIo,
+                          EfiPciIoWidthUint32,
+                          NVME_BAR,
+                          NVME_SQTDBL_OFFSET (QueueId, Private->Cap.Dstrd),
+                          1,
+                          &Data
+                          );
 
-  if (EFI_ERROR (Status)) {
-    goto EXIT;
+    if (EFI_ERROR (Status)) {
+      goto EXIT;
+    }
   }
 
   //
@@ -761,6 +787,7 @@ NvmExpressPassThru (
     AsyncRequest->Signature   = NVME_PASS_THRU_ASYNC_REQ_SIG;
     AsyncRequest->Packet      = Packet;
     AsyncRequest->CommandId   = Sq->Cid;
+    AsyncRequest->QueueId     = QueueId;
     AsyncRequest->CallerEvent = Event;
     AsyncRequest->MapData     = MapData;
     AsyncRequest->MapMeta     = MapMeta;
@@ -184,6 +184,46 @@ NvmeDiscoverNamespaces (
   return EFI_SUCCESS;
 }
 
+/**
+  Ensure the active namespaces on an Nvm Express controller have been
+  enumerated.
+
+  The enumeration issues one Identify Namespace command per valid namespace,
+  so it is performed lazily on the first consumer access to the namespace
+  information rather than during controller discovery.
+
+  @param[in,out] Private    The pointer to the PEI_NVME_CONTROLLER_PRIVATE_DATA data structure.
+
+  @retval EFI_SUCCESS    The namespaces on the controller have been enumerated.
+
+**/
+EFI_STATUS
+NvmeEnsureNamespacesDiscovered (
+  IN OUT PEI_NVME_CONTROLLER_PRIVATE_DATA  *Private
+  )
+{
+  EFI_STATUS  Status;
+
+  if (Private->NamespacesDiscovered) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // A controller without active namespaces simply reports zero block devices,
+  // so EFI_NOT_FOUND is not treated as an error here.
+  //
+  Status = NvmeDiscoverNamespaces (Private);
+  if (Status == EFI_NOT_FOUND) {
+    Status = EFI_SUCCESS;
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Private->NamespacesDiscovered = TRUE;
+  }
+
+  return Status;
+}
+
 /**
   One notified function to cleanup the allocated resources at the end of PEI.
 
@@ -389,24 +429,10 @@ NvmExpressPeimEntry (
     }
 
     //
-    // Enumerate the NVME namespaces on the controller
+    // The enumeration of the NVME namespaces on the controller is deferred
+    // to the first consumer access of the namespace information. See
+    // NvmeEnsureNamespacesDiscovered().
     //
-    Status = NvmeDiscoverNamespaces (Private);
-    if (EFI_ERROR (Status)) {
-      //
-      // No active namespace was found on the controller
-      //
-      DEBUG ((
-        DEBUG_ERROR,
-        "%a: Namespaces discovery fail for Controller %d with Status - %r.\n",
-        __FUNCTION__,
-        Controller,
-        Status
-        ));
-      NvmeFreeDmaResource (Private);
-      Controller++;
-      continue;
-    }
 
     //
     // Nvm Express Pass Thru PPI
@@ -139,8 +139,11 @@ struct _PEI_NVME_CONTROLLER_PRIVATE_DATA {
   NVME_CAP                   Cap;
 
   //
-  // Namespaces information on the controller
+  // Namespaces information on the controller. The enumeration issues one
+  // Identify Namespace command per valid namespace, so it is deferred until
+  // a consumer first asks for the namespace information.
   //
+  BOOLEAN                    NamespacesDiscovered;
   UINT32                     ActiveNamespaceNum;
   PEI_NVME_NAMESPACE_INFO    *NamespaceInfo;
 };
@@ -345,4 +348,18 @@ NvmeS3SkipThisController (
   IN  UINTN                     HcDevicePathLength
   );
 
+/**
+  Ensure the active namespaces on an Nvm Express controller have been
+  enumerated.
+
+  @param[in,out] Private    The pointer to the PEI_NVME_CONTROLLER_PRIVATE_DATA data structure.
+
+  @retval EFI_SUCCESS    The namespaces on the controller have been enumerated.
+
+**/
+EFI_STATUS
+NvmeEnsureNamespacesDiscovered (
+  IN OUT PEI_NVME_CONTROLLER_PRIVATE_DATA  *Private
+  );
+
 #endif
@@ -186,12 +186,18 @@ NvmeBlockIoPeimGetDeviceNo (
   )
 {
   PEI_NVME_CONTROLLER_PRIVATE_DATA  *Private;
+  EFI_STATUS                        Status;
 
   if ((This == NULL) || (NumberBlockDevices == NULL)) {
     return EFI_INVALID_PARAMETER;
   }
 
-  Private             = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_BLKIO (This);
+  Private = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_BLKIO (This);
+  Status  = NvmeEnsureNamespacesDiscovered (Private);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   *NumberBlockDevices = Private->ActiveNamespaceNum;
 
   return EFI_SUCCESS;
@@ -248,12 +254,17 @@ NvmeBlockIoPeimGetMediaInfo (
   )
 {
   PEI_NVME_CONTROLLER_PRIVATE_DATA  *Private;
+  EFI_STATUS                        Status;
 
   if ((This == NULL) || (MediaInfo == NULL)) {
     return EFI_INVALID_PARAMETER;
   }
 
   Private = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_BLKIO (This);
+  Status  = NvmeEnsureNamespacesDiscovered (Private);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
 
   if ((DeviceIndex == 0) || (DeviceIndex > Private->ActiveNamespaceNum)) {
     return EFI_INVALID_PARAMETER;
@@ -316,6 +327,7 @@ NvmeBlockIoPeimReadBlocks (
   PEI_NVME_NAMESPACE_INFO           *NamespaceInfo;
   UINT32                            BlockSize;
   UINTN                             NumberOfBlocks;
+  EFI_STATUS                        Status;
 
   Private = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_BLKIO (This);
 
@@ -330,6 +342,11 @@ NvmeBlockIoPeimReadBlocks (
     return EFI_SUCCESS;
   }
 
+  Status = NvmeEnsureNamespacesDiscovered (Private);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   if ((DeviceIndex == 0) || (DeviceIndex > Private->ActiveNamespaceNum)) {
     return EFI_INVALID_PARAMETER;
   }
@@ -380,12 +397,18 @@ NvmeBlockIoPeimGetDeviceNo2 (
   )
 {
   PEI_NVME_CONTROLLER_PRIVATE_DATA  *Private;
+  EFI_STATUS                        Status;
 
   if ((This == NULL) || (NumberBlockDevices == NULL)) {
     return EFI_INVALID_PARAMETER;
   }
 
-  Private             = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_BLKIO2 (This);
+  Private = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_BLKIO2 (This);
+  Status  = NvmeEnsureNamespacesDiscovered (Private);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   *NumberBlockDevices = Private->ActiveNamespaceNum;
 
   return EFI_SUCCESS;
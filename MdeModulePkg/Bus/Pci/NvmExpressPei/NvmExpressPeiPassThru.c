@@ -732,6 +732,10 @@ NvmePassThruGetNextNameSpace (
   }
 
   Private = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_NVME_PASSTHRU (This);
+  Status  = NvmeEnsureNamespacesDiscovered (Private);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
 
   Status = EFI_NOT_FOUND;
 
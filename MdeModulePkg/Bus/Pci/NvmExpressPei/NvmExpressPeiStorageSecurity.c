@@ -131,12 +131,18 @@ NvmeStorageSecurityGetDeviceNo (
   )
 {
   PEI_NVME_CONTROLLER_PRIVATE_DATA  *Private;
+  EFI_STATUS                        Status;
 
   if ((This == NULL) || (NumberofDevices == NULL)) {
     return EFI_INVALID_PARAMETER;
   }
 
-  Private          = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_STROAGE_SECURITY (This);
+  Private = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_STROAGE_SECURITY (This);
+  Status  = NvmeEnsureNamespacesDiscovered (Private);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   *NumberofDevices = Private->ActiveNamespaceNum;
 
   return EFI_SUCCESS;
@@ -177,12 +183,18 @@ NvmeStorageSecurityGetDevicePath (
   )
 {
   PEI_NVME_CONTROLLER_PRIVATE_DATA  *Private;
+  EFI_STATUS                        Status;
 
   if ((This == NULL) || (DevicePathLength == NULL) || (DevicePath == NULL)) {
     return EFI_INVALID_PARAMETER;
   }
 
   Private = GET_NVME_PEIM_HC_PRIVATE_DATA_FROM_THIS_STROAGE_SECURITY (This);
+  Status  = NvmeEnsureNamespacesDiscovered (Private);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   if ((DeviceIndex == 0) || (DeviceIndex > Private->ActiveNamespaceNum)) {
     return EFI_INVALID_PARAMETER;
   }
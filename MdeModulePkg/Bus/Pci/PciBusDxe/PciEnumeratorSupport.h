@@ -192,6 +192,25 @@ BarExisted (
   OUT UINT32         *OriginalBarValue
   );
 
+/**
+  Probe a range of consecutive bars with batched config transactions.
+
+  @param PciIoDevice        A pointer to the PCI_IO_DEVICE.
+  @param Offset             The offset of the first bar register to probe.
+  @param Count              Number of consecutive 32-bit bar registers.
+  @param BarLengthValues    The bar length value of each bar returned.
+  @param OriginalBarValues  The original value of each bar returned.
+
+**/
+VOID
+PciProbeBarValues (
+  IN  PCI_IO_DEVICE  *PciIoDevice,
+  IN  UINTN          Offset,
+  IN  UINTN          Count,
+  OUT UINT32         *BarLengthValues,
+  OUT UINT32         *OriginalBarValues
+  );
+
 /**
   Test whether the device can support given attributes.
 
@@ -290,9 +309,16 @@ SetNewAlign (
 /**
   Parse PCI bar information and fill them into PCI device instance.
 
-  @param PciIoDevice  Pci device instance.
-  @param Offset       Bar offset.
-  @param BarIndex     Bar index.
+  When BarLengthValues and OriginalBarValues are not NULL, they hold the
+  values probed in one batch by PciProbeBarValues() starting at bar offset
+  0x10, and no config transactions are issued by this function. When they are
+  NULL, the bar is probed individually through BarExisted().
+
+  @param PciIoDevice        Pci device instance.
+  @param Offset             Bar offset.
+  @param BarIndex           Bar index.
+  @param BarLengthValues    Bar length values probed in batch, or NULL.
+  @param OriginalBarValues  Original bar values probed in batch, or NULL.
 
   @return Next bar offset.
 
@@ -301,7 +327,9 @@ UINTN
 PciParseBar (
   IN PCI_IO_DEVICE  *PciIoDevice,
   IN UINTN          Offset,
-  IN UINTN          BarIndex
+  IN UINTN          BarIndex,
+  IN UINT32         *BarLengthValues    OPTIONAL,
+  IN UINT32         *OriginalBarValues  OPTIONAL
   );
 
 /**
@@ -411,6 +411,8 @@ AdjustPciDeviceBarSize (
   BOOLEAN        Adjusted;
   UINTN          Offset;
   UINTN          BarIndex;
+  UINT32         BarLengthValues[PCI_MAX_BAR];
+  UINT32         OriginalBarValues[PCI_MAX_BAR];
 
   Adjusted    = FALSE;
   CurrentLink = RootBridgeDev->ChildList.ForwardLink;
@@ -433,10 +435,12 @@ AdjustPciDeviceBarSize (
           ));
         PciProgramResizableBar (PciIoDevice, PciResizableBarMin);
         //
-        // Start to parse the bars
+        // Probe all the bars in one batch, then parse the probed values
         //
+        PciProbeBarValues (PciIoDevice, 0x10, PCI_MAX_BAR, BarLengthValues, OriginalBarValues);
+
         for (Offset = 0x10, BarIndex = 0; Offset <= 0x24 && BarIndex < PCI_MAX_BAR; BarIndex++) {
-          Offset = PciParseBar (PciIoDevice, Offset, BarIndex);
+          Offset = PciParseBar (PciIoDevice, Offset, BarIndex, BarLengthValues, OriginalBarValues);
         }
 
         Adjusted = TRUE;
@@ -165,68 +165,83 @@ ProcessAsyncTaskList (
   Private = (SD_MMC_HC_PRIVATE_DATA *)Context;
 
   //
-  // Check if the first entry in the async I/O queue is done or not.
+  // Process entries from the head of the async I/O queue until one is left
+  // executing on the bus. Starting the next TRB in the same tick right after
+  // its predecessor retires avoids a bus idle gap of up to one timer period
+  // between back-to-back commands.
   //
-  Status = EFI_SUCCESS;
-  Trb    = NULL;
-  Link   = GetFirstNode (&Private->Queue);
-  if (!IsNull (&Private->Queue, Link)) {
-    Trb = SD_MMC_HC_TRB_FROM_THIS (Link);
-    if (!Private->Slot[Trb->Slot].MediaPresent) {
-      Status = EFI_NO_MEDIA;
-      goto Done;
-    }
+  while (TRUE) {
+    Status = EFI_SUCCESS;
+    Trb    = NULL;
+    Link   = GetFirstNode (&Private->Queue);
+    if (!IsNull (&Private->Queue, Link)) {
+      Trb = SD_MMC_HC_TRB_FROM_THIS (Link);
+      if (!Private->Slot[Trb->Slot].MediaPresent) {
+        Status = EFI_NO_MEDIA;
+        goto Done;
+      }
 
-    if (!Trb->Started) {
-      //
-      // Check whether the cmd/data line is ready for transfer.
-      //
-      Status = SdMmcCheckTrbEnv (Private, Trb);
-      if (!EFI_ERROR (Status)) {
-        Trb->Started = TRUE;
-        Status       = SdMmcExecTrb (Private, Trb);
-        if (EFI_ERROR (Status)) {
+      if (!Trb->Started) {
+        //
+        // Check whether the cmd/data line is ready for transfer.
+        //
+        Status = SdMmcCheckTrbEnv (Private, Trb);
+        if (!EFI_ERROR (Status)) {
+          Trb->Started = TRUE;
+          Status       = SdMmcExecTrb (Private, Trb);
+          if (EFI_ERROR (Status)) {
+            goto Done;
+          }
+        } else {
           goto Done;
         }
-      } else {
-        goto Done;
       }
-    }
 
-    Status = SdMmcCheckTrbResult (Private, Trb);
-  }
+      Status = SdMmcCheckTrbResult (Private, Trb);
+    }
 
 Done:
-  if ((Trb != NULL) && (Status == EFI_NOT_READY)) {
-    Packet = Trb->Packet;
-    if (Packet->Timeout == 0) {
-      InfiniteWait = TRUE;
-    } else {
-      InfiniteWait = FALSE;
+    if (Trb == NULL) {
+      return;
     }
 
-    if ((!InfiniteWait) && (Trb->Timeout-- == 0)) {
+    if (Status == EFI_NOT_READY) {
+      Packet = Trb->Packet;
+      if (Packet->Timeout == 0) {
+        InfiniteWait = TRUE;
+      } else {
+        InfiniteWait = FALSE;
+      }
+
+      if ((!InfiniteWait) && (Trb->Timeout-- == 0)) {
+        RemoveEntryList (Link);
+        Trb->Packet->TransactionStatus = EFI_TIMEOUT;
+        TrbEvent                       = Trb->Event;
+        SdMmcFreeTrb (Trb);
+        DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p EFI_TIMEOUT\n", TrbEvent));
+        gBS->SignalEvent (TrbEvent);
+        continue;
+      }
+
+      //
+      // The TRB is still executing; check it again on the next tick.
+      //
+      return;
+    } else if ((Status == EFI_CRC_ERROR) && (Trb->Retries > 0)) {
+      //
+      // Reissue the TRB right away instead of waiting for the next tick.
+      //
+      Trb->Retries--;
+      Trb->Started = FALSE;
+    } else {
       RemoveEntryList (Link);
-      Trb->Packet->TransactionStatus = EFI_TIMEOUT;
+      Trb->Packet->TransactionStatus = Status;
       TrbEvent                       = Trb->Event;
       SdMmcFreeTrb (Trb);
-      DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p EFI_TIMEOUT\n", TrbEvent));
+      DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p with %r\n", TrbEvent, Status));
       gBS->SignalEvent (TrbEvent);
-      return;
     }
-  } else if ((Trb != NULL) && (Status == EFI_CRC_ERROR) && (Trb->Retries > 0)) {
-    Trb->Retries--;
-    Trb->Started = FALSE;
-  } else if ((Trb != NULL)) {
-    RemoveEntryList (Link);
-    Trb->Packet->TransactionStatus = Status;
-    TrbEvent                       = Trb->Event;
-    SdMmcFreeTrb (Trb);
-    DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p with %r\n", TrbEvent, Status));
-    gBS->SignalEvent (TrbEvent);
   }
-
-  return;
 }
 
 /**
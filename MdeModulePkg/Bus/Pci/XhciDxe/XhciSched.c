@@ -1086,6 +1086,11 @@ IsAsyncIntTrb (
   Check the URB's execution result and update the URB's
   result accordingly.
 
+  All new events on the event ring are processed, so the result of every
+  asynchronous URB matched by a dequeued transfer event is updated as well.
+  Urb may be NULL to only perform such a sweep of the event ring without
+  tracking a specific URB.
+
   @param  Xhc             The XHCI Instance.
   @param  Urb             The URB to check result.
 
@@ -1095,7 +1100,7 @@ IsAsyncIntTrb (
 BOOLEAN
 XhcCheckUrbResult (
   IN  USB_XHCI_INSTANCE  *Xhc,
-  IN  URB                *Urb
+  IN  URB                *Urb        OPTIONAL
   )
 {
   EVT_TRB_TRANSFER      *EvtTrb;
@@ -1110,19 +1115,22 @@ XhcCheckUrbResult (
   UINT32                Low;
   EFI_PHYSICAL_ADDRESS  PhyAddr;
 
-  ASSERT ((Xhc != NULL) && (Urb != NULL));
+  ASSERT (Xhc != NULL);
 
   Status   = EFI_SUCCESS;
   AsyncUrb = NULL;
 
-  if (Urb->Finished) {
+  if ((Urb != NULL) && Urb->Finished) {
     goto EXIT;
   }
 
   EvtTrb = NULL;
 
   if (XhcIsHalt (Xhc) || XhcIsSysError (Xhc)) {
-    Urb->Result |= EFI_USB_ERR_SYSTEM;
+    if (Urb != NULL) {
+      Urb->Result |= EFI_USB_ERR_SYSTEM;
+    }
+
     goto EXIT;
   }
 
@@ -1160,7 +1168,7 @@ XhcCheckUrbResult (
     //
     if ((Xhc->PendingUrb != NULL) && IsTransferRingTrb (Xhc, TRBPtr, Xhc->PendingUrb)) {
       CheckedUrb = Xhc->PendingUrb;
-    } else if (IsTransferRingTrb (Xhc, TRBPtr, Urb)) {
+    } else if ((Urb != NULL) && IsTransferRingTrb (Xhc, TRBPtr, Urb)) {
       CheckedUrb = Urb;
     } else if (IsAsyncIntTrb (Xhc, TRBPtr, &AsyncUrb)) {
       CheckedUrb = AsyncUrb;
@@ -1266,7 +1274,7 @@ EXIT:
     XhcWriteRuntimeReg (Xhc, XHC_ERDP_OFFSET + 4, XHC_HIGH_32BIT (PhyAddr));
   }
 
-  return Urb->Finished;
+  return (BOOLEAN)((Urb != NULL) && Urb->Finished);
 }
 
 /**
@@ -1636,6 +1644,15 @@ XhcMonitorAsyncRequests (
 
   Xhc = (USB_XHCI_INSTANCE *)Context;
 
+  //
+  // Sweep the event ring once per tick for all queued asynchronous
+  // transfers, instead of once per transfer. XhcCheckUrbResult updates
+  // every asynchronous URB matched by the transfer events it dequeues, so
+  // checking each URB's Finished flag below requires no further register
+  // or event ring access.
+  //
+  XhcCheckUrbResult (Xhc, NULL);
+
   BASE_LIST_FOR_EACH_SAFE (Entry, Next, &Xhc->AsyncIntTransfers) {
     Urb = EFI_LIST_CONTAINER (Entry, URB, UrbList);
 
@@ -1647,16 +1664,19 @@ XhcMonitorAsyncRequests (
       continue;
     }
 
-    //
-    // Check the result of URB execution. If it is still
-    // active, check the next one.
-    //
-    XhcCheckUrbResult (Xhc, Urb);
-
     if (!Urb->Finished) {
       continue;
     }
 
+    Urb->AsyncCompletions++;
+    DEBUG ((
+      DEBUG_VERBOSE,
+      "XhcMonitorAsyncRequests: addr %d ep 0x%x completed %Lu interrupt polls\n",
+      Urb->Ep.BusAddr,
+      Urb->Ep.EpAddr,
+      Urb->AsyncCompletions
+      ));
+
     //
     // Flush any PCI posted write transactions from a PCI host
     // bridge to system memory.
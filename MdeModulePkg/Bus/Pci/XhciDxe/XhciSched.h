@@ -191,6 +191,12 @@ typedef struct _URB {
   BOOLEAN                            StartDone;
   BOOLEAN                            EndDone;
   BOOLEAN                            Finished;
+  //
+  // Number of completions delivered for an asynchronous interrupt
+  // transfer, reported with DEBUG_VERBOSE to show which endpoints keep
+  // the periodic check busy.
+  //
+  UINT64                             AsyncCompletions;
 
   TRB_TEMPLATE                       *EvtTrb;
 } URB;
@@ -3765,8 +3765,6 @@ ScsiDiskAsyncReadSectors (
   InsertTailList (&ScsiDiskDevice->AsyncTaskQueue, &BlkIo2Req->Link);
   gBS->RestoreTPL (OldTpl);
 
-  InitializeListHead (&BlkIo2Req->ScsiRWQueue);
-
   Status = EFI_SUCCESS;
 
   BlocksRemaining = NumberOfBlocks;
@@ -3872,7 +3870,7 @@ ScsiDiskAsyncReadSectors (
       }
 
       OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-      if (IsListEmpty (&BlkIo2Req->ScsiRWQueue)) {
+      if (BlkIo2Req->OutstandingScsiRW == 0) {
         //
         // Free the SCSI_BLKIO2_REQUEST structure only when there is no other
         // SCSI sub-task running. Otherwise, it will be freed in the callback
@@ -3919,7 +3917,7 @@ Done:
     BlkIo2Req->LastScsiRW = TRUE;
 
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-    if (IsListEmpty (&BlkIo2Req->ScsiRWQueue)) {
+    if (BlkIo2Req->OutstandingScsiRW == 0) {
       RemoveEntryList (&BlkIo2Req->Link);
       FreePool (BlkIo2Req);
       BlkIo2Req = NULL;
@@ -3983,8 +3981,6 @@ ScsiDiskAsyncWriteSectors (
   InsertTailList (&ScsiDiskDevice->AsyncTaskQueue, &BlkIo2Req->Link);
   gBS->RestoreTPL (OldTpl);
 
-  InitializeListHead (&BlkIo2Req->ScsiRWQueue);
-
   Status = EFI_SUCCESS;
 
   BlocksRemaining = NumberOfBlocks;
@@ -4090,7 +4086,7 @@ ScsiDiskAsyncWriteSectors (
       }
 
       OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-      if (IsListEmpty (&BlkIo2Req->ScsiRWQueue)) {
+      if (BlkIo2Req->OutstandingScsiRW == 0) {
         //
         // Free the SCSI_BLKIO2_REQUEST structure only when there is no other
         // SCSI sub-task running. Otherwise, it will be freed in the callback
@@ -4137,7 +4133,7 @@ Done:
     BlkIo2Req->LastScsiRW = TRUE;
 
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-    if (IsListEmpty (&BlkIo2Req->ScsiRWQueue)) {
+    if (BlkIo2Req->OutstandingScsiRW == 0) {
       RemoveEntryList (&BlkIo2Req->Link);
       FreePool (BlkIo2Req);
       BlkIo2Req = NULL;
@@ -4913,13 +4909,20 @@ Retry:
   }
 
 Exit:
-  RemoveEntryList (&Request->Link);
-  if ((IsListEmpty (&Request->BlkIo2Req->ScsiRWQueue)) &&
+  Request->BlkIo2Req->OutstandingScsiRW--;
+  ScsiDiskDevice->BlkIo2Outstanding--;
+  if ((Request->BlkIo2Req->OutstandingScsiRW == 0) &&
       (Request->BlkIo2Req->LastScsiRW))
   {
     //
     // The last SCSI R/W command of a BlockIo2 request completes
     //
+    DEBUG ((
+      DEBUG_VERBOSE,
+      "ScsiDiskNotify: BlockIo2 request done, target sub-tasks %Lu, peak in flight %Lu\n",
+      ScsiDiskDevice->BlkIo2SubtaskCount,
+      ScsiDiskDevice->BlkIo2OutstandingPeak
+      ));
     RemoveEntryList (&Request->BlkIo2Req->Link);
     FreePool (Request->BlkIo2Req);  // Should be freed only once
     gBS->SignalEvent (Token->Event);
@@ -4975,7 +4978,13 @@ ScsiDiskAsyncRead10 (
   }
 
   OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-  InsertTailList (&BlkIo2Req->ScsiRWQueue, &Request->Link);
+  BlkIo2Req->OutstandingScsiRW++;
+  ScsiDiskDevice->BlkIo2SubtaskCount++;
+  ScsiDiskDevice->BlkIo2Outstanding++;
+  if (ScsiDiskDevice->BlkIo2Outstanding > ScsiDiskDevice->BlkIo2OutstandingPeak) {
+    ScsiDiskDevice->BlkIo2OutstandingPeak = ScsiDiskDevice->BlkIo2Outstanding;
+  }
+
   gBS->RestoreTPL (OldTpl);
 
   Request->SenseDataLength = (UINT8)(6 * sizeof (EFI_SCSI_SENSE_DATA));
@@ -5038,7 +5047,8 @@ ErrorExit:
     }
 
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-    RemoveEntryList (&Request->Link);
+    BlkIo2Req->OutstandingScsiRW--;
+    ScsiDiskDevice->BlkIo2Outstanding--;
     gBS->RestoreTPL (OldTpl);
 
     FreePool (Request);
@@ -5093,7 +5103,13 @@ ScsiDiskAsyncWrite10 (
   }
 
   OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-  InsertTailList (&BlkIo2Req->ScsiRWQueue, &Request->Link);
+  BlkIo2Req->OutstandingScsiRW++;
+  ScsiDiskDevice->BlkIo2SubtaskCount++;
+  ScsiDiskDevice->BlkIo2Outstanding++;
+  if (ScsiDiskDevice->BlkIo2Outstanding > ScsiDiskDevice->BlkIo2OutstandingPeak) {
+    ScsiDiskDevice->BlkIo2OutstandingPeak = ScsiDiskDevice->BlkIo2Outstanding;
+  }
+
   gBS->RestoreTPL (OldTpl);
 
   Request->SenseDataLength = (UINT8)(6 * sizeof (EFI_SCSI_SENSE_DATA));
@@ -5156,7 +5172,8 @@ ErrorExit:
     }
 
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-    RemoveEntryList (&Request->Link);
+    BlkIo2Req->OutstandingScsiRW--;
+    ScsiDiskDevice->BlkIo2Outstanding--;
     gBS->RestoreTPL (OldTpl);
 
     FreePool (Request);
@@ -5211,7 +5228,13 @@ ScsiDiskAsyncRead16 (
   }
 
   OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-  InsertTailList (&BlkIo2Req->ScsiRWQueue, &Request->Link);
+  BlkIo2Req->OutstandingScsiRW++;
+  ScsiDiskDevice->BlkIo2SubtaskCount++;
+  ScsiDiskDevice->BlkIo2Outstanding++;
+  if (ScsiDiskDevice->BlkIo2Outstanding > ScsiDiskDevice->BlkIo2OutstandingPeak) {
+    ScsiDiskDevice->BlkIo2OutstandingPeak = ScsiDiskDevice->BlkIo2Outstanding;
+  }
+
   gBS->RestoreTPL (OldTpl);
 
   Request->SenseDataLength = (UINT8)(6 * sizeof (EFI_SCSI_SENSE_DATA));
@@ -5274,7 +5297,8 @@ ErrorExit:
     }
 
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-    RemoveEntryList (&Request->Link);
+    BlkIo2Req->OutstandingScsiRW--;
+    ScsiDiskDevice->BlkIo2Outstanding--;
     gBS->RestoreTPL (OldTpl);
 
     FreePool (Request);
@@ -5329,7 +5353,13 @@ ScsiDiskAsyncWrite16 (
   }
 
   OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-  InsertTailList (&BlkIo2Req->ScsiRWQueue, &Request->Link);
+  BlkIo2Req->OutstandingScsiRW++;
+  ScsiDiskDevice->BlkIo2SubtaskCount++;
+  ScsiDiskDevice->BlkIo2Outstanding++;
+  if (ScsiDiskDevice->BlkIo2Outstanding > ScsiDiskDevice->BlkIo2OutstandingPeak) {
+    ScsiDiskDevice->BlkIo2OutstandingPeak = ScsiDiskDevice->BlkIo2Outstanding;
+  }
+
   gBS->RestoreTPL (OldTpl);
 
   Request->SenseDataLength = (UINT8)(6 * sizeof (EFI_SCSI_SENSE_DATA));
@@ -5392,7 +5422,8 @@ ErrorExit:
     }
 
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
-    RemoveEntryList (&Request->Link);
+    BlkIo2Req->OutstandingScsiRW--;
+    ScsiDiskDevice->BlkIo2Outstanding--;
     gBS->RestoreTPL (OldTpl);
 
     FreePool (Request);
@@ -94,6 +94,15 @@ typedef struct {
   // The queue for asynchronous task requests
   //
   LIST_ENTRY                               AsyncTaskQueue;
+
+  //
+  // Statistics of the BlockIo2 SCSI Read/Write sub-tasks issued to this
+  // target. They are updated at TPL_NOTIFY and reported with DEBUG_VERBOSE
+  // when a BlockIo2 request completes.
+  //
+  UINT64                                   BlkIo2Outstanding;
+  UINT64                                   BlkIo2OutstandingPeak;
+  UINT64                                   BlkIo2SubtaskCount;
 } SCSI_DISK_DEV;
 
 #define SCSI_DISK_DEV_FROM_BLKIO(a)     CR (a, SCSI_DISK_DEV, BlkIo, SCSI_DISK_DEV_SIGNATURE)
@@ -118,9 +127,11 @@ typedef struct {
   BOOLEAN                LastScsiRW;
 
   //
-  // The queue for Scsi Read/Write sub-tasks of a BlockIo2 request
+  // Number of Scsi Read/Write sub-tasks of a BlockIo2 request still in
+  // flight. The request completes when the count drops to zero after the
+  // last sub-task has been sent.
   //
-  LIST_ENTRY             ScsiRWQueue;
+  UINTN                  OutstandingScsiRW;
 
   LIST_ENTRY             Link;
 } SCSI_BLKIO2_REQUEST;
@@ -146,8 +157,6 @@ typedef struct {
   // The BlockIo2 request this SCSI command belongs to
   //
   SCSI_BLKIO2_REQUEST    *BlkIo2Req;
-
-  LIST_ENTRY             Link;
 } SCSI_ASYNC_RW_REQUEST;
 
 //
@@ -75,6 +75,13 @@ typedef struct _UFS_PASS_THRU_PRIVATE_DATA {
   //
   EFI_EVENT                             TimerEvent;
   LIST_ENTRY                            Queue;
+  //
+  // Bitmap of task slots owned by issued requests. A slot stays owned until
+  // its request is retired, so a slot whose doorbell bit has already been
+  // cleared by the host controller cannot be recycled before the completed
+  // request is signaled.
+  //
+  UINT32                                SlotsInUse;
 } UFS_PASS_THRU_PRIVATE_DATA;
 
 #define UFS_PASS_THRU_TRANS_REQ_SIG  SIGNATURE_32 ('U', 'F', 'S', 'T')
@@ -84,6 +91,7 @@ typedef struct {
   LIST_ENTRY                                    TransferList;
 
   UINT8                                         Slot;
+  BOOLEAN                                       IsStarted;
   UTP_TRD                                       *Trd;
   UINT32                                        CmdDescSize;
   VOID                                          *CmdDescHost;
@@ -93,6 +101,7 @@ typedef struct {
   VOID                                          *DataBufMapping;
 
   EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET    *Packet;
+  UINT8                                         Lun;
   UINT64                                        TimeoutRemain;
   EFI_EVENT                                     CallerEvent;
 } UFS_PASS_THRU_TRANS_REQ;
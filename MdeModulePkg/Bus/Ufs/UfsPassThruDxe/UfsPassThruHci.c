@@ -732,6 +732,13 @@ UfsFindAvailableSlotInTrl (
     return Status;
   }
 
+  //
+  // Skip slots still owned by the driver even if the host controller has
+  // already cleared their doorbell bits: a completed asynchronous request
+  // keeps its slot until it is retired from the async I/O queue.
+  //
+  Data |= Private->SlotsInUse;
+
   Nutrs = (UINT8)((Private->UfsHcInfo.Capabilities & UFS_HC_CAP_NUTRS) + 1);
 
   for (Index = 0; Index < Nutrs; Index++) {
@@ -745,17 +752,73 @@ UfsFindAvailableSlotInTrl (
 }
 
 /**
-  Start specified slot in transfer list of a UFS device.
+  Reserve an available slot in transfer list of a UFS device.
+
+  The reservation is made at TPL_NOTIFY so that the timer callback which
+  submits deferred requests cannot claim the same slot.
 
   @param[in]  Private       The pointer to the UFS_PASS_THRU_PRIVATE_DATA data structure.
-  @param[in]  Slot          The slot to be started.
+  @param[out] Slot          The reserved slot.
+
+  @retval EFI_SUCCESS       An available slot was reserved successfully.
+  @retval EFI_NOT_READY     No slot is available at this moment.
 
 **/
 EFI_STATUS
-UfsStartExecCmd (
+UfsClaimSlotInTrl (
+  IN     UFS_PASS_THRU_PRIVATE_DATA  *Private,
+  OUT UINT8                          *Slot
+  )
+{
+  EFI_TPL     OldTpl;
+  EFI_STATUS  Status;
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  Status = UfsFindAvailableSlotInTrl (Private, Slot);
+  if (!EFI_ERROR (Status)) {
+    Private->SlotsInUse |= (UINT32)(BIT0 << *Slot);
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  return Status;
+}
+
+/**
+  Release a slot reserved by UfsClaimSlotInTrl().
+
+  @param[in]  Private       The pointer to the UFS_PASS_THRU_PRIVATE_DATA data structure.
+  @param[in]  Slot          The slot to be released.
+
+**/
+VOID
+UfsReleaseSlotInTrl (
   IN  UFS_PASS_THRU_PRIVATE_DATA  *Private,
   IN  UINT8                       Slot
   )
+{
+  EFI_TPL  OldTpl;
+
+  OldTpl               = gBS->RaiseTPL (TPL_NOTIFY);
+  Private->SlotsInUse &= ~(UINT32)(BIT0 << Slot);
+  gBS->RestoreTPL (OldTpl);
+}
+
+/**
+  Start specified slots in transfer list of a UFS device.
+
+  The doorbell bits of all specified slots are set with one register write, so
+  several pending transfer requests can be handed to the device together.
+
+  @param[in]  Private       The pointer to the UFS_PASS_THRU_PRIVATE_DATA data structure.
+  @param[in]  SlotsMask     Bitmap of the slots to be started.
+
+**/
+EFI_STATUS
+UfsStartExecCmds (
+  IN  UFS_PASS_THRU_PRIVATE_DATA  *Private,
+  IN  UINT32                      SlotsMask
+  )
 {
   UINT32      Data;
   EFI_STATUS  Status;
@@ -772,7 +835,7 @@ UfsStartExecCmd (
     }
   }
 
-  Status = UfsMmioWrite32 (Private, UFS_HC_UTRLDBR_OFFSET, BIT0 << Slot);
+  Status = UfsMmioWrite32 (Private, UFS_HC_UTRLDBR_OFFSET, SlotsMask);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -780,6 +843,22 @@ UfsStartExecCmd (
   return EFI_SUCCESS;
 }
 
+/**
+  Start specified slot in transfer list of a UFS device.
+
+  @param[in]  Private       The pointer to the UFS_PASS_THRU_PRIVATE_DATA data structure.
+  @param[in]  Slot          The slot to be started.
+
+**/
+EFI_STATUS
+UfsStartExecCmd (
+  IN  UFS_PASS_THRU_PRIVATE_DATA  *Private,
+  IN  UINT8                       Slot
+  )
+{
+  return UfsStartExecCmds (Private, (UINT32)(BIT0 << Slot));
+}
+
 /**
   Stop specified slot in transfer list of a UFS device.
 
@@ -910,9 +989,9 @@ UfsSendDmRequestRetry (
   EFI_STATUS                          Status;
 
   //
-  // Find out which slot of transfer request list is available.
+  // Reserve an available slot of transfer request list.
   //
-  Status = UfsFindAvailableSlotInTrl (Private, &Slot);
+  Status = UfsClaimSlotInTrl (Private, &Slot);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -924,6 +1003,7 @@ UfsSendDmRequestRetry (
   Status = UfsCreateDMCommandDesc (Private, Packet, Trd, &CmdDescHost, &CmdDescMapping);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "Failed to create DM command descriptor\n"));
+    UfsReleaseSlotInTrl (Private, Slot);
     return Status;
   }
 
@@ -972,6 +1052,8 @@ Exit:
 
   UfsStopExecCmd (Private, Slot);
 
+  UfsReleaseSlotInTrl (Private, Slot);
+
   if (CmdDescMapping != NULL) {
     UfsHc->Unmap (UfsHc, CmdDescMapping);
   }
@@ -1265,9 +1347,9 @@ UfsExecNopCmds (
   EDKII_UFS_HOST_CONTROLLER_PROTOCOL  *UfsHc;
 
   //
-  // Find out which slot of transfer request list is available.
+  // Reserve an available slot of transfer request list.
   //
-  Status = UfsFindAvailableSlotInTrl (Private, &Slot);
+  Status = UfsClaimSlotInTrl (Private, &Slot);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -1275,6 +1357,7 @@ UfsExecNopCmds (
   Trd    = ((UTP_TRD *)Private->UtpTrlBase) + Slot;
   Status = UfsCreateNopCommandDesc (Private, Trd, &CmdDescHost, &CmdDescMapping);
   if (EFI_ERROR (Status)) {
+    UfsReleaseSlotInTrl (Private, Slot);
     return Status;
   }
 
@@ -1310,6 +1393,8 @@ Exit:
 
   UfsStopExecCmd (Private, Slot);
 
+  UfsReleaseSlotInTrl (Private, Slot);
+
   if (CmdDescMapping != NULL) {
     UfsHc->Unmap (UfsHc, CmdDescMapping);
   }
@@ -1464,6 +1549,96 @@ UfsPrepareDataTransferBuffer (
   return EFI_SUCCESS;
 }
 
+/**
+  Claim a slot in the transfer request list and issue a transfer request.
+
+  The slot is reserved at TPL_NOTIFY so that the timer driven submission of
+  deferred requests cannot pick the same slot. When RingDoorbell is FALSE the
+  doorbell register is left untouched and the caller is responsible for
+  starting the slot, which allows several requests to be started with a
+  single doorbell write.
+
+  @param[in]      Private       The pointer to the UFS_PASS_THRU_PRIVATE_DATA data structure.
+  @param[in, out] TransReq      The pointer to the transfer request to be issued.
+  @param[in]      RingDoorbell  TRUE to start the slot immediately.
+
+  @retval EFI_SUCCESS       The transfer request was issued successfully.
+  @retval EFI_NOT_READY     No slot is available at this moment.
+  @retval Others            Failed to issue the transfer request.
+
+**/
+EFI_STATUS
+UfsSubmitTransReq (
+  IN     UFS_PASS_THRU_PRIVATE_DATA  *Private,
+  IN OUT UFS_PASS_THRU_TRANS_REQ     *TransReq,
+  IN     BOOLEAN                     RingDoorbell
+  )
+{
+  EFI_STATUS                          Status;
+  EDKII_UFS_HOST_CONTROLLER_PROTOCOL  *UfsHc;
+
+  UfsHc = Private->UfsHostController;
+
+  //
+  // Reserve an available slot of transfer request list before the transfer
+  // request descriptor is built.
+  //
+  Status = UfsClaimSlotInTrl (Private, &TransReq->Slot);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  TransReq->Trd = ((UTP_TRD *)Private->UtpTrlBase) + TransReq->Slot;
+
+  //
+  // Fill transfer request descriptor to this slot.
+  //
+  Status = UfsCreateScsiCommandDesc (
+             Private,
+             TransReq->Lun,
+             TransReq->Packet,
+             TransReq->Trd,
+             &TransReq->CmdDescHost,
+             &TransReq->CmdDescMapping
+             );
+  if (EFI_ERROR (Status)) {
+    goto Error;
+  }
+
+  TransReq->CmdDescSize = TransReq->Trd->PrdtO * sizeof (UINT32) + TransReq->Trd->PrdtL * sizeof (UTP_TR_PRD);
+
+  Status = UfsPrepareDataTransferBuffer (Private, TransReq);
+  if (EFI_ERROR (Status)) {
+    goto Error;
+  }
+
+  TransReq->IsStarted = TRUE;
+
+  //
+  // Start to execute the transfer request.
+  //
+  if (RingDoorbell) {
+    UfsStartExecCmd (Private, TransReq->Slot);
+  }
+
+  return EFI_SUCCESS;
+
+Error:
+  if (TransReq->CmdDescMapping != NULL) {
+    UfsHc->Unmap (UfsHc, TransReq->CmdDescMapping);
+    TransReq->CmdDescMapping = NULL;
+  }
+
+  if (TransReq->CmdDescHost != NULL) {
+    UfsHc->FreeBuffer (UfsHc, EFI_SIZE_TO_PAGES (TransReq->CmdDescSize), TransReq->CmdDescHost);
+    TransReq->CmdDescHost = NULL;
+  }
+
+  UfsReleaseSlotInTrl (Private, TransReq->Slot);
+
+  return Status;
+}
+
 /**
   Sends a UFS-supported SCSI Request Packet to a UFS device that is attached to the UFS host controller.
 
@@ -1512,60 +1687,38 @@ UfsExecScsiCmds (
   TransReq->Signature     = UFS_PASS_THRU_TRANS_REQ_SIG;
   TransReq->TimeoutRemain = Packet->Timeout;
   TransReq->Packet        = Packet;
+  TransReq->Lun           = Lun;
 
   UfsHc = Private->UfsHostController;
-  //
-  // Find out which slot of transfer request list is available.
-  //
-  Status = UfsFindAvailableSlotInTrl (Private, &TransReq->Slot);
-  if (EFI_ERROR (Status)) {
-    return Status;
-  }
-
-  TransReq->Trd = ((UTP_TRD *)Private->UtpTrlBase) + TransReq->Slot;
-
-  //
-  // Fill transfer request descriptor to this slot.
-  //
-  Status = UfsCreateScsiCommandDesc (
-             Private,
-             Lun,
-             Packet,
-             TransReq->Trd,
-             &TransReq->CmdDescHost,
-             &TransReq->CmdDescMapping
-             );
-  if (EFI_ERROR (Status)) {
-    return Status;
-  }
-
-  TransReq->CmdDescSize = TransReq->Trd->PrdtO * sizeof (UINT32) + TransReq->Trd->PrdtL * sizeof (UTP_TR_PRD);
-
-  Status = UfsPrepareDataTransferBuffer (Private, TransReq);
-  if (EFI_ERROR (Status)) {
-    goto Exit1;
-  }
 
   //
-  // Insert the async SCSI cmd to the Async I/O list
+  // Queue the async SCSI cmd to the Async I/O list and issue it right away
+  // when a slot of the transfer request list is available. When all slots
+  // are busy the request stays queued unissued and is submitted by the timer
+  // callback once outstanding requests retire.
   //
   if (Event != NULL) {
     OldTpl                = gBS->RaiseTPL (TPL_NOTIFY);
     TransReq->CallerEvent = Event;
+    Status                = UfsSubmitTransReq (Private, TransReq, TRUE);
+    if (EFI_ERROR (Status) && (Status != EFI_NOT_READY)) {
+      gBS->RestoreTPL (OldTpl);
+      FreePool (TransReq);
+      return Status;
+    }
+
     InsertTailList (&Private->Queue, &TransReq->TransferList);
     gBS->RestoreTPL (OldTpl);
+    return EFI_SUCCESS;
   }
 
   //
-  // Start to execute the transfer request.
-  //
-  UfsStartExecCmd (Private, TransReq->Slot);
-
-  //
-  // Immediately return for async I/O.
+  // Issue the blocking SCSI cmd.
   //
-  if (Event != NULL) {
-    return EFI_SUCCESS;
+  Status = UfsSubmitTransReq (Private, TransReq, TRUE);
+  if (EFI_ERROR (Status)) {
+    FreePool (TransReq);
+    return Status;
   }
 
   //
@@ -1631,7 +1784,8 @@ Exit:
 
   UfsReconcileDataTransferBuffer (Private, TransReq);
 
-Exit1:
+  UfsReleaseSlotInTrl (Private, TransReq->Slot);
+
   if (TransReq->CmdDescMapping != NULL) {
     UfsHc->Unmap (UfsHc, TransReq->CmdDescMapping);
   }
@@ -2243,9 +2397,16 @@ SignalCallerEvent (
 
   RemoveEntryList (&TransReq->TransferList);
 
-  UfsHc->Flush (UfsHc);
+  //
+  // A request still waiting for a free slot owns no hardware resources yet.
+  //
+  if (TransReq->IsStarted) {
+    UfsHc->Flush (UfsHc);
 
-  UfsStopExecCmd (Private, TransReq->Slot);
+    UfsStopExecCmd (Private, TransReq->Slot);
+
+    UfsReleaseSlotInTrl (Private, TransReq->Slot);
+  }
 
   UfsReconcileDataTransferBuffer (Private, TransReq);
 
@@ -2290,6 +2451,7 @@ ProcessAsyncTaskList (
   UINT16                                      SenseDataLen;
   UINT32                                      ResTranCount;
   UINT32                                      SlotsMap;
+  UINT32                                      PendingSlots;
   UINT32                                      Value;
   EFI_STATUS                                  Status;
 
@@ -2304,6 +2466,22 @@ ProcessAsyncTaskList (
       TransReq = UFS_PASS_THRU_TRANS_REQ_FROM_THIS (Entry);
       Packet   = TransReq->Packet;
 
+      //
+      // Requests still waiting for a free slot are handled by the submission
+      // pass below; the time spent waiting counts against their timeout.
+      //
+      if (!TransReq->IsStarted) {
+        if (TransReq->TimeoutRemain > UFS_HC_ASYNC_TIMER) {
+          TransReq->TimeoutRemain -= UFS_HC_ASYNC_TIMER;
+        } else {
+          Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_TIMEOUT_COMMAND;
+          DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p EFI_TIMEOUT.\n", TransReq->CallerEvent));
+          SignalCallerEvent (Private, TransReq);
+        }
+
+        continue;
+      }
+
       if ((SlotsMap & (BIT0 << TransReq->Slot)) != 0) {
         return;
       }
@@ -2396,6 +2574,39 @@ ProcessAsyncTaskList (
       }
     }
   }
+
+  //
+  // Submit the requests which were queued while all slots were busy, ringing
+  // the doorbell once for all of them.
+  //
+  PendingSlots = 0;
+  BASE_LIST_FOR_EACH_SAFE (Entry, NextEntry, &Private->Queue) {
+    TransReq = UFS_PASS_THRU_TRANS_REQ_FROM_THIS (Entry);
+    if (TransReq->IsStarted) {
+      continue;
+    }
+
+    Status = UfsSubmitTransReq (Private, TransReq, FALSE);
+    if (Status == EFI_NOT_READY) {
+      //
+      // Keep the queue order: later requests must not overtake this one.
+      //
+      break;
+    }
+
+    if (EFI_ERROR (Status)) {
+      TransReq->Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_PHASE_ERROR;
+      DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p Submit Error.\n", TransReq->CallerEvent));
+      SignalCallerEvent (Private, TransReq);
+      continue;
+    }
+
+    PendingSlots |= BIT0 << TransReq->Slot;
+  }
+
+  if (PendingSlots != 0) {
+    UfsStartExecCmds (Private, PendingSlots);
+  }
 }
 
 /**
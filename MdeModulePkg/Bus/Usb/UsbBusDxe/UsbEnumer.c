@@ -652,6 +652,9 @@ UsbFindChild (
   @param  HubIf                 The HUB that has the device connected.
   @param  Port                  The port index of the hub (started with zero).
   @param  ResetIsNeeded         The boolean to control whether skip the reset of the port.
+  @param  DebounceIsNeeded      The boolean to control whether skip the connect
+                                debounce wait, because the enumeration sweep has
+                                already waited it out for this port.
 
   @retval EFI_SUCCESS           The device is enumerated (added or removed).
   @retval EFI_OUT_OF_RESOURCES  Failed to allocate resource for the device.
@@ -662,7 +665,8 @@ EFI_STATUS
 UsbEnumerateNewDev (
   IN USB_INTERFACE  *HubIf,
   IN UINT8          Port,
-  IN BOOLEAN        ResetIsNeeded
+  IN BOOLEAN        ResetIsNeeded,
+  IN BOOLEAN        DebounceIsNeeded
   )
 {
   USB_BUS              *Bus;
@@ -679,7 +683,9 @@ UsbEnumerateNewDev (
   HubApi  = HubIf->HubApi;
   Address = Bus->MaxDevices;
 
-  gBS->Stall (USB_WAIT_PORT_STABLE_STALL);
+  if (DebounceIsNeeded) {
+    gBS->Stall (USB_WAIT_PORT_STABLE_STALL);
+  }
 
   //
   // Hub resets the device for at least 10 milliseconds.
@@ -880,6 +886,10 @@ ON_ERROR:
 
   @param  HubIf                 The HUB that has the device connected.
   @param  Port                  The port index of the hub (started with zero).
+  @param  DebounceIsNeeded      The boolean to control whether skip the connect
+                                debounce wait for a newly connected device,
+                                because the enumeration sweep has already
+                                waited it out for this port.
 
   @retval EFI_SUCCESS           The device is enumerated (added or removed).
   @retval EFI_OUT_OF_RESOURCES  Failed to allocate resource for the device.
@@ -889,7 +899,8 @@ ON_ERROR:
 EFI_STATUS
 UsbEnumeratePort (
   IN USB_INTERFACE  *HubIf,
-  IN UINT8          Port
+  IN UINT8          Port,
+  IN BOOLEAN        DebounceIsNeeded
   )
 {
   USB_HUB_API          *HubApi;
@@ -988,9 +999,9 @@ UsbEnumeratePort (
     //
     DEBUG ((DEBUG_INFO, "UsbEnumeratePort: new device connected at port %d\n", Port));
     if (USB_BIT_IS_SET (PortState.PortChangeStatus, USB_PORT_STAT_C_RESET)) {
-      Status = UsbEnumerateNewDev (HubIf, Port, FALSE);
+      Status = UsbEnumerateNewDev (HubIf, Port, FALSE, DebounceIsNeeded);
     } else {
-      Status = UsbEnumerateNewDev (HubIf, Port, TRUE);
+      Status = UsbEnumerateNewDev (HubIf, Port, TRUE, DebounceIsNeeded);
     }
   } else {
     DEBUG ((DEBUG_INFO, "UsbEnumeratePort: device disconnected event on port %d\n", Port));
@@ -1000,6 +1011,36 @@ UsbEnumeratePort (
   return Status;
 }
 
+/**
+  Check whether a new device is connected on the port and still needs the
+  connect debounce wait.
+
+  @param  HubIf                 The HUB that has the device connected.
+  @param  Port                  The port index of the hub (started with zero).
+
+  @retval TRUE                  A newly connected device is present on the port.
+  @retval FALSE                 No newly connected device is present on the port.
+
+**/
+BOOLEAN
+UsbPortConnectIsNew (
+  IN USB_INTERFACE  *HubIf,
+  IN UINT8          Port
+  )
+{
+  EFI_USB_PORT_STATUS  PortState;
+  EFI_STATUS           Status;
+
+  Status = HubIf->HubApi->GetPortStatus (HubIf, Port, &PortState);
+
+  if (EFI_ERROR (Status)) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)(USB_BIT_IS_SET (PortState.PortChangeStatus, USB_PORT_STAT_C_CONNECTION) &&
+                   USB_BIT_IS_SET (PortState.PortStatus, USB_PORT_STAT_CONNECTION));
+}
+
 /**
   Enumerate all the changed hub ports.
 
@@ -1019,6 +1060,8 @@ UsbHubEnumeration (
   UINT8          Bit;
   UINT8          Index;
   USB_DEVICE     *Child;
+  UINT8          DebounceMap[32];
+  BOOLEAN        DebounceIsDone;
 
   ASSERT (Context != NULL);
 
@@ -1036,15 +1079,45 @@ UsbHubEnumeration (
     return;
   }
 
+  //
+  // Find the ports with a newly connected device first, then wait the
+  // connect debounce time once for all of them together. Enumerating the
+  // ports serially afterwards can skip the per-port debounce wait, which
+  // otherwise adds up through a deep hub tree.
   //
   // HUB starts its port index with 1.
   //
+  ZeroMem (DebounceMap, sizeof (DebounceMap));
+  DebounceIsDone = FALSE;
+
+  Byte = 0;
+  Bit  = 1;
+
+  for (Index = 0; Index < HubIf->NumOfPort; Index++) {
+    if (USB_BIT_IS_SET (HubIf->ChangeMap[Byte], USB_BIT (Bit)) &&
+        UsbPortConnectIsNew (HubIf, Index))
+    {
+      DebounceMap[Index / 8] = (UINT8)(DebounceMap[Index / 8] | USB_BIT (Index % 8));
+      DebounceIsDone         = TRUE;
+    }
+
+    USB_NEXT_BIT (Byte, Bit);
+  }
+
+  if (DebounceIsDone) {
+    gBS->Stall (USB_WAIT_PORT_STABLE_STALL);
+  }
+
   Byte = 0;
   Bit  = 1;
 
   for (Index = 0; Index < HubIf->NumOfPort; Index++) {
     if (USB_BIT_IS_SET (HubIf->ChangeMap[Byte], USB_BIT (Bit))) {
-      UsbEnumeratePort (HubIf, Index);
+      UsbEnumeratePort (
+        HubIf,
+        Index,
+        (BOOLEAN)!USB_BIT_IS_SET (DebounceMap[Index / 8], USB_BIT (Index % 8))
+        );
     }
 
     USB_NEXT_BIT (Byte, Bit);
@@ -1074,9 +1147,30 @@ UsbRootHubEnumeration (
   USB_INTERFACE  *RootHub;
   UINT8          Index;
   USB_DEVICE     *Child;
+  UINT8          DebounceMap[32];
+  BOOLEAN        DebounceIsDone;
 
   RootHub = (USB_INTERFACE *)Context;
 
+  //
+  // Wait the connect debounce time once for all the ports with a newly
+  // connected device, so that enumerating the ports serially afterwards
+  // can skip the per-port debounce wait.
+  //
+  ZeroMem (DebounceMap, sizeof (DebounceMap));
+  DebounceIsDone = FALSE;
+
+  for (Index = 0; Index < RootHub->NumOfPort; Index++) {
+    if (UsbPortConnectIsNew (RootHub, Index)) {
+      DebounceMap[Index / 8] = (UINT8)(DebounceMap[Index / 8] | USB_BIT (Index % 8));
+      DebounceIsDone         = TRUE;
+    }
+  }
+
+  if (DebounceIsDone) {
+    gBS->Stall (USB_WAIT_PORT_STABLE_STALL);
+  }
+
   for (Index = 0; Index < RootHub->NumOfPort; Index++) {
     Child = UsbFindChild (RootHub, Index);
     if ((Child != NULL) && (Child->DisconnectFail == TRUE)) {
@@ -1084,6 +1178,10 @@ UsbRootHubEnumeration (
       UsbRemoveDevice (Child);
     }
 
-    UsbEnumeratePort (RootHub, Index);
+    UsbEnumeratePort (
+      RootHub,
+      Index,
+      (BOOLEAN)!USB_BIT_IS_SET (DebounceMap[Index / 8], USB_BIT (Index % 8))
+      );
   }
 }
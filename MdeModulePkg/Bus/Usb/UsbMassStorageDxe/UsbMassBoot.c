@@ -769,6 +769,13 @@ UsbBootDetectMedia (
            &UsbMass->BlockIo
            );
 
+    gBS->ReinstallProtocolInterface (
+           UsbMass->Controller,
+           &gEfiBlockIo2ProtocolGuid,
+           &UsbMass->BlockIo2,
+           &UsbMass->BlockIo2
+           );
+
     //
     // Reset MediaId after reinstalling Block I/O Protocol.
     //
@@ -59,9 +59,17 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define USB_PDT_SIMPLE_DIRECT  0x0E                ///< Simplified direct access device
 
 //
-// Other parameters, Max carried size is 64KB.
+// Other parameters, Max carried size is 512KB.
 //
-#define USB_BOOT_MAX_CARRY_SIZE  SIZE_64KB
+// Each CBW/data/CSW cycle is executed as synchronous lock-step bulk
+// transfers, so the fixed per-command cost (command/status exchanges,
+// transfer setup and completion polling) is paid once per carried chunk.
+// Carrying 512KB per command instead of 64KB cuts that cost by 8x for
+// large reads, which dominates mass storage throughput on USB3 drives.
+// xHCI transfer rings hold 255 usable TRBs of up to 64KB each, so 512KB
+// (8 TRBs) stays well within a single ring.
+//
+#define USB_BOOT_MAX_CARRY_SIZE  SIZE_512KB
 
 //
 // Retry mass command times, set by experience
@@ -293,6 +293,7 @@ CoreIsSchedulable (
 
         if (EFI_ERROR (Status)) {
           DEBUG ((DEBUG_DISPATCH, "  PUSH GUID(%g) = FALSE\n", &DriverGuid));
+          CoreRegisterDepexWait (&DriverGuid, DriverEntry);
           Status = PushBool (FALSE);
         } else {
           DEBUG ((DEBUG_DISPATCH, "  PUSH GUID(%g) = TRUE\n", &DriverGuid));
@@ -84,6 +84,39 @@ typedef struct {
 
 FV_FILEPATH_DEVICE_PATH  mFvDevicePath;
 
+//
+// Reverse dependency index built from failed depex evaluations.  Each entry
+// names a protocol GUID that at least one Dependent driver's depex pushed
+// FALSE for, together with the drivers waiting on it.  The dispatcher checks
+// each distinct pending GUID once per pass and only re-evaluates the depex of
+// drivers one of whose awaited protocols has actually been installed, instead
+// of re-running every pending driver's depex on every pass.
+//
+#define DEPEX_WAIT_SIGNATURE  SIGNATURE_32('d','p','x','w')
+typedef struct {
+  UINTN         Signature;
+  LIST_ENTRY    Link;       // mDepexWaitList
+  EFI_GUID      Protocol;
+  LIST_ENTRY    Waiters;    // list of DEPEX_WAITER
+} DEPEX_WAIT;
+
+#define DEPEX_WAITER_SIGNATURE  SIGNATURE_32('d','p','x','r')
+typedef struct {
+  UINTN                    Signature;
+  LIST_ENTRY               Link;     // DEPEX_WAIT.Waiters
+  EFI_CORE_DRIVER_ENTRY    *DriverEntry;
+} DEPEX_WAITER;
+
+LIST_ENTRY  mDepexWaitList = INITIALIZE_LIST_HEAD_VARIABLE (mDepexWaitList);
+
+//
+// Bumped on every successful wait registration so the dispatcher can tell
+// whether a failed depex actually parked the driver on the wait list.  A
+// depex that fails without registering any wait (for example one using NOT
+// on an installed protocol) keeps being re-evaluated every pass.
+//
+UINTN  mDepexWaitRegistrations = 0;
+
 //
 // Function Prototypes
 //
@@ -381,6 +414,116 @@ CoreTrust (
   return EFI_NOT_FOUND;
 }
 
+/**
+  Record that a driver's depex is waiting for a protocol to be installed, so
+  the dispatcher re-evaluates the depex only after the protocol shows up.
+
+  @param  Protocol              The protocol GUID the depex pushed FALSE for.
+  @param  DriverEntry           The driver whose depex is waiting.
+
+**/
+VOID
+CoreRegisterDepexWait (
+  IN EFI_GUID               *Protocol,
+  IN EFI_CORE_DRIVER_ENTRY  *DriverEntry
+  )
+{
+  LIST_ENTRY    *Link;
+  LIST_ENTRY    *WaiterLink;
+  DEPEX_WAIT    *WaitEntry;
+  DEPEX_WAITER  *Waiter;
+
+  //
+  // Find the wait entry for this protocol, creating one on first use
+  //
+  WaitEntry = NULL;
+  for (Link = mDepexWaitList.ForwardLink; Link != &mDepexWaitList; Link = Link->ForwardLink) {
+    WaitEntry = CR (Link, DEPEX_WAIT, Link, DEPEX_WAIT_SIGNATURE);
+    if (CompareGuid (&WaitEntry->Protocol, Protocol)) {
+      break;
+    }
+
+    WaitEntry = NULL;
+  }
+
+  if (WaitEntry == NULL) {
+    WaitEntry = AllocatePool (sizeof (DEPEX_WAIT));
+    if (WaitEntry == NULL) {
+      return;
+    }
+
+    WaitEntry->Signature = DEPEX_WAIT_SIGNATURE;
+    CopyGuid (&WaitEntry->Protocol, Protocol);
+    InitializeListHead (&WaitEntry->Waiters);
+    InsertTailList (&mDepexWaitList, &WaitEntry->Link);
+  }
+
+  //
+  // The driver may re-register the same protocol after being woken for a
+  // different one; keep one waiter node per driver per protocol
+  //
+  for (WaiterLink = WaitEntry->Waiters.ForwardLink; WaiterLink != &WaitEntry->Waiters; WaiterLink = WaiterLink->ForwardLink) {
+    Waiter = CR (WaiterLink, DEPEX_WAITER, Link, DEPEX_WAITER_SIGNATURE);
+    if (Waiter->DriverEntry == DriverEntry) {
+      mDepexWaitRegistrations++;
+      return;
+    }
+  }
+
+  Waiter = AllocatePool (sizeof (DEPEX_WAITER));
+  if (Waiter == NULL) {
+    return;
+  }
+
+  Waiter->Signature   = DEPEX_WAITER_SIGNATURE;
+  Waiter->DriverEntry = DriverEntry;
+  InsertTailList (&WaitEntry->Waiters, &Waiter->Link);
+  mDepexWaitRegistrations++;
+}
+
+/**
+  Check each protocol that pending drivers are waiting on exactly once, and
+  mark the depex of every driver waiting on a newly installed protocol as
+  needing re-evaluation.
+
+**/
+VOID
+CoreWakeDriversWaitingOnProtocols (
+  VOID
+  )
+{
+  LIST_ENTRY    *Link;
+  DEPEX_WAIT    *WaitEntry;
+  DEPEX_WAITER  *Waiter;
+  VOID          *Interface;
+  EFI_STATUS    Status;
+
+  Link = mDepexWaitList.ForwardLink;
+  while (Link != &mDepexWaitList) {
+    WaitEntry = CR (Link, DEPEX_WAIT, Link, DEPEX_WAIT_SIGNATURE);
+    Link      = Link->ForwardLink;
+
+    Status = CoreLocateProtocol (&WaitEntry->Protocol, NULL, &Interface);
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    //
+    // The protocol is now present; wake every driver waiting on it and
+    // retire the wait entry
+    //
+    while (!IsListEmpty (&WaitEntry->Waiters)) {
+      Waiter = CR (WaitEntry->Waiters.ForwardLink, DEPEX_WAITER, Link, DEPEX_WAITER_SIGNATURE);
+      Waiter->DriverEntry->DepexUpToDate = FALSE;
+      RemoveEntryList (&Waiter->Link);
+      CoreFreePool (Waiter);
+    }
+
+    RemoveEntryList (&WaitEntry->Link);
+    CoreFreePool (WaitEntry);
+  }
+}
+
 /**
   This is the main Dispatcher for DXE and it exits when there are no more
   drivers to run. Drain the mScheduledQueue and load and start a PE
@@ -407,6 +550,7 @@ CoreDispatcher (
   EFI_CORE_DRIVER_ENTRY  *DriverEntry;
   BOOLEAN                ReadyToRun;
   EFI_EVENT              DxeDispatchEvent;
+  UINTN                  WaitRegistrations;
 
   PERF_FUNCTION_BEGIN ();
 
@@ -537,6 +681,12 @@ CoreDispatcher (
       CoreSignalEvent (DxeDispatchEvent);
     }
 
+    //
+    // Wake only the drivers whose awaited protocols have been installed
+    // since their depex last evaluated to FALSE
+    //
+    CoreWakeDriversWaitingOnProtocols ();
+
     //
     // Search DriverList for items to place on Scheduled Queue
     //
@@ -552,9 +702,26 @@ CoreDispatcher (
       }
 
       if (DriverEntry->Dependent) {
+        if (DriverEntry->DepexUpToDate) {
+          //
+          // None of the protocols this depex waits on have shown up yet
+          //
+          continue;
+        }
+
+        WaitRegistrations = mDepexWaitRegistrations;
         if (CoreIsSchedulable (DriverEntry)) {
           CoreInsertOnScheduledQueueWhileProcessingBeforeAndAfter (DriverEntry);
           ReadyToRun = TRUE;
+        } else if ((DriverEntry->Depex != NULL) && (mDepexWaitRegistrations != WaitRegistrations)) {
+          //
+          // The failed PUSH opcodes parked the driver on the depex wait
+          // list; skip this driver until one of those protocols is
+          // installed.  NULL depex drivers wait on all UEFI services and
+          // drivers that failed without registering a wait are re-checked
+          // every pass.
+          //
+          DriverEntry->DepexUpToDate = TRUE;
         }
       } else {
         if (DriverEntry->Unrequested) {
@@ -77,6 +77,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/PeCoffGetEntryPointLib.h>
 #include <Library/PeCoffExtraActionLib.h>
 #include <Library/PcdLib.h>
+#include <Library/PrintLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/DevicePathLib.h>
 #include <Library/UefiBootServicesTableLib.h>
@@ -158,6 +159,12 @@ typedef struct {
   BOOLEAN                          Initialized;
   BOOLEAN                          DepexProtocolError;
 
+  //
+  // TRUE when the depex last evaluated to FALSE and none of the protocols it
+  // waits on have been installed since, so re-evaluation can be skipped
+  //
+  BOOLEAN                          DepexUpToDate;
+
   EFI_HANDLE                       ImageHandle;
   BOOLEAN                          IsFvImage;
 } EFI_CORE_DRIVER_ENTRY;
@@ -495,6 +502,20 @@ CorePreProcessDepex (
   IN  EFI_CORE_DRIVER_ENTRY  *DriverEntry
   );
 
+/**
+  Record that a driver's depex is waiting for a protocol to be installed, so
+  the dispatcher re-evaluates the depex only after the protocol shows up.
+
+  @param  Protocol              The protocol GUID the depex pushed FALSE for.
+  @param  DriverEntry           The driver whose depex is waiting.
+
+**/
+VOID
+CoreRegisterDepexWait (
+  IN EFI_GUID               *Protocol,
+  IN EFI_CORE_DRIVER_ENTRY  *DriverEntry
+  );
+
 /**
   Terminates all boot services.
 
@@ -2664,6 +2685,39 @@ CoreUpdateProfile (
   IN CHAR8                  *ActionString OPTIONAL
   );
 
+/**
+  Record a sampled allocation or free action.
+
+  This function implements 1/N sampling against
+  PcdMemoryProfileSampleRate and stores the sampled action in the ring of
+  the current TPL. It is called on every memory service action and returns
+  immediately when sampling is disabled.
+
+  @param CallerAddress  Address of caller who called Allocate or Free.
+  @param Action         This Allocate or Free action.
+  @param MemoryType     Memory type.
+                        EfiMaxMemoryType means the MemoryType is unknown.
+  @param Size           Buffer size in bytes for pool actions, or the number
+                        of pages for page actions.
+
+**/
+VOID
+CoreUpdateProfileSample (
+  IN PHYSICAL_ADDRESS       CallerAddress,
+  IN MEMORY_PROFILE_ACTION  Action,
+  IN EFI_MEMORY_TYPE        MemoryType,
+  IN UINTN                  Size
+  );
+
+/**
+  Install memory profile sample protocol.
+
+**/
+VOID
+MemoryProfileSampleInstallProtocol (
+  VOID
+  );
+
 /**
   Internal function.  Converts a memory range to use new attributes.
 
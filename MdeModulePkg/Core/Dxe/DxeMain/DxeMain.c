@@ -444,6 +444,8 @@ DxeMain (
 
   MemoryProfileInstallProtocol ();
 
+  MemoryProfileSampleInstallProtocol ();
+
   CoreInitializeMemoryAttributesTable ();
   CoreInitializeMemoryProtection ();
 
@@ -13,6 +13,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define VALID_TPL(a)  ((a) <= TPL_HIGH_LEVEL)
 extern  UINTN  gEventPending;
 
+///
+/// Per-TPL event dispatch statistics for boot profiling: number of
+/// notification functions run at each priority level and cumulative time
+/// spent in them, in 100ns system time units
+///
+extern UINT64  gEventDispatchCount[TPL_HIGH_LEVEL + 1];
+extern UINT64  gEventDispatchTime[TPL_HIGH_LEVEL + 1];
+
 ///
 /// Set if Event is part of an event group
 ///
@@ -33,6 +41,13 @@ typedef struct {
   LIST_ENTRY    Link;
   UINT64        TriggerTime;
   UINT64        Period;
+  ///
+  /// Number of times the timer has fired, and the cumulative delay between
+  /// the programmed trigger time and the time the timer was actually
+  /// signaled, in 100ns units.  Used to find misbehaving periodic pollers.
+  ///
+  UINT64        FireCount;
+  UINT64        TotalLatency;
 } TIMER_EVENT_INFO;
 
 #define EVENT_SIGNATURE  SIGNATURE_32('e','v','n','t')
@@ -54,6 +69,10 @@ typedef struct {
   LIST_ENTRY                 NotifyLink;
   UINT8                      ExFlag;
   ///
+  /// Number of times the notification function has been dispatched
+  ///
+  UINT64                     DispatchCount;
+  ///
   /// A list of all runtime events
   ///
   EFI_RUNTIME_EVENT_ENTRY    RuntimeData;
@@ -85,4 +104,15 @@ CoreInitializeTimer (
   VOID
   );
 
+/**
+  Returns the current system time.
+
+  @return The current system time
+
+**/
+UINT64
+CoreCurrentSystemTime (
+  VOID
+  );
+
 #endif
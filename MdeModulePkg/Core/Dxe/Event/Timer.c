@@ -13,9 +13,35 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 // Internal data
 //
 
-LIST_ENTRY  mEfiTimerList       = INITIALIZE_LIST_HEAD_VARIABLE (mEfiTimerList);
-EFI_LOCK    mEfiTimerLock       = EFI_INITIALIZE_LOCK_VARIABLE (TPL_HIGH_LEVEL - 1);
-EFI_EVENT   mEfiCheckTimerEvent = NULL;
+///
+/// The pending timers hang off a timing wheel instead of a single sorted
+/// list.  Each wheel slot covers 2^TIMER_WHEEL_SHIFT 100ns units of system
+/// time (about 13 ms) and holds an unsorted bucket of the timers whose
+/// trigger time falls in a slot congruent to it.  Arming and canceling a
+/// timer are O(1); CoreCheckTimers() only scans the buckets whose time
+/// slots have been reached since the previous check.
+///
+#define TIMER_WHEEL_SLOTS  64
+#define TIMER_WHEEL_SHIFT  17
+
+LIST_ENTRY  mEfiTimerWheel[TIMER_WHEEL_SLOTS];
+BOOLEAN     mEfiTimerWheelInitialized = FALSE;
+///
+/// The last wheel slot processed by CoreCheckTimers()
+///
+UINT64  mEfiTimerWheelSlot = 0;
+///
+/// Number of timers currently on the wheel
+///
+UINTN  mEfiTimerCount = 0;
+///
+/// Lower bound on the earliest pending trigger time, used by CoreTimerTick()
+/// to decide whether to signal the check timer event
+///
+UINT64  mEfiNearestTriggerTime = MAX_UINT64;
+
+EFI_LOCK   mEfiTimerLock       = EFI_INITIALIZE_LOCK_VARIABLE (TPL_HIGH_LEVEL - 1);
+EFI_EVENT  mEfiCheckTimerEvent = NULL;
 
 EFI_LOCK  mEfiSystemTimeLock = EFI_INITIALIZE_LOCK_VARIABLE (TPL_HIGH_LEVEL);
 UINT64    mEfiSystemTime     = 0;
@@ -36,29 +62,29 @@ CoreInsertEventTimer (
   IN IEVENT  *Event
   )
 {
-  UINT64      TriggerTime;
-  LIST_ENTRY  *Link;
-  IEVENT      *Event2;
+  UINT64  TriggerTime;
+  UINTN   Index;
 
   ASSERT_LOCKED (&mEfiTimerLock);
 
-  //
-  // Get the timer's trigger time
-  //
-  TriggerTime = Event->Timer.TriggerTime;
+  if (!mEfiTimerWheelInitialized) {
+    for (Index = 0; Index < TIMER_WHEEL_SLOTS; Index++) {
+      InitializeListHead (&mEfiTimerWheel[Index]);
+    }
+
+    mEfiTimerWheelInitialized = TRUE;
+  }
 
   //
-  // Insert the timer into the timer database in assending sorted order
+  // Hang the timer off the wheel bucket covering its trigger time
   //
-  for (Link = mEfiTimerList.ForwardLink; Link != &mEfiTimerList; Link = Link->ForwardLink) {
-    Event2 = CR (Link, IEVENT, Timer.Link, EVENT_SIGNATURE);
-
-    if (Event2->Timer.TriggerTime > TriggerTime) {
-      break;
-    }
+  TriggerTime = Event->Timer.TriggerTime;
+  Index       = (UINTN)(RShiftU64 (TriggerTime, TIMER_WHEEL_SHIFT) & (TIMER_WHEEL_SLOTS - 1));
+  InsertTailList (&mEfiTimerWheel[Index], &Event->Timer.Link);
+  mEfiTimerCount++;
+  if (TriggerTime < mEfiNearestTriggerTime) {
+    mEfiNearestTriggerTime = TriggerTime;
   }
-
-  InsertTailList (Link, &Event->Timer.Link);
 }
 
 /**
@@ -82,7 +108,7 @@ CoreCurrentSystemTime (
 }
 
 /**
-  Checks the sorted timer list against the current system time.
+  Checks the timer wheel against the current system time.
   Signals any expired event timer.
 
   @param  CheckEvent             Not used
@@ -96,61 +122,110 @@ CoreCheckTimers (
   IN VOID       *Context
   )
 {
-  UINT64  SystemTime;
-  IEVENT  *Event;
+  UINT64      SystemTime;
+  UINT64      CurrentSlot;
+  UINT64      Nearest;
+  LIST_ENTRY  *Bucket;
+  LIST_ENTRY  *Link;
+  LIST_ENTRY  *NextLink;
+  IEVENT      *Event;
 
   //
   // Check the timer database for expired timers
   //
   CoreAcquireLock (&mEfiTimerLock);
-  SystemTime = CoreCurrentSystemTime ();
 
-  while (!IsListEmpty (&mEfiTimerList)) {
-    Event = CR (mEfiTimerList.ForwardLink, IEVENT, Timer.Link, EVENT_SIGNATURE);
+  if (!mEfiTimerWheelInitialized || (mEfiTimerCount == 0)) {
+    mEfiNearestTriggerTime = MAX_UINT64;
+    CoreReleaseLock (&mEfiTimerLock);
+    return;
+  }
 
-    //
-    // If this timer is not expired, then we're done
-    //
-    if (Event->Timer.TriggerTime > SystemTime) {
-      break;
-    }
+  SystemTime  = CoreCurrentSystemTime ();
+  CurrentSlot = RShiftU64 (SystemTime, TIMER_WHEEL_SHIFT);
 
-    //
-    // Remove this timer from the timer queue
-    //
+  //
+  // If the wheel has not been checked for a full rotation, every bucket may
+  // hold expired timers; scanning one full rotation covers them all.
+  //
+  if ((CurrentSlot - mEfiTimerWheelSlot) >= TIMER_WHEEL_SLOTS) {
+    mEfiTimerWheelSlot = CurrentSlot - TIMER_WHEEL_SLOTS + 1;
+  }
 
-    RemoveEntryList (&Event->Timer.Link);
-    Event->Timer.Link.ForwardLink = NULL;
+  Nearest = MAX_UINT64;
+  for ( ; ; mEfiTimerWheelSlot++) {
+    Bucket = &mEfiTimerWheel[mEfiTimerWheelSlot & (TIMER_WHEEL_SLOTS - 1)];
+    Link   = Bucket->ForwardLink;
+    while (Link != Bucket) {
+      Event    = CR (Link, IEVENT, Timer.Link, EVENT_SIGNATURE);
+      NextLink = Link->ForwardLink;
 
-    //
-    // Signal it
-    //
-    CoreSignalEvent (Event);
-
-    //
-    // If this is a periodic timer, set it
-    //
-    if (Event->Timer.Period != 0) {
-      //
-      // Compute the timers new trigger time
-      //
-      Event->Timer.TriggerTime = Event->Timer.TriggerTime + Event->Timer.Period;
-
-      //
-      // If that's before now, then reset the timer to start from now
-      //
       if (Event->Timer.TriggerTime <= SystemTime) {
-        Event->Timer.TriggerTime = SystemTime;
-        CoreSignalEvent (mEfiCheckTimerEvent);
+        //
+        // Remove this timer from the timer queue
+        //
+        RemoveEntryList (&Event->Timer.Link);
+        Event->Timer.Link.ForwardLink = NULL;
+        mEfiTimerCount--;
+
+        //
+        // Record fire count and how late the timer was signaled
+        //
+        Event->Timer.FireCount++;
+        Event->Timer.TotalLatency += SystemTime - Event->Timer.TriggerTime;
+
+        //
+        // Signal it
+        //
+        CoreSignalEvent (Event);
+
+        //
+        // If this is a periodic timer, set it
+        //
+        if (Event->Timer.Period != 0) {
+          //
+          // Compute the timers new trigger time
+          //
+          Event->Timer.TriggerTime = Event->Timer.TriggerTime + Event->Timer.Period;
+
+          //
+          // If that's before now, then reset the timer to start from now
+          //
+          if (Event->Timer.TriggerTime <= SystemTime) {
+            Event->Timer.TriggerTime = SystemTime;
+            CoreSignalEvent (mEfiCheckTimerEvent);
+          }
+
+          //
+          // Add the timer.  If it lands back in the bucket being scanned it
+          // is appended at the tail and will be re-examined by this loop,
+          // matching the old behavior of re-checking the head of the sorted
+          // list.
+          //
+          CoreInsertEventTimer (Event);
+        }
+      } else if (Event->Timer.TriggerTime < Nearest) {
+        Nearest = Event->Timer.TriggerTime;
       }
 
-      //
-      // Add the timer
-      //
-      CoreInsertEventTimer (Event);
+      Link = NextLink;
+    }
+
+    if (mEfiTimerWheelSlot == CurrentSlot) {
+      break;
     }
   }
 
+  //
+  // Timers in buckets ahead of the current slot cannot expire before the
+  // start of the next slot, so that bounds the next check from below.
+  //
+  if (mEfiTimerCount == 0) {
+    mEfiNearestTriggerTime = MAX_UINT64;
+  } else {
+    mEfiNearestTriggerTime = MIN (Nearest, LShiftU64 (CurrentSlot + 1, TIMER_WHEEL_SHIFT));
+  }
+
   CoreReleaseLock (&mEfiTimerLock);
 }
 
@@ -189,8 +264,6 @@ CoreTimerTick (
   IN UINT64  Duration
   )
 {
-  IEVENT  *Event;
-
   //
   // Check runtiem flag in case there are ticks while exiting boot services
   //
@@ -202,15 +275,11 @@ CoreTimerTick (
   mEfiSystemTime += Duration;
 
   //
-  // If the head of the list is expired, fire the timer event
-  // to process it
+  // If the earliest pending timer may have expired, fire the timer event
+  // to process the wheel
   //
-  if (!IsListEmpty (&mEfiTimerList)) {
-    Event = CR (mEfiTimerList.ForwardLink, IEVENT, Timer.Link, EVENT_SIGNATURE);
-
-    if (Event->Timer.TriggerTime <= mEfiSystemTime) {
-      CoreSignalEvent (mEfiCheckTimerEvent);
-    }
+  if (mEfiNearestTriggerTime <= mEfiSystemTime) {
+    CoreSignalEvent (mEfiCheckTimerEvent);
   }
 
   CoreReleaseLock (&mEfiSystemTimeLock);
@@ -263,6 +332,7 @@ CoreSetTimer (
   if (Event->Timer.Link.ForwardLink != NULL) {
     RemoveEntryList (&Event->Timer.Link);
     Event->Timer.Link.ForwardLink = NULL;
+    mEfiTimerCount--;
   }
 
   Event->Timer.TriggerTime = 0;
@@ -241,6 +241,54 @@ GetFwVolHeader (
   return Status;
 }
 
+/**
+  Compute the file name hash table bucket for a file name GUID.
+
+  @param  Name                  Name of the file.
+
+  @return Index of the hash table bucket the name belongs in.
+
+**/
+UINTN
+FvFileNameHashIndex (
+  IN CONST EFI_GUID  *Name
+  )
+{
+  return (Name->Data1 ^ (Name->Data1 >> 16)) & (FFS_FILE_NAME_HASH_TABLE_SIZE - 1);
+}
+
+/**
+  Find the file list entry for the file named by NameGuid using the
+  volume's file name hash table.
+
+  @param  FvDevice       The firmware volume to search.
+  @param  NameGuid       Name of the file to find.
+
+  @return The matching file list entry, or NULL if the volume contains no
+          file with that name.
+
+**/
+FFS_FILE_LIST_ENTRY *
+FvFindFfsFileByName (
+  IN FV_DEVICE       *FvDevice,
+  IN CONST EFI_GUID  *NameGuid
+  )
+{
+  LIST_ENTRY           *Bucket;
+  LIST_ENTRY           *Link;
+  FFS_FILE_LIST_ENTRY  *FfsFileEntry;
+
+  Bucket = &FvDevice->FfsFileNameHashTable[FvFileNameHashIndex (NameGuid)];
+  for (Link = Bucket->ForwardLink; Link != Bucket; Link = Link->ForwardLink) {
+    FfsFileEntry = BASE_CR (Link, FFS_FILE_LIST_ENTRY, NameHashLink);
+    if (CompareGuid (&FfsFileEntry->FfsHeader->Name, NameGuid)) {
+      return FfsFileEntry;
+    }
+  }
+
+  return NULL;
+}
+
 /**
   Free FvDevice resource when error happens
 
@@ -420,6 +468,9 @@ FvCheck (
   //
   Status = EFI_SUCCESS;
   InitializeListHead (&FvDevice->FfsFileListHeader);
+  for (Index = 0; Index < FFS_FILE_NAME_HASH_TABLE_SIZE; Index++) {
+    InitializeListHead (&FvDevice->FfsFileNameHashTable[Index]);
+  }
 
   //
   // Build FFS list
@@ -537,6 +588,12 @@ FvCheck (
       FfsFileEntry->FileCached = FileCached;
       FileCached               = FALSE;
       InsertTailList (&FvDevice->FfsFileListHeader, &FfsFileEntry->Link);
+      if (CacheFfsHeader->Type != EFI_FV_FILETYPE_FFS_PAD) {
+        InsertTailList (
+          &FvDevice->FfsFileNameHashTable[FvFileNameHashIndex (&CacheFfsHeader->Name)],
+          &FfsFileEntry->NameHashLink
+          );
+      }
     }
 
     if (IS_FFS_FILE2 (CacheFfsHeader)) {
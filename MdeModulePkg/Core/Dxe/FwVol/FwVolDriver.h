@@ -12,11 +12,21 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define FV2_DEVICE_SIGNATURE  SIGNATURE_32 ('_', 'F', 'V', '2')
 
+//
+// Number of buckets in the per-volume file name hash table
+//
+#define FFS_FILE_NAME_HASH_TABLE_SIZE  32
+
 //
 // Used to track all non-deleted files
 //
 typedef struct {
   LIST_ENTRY             Link;
+  ///
+  /// Entry in the owning volume's file name hash table.  Pad files are not
+  /// hashed because they are never exposed through the FV protocol.
+  ///
+  LIST_ENTRY             NameHashLink;
   EFI_FFS_FILE_HEADER    *FfsHeader;
   UINTN                  StreamHandle;
   BOOLEAN                FileCached;
@@ -40,6 +50,13 @@ typedef struct {
   UINT8                                 ErasePolarity;
   BOOLEAN                               IsFfs3Fv;
   BOOLEAN                               IsMemoryMapped;
+
+  ///
+  /// File name hash table built by FvCheck() so FvReadFile() can locate a
+  /// file by GUID without walking the whole file list.  The list of files
+  /// never changes after FvCheck() because FvWriteFile() is not supported.
+  ///
+  LIST_ENTRY                            FfsFileNameHashTable[FFS_FILE_NAME_HASH_TABLE_SIZE];
 } FV_DEVICE;
 
 #define FV_DEVICE_FROM_THIS(a)  CR(a, FV_DEVICE, Fv, FV2_DEVICE_SIGNATURE)
@@ -384,4 +401,21 @@ IsValidFfsFile (
   IN EFI_FFS_FILE_HEADER  *FfsHeader
   );
 
+/**
+  Find the file list entry for the file named by NameGuid using the
+  volume's file name hash table.
+
+  @param  FvDevice       The firmware volume to search.
+  @param  NameGuid       Name of the file to find.
+
+  @return The matching file list entry, or NULL if the volume contains no
+          file with that name.
+
+**/
+FFS_FILE_LIST_ENTRY *
+FvFindFfsFileByName (
+  IN FV_DEVICE       *FvDevice,
+  IN CONST EFI_GUID  *NameGuid
+  );
+
 #endif
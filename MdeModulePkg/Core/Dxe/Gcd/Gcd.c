@@ -43,6 +43,22 @@ EFI_LOCK    mGcdIoSpaceLock     = EFI_INITIALIZE_LOCK_VARIABLE (TPL_NOTIFY);
 LIST_ENTRY  mGcdMemorySpaceMap  = INITIALIZE_LIST_HEAD_VARIABLE (mGcdMemorySpaceMap);
 LIST_ENTRY  mGcdIoSpaceMap      = INITIALIZE_LIST_HEAD_VARIABLE (mGcdIoSpaceMap);
 
+///
+/// Sorted array index over a GCD map, used to locate the descriptor that
+/// covers an address with a binary search instead of walking the list.
+/// The index is rebuilt lazily on the first search after the list structure
+/// of the map has changed.
+///
+typedef struct {
+  EFI_GCD_MAP_ENTRY    **Entries;
+  UINTN                Count;
+  UINTN                Capacity;
+  BOOLEAN              Valid;
+} GCD_MAP_INDEX;
+
+GCD_MAP_INDEX  mGcdMemorySpaceIndex = { NULL, 0, 0, FALSE };
+GCD_MAP_INDEX  mGcdIoSpaceIndex     = { NULL, 0, 0, FALSE };
+
 EFI_GCD_MAP_ENTRY  mGcdMemorySpaceMapEntryTemplate = {
   EFI_GCD_MAP_SIGNATURE,
   {
@@ -410,6 +426,106 @@ CoreAllocateGcdMapEntry (
   return EFI_SUCCESS;
 }
 
+/**
+  Internal function.  Returns the search index associated with a GCD map.
+
+  @param  Map                    The GCD map the index is requested for.
+
+  @return A pointer to the index, or NULL if Map is not one of the GCD maps.
+
+**/
+GCD_MAP_INDEX *
+CoreGetGcdMapIndex (
+  IN LIST_ENTRY  *Map
+  )
+{
+  if (Map == &mGcdMemorySpaceMap) {
+    return &mGcdMemorySpaceIndex;
+  }
+
+  if (Map == &mGcdIoSpaceMap) {
+    return &mGcdIoSpaceIndex;
+  }
+
+  return NULL;
+}
+
+/**
+  Internal function.  Marks the search indexes of both GCD maps stale so they
+  are rebuilt on the next search.  Must be called whenever a map entry is
+  inserted into or removed from a GCD map.
+
+**/
+VOID
+CoreInvalidateGcdMapIndexes (
+  VOID
+  )
+{
+  mGcdMemorySpaceIndex.Valid = FALSE;
+  mGcdIoSpaceIndex.Valid     = FALSE;
+}
+
+/**
+  Internal function.  Rebuilds the search index for a GCD map by collecting
+  the map entries, in ascending address order, into the index array.  If the
+  index array cannot be grown, the index is left invalid and searches fall
+  back to walking the list.
+
+  @param  Index                  The index to rebuild.
+  @param  Map                    The GCD map the index describes.
+
+**/
+VOID
+CoreBuildGcdMapIndex (
+  IN GCD_MAP_INDEX  *Index,
+  IN LIST_ENTRY     *Map
+  )
+{
+  UINTN       Count;
+  LIST_ENTRY  *Link;
+
+  Count = 0;
+  for (Link = Map->ForwardLink; Link != Map; Link = Link->ForwardLink) {
+    Count++;
+  }
+
+  if (Count > Index->Capacity) {
+    if (Index->Entries != NULL) {
+      CoreFreePool (Index->Entries);
+      Index->Entries  = NULL;
+      Index->Capacity = 0;
+    }
+
+    //
+    // Reserve some headroom so the array is not reallocated on every split
+    //
+    mOnGuarding    = TRUE;
+    Index->Entries = AllocatePool ((Count + 16) * sizeof (EFI_GCD_MAP_ENTRY *));
+    mOnGuarding    = FALSE;
+    if (Index->Entries == NULL) {
+      return;
+    }
+
+    Index->Capacity = Count + 16;
+  }
+
+  Count = 0;
+  for (Link = Map->ForwardLink; Link != Map; Link = Link->ForwardLink) {
+    if (Count == Index->Capacity) {
+      //
+      // The map grew while the index array was being allocated; leave the
+      // index invalid so this search walks the list instead.
+      //
+      return;
+    }
+
+    Index->Entries[Count++] = CR (Link, EFI_GCD_MAP_ENTRY, Link, EFI_GCD_MAP_SIGNATURE);
+  }
+
+  Index->Count = Count;
+  Index->Valid = TRUE;
+}
+
 /**
   Internal function.  Inserts a new descriptor into a sorted list
 
@@ -443,6 +559,7 @@ CoreInsertGcdMapEntry (
     Entry->BaseAddress      = BaseAddress;
     BottomEntry->EndAddress = BaseAddress - 1;
     InsertTailList (Link, &BottomEntry->Link);
+    CoreInvalidateGcdMapIndexes ();
   }
 
   if ((BaseAddress + Length - 1) < Entry->EndAddress) {
@@ -452,6 +569,7 @@ CoreInsertGcdMapEntry (
     TopEntry->BaseAddress = BaseAddress + Length;
     Entry->EndAddress     = BaseAddress + Length - 1;
     InsertHeadList (Link, &TopEntry->Link);
+    CoreInvalidateGcdMapIndexes ();
   }
 
   return EFI_SUCCESS;
@@ -530,6 +648,7 @@ CoreMergeGcdMapEntry (
   }
 
   RemoveEntryList (AdjacentLink);
+  CoreInvalidateGcdMapIndexes ();
   CoreFreePool (AdjacentEntry);
 
   return EFI_SUCCESS;
@@ -603,12 +722,72 @@ CoreSearchGcdMapEntry (
 {
   LIST_ENTRY         *Link;
   EFI_GCD_MAP_ENTRY  *Entry;
+  GCD_MAP_INDEX      *Index;
+  UINTN              Lo;
+  UINTN              Hi;
+  UINTN              Mid;
 
   ASSERT (Length != 0);
 
   *StartLink = NULL;
   *EndLink   = NULL;
 
+  //
+  // Binary search the map index for the descriptor that covers BaseAddress,
+  // then walk forward from it to find the descriptor that covers the end of
+  // the range.  The maps stay sorted by address, so both loops below only
+  // visit descriptors inside the requested range.
+  //
+  Index = CoreGetGcdMapIndex (Map);
+  if ((Index != NULL) && !Index->Valid) {
+    CoreBuildGcdMapIndex (Index, Map);
+  }
+
+  if ((Index != NULL) && Index->Valid) {
+    if (Index->Count == 0) {
+      return EFI_NOT_FOUND;
+    }
+
+    Lo = 0;
+    Hi = Index->Count - 1;
+    while (Lo <= Hi) {
+      Mid   = Lo + ((Hi - Lo) / 2);
+      Entry = Index->Entries[Mid];
+      if (BaseAddress < Entry->BaseAddress) {
+        if (Mid == 0) {
+          break;
+        }
+
+        Hi = Mid - 1;
+      } else if (BaseAddress > Entry->EndAddress) {
+        Lo = Mid + 1;
+      } else {
+        *StartLink = &Entry->Link;
+        break;
+      }
+    }
+
+    if (*StartLink == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    for (Link = *StartLink; Link != Map; Link = Link->ForwardLink) {
+      Entry = CR (Link, EFI_GCD_MAP_ENTRY, Link, EFI_GCD_MAP_SIGNATURE);
+      if (((BaseAddress + Length - 1) >= Entry->BaseAddress) &&
+          ((BaseAddress + Length - 1) <= Entry->EndAddress))
+      {
+        *EndLink = Link;
+        return EFI_SUCCESS;
+      }
+    }
+
+    *StartLink = NULL;
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // The index could not be built; fall back to walking the whole map.
+  //
   Link = Map->ForwardLink;
   while (Link != Map) {
     Entry = CR (Link, EFI_GCD_MAP_ENTRY, Link, EFI_GCD_MAP_SIGNATURE);
@@ -20,6 +20,79 @@ LIST_ENTRY  gHandleList           = INITIALIZE_LIST_HEAD_VARIABLE (gHandleList);
 EFI_LOCK    gProtocolDatabaseLock = EFI_INITIALIZE_LOCK_VARIABLE (TPL_NOTIFY);
 UINT64      gHandleDatabaseKey    = 0;
 
+//
+// Hash tables indexing the handle and protocol databases.  Handle validation
+// and protocol entry lookup run on nearly every boot service call, so neither
+// is allowed to scale with the total number of handles or protocols.
+//
+#define HANDLE_HASH_TABLE_SIZE    256
+#define PROTOCOL_HASH_TABLE_SIZE  64
+
+LIST_ENTRY  mHandleHashTable[HANDLE_HASH_TABLE_SIZE];
+LIST_ENTRY  mProtocolHashTable[PROTOCOL_HASH_TABLE_SIZE];
+BOOLEAN     mHandleHashTablesInitialized = FALSE;
+
+/**
+  Initialize the handle and protocol hash table buckets on first use.
+
+**/
+VOID
+CoreInitializeHandleHashTables (
+  VOID
+  )
+{
+  UINTN  Index;
+
+  if (mHandleHashTablesInitialized) {
+    return;
+  }
+
+  for (Index = 0; Index < HANDLE_HASH_TABLE_SIZE; Index++) {
+    InitializeListHead (&mHandleHashTable[Index]);
+  }
+
+  for (Index = 0; Index < PROTOCOL_HASH_TABLE_SIZE; Index++) {
+    InitializeListHead (&mProtocolHashTable[Index]);
+  }
+
+  mHandleHashTablesInitialized = TRUE;
+}
+
+/**
+  Compute the hash table bucket for a handle.
+
+  @param  UserHandle             The handle to hash
+
+  @return The bucket holding the handle if it is valid
+
+**/
+UINTN
+CoreHandleHashIndex (
+  IN EFI_HANDLE  UserHandle
+  )
+{
+  //
+  // Handles are pool allocations, so discard the low alignment bits
+  //
+  return (((UINTN)UserHandle) >> 4) & (HANDLE_HASH_TABLE_SIZE - 1);
+}
+
+/**
+  Compute the hash table bucket for a protocol GUID.
+
+  @param  Protocol               The ID of the protocol
+
+  @return The bucket holding the protocol entry if one exists
+
+**/
+UINTN
+CoreProtocolHashIndex (
+  IN EFI_GUID  *Protocol
+  )
+{
+  return (Protocol->Data1 ^ (Protocol->Data1 >> 16)) & (PROTOCOL_HASH_TABLE_SIZE - 1);
+}
+
 /**
   Acquire lock on gProtocolDatabaseLock.
 
@@ -60,6 +133,7 @@ CoreValidateHandle (
   )
 {
   IHANDLE     *Handle;
+  LIST_ENTRY  *Bucket;
   LIST_ENTRY  *Link;
 
   if (UserHandle == NULL) {
@@ -68,8 +142,16 @@ CoreValidateHandle (
 
   ASSERT_LOCKED (&gProtocolDatabaseLock);
 
-  for (Link = gHandleList.BackLink; Link != &gHandleList; Link = Link->BackLink) {
-    Handle = CR (Link, IHANDLE, AllHandles, EFI_HANDLE_SIGNATURE);
+  if (!mHandleHashTablesInitialized) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Only the hash bucket the handle would live in has to be searched
+  //
+  Bucket = &mHandleHashTable[CoreHandleHashIndex (UserHandle)];
+  for (Link = Bucket->ForwardLink; Link != Bucket; Link = Link->ForwardLink) {
+    Handle = CR (Link, IHANDLE, HashLink, EFI_HANDLE_SIGNATURE);
     if (Handle == (IHANDLE *)UserHandle) {
       return EFI_SUCCESS;
     }
@@ -94,22 +176,23 @@ CoreFindProtocolEntry (
   IN BOOLEAN   Create
   )
 {
+  LIST_ENTRY      *Bucket;
   LIST_ENTRY      *Link;
   PROTOCOL_ENTRY  *Item;
   PROTOCOL_ENTRY  *ProtEntry;
 
   ASSERT_LOCKED (&gProtocolDatabaseLock);
 
+  CoreInitializeHandleHashTables ();
+
   //
-  // Search the database for the matching GUID
+  // Search the hash bucket for the matching GUID
   //
 
   ProtEntry = NULL;
-  for (Link = mProtocolDatabase.ForwardLink;
-       Link != &mProtocolDatabase;
-       Link = Link->ForwardLink)
-  {
-    Item = CR (Link, PROTOCOL_ENTRY, AllEntries, PROTOCOL_ENTRY_SIGNATURE);
+  Bucket    = &mProtocolHashTable[CoreProtocolHashIndex (Protocol)];
+  for (Link = Bucket->ForwardLink; Link != Bucket; Link = Link->ForwardLink) {
+    Item = CR (Link, PROTOCOL_ENTRY, HashLink, PROTOCOL_ENTRY_SIGNATURE);
     if (CompareGuid (&Item->ProtocolID, Protocol)) {
       //
       // This is the protocol entry
@@ -137,9 +220,10 @@ CoreFindProtocolEntry (
       InitializeListHead (&ProtEntry->Notify);
 
       //
-      // Add it to protocol database
+      // Add it to protocol database and the GUID hash table
       //
       InsertTailList (&mProtocolDatabase, &ProtEntry->AllEntries);
+      InsertTailList (Bucket, &ProtEntry->HashLink);
     }
   }
 
@@ -406,9 +490,11 @@ CoreInstallProtocolInterfaceNotify (
 
     //
     // Add this handle to the list global list of all handles
-    // in the system
+    // in the system, and to the handle validation hash table
     //
     InsertTailList (&gHandleList, &Handle->AllHandles);
+    CoreInitializeHandleHashTables ();
+    InsertTailList (&mHandleHashTable[CoreHandleHashIndex (Handle)], &Handle->HashLink);
   } else {
     Status = CoreValidateHandle (Handle);
     if (EFI_ERROR (Status)) {
@@ -771,6 +857,7 @@ CoreUninstallProtocolInterface (
   if (IsListEmpty (&Handle->Protocols)) {
     Handle->Signature = 0;
     RemoveEntryList (&Handle->AllHandles);
+    RemoveEntryList (&Handle->HashLink);
     CoreFreePool (Handle);
   }
 
@@ -18,6 +18,8 @@ typedef struct {
   UINTN         Signature;
   /// All handles list of IHANDLE
   LIST_ENTRY    AllHandles;
+  /// Link in the handle validation hash table bucket
+  LIST_ENTRY    HashLink;
   /// List of PROTOCOL_INTERFACE's for this handle
   LIST_ENTRY    Protocols;
   UINTN         LocateRequest;
@@ -38,6 +40,8 @@ typedef struct {
   UINTN         Signature;
   /// Link Entry inserted to mProtocolDatabase
   LIST_ENTRY    AllEntries;
+  /// Link in the protocol GUID hash table bucket
+  LIST_ENTRY    HashLink;
   /// ID of the protocol
   EFI_GUID      ProtocolID;
   /// All protocol interfaces
@@ -580,9 +580,12 @@ CoreLoadPeImage (
   IN  UINT32                    Attribute
   )
 {
-  EFI_STATUS  Status;
-  BOOLEAN     DstBufAlocated;
-  UINTN       Size;
+  EFI_STATUS         Status;
+  BOOLEAN            DstBufAlocated;
+  UINTN              Size;
+  IMAGE_FILE_HANDLE  *FHand;
+  VOID               *EntryPointInImage;
+  BOOLEAN            ExecuteInPlace;
 
   ZeroMem (&Image->ImageContext, sizeof (Image->ImageContext));
 
@@ -633,11 +636,49 @@ CoreLoadPeImage (
       return EFI_UNSUPPORTED;
   }
 
+  //
+  // Execute-in-place fast path.  If the image has its relocations stripped
+  // and the caller supplied source buffer already sits at the address the
+  // image is linked at (an XIP driver in a memory mapped FV), the buffer is
+  // the loaded image: XIP images are built with matching file and section
+  // layout, so no pages need to be allocated and no sections copied.  The
+  // buffer must outlive the image, so the path is only taken when the core
+  // does not own (and free) the source buffer.  Runtime drivers are
+  // excluded because they must be relocated again for the virtual address
+  // map, and TE images because their header is not laid out in place.
+  //
+  ExecuteInPlace = FALSE;
+  FHand          = (IMAGE_FILE_HANDLE *)Pe32Handle;
+  if ((DstBuffer == 0) &&
+      !FHand->FreeBuffer &&
+      Image->ImageContext.RelocationsStripped &&
+      !Image->ImageContext.IsTeImage &&
+      (Image->ImageContext.ImageCodeMemoryType != EfiRuntimeServicesCode) &&
+      ((UINTN)FHand->Source == (UINTN)Image->ImageContext.ImageAddress) &&
+      ((Image->ImageContext.SectionAlignment == 0) ||
+       (((UINTN)FHand->Source & ((UINTN)Image->ImageContext.SectionAlignment - 1)) == 0)))
+  {
+    Status = PeCoffLoaderGetEntryPoint (FHand->Source, &EntryPointInImage);
+    if (!EFI_ERROR (Status)) {
+      Image->ImageContext.EntryPoint = (PHYSICAL_ADDRESS)(UINTN)EntryPointInImage;
+      //
+      // No pages belong to the image, so unload must not free any
+      //
+      Image->NumberOfPages = 0;
+      Image->ImageBasePage = 0;
+      ExecuteInPlace       = TRUE;
+    }
+  }
+
   //
   // Allocate memory of the correct memory type aligned on the required image boundary
   //
   DstBufAlocated = FALSE;
-  if (DstBuffer == 0) {
+  if (ExecuteInPlace) {
+    //
+    // Nothing to allocate, load, or relocate
+    //
+  } else if (DstBuffer == 0) {
     //
     // Allocate Destination Buffer as caller did not pass it in
     //
@@ -729,48 +770,50 @@ CoreLoadPeImage (
     Image->ImageContext.ImageAddress = DstBuffer;
   }
 
-  Image->ImageBasePage = Image->ImageContext.ImageAddress;
-  if (!Image->ImageContext.IsTeImage) {
-    Image->ImageContext.ImageAddress =
-      (Image->ImageContext.ImageAddress + Image->ImageContext.SectionAlignment - 1) &
-      ~((UINTN)Image->ImageContext.SectionAlignment - 1);
-  }
+  if (!ExecuteInPlace) {
+    Image->ImageBasePage = Image->ImageContext.ImageAddress;
+    if (!Image->ImageContext.IsTeImage) {
+      Image->ImageContext.ImageAddress =
+        (Image->ImageContext.ImageAddress + Image->ImageContext.SectionAlignment - 1) &
+        ~((UINTN)Image->ImageContext.SectionAlignment - 1);
+    }
 
-  //
-  // Load the image from the file into the allocated memory
-  //
-  Status = PeCoffLoaderLoadImage (&Image->ImageContext);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
+    //
+    // Load the image from the file into the allocated memory
+    //
+    Status = PeCoffLoaderLoadImage (&Image->ImageContext);
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
 
-  //
-  // If this is a Runtime Driver, then allocate memory for the FixupData that
-  // is used to relocate the image when SetVirtualAddressMap() is called. The
-  // relocation is done by the Runtime AP.
-  //
-  if ((Attribute & EFI_LOAD_PE_IMAGE_ATTRIBUTE_RUNTIME_REGISTRATION) != 0) {
-    if (Image->ImageContext.ImageType == EFI_IMAGE_SUBSYSTEM_EFI_RUNTIME_DRIVER) {
-      Image->ImageContext.FixupData = AllocateRuntimePool ((UINTN)(Image->ImageContext.FixupDataSize));
-      if (Image->ImageContext.FixupData == NULL) {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto Done;
+    //
+    // If this is a Runtime Driver, then allocate memory for the FixupData that
+    // is used to relocate the image when SetVirtualAddressMap() is called. The
+    // relocation is done by the Runtime AP.
+    //
+    if ((Attribute & EFI_LOAD_PE_IMAGE_ATTRIBUTE_RUNTIME_REGISTRATION) != 0) {
+      if (Image->ImageContext.ImageType == EFI_IMAGE_SUBSYSTEM_EFI_RUNTIME_DRIVER) {
+        Image->ImageContext.FixupData = AllocateRuntimePool ((UINTN)(Image->ImageContext.FixupDataSize));
+        if (Image->ImageContext.FixupData == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto Done;
+        }
       }
     }
-  }
 
-  //
-  // Relocate the image in memory
-  //
-  Status = PeCoffLoaderRelocateImage (&Image->ImageContext);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
+    //
+    // Relocate the image in memory
+    //
+    Status = PeCoffLoaderRelocateImage (&Image->ImageContext);
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
 
-  //
-  // Flush the Instruction Cache
-  //
-  InvalidateInstructionCacheRange ((VOID *)(UINTN)Image->ImageContext.ImageAddress, (UINTN)Image->ImageContext.ImageSize);
+    //
+    // Flush the Instruction Cache
+    //
+    InvalidateInstructionCacheRange ((VOID *)(UINTN)Image->ImageContext.ImageAddress, (UINTN)Image->ImageContext.ImageSize);
+  }
 
   //
   // Copy the machine type from the context to the image private data.
@@ -41,6 +41,12 @@ typedef struct {
 
   UINT64             VirtualStart;
   UINT64             Attribute;
+
+  ///
+  /// Link in the size-bucketed free range index.  Only used while Type is
+  /// EfiConventionalMemory; ForwardLink is NULL when the entry is not indexed.
+  ///
+  LIST_ENTRY         FreeRunLink;
 } MEMORY_MAP;
 
 //
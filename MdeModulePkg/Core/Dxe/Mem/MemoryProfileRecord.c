@@ -1367,6 +1367,12 @@ CoreUpdateProfile (
   MEMORY_PROFILE_CONTEXT_DATA  *ContextData;
   MEMORY_PROFILE_ACTION        BasicAction;
 
+  //
+  // The sampling profile operates independently of the full profile and
+  // must see every action, including when the full profile is disabled.
+  //
+  CoreUpdateProfileSample (CallerAddress, Action, MemoryType, Size);
+
   if (!IS_UEFI_MEMORY_PROFILE_ENABLED) {
     return EFI_UNSUPPORTED;
   }
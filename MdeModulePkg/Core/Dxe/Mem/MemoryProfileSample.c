@@ -0,0 +1,237 @@
+/** @file
+  Support routines for the sampled memory profile.
+
+  Unlike the full UEFI memory profile, the sampling profile keeps no
+  per-allocation bookkeeping: one out of every PcdMemoryProfileSampleRate
+  allocation or free actions is copied into a fixed-depth ring selected by
+  the current TPL. DXE executes on a single processor and code at a given
+  TPL can only be preempted by higher TPL code, which records into a
+  different ring, so the producers need no lock. The rings are drained
+  through EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL, which raises to
+  TPL_HIGH_LEVEL for the copy.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "DxeMain.h"
+#include "Imem.h"
+#include <Guid/MemoryProfileSample.h>
+
+//
+// Number of records in each per-TPL ring.
+//
+#define MEMORY_PROFILE_SAMPLE_RING_DEPTH  32
+
+typedef struct {
+  //
+  // Monotonic producer and consumer positions; Head - Tail is the number
+  // of records currently in the ring.
+  //
+  UINTN                           Head;
+  UINTN                           Tail;
+  //
+  // Actions seen since the last recorded sample, for 1/N sampling.
+  //
+  UINTN                           SampleCounter;
+  //
+  // Samples discarded because the ring was full when they were taken.
+  //
+  UINT64                          Dropped;
+  MEMORY_PROFILE_SAMPLE_RECORD    Records[MEMORY_PROFILE_SAMPLE_RING_DEPTH];
+} MEMORY_PROFILE_SAMPLE_RING;
+
+GLOBAL_REMOVE_IF_UNREFERENCED MEMORY_PROFILE_SAMPLE_RING  mMemoryProfileSampleRings[TPL_HIGH_LEVEL + 1];
+
+/**
+  Drain sampled allocation records.
+
+  Copies up to the caller supplied number of records out of the sampling
+  rings, oldest first, and removes the copied records so the ring space can
+  be reused. Records dropped because a ring was full are counted and the
+  count is returned cumulatively.
+
+  @param[in]      This          The EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL instance.
+  @param[in, out] RecordCount   On entry, the number of records Records can hold.
+                                On return, the number of records copied.
+  @param[out]     Records       The buffer to copy the sampled records into.
+  @param[out]     DroppedCount  If not NULL, returns the cumulative number of
+                                samples dropped because a ring was full.
+
+  @retval EFI_SUCCESS            The records were drained successfully.
+  @retval EFI_INVALID_PARAMETER  RecordCount is NULL, or Records is NULL while
+                                 *RecordCount is not zero.
+  @retval EFI_UNSUPPORTED        Memory profile sampling is disabled.
+
+**/
+EFI_STATUS
+EFIAPI
+ProfileSampleProtocolDrainRecords (
+  IN     EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL  *This,
+  IN OUT UINTN                                 *RecordCount,
+  OUT    MEMORY_PROFILE_SAMPLE_RECORD          *Records  OPTIONAL,
+  OUT    UINT64                                *DroppedCount  OPTIONAL
+  );
+
+GLOBAL_REMOVE_IF_UNREFERENCED EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL  mProfileSampleProtocol = {
+  ProfileSampleProtocolDrainRecords,
+};
+
+/**
+  Record a sampled allocation or free action.
+
+  This function implements 1/N sampling against
+  PcdMemoryProfileSampleRate and stores the sampled action in the ring of
+  the current TPL. It is called on every memory service action and returns
+  immediately when sampling is disabled.
+
+  @param CallerAddress  Address of caller who called Allocate or Free.
+  @param Action         This Allocate or Free action.
+  @param MemoryType     Memory type.
+                        EfiMaxMemoryType means the MemoryType is unknown.
+  @param Size           Buffer size in bytes for pool actions, or the number
+                        of pages for page actions.
+
+**/
+VOID
+CoreUpdateProfileSample (
+  IN PHYSICAL_ADDRESS       CallerAddress,
+  IN MEMORY_PROFILE_ACTION  Action,
+  IN EFI_MEMORY_TYPE        MemoryType,
+  IN UINTN                  Size
+  )
+{
+  UINT32                        SampleRate;
+  MEMORY_PROFILE_SAMPLE_RING    *Ring;
+  MEMORY_PROFILE_SAMPLE_RECORD  *Record;
+
+  SampleRate = PcdGet32 (PcdMemoryProfileSampleRate);
+  if (SampleRate == 0) {
+    return;
+  }
+
+  ASSERT (gEfiCurrentTpl <= TPL_HIGH_LEVEL);
+  Ring = &mMemoryProfileSampleRings[gEfiCurrentTpl];
+
+  Ring->SampleCounter++;
+  if (Ring->SampleCounter < SampleRate) {
+    return;
+  }
+
+  Ring->SampleCounter = 0;
+
+  if ((Ring->Head - Ring->Tail) >= MEMORY_PROFILE_SAMPLE_RING_DEPTH) {
+    Ring->Dropped++;
+    return;
+  }
+
+  Record                = &Ring->Records[Ring->Head % MEMORY_PROFILE_SAMPLE_RING_DEPTH];
+  Record->CallerAddress = CallerAddress;
+  Record->Size          = Size;
+  Record->Action        = (UINT32)Action;
+  Record->MemoryType    = (UINT32)MemoryType;
+
+  //
+  // Publish the record only after it is complete.
+  //
+  Ring->Head++;
+}
+
+/**
+  Drain sampled allocation records.
+
+  Copies up to the caller supplied number of records out of the sampling
+  rings, oldest first, and removes the copied records so the ring space can
+  be reused. Records dropped because a ring was full are counted and the
+  count is returned cumulatively.
+
+  @param[in]      This          The EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL instance.
+  @param[in, out] RecordCount   On entry, the number of records Records can hold.
+                                On return, the number of records copied.
+  @param[out]     Records       The buffer to copy the sampled records into.
+  @param[out]     DroppedCount  If not NULL, returns the cumulative number of
+                                samples dropped because a ring was full.
+
+  @retval EFI_SUCCESS            The records were drained successfully.
+  @retval EFI_INVALID_PARAMETER  RecordCount is NULL, or Records is NULL while
+                                 *RecordCount is not zero.
+  @retval EFI_UNSUPPORTED        Memory profile sampling is disabled.
+
+**/
+EFI_STATUS
+EFIAPI
+ProfileSampleProtocolDrainRecords (
+  IN     EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL  *This,
+  IN OUT UINTN                                 *RecordCount,
+  OUT    MEMORY_PROFILE_SAMPLE_RECORD          *Records  OPTIONAL,
+  OUT    UINT64                                *DroppedCount  OPTIONAL
+  )
+{
+  EFI_TPL                     OldTpl;
+  MEMORY_PROFILE_SAMPLE_RING  *Ring;
+  UINTN                       Tpl;
+  UINTN                       Count;
+  UINT64                      Dropped;
+
+  if (PcdGet32 (PcdMemoryProfileSampleRate) == 0) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if ((RecordCount == NULL) || ((Records == NULL) && (*RecordCount != 0))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Raise to TPL_HIGH_LEVEL so no producer can run while the rings are
+  // being drained.
+  //
+  OldTpl = CoreRaiseTpl (TPL_HIGH_LEVEL);
+
+  Count   = 0;
+  Dropped = 0;
+  for (Tpl = 0; Tpl <= TPL_HIGH_LEVEL; Tpl++) {
+    Ring     = &mMemoryProfileSampleRings[Tpl];
+    Dropped += Ring->Dropped;
+    while ((Ring->Tail != Ring->Head) && (Count < *RecordCount)) {
+      Records[Count] = Ring->Records[Ring->Tail % MEMORY_PROFILE_SAMPLE_RING_DEPTH];
+      Ring->Tail++;
+      Count++;
+    }
+  }
+
+  CoreRestoreTpl (OldTpl);
+
+  *RecordCount = Count;
+  if (DroppedCount != NULL) {
+    *DroppedCount = Dropped;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Install memory profile sample protocol.
+
+**/
+VOID
+MemoryProfileSampleInstallProtocol (
+  VOID
+  )
+{
+  EFI_HANDLE  Handle;
+  EFI_STATUS  Status;
+
+  if (PcdGet32 (PcdMemoryProfileSampleRate) == 0) {
+    return;
+  }
+
+  Handle = NULL;
+  Status = CoreInstallMultipleProtocolInterfaces (
+             &Handle,
+             &gEdkiiMemoryProfileSampleGuid,
+             &mProfileSampleProtocol,
+             NULL
+             );
+  ASSERT_EFI_ERROR (Status);
+}
@@ -45,6 +45,26 @@ UINTN       mFreeMapStack = 0;
 LIST_ENTRY  mFreeMemoryMapEntryList           = INITIALIZE_LIST_HEAD_VARIABLE (mFreeMemoryMapEntryList);
 BOOLEAN     mMemoryTypeInformationInitialized = FALSE;
 
+///
+/// Number of buckets in the free range index.  Bucket N holds the free memory
+/// map entries whose size in bytes satisfies 2^N <= Size < 2^(N+1), so a search
+/// for a run of pages only has to visit the buckets that can hold a range large
+/// enough for the request instead of walking the whole memory map.
+///
+#define FREE_PAGE_RUN_BUCKET_COUNT  64
+
+LIST_ENTRY  mFreePageRunBuckets[FREE_PAGE_RUN_BUCKET_COUNT];
+BOOLEAN     mFreePageRunBucketsInitialized = FALSE;
+
+///
+/// TRUE when ranges have been added to the memory map without merging them
+/// with their neighbors.  Coalescing is deferred until the map is published,
+/// a free range search comes up short, or an exact-address conversion finds
+/// the range split across entries, so that alloc/free churn does not pay for
+/// a full map walk on every conversion.
+///
+BOOLEAN  mMemoryMapCoalescePending = FALSE;
+
 EFI_MEMORY_TYPE_STATISTICS  mMemoryTypeStatistics[EfiMaxMemoryType + 1] = {
   { 0, MAX_ALLOC_ADDRESS, 0, 0, EfiMaxMemoryType, TRUE,  FALSE },  // EfiReservedMemoryType
   { 0, MAX_ALLOC_ADDRESS, 0, 0, EfiMaxMemoryType, FALSE, FALSE },  // EfiLoaderCode
@@ -116,6 +136,95 @@ CoreReleaseMemoryLock (
   CoreReleaseLock (&gMemoryLock);
 }
 
+/**
+  Internal function.  Computes the free range index bucket that holds
+  entries of the specified size.
+
+  @param  NumberOfBytes          Size of the range in bytes
+
+  @return The index of the bucket for ranges of this size
+
+**/
+UINTN
+FreePageRunBucketIndex (
+  IN UINT64  NumberOfBytes
+  )
+{
+  INTN  HighBit;
+
+  HighBit = HighBitSet64 (NumberOfBytes);
+  if (HighBit < 0) {
+    HighBit = 0;
+  }
+
+  return (UINTN)HighBit;
+}
+
+/**
+  Internal function.  Adds a memory map entry to the free range index if it
+  describes free memory.  Entries of any other type are left unindexed.
+
+  @param  Entry                  The entry to index
+
+**/
+VOID
+InsertFreePageRun (
+  IN OUT MEMORY_MAP  *Entry
+  )
+{
+  UINTN  Index;
+
+  if (!mFreePageRunBucketsInitialized) {
+    for (Index = 0; Index < FREE_PAGE_RUN_BUCKET_COUNT; Index++) {
+      InitializeListHead (&mFreePageRunBuckets[Index]);
+    }
+
+    mFreePageRunBucketsInitialized = TRUE;
+  }
+
+  if (Entry->Type != EfiConventionalMemory) {
+    Entry->FreeRunLink.ForwardLink = NULL;
+    return;
+  }
+
+  Index = FreePageRunBucketIndex (Entry->End - Entry->Start + 1);
+  InsertHeadList (&mFreePageRunBuckets[Index], &Entry->FreeRunLink);
+}
+
+/**
+  Internal function.  Removes a memory map entry from the free range index
+  if it is currently indexed.
+
+  @param  Entry                  The entry to unindex
+
+**/
+VOID
+RemoveFreePageRun (
+  IN OUT MEMORY_MAP  *Entry
+  )
+{
+  if (Entry->FreeRunLink.ForwardLink != NULL) {
+    RemoveEntryList (&Entry->FreeRunLink);
+    Entry->FreeRunLink.ForwardLink = NULL;
+  }
+}
+
+/**
+  Internal function.  Moves a memory map entry to the free range index bucket
+  matching its current size after the entry has been clipped or extended.
+
+  @param  Entry                  The entry to reindex
+
+**/
+VOID
+RebucketFreePageRun (
+  IN OUT MEMORY_MAP  *Entry
+  )
+{
+  RemoveFreePageRun (Entry);
+  InsertFreePageRun (Entry);
+}
+
 /**
   Internal function.  Removes a descriptor entry.
 
@@ -127,6 +236,7 @@ RemoveMemoryMapEntry (
   IN OUT MEMORY_MAP  *Entry
   )
 {
+  RemoveFreePageRun (Entry);
   RemoveEntryList (&Entry->Link);
   Entry->Link.ForwardLink = NULL;
 
@@ -158,9 +268,6 @@ CoreAddRange (
   IN UINT64                Attribute
   )
 {
-  LIST_ENTRY  *Link;
-  MEMORY_MAP  *Entry;
-
   ASSERT ((Start & EFI_PAGE_MASK) == 0);
   ASSERT (End > Start);
 
@@ -200,34 +307,11 @@ CoreAddRange (
   CoreNotifySignalList (&gEfiEventMemoryMapChangeGuid);
 
   //
-  // Look for adjoining memory descriptor
-  //
-
-  // Two memory descriptors can only be merged if they have the same Type
-  // and the same Attribute
+  // Merging the new range with adjoining descriptors of the same Type and
+  // Attribute is deferred to CoreCoalesceMemoryMap() so that heavy alloc/free
+  // churn does not walk the whole memory map on every conversion
   //
-
-  Link = gMemoryMap.ForwardLink;
-  while (Link != &gMemoryMap) {
-    Entry = CR (Link, MEMORY_MAP, Link, MEMORY_MAP_SIGNATURE);
-    Link  = Link->ForwardLink;
-
-    if (Entry->Type != Type) {
-      continue;
-    }
-
-    if (Entry->Attribute != Attribute) {
-      continue;
-    }
-
-    if (Entry->End + 1 == Start) {
-      Start = Entry->Start;
-      RemoveMemoryMapEntry (Entry);
-    } else if (Entry->Start == End + 1) {
-      End = Entry->End;
-      RemoveMemoryMapEntry (Entry);
-    }
-  }
+  mMemoryMapCoalescePending = TRUE;
 
   //
   // Add descriptor
@@ -241,6 +325,7 @@ CoreAddRange (
   mMapStack[mMapDepth].VirtualStart = 0;
   mMapStack[mMapDepth].Attribute    = Attribute;
   InsertTailList (&gMemoryMap, &mMapStack[mMapDepth].Link);
+  InsertFreePageRun (&mMapStack[mMapDepth]);
 
   mMapDepth += 1;
   ASSERT (mMapDepth < MAX_MAP_DEPTH);
@@ -347,6 +432,7 @@ CoreFreeMemoryMapStack (
       //
       // Move this entry to general memory
       //
+      RemoveFreePageRun (&mMapStack[mMapDepth]);
       RemoveEntryList (&mMapStack[mMapDepth].Link);
       mMapStack[mMapDepth].Link.ForwardLink = NULL;
 
@@ -364,6 +450,7 @@ CoreFreeMemoryMapStack (
       }
 
       InsertTailList (Link2, &Entry->Link);
+      InsertFreePageRun (Entry);
     } else {
       //
       // This item of mMapStack[mMapDepth] has already been dequeued from gMemoryMap list,
@@ -376,6 +463,66 @@ CoreFreeMemoryMapStack (
   mFreeMapStack -= 1;
 }
 
+/**
+  Internal function.  Merges all adjoining memory map descriptors that have
+  the same Type and Attribute.  CoreAddRange() defers this work, so the pass
+  runs once per batch of conversions instead of once per range added.
+
+**/
+VOID
+CoreCoalesceMemoryMap (
+  VOID
+  )
+{
+  LIST_ENTRY  *Link;
+  LIST_ENTRY  *Link2;
+  MEMORY_MAP  *Entry;
+  MEMORY_MAP  *Entry2;
+  BOOLEAN     Merged;
+
+  ASSERT_LOCKED (&gMemoryLock);
+
+  if (!mMemoryMapCoalescePending) {
+    return;
+  }
+
+  mMemoryMapCoalescePending = FALSE;
+
+  //
+  // Repeat until no merge is found so that chains of adjoining descriptors
+  // collapse into a single entry no matter the order they appear in the list
+  //
+  do {
+    Merged = FALSE;
+
+    for (Link = gMemoryMap.ForwardLink; Link != &gMemoryMap; Link = Link->ForwardLink) {
+      Entry = CR (Link, MEMORY_MAP, Link, MEMORY_MAP_SIGNATURE);
+
+      Link2 = Link->ForwardLink;
+      while (Link2 != &gMemoryMap) {
+        Entry2 = CR (Link2, MEMORY_MAP, Link, MEMORY_MAP_SIGNATURE);
+        Link2  = Link2->ForwardLink;
+
+        if ((Entry2->Type != Entry->Type) || (Entry2->Attribute != Entry->Attribute)) {
+          continue;
+        }
+
+        if (Entry2->End + 1 == Entry->Start) {
+          Entry->Start = Entry2->Start;
+          RemoveMemoryMapEntry (Entry2);
+          RebucketFreePageRun (Entry);
+          Merged = TRUE;
+        } else if (Entry2->Start == Entry->End + 1) {
+          Entry->End = Entry2->End;
+          RemoveMemoryMapEntry (Entry2);
+          RebucketFreePageRun (Entry);
+          Merged = TRUE;
+        }
+      }
+    }
+  } while (Merged);
+}
+
 /**
   Find untested but initialized memory regions in GCD map and convert them to be DXE allocatable.
 
@@ -782,6 +929,15 @@ CoreConvertPagesEx (
     //
     if (ChangingType && (NewType != EfiConventionalMemory)) {
       if (Entry->End < End) {
+        //
+        // The range may only appear split because coalescing has been
+        // deferred; merge adjoining descriptors and search again
+        //
+        if (mMemoryMapCoalescePending) {
+          CoreCoalesceMemoryMap ();
+          continue;
+        }
+
         DEBUG ((DEBUG_ERROR | DEBUG_PAGE, "ConvertPages: range %lx - %lx covers multiple entries\n", Start, End));
         return EFI_NOT_FOUND;
       }
@@ -856,11 +1012,13 @@ CoreConvertPagesEx (
       // Clip start
       //
       Entry->Start = RangeEnd + 1;
+      RebucketFreePageRun (Entry);
     } else if (Entry->End == RangeEnd) {
       //
       // Clip end
       //
       Entry->End = Start - 1;
+      RebucketFreePageRun (Entry);
     } else {
       //
       // Pull it out of the center, clip current
@@ -882,9 +1040,11 @@ CoreConvertPagesEx (
 
       Entry->End = Start - 1;
       ASSERT (Entry->Start < Entry->End);
+      RebucketFreePageRun (Entry);
 
       Entry = &mMapStack[mMapDepth];
       InsertTailList (&gMemoryMap, &Entry->Link);
+      InsertFreePageRun (Entry);
 
       mMapDepth += 1;
       ASSERT (mMapDepth < MAX_MAP_DEPTH);
@@ -1036,6 +1196,7 @@ CoreFindFreePagesI (
   UINT64      DescStart;
   UINT64      DescEnd;
   UINT64      DescNumberOfBytes;
+  UINTN       BucketIndex;
   LIST_ENTRY  *Link;
   MEMORY_MAP  *Entry;
 
@@ -1043,6 +1204,13 @@ CoreFindFreePagesI (
     return 0;
   }
 
+  if (!mFreePageRunBucketsInitialized) {
+    //
+    // No free memory has ever been added to the memory map
+    //
+    return 0;
+  }
+
   if ((MaxAddress & EFI_PAGE_MASK) != EFI_PAGE_MASK) {
     //
     // If MaxAddress is not aligned to the end of a page
@@ -1067,70 +1235,76 @@ CoreFindFreePagesI (
   NumberOfBytes = LShiftU64 (NumberOfPages, EFI_PAGE_SHIFT);
   Target        = 0;
 
-  for (Link = gMemoryMap.ForwardLink; Link != &gMemoryMap; Link = Link->ForwardLink) {
-    Entry = CR (Link, MEMORY_MAP, Link, MEMORY_MAP_SIGNATURE);
-
-    //
-    // If it's not a free entry, don't bother with it
-    //
-    if (Entry->Type != EfiConventionalMemory) {
-      continue;
-    }
-
-    DescStart = Entry->Start;
-    DescEnd   = Entry->End;
-
-    //
-    // If desc is past max allowed address or below min allowed address, skip it
-    //
-    if ((DescStart >= MaxAddress) || (DescEnd < MinAddress)) {
-      continue;
-    }
-
-    //
-    // If desc ends past max allowed address, clip the end
-    //
-    if (DescEnd >= MaxAddress) {
-      DescEnd = MaxAddress;
-    }
-
-    DescEnd = ((DescEnd + 1) & (~(Alignment - 1))) - 1;
+  //
+  // Only visit the free range index buckets that can hold an entry large
+  // enough for this request.  Smaller buckets cannot satisfy it, so lookup
+  // cost no longer scales with the number of small free fragments.
+  //
+  for (BucketIndex = FreePageRunBucketIndex (NumberOfBytes);
+       BucketIndex < FREE_PAGE_RUN_BUCKET_COUNT;
+       BucketIndex++)
+  {
+    for (Link = mFreePageRunBuckets[BucketIndex].ForwardLink;
+         Link != &mFreePageRunBuckets[BucketIndex];
+         Link = Link->ForwardLink)
+    {
+      Entry = CR (Link, MEMORY_MAP, FreeRunLink, MEMORY_MAP_SIGNATURE);
 
-    // Skip if DescEnd is less than DescStart after alignment clipping
-    if (DescEnd < DescStart) {
-      continue;
-    }
+      DescStart = Entry->Start;
+      DescEnd   = Entry->End;
 
-    //
-    // Compute the number of bytes we can used from this
-    // descriptor, and see it's enough to satisfy the request
-    //
-    DescNumberOfBytes = DescEnd - DescStart + 1;
+      //
+      // If desc is past max allowed address or below min allowed address, skip it
+      //
+      if ((DescStart >= MaxAddress) || (DescEnd < MinAddress)) {
+        continue;
+      }
 
-    if (DescNumberOfBytes >= NumberOfBytes) {
       //
-      // If the start of the allocated range is below the min address allowed, skip it
+      // If desc ends past max allowed address, clip the end
       //
-      if ((DescEnd - NumberOfBytes + 1) < MinAddress) {
+      if (DescEnd >= MaxAddress) {
+        DescEnd = MaxAddress;
+      }
+
+      DescEnd = ((DescEnd + 1) & (~(Alignment - 1))) - 1;
+
+      // Skip if DescEnd is less than DescStart after alignment clipping
+      if (DescEnd < DescStart) {
         continue;
       }
 
       //
-      // If this is the best match so far remember it
+      // Compute the number of bytes we can used from this
+      // descriptor, and see it's enough to satisfy the request
       //
-      if (DescEnd > Target) {
-        if (NeedGuard) {
-          DescEnd = AdjustMemoryS (
-                      DescEnd + 1 - DescNumberOfBytes,
-                      DescNumberOfBytes,
-                      NumberOfBytes
-                      );
-          if (DescEnd == 0) {
-            continue;
-          }
+      DescNumberOfBytes = DescEnd - DescStart + 1;
+
+      if (DescNumberOfBytes >= NumberOfBytes) {
+        //
+        // If the start of the allocated range is below the min address allowed, skip it
+        //
+        if ((DescEnd - NumberOfBytes + 1) < MinAddress) {
+          continue;
         }
 
-        Target = DescEnd;
+        //
+        // If this is the best match so far remember it
+        //
+        if (DescEnd > Target) {
+          if (NeedGuard) {
+            DescEnd = AdjustMemoryS (
+                        DescEnd + 1 - DescNumberOfBytes,
+                        DescNumberOfBytes,
+                        NumberOfBytes
+                        );
+            if (DescEnd == 0) {
+              continue;
+            }
+          }
+
+          Target = DescEnd;
+        }
       }
     }
   }
@@ -1231,6 +1405,15 @@ FindFreePages (
     return Start;
   }
 
+  //
+  // Merge any deferred adjoining free ranges and retry before falling back
+  // to promoting memory resources
+  //
+  if (mMemoryMapCoalescePending) {
+    CoreCoalesceMemoryMap ();
+    return FindFreePages (MaxAddress, NoPages, NewType, Alignment, NeedGuard);
+  }
+
   //
   // If allocations from the preferred bins fail, then attempt to promote memory resources.
   //
@@ -1799,6 +1982,12 @@ CoreGetMemoryMap (
 
   CoreAcquireMemoryLock ();
 
+  //
+  // Merge any adjoining descriptors whose coalescing was deferred so the
+  // reported map is as compact as possible
+  //
+  CoreCoalesceMemoryMap ();
+
   //
   // Compute the buffer size needed to fit the entire map
   //
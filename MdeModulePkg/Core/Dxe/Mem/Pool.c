@@ -40,6 +40,26 @@ typedef struct {
 
 #define POOL_OVERHEAD  (SIZE_OF_POOL_HEAD + sizeof(POOL_TAIL))
 
+//
+// Slab-style header kept at the start of every page carved up for the
+// segregated free lists.  LiveCount tracks the number of entries in the page
+// that are currently allocated, so freeing an entry can detect an all-free
+// page in O(1) instead of rescanning every entry in the page.
+//
+#define POOL_PAGE_SIGNATURE  SIGNATURE_32('p','p','g','0')
+typedef struct {
+  UINT32    Signature;
+  UINT32    LiveCount;
+} POOL_PAGE;
+
+//
+// The page header reserves one smallest-bin slot so the offsets of the carved
+// entries remain multiples of the bin sizes.
+//
+#define POOL_PAGE_OVERHEAD  128
+
+STATIC_ASSERT (sizeof (POOL_PAGE) <= POOL_PAGE_OVERHEAD, "POOL_PAGE must fit in the reserved slot");
+
 #define HEAD_TO_TAIL(a)   \
   ((POOL_TAIL *) (((CHAR8 *) (a)) + (a)->Size - sizeof(POOL_TAIL)));
 
@@ -358,6 +378,7 @@ CoreAllocatePoolI (
   POOL_FREE  *Free;
   POOL_HEAD  *Head;
   POOL_TAIL  *Tail;
+  POOL_PAGE  *PoolPage;
   CHAR8      *NewPage;
   VOID       *Buffer;
   UINTN      Index;
@@ -456,11 +477,24 @@ CoreAllocatePoolI (
       goto Done;
     }
 
+    //
+    // Reserve the slab page header at the start of the fresh page, then
+    // serve the request from the remaining space
+    //
+    PoolPage            = (POOL_PAGE *)NewPage;
+    PoolPage->Signature = POOL_PAGE_SIGNATURE;
+    PoolPage->LiveCount = 0;
+    NewPage            += POOL_PAGE_OVERHEAD;
+    MaxOffset          -= POOL_PAGE_OVERHEAD;
+
     //
     // Serve the allocation request from the head of the allocated block
     //
 Carve:
-    Head = (POOL_HEAD *)NewPage;
+    Head     = (POOL_HEAD *)NewPage;
+    PoolPage = (POOL_PAGE *)((UINTN)Head & ~(Granularity - 1));
+    ASSERT (PoolPage->Signature == POOL_PAGE_SIGNATURE);
+    PoolPage->LiveCount++;
 
     //
     // Carve up remaining space into free pool blocks
@@ -491,7 +525,10 @@ Carve:
   Free = CR (Pool->FreeList[Index].ForwardLink, POOL_FREE, Link, POOL_FREE_SIGNATURE);
   RemoveEntryList (&Free->Link);
 
-  Head = (POOL_HEAD *)Free;
+  Head     = (POOL_HEAD *)Free;
+  PoolPage = (POOL_PAGE *)((UINTN)Head & ~(Granularity - 1));
+  ASSERT (PoolPage->Signature == POOL_PAGE_SIGNATURE);
+  PoolPage->LiveCount++;
 
 Done:
   Buffer = NULL;
@@ -686,12 +723,12 @@ CoreFreePoolI (
   POOL_HEAD  *Head;
   POOL_TAIL  *Tail;
   POOL_FREE  *Free;
+  POOL_PAGE  *PoolPage;
   UINTN      Index;
   UINTN      NoPages;
   UINTN      Size;
   CHAR8      *NewPage;
   UINTN      Offset;
-  BOOLEAN    AllFree;
   UINTN      Granularity;
   BOOLEAN    IsGuarded;
   BOOLEAN    HasPoolTail;
@@ -807,53 +844,39 @@ CoreFreePoolI (
     InsertHeadList (&Pool->FreeList[Index], &Free->Link);
 
     //
-    // See if all the pool entries in the same page as Free are freed pool
-    // entries
+    // Drop the live entry count of the slab page holding Free, and reclaim
+    // the page once the last allocated entry in it has been released
     //
-    NewPage = (CHAR8 *)((UINTN)Free & ~(Granularity - 1));
-    Free    = (POOL_FREE *)&NewPage[0];
-    ASSERT (Free != NULL);
-
-    if (Free->Signature == POOL_FREE_SIGNATURE) {
-      AllFree = TRUE;
-      Offset  = 0;
-
-      while ((Offset < Granularity) && (AllFree)) {
+    NewPage  = (CHAR8 *)((UINTN)Free & ~(Granularity - 1));
+    PoolPage = (POOL_PAGE *)NewPage;
+    ASSERT (PoolPage->Signature == POOL_PAGE_SIGNATURE);
+    ASSERT (PoolPage->LiveCount > 0);
+    PoolPage->LiveCount--;
+
+    if (PoolPage->LiveCount == 0) {
+      //
+      // All of the pool entries in the same page as Free are free pool
+      // entries
+      // Remove all of these pool entries from the free loop lists.
+      //
+      Offset = POOL_PAGE_OVERHEAD;
+
+      while (Offset < Granularity) {
         Free = (POOL_FREE *)&NewPage[Offset];
         ASSERT (Free != NULL);
-        if (Free->Signature != POOL_FREE_SIGNATURE) {
-          AllFree = FALSE;
-        }
-
+        ASSERT (Free->Signature == POOL_FREE_SIGNATURE);
+        RemoveEntryList (&Free->Link);
         Offset += LIST_TO_SIZE (Free->Index);
       }
 
-      if (AllFree) {
-        //
-        // All of the pool entries in the same page as Free are free pool
-        // entries
-        // Remove all of these pool entries from the free loop lists.
-        //
-        Free = (POOL_FREE *)&NewPage[0];
-        ASSERT (Free != NULL);
-        Offset = 0;
-
-        while (Offset < Granularity) {
-          Free = (POOL_FREE *)&NewPage[Offset];
-          ASSERT (Free != NULL);
-          RemoveEntryList (&Free->Link);
-          Offset += LIST_TO_SIZE (Free->Index);
-        }
-
-        //
-        // Free the page
-        //
-        CoreFreePoolPagesI (
-          Pool->MemoryType,
-          (EFI_PHYSICAL_ADDRESS)(UINTN)NewPage,
-          EFI_SIZE_TO_PAGES (Granularity)
-          );
-      }
+      //
+      // Free the page
+      //
+      CoreFreePoolPagesI (
+        Pool->MemoryType,
+        (EFI_PHYSICAL_ADDRESS)(UINTN)NewPage,
+        EFI_SIZE_TO_PAGES (Granularity)
+        );
     }
   }
 
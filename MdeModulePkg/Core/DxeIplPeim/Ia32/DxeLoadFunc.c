@@ -301,7 +301,9 @@ HandOffToDxeCore (
     //
     // Create page table and save PageMapLevel4 to CR3
     //
+    PERF_INMODULE_BEGIN ("CreateIdentityMappingPageTables");
     PageTables = CreateIdentityMappingPageTables (BaseOfStack, STACK_SIZE, 0, 0);
+    PERF_INMODULE_END ("CreateIdentityMappingPageTables");
 
     //
     // End of PEI phase signal
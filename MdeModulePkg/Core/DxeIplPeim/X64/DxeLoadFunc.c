@@ -93,12 +93,14 @@ HandOffToDxeCore (
     //
     // Create page table and save PageMapLevel4 to CR3
     //
+    PERF_INMODULE_BEGIN ("CreateIdentityMappingPageTables");
     PageTables = CreateIdentityMappingPageTables (
                    (EFI_PHYSICAL_ADDRESS)(UINTN)BaseOfStack,
                    STACK_SIZE,
                    (EFI_PHYSICAL_ADDRESS)(UINTN)GhcbBase,
                    GhcbSize
                    );
+    PERF_INMODULE_END ("CreateIdentityMappingPageTables");
   } else {
     //
     // Set NX for stack feature also require PcdDxeIplBuildPageTables be TRUE
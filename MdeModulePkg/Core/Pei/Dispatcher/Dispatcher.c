@@ -122,6 +122,10 @@ DiscoverPeimsAndOrderWithApriori (
   ASSERT (CoreFileHandle->PeimState != NULL);
   CoreFileHandle->FvFileHandles = AllocateZeroPool (sizeof (EFI_PEI_FILE_HANDLE) * PeimCount);
   ASSERT (CoreFileHandle->FvFileHandles != NULL);
+  CoreFileHandle->PeimDepexGeneration = AllocateZeroPool (sizeof (UINTN) * PeimCount);
+  ASSERT (CoreFileHandle->PeimDepexGeneration != NULL);
+  CoreFileHandle->PeimDepexWaitCount = AllocateZeroPool (sizeof (UINT32) * PeimCount);
+  ASSERT (CoreFileHandle->PeimDepexWaitCount != NULL);
 
   //
   // Get Apriori File handle
@@ -370,6 +374,7 @@ PeiLoadFixAddressHook (
               // Delete the NextResourceHob by marking it as unused.
               //
               GET_HOB_TYPE (NextHob) = EFI_HOB_TYPE_UNUSED;
+              PrivateData->UnusedHobCount++;
             }
           }
         }
@@ -627,6 +632,7 @@ PeiLoadFixAddressHook (
     // Delete CurrentHob by marking it as unused since the memory range described by is rebuilt.
     //
     GET_HOB_TYPE (CurrentHob) = EFI_HOB_TYPE_UNUSED;
+    PrivateData->UnusedHobCount++;
   }
 
   //
@@ -697,6 +703,9 @@ PeiCheckAndSwitchStack (
   EFI_PHYSICAL_ADDRESS               HoleMemBase;
   UINTN                              HoleMemSize;
   UINTN                              HeapTemporaryRamSize;
+  UINT32                             *UsedStackBottom;
+  UINT32                             StackFillValue;
+  UINTN                              UsedStackSize;
   EFI_PHYSICAL_ADDRESS               TempBase1;
   UINTN                              TempSize1;
   EFI_PHYSICAL_ADDRESS               TempBase2;
@@ -916,7 +925,22 @@ PeiCheckAndSwitchStack (
       //
       // Migrate Stack
       //
-      CopyMem ((UINT8 *)(UINTN)(TopOfNewStack - TemporaryStackSize), TemporaryStackBase, TemporaryStackSize);
+      // SEC fills the temporary stack with PcdInitValueInTempStack, so the
+      // words still holding the fill value at the bottom were never used
+      // and do not have to be copied.  On a platform that does not fill
+      // the stack the scan stops at the first word and the whole stack is
+      // copied as before.
+      //
+      StackFillValue  = PcdGet32 (PcdInitValueInTempStack);
+      UsedStackBottom = (UINT32 *)TemporaryStackBase;
+      while (((UINTN)UsedStackBottom < ((UINTN)TemporaryStackBase + TemporaryStackSize)) &&
+             (*UsedStackBottom == StackFillValue))
+      {
+        UsedStackBottom++;
+      }
+
+      UsedStackSize = (UINTN)TemporaryStackBase + TemporaryStackSize - (UINTN)UsedStackBottom;
+      CopyMem ((UINT8 *)(UINTN)(TopOfNewStack - UsedStackSize), UsedStackBottom, UsedStackSize);
 
       //
       // Copy Hole Range Data
@@ -1443,6 +1467,7 @@ PeiDispatcher (
     if (!Private->PeimDispatcherReenter) {
       Private->PeimNeedingDispatch    = FALSE;
       Private->PeimDispatchOnThisPass = FALSE;
+      Private->DispatchPassCount++;
     } else {
       Private->PeimDispatcherReenter = FALSE;
     }
@@ -1480,7 +1505,24 @@ PeiDispatcher (
         PeimFileHandle            = Private->CurrentFileHandle = Private->CurrentFvFileHandles[PeimCount];
 
         if (Private->Fv[FvCount].PeimState[PeimCount] == PEIM_STATE_NOT_DISPATCHED) {
-          if (!DepexSatisfied (Private, PeimFileHandle, PeimCount)) {
+          //
+          // A depex that evaluated to FALSE can only start passing after the
+          // PPI database has changed, so skip re-evaluating it (and the FFS
+          // section search that entails) until another PPI is installed.
+          //
+          if ((Private->Fv[FvCount].PeimDepexGeneration != NULL) &&
+              (Private->Fv[FvCount].PeimDepexGeneration[PeimCount] == Private->PpiData.InstallGeneration + 1))
+          {
+            Private->PeimNeedingDispatch = TRUE;
+          } else if (!DepexSatisfied (Private, PeimFileHandle, PeimCount)) {
+            if (Private->Fv[FvCount].PeimDepexGeneration != NULL) {
+              Private->Fv[FvCount].PeimDepexGeneration[PeimCount] = Private->PpiData.InstallGeneration + 1;
+            }
+
+            if (Private->Fv[FvCount].PeimDepexWaitCount != NULL) {
+              Private->Fv[FvCount].PeimDepexWaitCount[PeimCount]++;
+            }
+
             Private->PeimNeedingDispatch = TRUE;
           } else {
             Status = CoreFvHandle->FvPpi->GetFileInfo (CoreFvHandle->FvPpi, PeimFileHandle, &FvFileInfo);
@@ -1496,6 +1538,15 @@ PeiDispatcher (
                 //
                 Private->Fv[FvCount].PeimState[PeimCount]++;
                 Private->PeimDispatchOnThisPass = TRUE;
+                Private->DispatchedPeimCount++;
+                DEBUG ((
+                  DEBUG_INFO,
+                  "PeiDispatchProfile: Order=%d Pass=%d Waits=%d File=%g\n",
+                  (UINT32)Private->DispatchedPeimCount,
+                  (UINT32)Private->DispatchPassCount,
+                  (Private->Fv[FvCount].PeimDepexWaitCount != NULL) ? Private->Fv[FvCount].PeimDepexWaitCount[PeimCount] : 0,
+                  &FvFileInfo.FileName
+                  ));
               } else {
                 //
                 // The related GuidedSectionExtraction/Decompress PPI for the
@@ -1535,6 +1586,15 @@ PeiDispatcher (
                   // PEIM_STATE_NOT_DISPATCHED move to PEIM_STATE_DISPATCHED
                   //
                   Private->Fv[FvCount].PeimState[PeimCount]++;
+                  Private->DispatchedPeimCount++;
+                  DEBUG ((
+                    DEBUG_INFO,
+                    "PeiDispatchProfile: Order=%d Pass=%d Waits=%d File=%g\n",
+                    (UINT32)Private->DispatchedPeimCount,
+                    (UINT32)Private->DispatchPassCount,
+                    (Private->Fv[FvCount].PeimDepexWaitCount != NULL) ? Private->Fv[FvCount].PeimDepexWaitCount[PeimCount] : 0,
+                    &FvFileInfo.FileName
+                    ));
                   //
                   // Call the PEIM entry point for PEIM driver
                   //
@@ -1647,6 +1707,13 @@ PeiDispatcher (
     //  as it will fail the next time too (nothing has changed).
     //
   } while (Private->PeimNeedingDispatch && Private->PeimDispatchOnThisPass);
+
+  DEBUG ((
+    DEBUG_INFO,
+    "PeiDispatchProfile: %d PEIM(s) dispatched in %d pass(es)\n",
+    (UINT32)Private->DispatchedPeimCount,
+    (UINT32)Private->DispatchPassCount
+    ));
 }
 
 /**
@@ -243,6 +243,187 @@ FileHandleToVolume (
   return NULL;
 }
 
+/**
+  Build the one-pass FFS file index for a firmware volume.
+
+  The volume is enumerated once through the raw FFS walk, validating every
+  file, and the name, type and offset of each file are recorded so that
+  later searches do not have to re-read and re-checksum headers out of the
+  volume.  On any failure the index is simply left unbuilt and searches
+  keep using the raw walk.
+
+  @param Private         Pointer to the PEI Core instance private data.
+  @param CoreFvHandle    The volume to index.
+
+**/
+VOID
+PeiBuildFfsFileIndex (
+  IN PEI_CORE_INSTANCE   *Private,
+  IN PEI_CORE_FV_HANDLE  *CoreFvHandle
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_PEI_FILE_HANDLE           FileHandle;
+  EFI_PEI_FILE_HANDLE           *TempFileHandles;
+  EFI_FFS_FILE_HEADER           *FfsFileHeader;
+  PEI_CORE_FV_FILE_INDEX_ENTRY  *FileIndex;
+  UINTN                         Count;
+  UINTN                         Index;
+
+  //
+  // Enumerate every validated file once, caching the handles in the
+  // dispatcher's temporary file buffer.
+  //
+  Count      = 0;
+  FileHandle = NULL;
+  for ( ; ;) {
+    Status = FindFileEx (CoreFvHandle->FvHandle, NULL, EFI_FV_FILETYPE_ALL, &FileHandle, NULL);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    if (Count >= Private->TempPeimCount) {
+      //
+      // Run out of room, grow the buffer.
+      //
+      TempFileHandles = AllocatePool (
+                          sizeof (EFI_PEI_FILE_HANDLE) * (Private->TempPeimCount + TEMP_FILE_GROWTH_STEP)
+                          );
+      if (TempFileHandles == NULL) {
+        return;
+      }
+
+      CopyMem (
+        TempFileHandles,
+        Private->TempFileHandles,
+        sizeof (EFI_PEI_FILE_HANDLE) * Private->TempPeimCount
+        );
+      Private->TempFileHandles = TempFileHandles;
+      Private->TempPeimCount   = Private->TempPeimCount + TEMP_FILE_GROWTH_STEP;
+    }
+
+    Private->TempFileHandles[Count++] = FileHandle;
+  }
+
+  FileIndex = AllocateZeroPool (sizeof (PEI_CORE_FV_FILE_INDEX_ENTRY) * (Count + 1));
+  if (FileIndex == NULL) {
+    return;
+  }
+
+  for (Index = 0; Index < Count; Index++) {
+    FfsFileHeader = (EFI_FFS_FILE_HEADER *)Private->TempFileHandles[Index];
+    CopyMem (&FileIndex[Index].Name, &FfsFileHeader->Name, sizeof (EFI_GUID));
+    FileIndex[Index].FileOffset = (UINT32)((UINT8 *)FfsFileHeader - (UINT8 *)CoreFvHandle->FvHandle);
+    FileIndex[Index].Type       = FfsFileHeader->Type;
+    if ((FfsFileHeader->Type == EFI_FV_FILETYPE_FREEFORM) &&
+        CompareGuid (&FfsFileHeader->Name, &gPeiAprioriFileNameGuid))
+    {
+      CoreFvHandle->AprioriFileIndex = Index + 1;
+    }
+  }
+
+  CoreFvHandle->FfsFileIndexCount = Count;
+  CoreFvHandle->FfsFileIndex      = FileIndex;
+}
+
+/**
+  Search a firmware volume's FFS file index with the same matching rules as
+  the raw FFS walk in FindFileEx().
+
+  @param CoreFvHandle    The indexed volume to search.
+  @param FileName        File name to search for, or NULL to search by type.
+  @param SearchType      Filter to find only files of this type.
+                         Type EFI_FV_FILETYPE_ALL causes no filtering to be done.
+  @param FileHandle      On input the file to continue the search after, or
+                         NULL to search from the beginning.  On output the
+                         matching file.
+  @param AprioriFile     Pointer to AprioriFile image in this FV if has
+
+  @retval EFI_SUCCESS      A matching file was found.
+  @retval EFI_NOT_FOUND    No files matching the search criteria were found.
+  @retval EFI_UNSUPPORTED  The continuation handle is not in the index; the
+                           caller must fall back to the raw walk.
+
+**/
+EFI_STATUS
+PeiFindFileIndexed (
+  IN     PEI_CORE_FV_HANDLE   *CoreFvHandle,
+  IN     CONST EFI_GUID       *FileName    OPTIONAL,
+  IN     EFI_FV_FILETYPE      SearchType,
+  IN OUT EFI_PEI_FILE_HANDLE  *FileHandle,
+  IN OUT EFI_PEI_FILE_HANDLE  *AprioriFile  OPTIONAL
+  )
+{
+  PEI_CORE_FV_FILE_INDEX_ENTRY  *Entry;
+  UINT8                         *FvBase;
+  UINT32                        FileOffset;
+  UINTN                         StartIndex;
+  UINTN                         Index;
+  BOOLEAN                       Found;
+
+  FvBase = (UINT8 *)CoreFvHandle->FvHandle;
+
+  //
+  // Locate the position to continue the search from
+  //
+  StartIndex = 0;
+  if ((*FileHandle != NULL) && (FileName == NULL)) {
+    FileOffset = (UINT32)((UINT8 *)*FileHandle - FvBase);
+    for (Index = 0; Index < CoreFvHandle->FfsFileIndexCount; Index++) {
+      if (CoreFvHandle->FfsFileIndex[Index].FileOffset == FileOffset) {
+        StartIndex = Index + 1;
+        break;
+      }
+    }
+
+    if (Index == CoreFvHandle->FfsFileIndexCount) {
+      return EFI_UNSUPPORTED;
+    }
+  }
+
+  for (Index = StartIndex; Index < CoreFvHandle->FfsFileIndexCount; Index++) {
+    Entry = &CoreFvHandle->FfsFileIndex[Index];
+    Found = FALSE;
+    if (FileName != NULL) {
+      Found = CompareGuid (&Entry->Name, FileName);
+    } else if (SearchType == PEI_CORE_INTERNAL_FFS_FILE_DISPATCH_TYPE) {
+      Found = (BOOLEAN)((Entry->Type == EFI_FV_FILETYPE_PEIM) ||
+                        (Entry->Type == EFI_FV_FILETYPE_COMBINED_PEIM_DRIVER) ||
+                        (Entry->Type == EFI_FV_FILETYPE_FIRMWARE_VOLUME_IMAGE));
+    } else {
+      Found = (BOOLEAN)(((SearchType == Entry->Type) || (SearchType == EFI_FV_FILETYPE_ALL)) &&
+                        (Entry->Type != EFI_FV_FILETYPE_FFS_PAD));
+    }
+
+    if (Found) {
+      //
+      // Report the Apriori file if the search passed over it, matching the
+      // raw walk behavior.
+      //
+      if ((SearchType == PEI_CORE_INTERNAL_FFS_FILE_DISPATCH_TYPE) &&
+          (AprioriFile != NULL) &&
+          (CoreFvHandle->AprioriFileIndex > StartIndex) &&
+          ((CoreFvHandle->AprioriFileIndex - 1) < Index))
+      {
+        *AprioriFile = (EFI_PEI_FILE_HANDLE)(FvBase + CoreFvHandle->FfsFileIndex[CoreFvHandle->AprioriFileIndex - 1].FileOffset);
+      }
+
+      *FileHandle = (EFI_PEI_FILE_HANDLE)(FvBase + Entry->FileOffset);
+      return EFI_SUCCESS;
+    }
+  }
+
+  if ((SearchType == PEI_CORE_INTERNAL_FFS_FILE_DISPATCH_TYPE) &&
+      (AprioriFile != NULL) &&
+      (CoreFvHandle->AprioriFileIndex > StartIndex))
+  {
+    *AprioriFile = (EFI_PEI_FILE_HANDLE)(FvBase + CoreFvHandle->FfsFileIndex[CoreFvHandle->AprioriFileIndex - 1].FileOffset);
+  }
+
+  *FileHandle = NULL;
+  return EFI_NOT_FOUND;
+}
+
 /**
   Given the input file pointer, search for the first matching file in the
   FFS volume as defined by SearchType. The search starts from FileHeader inside
@@ -283,6 +464,10 @@ FindFileEx (
   UINT8                           FileState;
   UINT8                           DataCheckSum;
   BOOLEAN                         IsFfs3Fv;
+  PEI_CORE_INSTANCE               *PrivateData;
+  PEI_CORE_FV_HANDLE              *CoreFvHandle;
+  UINTN                           Index;
+  EFI_STATUS                      Status;
 
   //
   // Convert the handle of FV to FV header for memory-mapped firmware volume
@@ -290,6 +475,38 @@ FindFileEx (
   FwVolHeader = (EFI_FIRMWARE_VOLUME_HEADER *)FvHandle;
   FileHeader  = (EFI_FFS_FILE_HEADER **)FileHandle;
 
+  //
+  // Serve the search from the volume's one-pass file index when available,
+  // building it on the first search, so repeated searches do not re-read
+  // and re-checksum FFS headers out of the volume.
+  //
+  PrivateData  = PEI_CORE_INSTANCE_FROM_PS_THIS (GetPeiServicesTablePointer ());
+  CoreFvHandle = NULL;
+  for (Index = 0; Index < PrivateData->FvCount; Index++) {
+    if (PrivateData->Fv[Index].FvHandle == FvHandle) {
+      CoreFvHandle = &PrivateData->Fv[Index];
+      break;
+    }
+  }
+
+  if (CoreFvHandle != NULL) {
+    if (!CoreFvHandle->FfsFileIndexBuilt) {
+      //
+      // Mark the build attempted first so the enumeration the build runs
+      // uses the raw walk below.
+      //
+      CoreFvHandle->FfsFileIndexBuilt = TRUE;
+      PeiBuildFfsFileIndex (PrivateData, CoreFvHandle);
+    }
+
+    if (CoreFvHandle->FfsFileIndex != NULL) {
+      Status = PeiFindFileIndexed (CoreFvHandle, FileName, SearchType, FileHandle, AprioriFile);
+      if (Status != EFI_UNSUPPORTED) {
+        return Status;
+      }
+    }
+  }
+
   IsFfs3Fv = CompareGuid (&FwVolHeader->FileSystemGuid, &gEfiFirmwareFileSystem3Guid);
 
   FvLength = FwVolHeader->FvLength;
@@ -805,6 +1022,7 @@ ProcessSection (
   VOID                                   *TempOutputBuffer;
   UINT32                                 TempAuthenticationStatus;
   UINT16                                 GuidedSectionAttributes;
+  CACHE_SECTION_ENTRY                    *ExtendedSection;
 
   PrivateData   = PEI_CORE_INSTANCE_FROM_PS_THIS (PeiServices);
   *OutputBuffer = NULL;
@@ -875,28 +1093,44 @@ ProcessSection (
           PpiOutput      = PrivateData->CacheSection.SectionData[Index];
           PpiOutputSize  = PrivateData->CacheSection.SectionSize[Index];
           Authentication = PrivateData->CacheSection.AuthenticationStatus[Index];
-          //
-          // Search section directly from the cache data.
-          //
-          TempAuthenticationStatus = 0;
-          Status                   = ProcessSection (
-                                       PeiServices,
-                                       SectionType,
-                                       SectionInstance,
-                                       PpiOutput,
-                                       PpiOutputSize,
-                                       &TempOutputBuffer,
-                                       &TempAuthenticationStatus,
-                                       IsFfs3Fv
-                                       );
-          if (!EFI_ERROR (Status)) {
-            *OutputBuffer         = TempOutputBuffer;
-            *AuthenticationStatus = TempAuthenticationStatus | Authentication;
-            return EFI_SUCCESS;
+          break;
+        }
+      }
+
+      if (!SectionCached) {
+        for (Index = 0; Index < PrivateData->CacheSection.ExtendedSectionCount; Index++) {
+          if (Section == PrivateData->CacheSection.ExtendedSection[Index].Section) {
+            SectionCached  = TRUE;
+            PpiOutput      = PrivateData->CacheSection.ExtendedSection[Index].SectionData;
+            PpiOutputSize  = PrivateData->CacheSection.ExtendedSection[Index].SectionSize;
+            Authentication = PrivateData->CacheSection.ExtendedSection[Index].AuthenticationStatus;
+            break;
           }
         }
       }
 
+      if (SectionCached) {
+        //
+        // Search section directly from the cache data.
+        //
+        TempAuthenticationStatus = 0;
+        Status                   = ProcessSection (
+                                     PeiServices,
+                                     SectionType,
+                                     SectionInstance,
+                                     PpiOutput,
+                                     PpiOutputSize,
+                                     &TempOutputBuffer,
+                                     &TempAuthenticationStatus,
+                                     IsFfs3Fv
+                                     );
+        if (!EFI_ERROR (Status)) {
+          *OutputBuffer         = TempOutputBuffer;
+          *AuthenticationStatus = TempAuthenticationStatus | Authentication;
+          return EFI_SUCCESS;
+        }
+      }
+
       //
       // If SectionCached is TRUE, the section data has been cached and scanned.
       //
@@ -952,17 +1186,49 @@ ProcessSection (
         if (!EFI_ERROR (Status)) {
           if ((Authentication & EFI_AUTH_STATUS_NOT_TESTED) == 0) {
             //
-            // Update cache section data.
+            // Update cache section data. Once PeiCore is running from permanent
+            // memory, keep every extraction result in the pool backed overflow
+            // cache instead of recycling ring entries, so a given encapsulation
+            // section is never extracted twice.
             //
-            if (PrivateData->CacheSection.AllSectionCount < CACHE_SETION_MAX_NUMBER) {
-              PrivateData->CacheSection.AllSectionCount++;
+            if (PrivateData->PeiMemoryInstalled) {
+              if (PrivateData->CacheSection.ExtendedSectionCount == PrivateData->CacheSection.ExtendedSectionMax) {
+                ExtendedSection = AllocatePool (sizeof (CACHE_SECTION_ENTRY) * (PrivateData->CacheSection.ExtendedSectionMax + CACHE_SETION_MAX_NUMBER));
+                if (ExtendedSection != NULL) {
+                  if (PrivateData->CacheSection.ExtendedSection != NULL) {
+                    CopyMem (
+                      ExtendedSection,
+                      PrivateData->CacheSection.ExtendedSection,
+                      sizeof (CACHE_SECTION_ENTRY) * PrivateData->CacheSection.ExtendedSectionCount
+                      );
+                  }
+
+                  PrivateData->CacheSection.ExtendedSection     = ExtendedSection;
+                  PrivateData->CacheSection.ExtendedSectionMax += CACHE_SETION_MAX_NUMBER;
+                }
+              }
             }
 
-            PrivateData->CacheSection.Section[PrivateData->CacheSection.SectionIndex]              = Section;
-            PrivateData->CacheSection.SectionData[PrivateData->CacheSection.SectionIndex]          = PpiOutput;
-            PrivateData->CacheSection.SectionSize[PrivateData->CacheSection.SectionIndex]          = PpiOutputSize;
-            PrivateData->CacheSection.AuthenticationStatus[PrivateData->CacheSection.SectionIndex] = Authentication;
-            PrivateData->CacheSection.SectionIndex                                                 = (PrivateData->CacheSection.SectionIndex + 1)%CACHE_SETION_MAX_NUMBER;
+            if (PrivateData->PeiMemoryInstalled &&
+                (PrivateData->CacheSection.ExtendedSectionCount < PrivateData->CacheSection.ExtendedSectionMax))
+            {
+              Index = PrivateData->CacheSection.ExtendedSectionCount;
+              PrivateData->CacheSection.ExtendedSection[Index].Section              = Section;
+              PrivateData->CacheSection.ExtendedSection[Index].SectionData          = PpiOutput;
+              PrivateData->CacheSection.ExtendedSection[Index].SectionSize          = PpiOutputSize;
+              PrivateData->CacheSection.ExtendedSection[Index].AuthenticationStatus = Authentication;
+              PrivateData->CacheSection.ExtendedSectionCount++;
+            } else {
+              if (PrivateData->CacheSection.AllSectionCount < CACHE_SETION_MAX_NUMBER) {
+                PrivateData->CacheSection.AllSectionCount++;
+              }
+
+              PrivateData->CacheSection.Section[PrivateData->CacheSection.SectionIndex]              = Section;
+              PrivateData->CacheSection.SectionData[PrivateData->CacheSection.SectionIndex]          = PpiOutput;
+              PrivateData->CacheSection.SectionSize[PrivateData->CacheSection.SectionIndex]          = PpiOutputSize;
+              PrivateData->CacheSection.AuthenticationStatus[PrivateData->CacheSection.SectionIndex] = Authentication;
+              PrivateData->CacheSection.SectionIndex                                                 = (PrivateData->CacheSection.SectionIndex + 1)%CACHE_SETION_MAX_NUMBER;
+            }
           }
 
           TempAuthenticationStatus = 0;
@@ -201,6 +201,7 @@ RemoveFvHobsInTemporaryMemory (
       {
         DEBUG ((DEBUG_INFO, "      Removing FV HOB to an FV in T-RAM (was not migrated).\n"));
         Hob.Header->HobType = EFI_HOB_TYPE_UNUSED;
+        Private->UnusedHobCount++;
       }
     }
   }
@@ -301,6 +302,7 @@ ConvertMemoryAllocationHobs (
   It will search and reuse the unused(freed) memory allocation HOB,
   or build memory allocation HOB normally if no unused(freed) memory allocation HOB found.
 
+  @param[in] PrivateData        Pointer to PeiCore's private data structure.
   @param[in] BaseAddress        The 64 bit physical address of the memory.
   @param[in] Length             The length of the memory allocation in bytes.
   @param[in] MemoryType         The type of memory allocated by this HOB.
@@ -308,6 +310,7 @@ ConvertMemoryAllocationHobs (
 **/
 VOID
 InternalBuildMemoryAllocationHob (
+  IN PEI_CORE_INSTANCE     *PrivateData,
   IN EFI_PHYSICAL_ADDRESS  BaseAddress,
   IN UINT64                Length,
   IN EFI_MEMORY_TYPE       MemoryType
@@ -317,24 +320,28 @@ InternalBuildMemoryAllocationHob (
   EFI_HOB_MEMORY_ALLOCATION  *MemoryAllocationHob;
 
   //
-  // Search unused(freed) memory allocation HOB.
+  // Search unused(freed) memory allocation HOB.  The walk is skipped in the
+  // common case that no HOB is marked unused.
   //
   MemoryAllocationHob = NULL;
-  Hob.Raw             = GetFirstHob (EFI_HOB_TYPE_UNUSED);
-  while (Hob.Raw != NULL) {
-    if (Hob.Header->HobLength == sizeof (EFI_HOB_MEMORY_ALLOCATION)) {
-      MemoryAllocationHob = (EFI_HOB_MEMORY_ALLOCATION *)Hob.Raw;
-      break;
-    }
+  if (PrivateData->UnusedHobCount != 0) {
+    Hob.Raw = GetFirstHob (EFI_HOB_TYPE_UNUSED);
+    while (Hob.Raw != NULL) {
+      if (Hob.Header->HobLength == sizeof (EFI_HOB_MEMORY_ALLOCATION)) {
+        MemoryAllocationHob = (EFI_HOB_MEMORY_ALLOCATION *)Hob.Raw;
+        break;
+      }
 
-    Hob.Raw = GET_NEXT_HOB (Hob);
-    Hob.Raw = GetNextHob (EFI_HOB_TYPE_UNUSED, Hob.Raw);
+      Hob.Raw = GET_NEXT_HOB (Hob);
+      Hob.Raw = GetNextHob (EFI_HOB_TYPE_UNUSED, Hob.Raw);
+    }
   }
 
   if (MemoryAllocationHob != NULL) {
     //
     // Reuse the unused(freed) memory allocation HOB.
     //
+    PrivateData->UnusedHobCount--;
     MemoryAllocationHob->Header.HobType = EFI_HOB_TYPE_MEMORY_ALLOCATION;
     ZeroMem (&(MemoryAllocationHob->AllocDescriptor.Name), sizeof (EFI_GUID));
     MemoryAllocationHob->AllocDescriptor.MemoryBaseAddress = BaseAddress;
@@ -360,6 +367,7 @@ InternalBuildMemoryAllocationHob (
 /**
   Update or split memory allocation HOB for memory pages allocate and free.
 
+  @param[in]      PrivateData           Pointer to PeiCore's private data structure.
   @param[in, out] MemoryAllocationHob   Pointer to the memory allocation HOB
                                         that needs to be updated or split.
                                         On output, it will be filled with
@@ -372,6 +380,7 @@ InternalBuildMemoryAllocationHob (
 **/
 VOID
 UpdateOrSplitMemoryAllocationHob (
+  IN PEI_CORE_INSTANCE              *PrivateData,
   IN OUT EFI_HOB_MEMORY_ALLOCATION  *MemoryAllocationHob,
   IN EFI_PHYSICAL_ADDRESS           Memory,
   IN UINT64                         Bytes,
@@ -385,6 +394,7 @@ UpdateOrSplitMemoryAllocationHob (
     // Last pages need to be split out.
     //
     InternalBuildMemoryAllocationHob (
+      PrivateData,
       Memory + Bytes,
       (MemoryAllocationHob->AllocDescriptor.MemoryBaseAddress + MemoryAllocationHob->AllocDescriptor.MemoryLength) - (Memory + Bytes),
       MemoryAllocationHob->AllocDescriptor.MemoryType
@@ -396,6 +406,7 @@ UpdateOrSplitMemoryAllocationHob (
     // First pages need to be split out.
     //
     InternalBuildMemoryAllocationHob (
+      PrivateData,
       MemoryAllocationHob->AllocDescriptor.MemoryBaseAddress,
       Memory - MemoryAllocationHob->AllocDescriptor.MemoryBaseAddress,
       MemoryAllocationHob->AllocDescriptor.MemoryType
@@ -413,13 +424,15 @@ UpdateOrSplitMemoryAllocationHob (
 /**
   Merge adjacent free memory ranges in memory allocation HOBs.
 
+  @param[in] PrivateData    Pointer to PeiCore's private data structure.
+
   @retval TRUE          There are free memory ranges merged.
   @retval FALSE         No free memory ranges merged.
 
 **/
 BOOLEAN
 MergeFreeMemoryInMemoryAllocationHob (
-  VOID
+  IN PEI_CORE_INSTANCE  *PrivateData
   )
 {
   EFI_PEI_HOB_POINTERS       Hob;
@@ -454,6 +467,7 @@ MergeFreeMemoryInMemoryAllocationHob (
             // Mark MemoryHob to be unused(freed).
             //
             MemoryHob->Header.HobType = EFI_HOB_TYPE_UNUSED;
+            PrivateData->UnusedHobCount++;
             break;
           } else if (End == MemoryHob2->AllocDescriptor.MemoryBaseAddress) {
             //
@@ -466,6 +480,7 @@ MergeFreeMemoryInMemoryAllocationHob (
             // Mark MemoryHob to be unused(freed).
             //
             MemoryHob->Header.HobType = EFI_HOB_TYPE_UNUSED;
+            PrivateData->UnusedHobCount++;
             break;
           }
         }
@@ -485,6 +500,7 @@ MergeFreeMemoryInMemoryAllocationHob (
 /**
   Find free memory by searching memory allocation HOBs.
 
+  @param[in]  PrivateData       Pointer to PeiCore's private data structure.
   @param[in]  MemoryType        The type of memory to allocate.
   @param[in]  Pages             The number of contiguous 4 KB pages to allocate.
   @param[in]  Granularity       Page allocation granularity.
@@ -497,6 +513,7 @@ MergeFreeMemoryInMemoryAllocationHob (
 **/
 EFI_STATUS
 FindFreeMemoryFromMemoryAllocationHob (
+  IN  PEI_CORE_INSTANCE     *PrivateData,
   IN  EFI_MEMORY_TYPE       MemoryType,
   IN  UINTN                 Pages,
   IN  UINTN                 Granularity,
@@ -543,15 +560,15 @@ FindFreeMemoryFromMemoryAllocationHob (
   }
 
   if (MemoryAllocationHob != NULL) {
-    UpdateOrSplitMemoryAllocationHob (MemoryAllocationHob, BaseAddress, Bytes, MemoryType);
+    UpdateOrSplitMemoryAllocationHob (PrivateData, MemoryAllocationHob, BaseAddress, Bytes, MemoryType);
     *Memory = BaseAddress;
     return EFI_SUCCESS;
   } else {
-    if (MergeFreeMemoryInMemoryAllocationHob ()) {
+    if (MergeFreeMemoryInMemoryAllocationHob (PrivateData)) {
       //
       // Retry if there are free memory ranges merged.
       //
-      return FindFreeMemoryFromMemoryAllocationHob (MemoryType, Pages, Granularity, Memory);
+      return FindFreeMemoryFromMemoryAllocationHob (PrivateData, MemoryType, Pages, Granularity, Memory);
     }
 
     return EFI_NOT_FOUND;
@@ -667,6 +684,7 @@ PeiAllocatePages (
     // the pages that we will lose to rounding
     //
     InternalBuildMemoryAllocationHob (
+      PrivateData,
       *(FreeMemoryTop),
       Padding & ~(UINTN)EFI_PAGE_MASK,
       EfiConventionalMemory
@@ -685,7 +703,7 @@ PeiAllocatePages (
     //
     // Try to find free memory by searching memory allocation HOBs.
     //
-    Status = FindFreeMemoryFromMemoryAllocationHob (MemoryType, Pages, Granularity, Memory);
+    Status = FindFreeMemoryFromMemoryAllocationHob (PrivateData, MemoryType, Pages, Granularity, Memory);
     if (!EFI_ERROR (Status)) {
       return Status;
     }
@@ -708,6 +726,7 @@ PeiAllocatePages (
     // Create a memory allocation HOB.
     //
     InternalBuildMemoryAllocationHob (
+      PrivateData,
       *(FreeMemoryTop),
       Pages * EFI_PAGE_SIZE,
       MemoryType
@@ -756,6 +775,7 @@ FreeMemoryAllocationHob (
     // Mark the memory allocation HOB to be unused(freed).
     //
     MemoryAllocationHobToFree->Header.HobType = EFI_HOB_TYPE_UNUSED;
+    PrivateData->UnusedHobCount++;
 
     MemoryAllocationHob = NULL;
     Hob.Raw             = GetFirstHob (EFI_HOB_TYPE_MEMORY_ALLOCATION);
@@ -849,7 +869,7 @@ PeiFreePages (
   }
 
   if (MemoryAllocationHob != NULL) {
-    UpdateOrSplitMemoryAllocationHob (MemoryAllocationHob, Memory, Bytes, EfiConventionalMemory);
+    UpdateOrSplitMemoryAllocationHob (PrivateData, MemoryAllocationHob, Memory, Bytes, EfiConventionalMemory);
     FreeMemoryAllocationHob (PrivateData, MemoryAllocationHob);
     return EFI_SUCCESS;
   } else {
@@ -114,6 +114,12 @@ typedef struct {
   /// Notify List at callback level.
   ///
   PEI_DISPATCH_NOTIFY_LIST    DispatchNotifyList;
+  ///
+  /// Bumped whenever a PPI is installed or reinstalled.  A dependency
+  /// expression that evaluated to FALSE cannot start passing until this
+  /// changes, which lets the dispatcher skip re-evaluating it.
+  ///
+  UINTN                       InstallGeneration;
 } PEI_PPI_DATABASE;
 
 //
@@ -131,21 +137,58 @@ typedef struct {
 //
 #define FV_GROWTH_STEP  8
 
+///
+/// Cached metadata for one validated FFS file.  A firmware volume is walked
+/// and checksummed once to build its index; later file searches consult the
+/// index instead of re-reading FFS headers out of memory mapped flash.
+///
 typedef struct {
-  EFI_FIRMWARE_VOLUME_HEADER     *FvHeader;
-  EFI_PEI_FIRMWARE_VOLUME_PPI    *FvPpi;
-  EFI_PEI_FV_HANDLE              FvHandle;
-  UINTN                          PeimCount;
+  EFI_GUID           Name;
+  UINT32             FileOffset;
+  EFI_FV_FILETYPE    Type;
+} PEI_CORE_FV_FILE_INDEX_ENTRY;
+
+typedef struct {
+  EFI_FIRMWARE_VOLUME_HEADER      *FvHeader;
+  EFI_PEI_FIRMWARE_VOLUME_PPI     *FvPpi;
+  EFI_PEI_FV_HANDLE               FvHandle;
+  UINTN                           PeimCount;
   //
   // Pointer to the buffer with the PeimCount number of Entries.
   //
-  UINT8                          *PeimState;
+  UINT8                           *PeimState;
   //
   // Pointer to the buffer with the PeimCount number of Entries.
   //
-  EFI_PEI_FILE_HANDLE            *FvFileHandles;
-  BOOLEAN                        ScanFv;
-  UINT32                         AuthenticationStatus;
+  EFI_PEI_FILE_HANDLE             *FvFileHandles;
+  //
+  // Per PEIM, the PPI database InstallGeneration at the last failed depex
+  // evaluation plus one, 0 when the depex has not been evaluated yet.
+  //
+  UINTN                           *PeimDepexGeneration;
+  //
+  // Per PEIM, number of depex evaluations that returned FALSE before the
+  // PEIM was dispatched.  Reported in the dispatch profile.
+  //
+  UINT32                          *PeimDepexWaitCount;
+  BOOLEAN                         ScanFv;
+  UINT32                          AuthenticationStatus;
+  //
+  // One-pass index of the validated FFS files in this FV, built on the
+  // first file search.  NULL when not built (or the build failed), in
+  // which case searches fall back to walking the raw FFS headers.
+  //
+  PEI_CORE_FV_FILE_INDEX_ENTRY    *FfsFileIndex;
+  UINTN                           FfsFileIndexCount;
+  //
+  // Position of the Apriori file in FfsFileIndex plus one, 0 when absent.
+  //
+  UINTN                           AprioriFileIndex;
+  //
+  // Set once an index build has been attempted, so a failed build is not
+  // retried and the build's own file enumeration uses the raw walk.
+  //
+  BOOLEAN                         FfsFileIndexBuilt;
 } PEI_CORE_FV_HANDLE;
 
 typedef struct {
@@ -156,6 +199,13 @@ typedef struct {
   EFI_PEI_NOTIFY_DESCRIPTOR    NotifyDescriptor;
 } PEI_CORE_UNKNOW_FORMAT_FV_INFO;
 
+typedef struct {
+  EFI_COMMON_SECTION_HEADER    *Section;
+  VOID                         *SectionData;
+  UINTN                        SectionSize;
+  UINT32                       AuthenticationStatus;
+} CACHE_SECTION_ENTRY;
+
 #define CACHE_SETION_MAX_NUMBER  0x10
 typedef struct {
   EFI_COMMON_SECTION_HEADER    *Section[CACHE_SETION_MAX_NUMBER];
@@ -164,6 +214,13 @@ typedef struct {
   UINT32                       AuthenticationStatus[CACHE_SETION_MAX_NUMBER];
   UINTN                        AllSectionCount;
   UINTN                        SectionIndex;
+  //
+  // Overflow cache used after PeiCore is running from permanent memory, so
+  // that a given encapsulation section is extracted at most once per boot.
+  //
+  CACHE_SECTION_ENTRY          *ExtendedSection;
+  UINTN                        ExtendedSectionCount;
+  UINTN                        ExtendedSectionMax;
 } CACHE_SECTION_DATA;
 
 #define HOLE_MAX_NUMBER  0x3
@@ -254,6 +311,13 @@ struct _PEI_CORE_INSTANCE {
   BOOLEAN                           PeimNeedingDispatch;
   BOOLEAN                           PeimDispatchOnThisPass;
   BOOLEAN                           PeimDispatcherReenter;
+  ///
+  /// Dispatch profile counters: number of full dispatcher passes made so
+  /// far and number of PEIMs dispatched so far, both reported per PEIM in
+  /// the PeiDispatchProfile debug output.
+  ///
+  UINTN                             DispatchPassCount;
+  UINTN                             DispatchedPeimCount;
   EFI_PEI_HOB_POINTERS              HobList;
   BOOLEAN                           SwitchStackSignal;
   BOOLEAN                           PeiMemoryInstalled;
@@ -272,6 +336,12 @@ struct _PEI_CORE_INSTANCE {
   // Information for migrating memory pages allocated in pre-memory phase.
   //
   HOLE_MEMORY_DATA                  MemoryPages;
+  //
+  // Number of HOBs currently marked EFI_HOB_TYPE_UNUSED, so the reuse scan
+  // in the page allocation path can be skipped when there is nothing to
+  // reuse.
+  //
+  UINTN                             UnusedHobCount;
   PEICORE_FUNCTION_POINTER          ShadowedPeiCore;
   CACHE_SECTION_DATA                CacheSection;
   //
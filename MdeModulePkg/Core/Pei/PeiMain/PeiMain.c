@@ -236,6 +236,18 @@ PeiCore (
           if (OldCoreData->Fv[Index].FvFileHandles != NULL) {
             OldCoreData->Fv[Index].FvFileHandles = (EFI_PEI_FILE_HANDLE *)((UINT8 *)OldCoreData->Fv[Index].FvFileHandles + OldCoreData->HeapOffset);
           }
+
+          if (OldCoreData->Fv[Index].PeimDepexGeneration != NULL) {
+            OldCoreData->Fv[Index].PeimDepexGeneration = (UINTN *)((UINT8 *)OldCoreData->Fv[Index].PeimDepexGeneration + OldCoreData->HeapOffset);
+          }
+
+          if (OldCoreData->Fv[Index].PeimDepexWaitCount != NULL) {
+            OldCoreData->Fv[Index].PeimDepexWaitCount = (UINT32 *)((UINT8 *)OldCoreData->Fv[Index].PeimDepexWaitCount + OldCoreData->HeapOffset);
+          }
+
+          if (OldCoreData->Fv[Index].FfsFileIndex != NULL) {
+            OldCoreData->Fv[Index].FfsFileIndex = (PEI_CORE_FV_FILE_INDEX_ENTRY *)((UINT8 *)OldCoreData->Fv[Index].FfsFileIndex + OldCoreData->HeapOffset);
+          }
         }
 
         OldCoreData->TempFileGuid    = (EFI_GUID *)((UINT8 *)OldCoreData->TempFileGuid + OldCoreData->HeapOffset);
@@ -271,6 +283,18 @@ PeiCore (
           if (OldCoreData->Fv[Index].FvFileHandles != NULL) {
             OldCoreData->Fv[Index].FvFileHandles = (EFI_PEI_FILE_HANDLE *)((UINT8 *)OldCoreData->Fv[Index].FvFileHandles - OldCoreData->HeapOffset);
           }
+
+          if (OldCoreData->Fv[Index].PeimDepexGeneration != NULL) {
+            OldCoreData->Fv[Index].PeimDepexGeneration = (UINTN *)((UINT8 *)OldCoreData->Fv[Index].PeimDepexGeneration - OldCoreData->HeapOffset);
+          }
+
+          if (OldCoreData->Fv[Index].PeimDepexWaitCount != NULL) {
+            OldCoreData->Fv[Index].PeimDepexWaitCount = (UINT32 *)((UINT8 *)OldCoreData->Fv[Index].PeimDepexWaitCount - OldCoreData->HeapOffset);
+          }
+
+          if (OldCoreData->Fv[Index].FfsFileIndex != NULL) {
+            OldCoreData->Fv[Index].FfsFileIndex = (PEI_CORE_FV_FILE_INDEX_ENTRY *)((UINT8 *)OldCoreData->Fv[Index].FfsFileIndex - OldCoreData->HeapOffset);
+          }
         }
 
         OldCoreData->TempFileGuid    = (EFI_GUID *)((UINT8 *)OldCoreData->TempFileGuid - OldCoreData->HeapOffset);
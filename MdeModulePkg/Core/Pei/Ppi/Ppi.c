@@ -528,6 +528,12 @@ InternalPeiInstallPpi (
     PpiList++;
   }
 
+  //
+  // The PPI database changed, so dependency expressions that failed before
+  // are worth re-evaluating.
+  //
+  PrivateData->PpiData.InstallGeneration++;
+
   //
   // Process any callback level notifies for newly installed PPIs.
   //
@@ -625,6 +631,7 @@ PeiReInstallPpi (
   //
   DEBUG ((DEBUG_INFO, "Reinstall PPI: %g\n", NewPpi->Guid));
   PrivateData->PpiData.PpiList.PpiPtrs[Index].Ppi = (EFI_PEI_PPI_DESCRIPTOR *)NewPpi;
+  PrivateData->PpiData.InstallGeneration++;
 
   //
   // Process any callback level notifies for the newly installed PPI.
@@ -1206,6 +1206,49 @@ SmiHandlerProfileUnregisterHandler (
   IN UINTN                         ContextSize OPTIONAL
   );
 
+/**
+  This function is called by the SMM CPU driver to report the time spent
+  waiting for all CPUs to rendezvous for the current SMI, to SmmCore.
+  The reported value is stamped into the SMI latency records produced
+  while dispatching the current SMI.
+
+  @param This              The protocol instance
+  @param RendezvousCycles  The TSC cycles spent waiting for all CPUs
+                           to rendezvous for the current SMI.
+
+  @retval EFI_SUCCESS      The information is recorded.
+  @retval EFI_UNSUPPORTED  The SMI latency ring is not enabled.
+**/
+EFI_STATUS
+EFIAPI
+SmiHandlerProfileRecordSmiRendezvous (
+  IN SMI_HANDLER_PROFILE_PROTOCOL  *This,
+  IN UINT64                        RendezvousCycles
+  );
+
+/**
+  Record one SMI handler invocation into the SMI latency ring buffer.
+
+  This function is called by SmiManage() on the BSP with the other CPUs
+  held in SMM, so no lock is needed for the ring buffer update.
+  If the ring buffer is full, the oldest record is overwritten.
+
+  @param HandlerType  Points to the handler type GUID, or NULL for the root
+                      SMI handler.
+  @param SmiHandler   The SMI handler that was invoked.
+  @param StartTsc     The TSC value when the handler was invoked.
+  @param Cycles       The TSC cycles spent in the handler.
+**/
+VOID
+SmiHandlerProfileRecordSmiLatency (
+  IN CONST EFI_GUID  *HandlerType  OPTIONAL,
+  IN SMI_HANDLER     *SmiHandler,
+  IN UINT64          StartTsc,
+  IN UINT64          Cycles
+  );
+
+extern BOOLEAN  mSmiHandlerProfileLatencyEnabled;
+
 extern UINTN                 mFullSmramRangeCount;
 extern EFI_SMRAM_DESCRIPTOR  *mFullSmramRanges;
 
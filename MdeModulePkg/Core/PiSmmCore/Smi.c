@@ -108,9 +108,11 @@ SmiManage (
   SMI_HANDLER  *SmiHandler;
   BOOLEAN      SuccessReturn;
   EFI_STATUS   Status;
+  UINT64       StartTsc;
 
   Status        = EFI_NOT_FOUND;
   SuccessReturn = FALSE;
+  StartTsc      = 0;
   if (HandlerType == NULL) {
     //
     // Root SMI handler
@@ -134,6 +136,10 @@ SmiManage (
   for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
     SmiHandler = CR (Link, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
 
+    if (mSmiHandlerProfileLatencyEnabled) {
+      StartTsc = AsmReadTsc ();
+    }
+
     Status = SmiHandler->Handler (
                            (EFI_HANDLE)SmiHandler,
                            Context,
@@ -141,6 +147,10 @@ SmiManage (
                            CommBufferSize
                            );
 
+    if (mSmiHandlerProfileLatencyEnabled) {
+      SmiHandlerProfileRecordSmiLatency (HandlerType, SmiHandler, StartTsc, AsmReadTsc () - StartTsc);
+    }
+
     switch (Status) {
       case EFI_INTERRUPT_PENDING:
         //
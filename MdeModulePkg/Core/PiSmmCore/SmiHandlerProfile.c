@@ -98,9 +98,21 @@ GLOBAL_REMOVE_IF_UNREFERENCED UINTN  mSmmHardwareSmiDatabaseSize;
 
 GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN  mSmiHandlerProfileRecordingStatus;
 
+//
+// The number of SMI_HANDLER_PROFILE_LATENCY_RECORD entries in the
+// continuous SMI latency ring buffer.
+//
+#define SMI_HANDLER_PROFILE_LATENCY_RING_DEPTH  256
+
+GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN                             mSmiHandlerProfileLatencyEnabled;
+GLOBAL_REMOVE_IF_UNREFERENCED SMI_HANDLER_PROFILE_LATENCY_RECORD  *mSmiHandlerProfileLatencyRing;
+GLOBAL_REMOVE_IF_UNREFERENCED UINT64                              mSmiHandlerProfileLatencyRecordCount;
+GLOBAL_REMOVE_IF_UNREFERENCED UINT64                              mSmiHandlerProfileRendezvousCycles;
+
 GLOBAL_REMOVE_IF_UNREFERENCED SMI_HANDLER_PROFILE_PROTOCOL  mSmiHandlerProfile = {
   SmiHandlerProfileRegisterHandler,
   SmiHandlerProfileUnregisterHandler,
+  SmiHandlerProfileRecordSmiRendezvous,
 };
 
 /**
@@ -974,6 +986,138 @@ Done:
   mSmiHandlerProfileRecordingStatus = SmiHandlerProfileRecordingStatus;
 }
 
+/**
+  Record one SMI handler invocation into the SMI latency ring buffer.
+
+  This function is called by SmiManage() on the BSP with the other CPUs
+  held in SMM, so no lock is needed for the ring buffer update.
+  If the ring buffer is full, the oldest record is overwritten.
+
+  @param HandlerType  Points to the handler type GUID, or NULL for the root
+                      SMI handler.
+  @param SmiHandler   The SMI handler that was invoked.
+  @param StartTsc     The TSC value when the handler was invoked.
+  @param Cycles       The TSC cycles spent in the handler.
+**/
+VOID
+SmiHandlerProfileRecordSmiLatency (
+  IN CONST EFI_GUID  *HandlerType  OPTIONAL,
+  IN SMI_HANDLER     *SmiHandler,
+  IN UINT64          StartTsc,
+  IN UINT64          Cycles
+  )
+{
+  SMI_HANDLER_PROFILE_LATENCY_RECORD  *Record;
+
+  if (mSmiHandlerProfileLatencyRing == NULL) {
+    return;
+  }
+
+  Record = &mSmiHandlerProfileLatencyRing[mSmiHandlerProfileLatencyRecordCount % SMI_HANDLER_PROFILE_LATENCY_RING_DEPTH];
+  if (HandlerType != NULL) {
+    CopyGuid (&Record->HandlerType, HandlerType);
+  } else {
+    ZeroMem (&Record->HandlerType, sizeof (EFI_GUID));
+  }
+
+  Record->Handler          = (UINT64)(UINTN)SmiHandler->Handler;
+  Record->StartTsc         = StartTsc;
+  Record->Cycles           = Cycles;
+  Record->RendezvousCycles = mSmiHandlerProfileRendezvousCycles;
+
+  mSmiHandlerProfileLatencyRecordCount++;
+}
+
+/**
+  This function is called by the SMM CPU driver to report the time spent
+  waiting for all CPUs to rendezvous for the current SMI, to SmmCore.
+  The reported value is stamped into the SMI latency records produced
+  while dispatching the current SMI.
+
+  @param This              The protocol instance
+  @param RendezvousCycles  The TSC cycles spent waiting for all CPUs
+                           to rendezvous for the current SMI.
+
+  @retval EFI_SUCCESS      The information is recorded.
+  @retval EFI_UNSUPPORTED  The SMI latency ring is not enabled.
+**/
+EFI_STATUS
+EFIAPI
+SmiHandlerProfileRecordSmiRendezvous (
+  IN SMI_HANDLER_PROFILE_PROTOCOL  *This,
+  IN UINT64                        RendezvousCycles
+  )
+{
+  if (!mSmiHandlerProfileLatencyEnabled) {
+    return EFI_UNSUPPORTED;
+  }
+
+  mSmiHandlerProfileRendezvousCycles = RendezvousCycles;
+  return EFI_SUCCESS;
+}
+
+/**
+  SMI handler profile handler to get SMI latency data.
+
+  @param SmiHandlerProfileParameterGetLatencyData   The parameter of SMI handler profile get latency data.
+
+**/
+VOID
+SmiHandlerProfileHandlerGetLatencyData (
+  IN SMI_HANDLER_PROFILE_PARAMETER_GET_LATENCY_DATA  *SmiHandlerProfileParameterGetLatencyData
+  )
+{
+  SMI_HANDLER_PROFILE_PARAMETER_GET_LATENCY_DATA  SmiHandlerProfileGetLatencyData;
+  SMI_HANDLER_PROFILE_LATENCY_RECORD              *DataBuffer;
+  UINT64                                          RecordCount;
+  UINT64                                          RecordIndex;
+  UINT64                                          Index;
+
+  if (mSmiHandlerProfileLatencyRing == NULL) {
+    SmiHandlerProfileParameterGetLatencyData->Header.ReturnStatus = (UINT64)(INT64)(INTN)EFI_UNSUPPORTED;
+    return;
+  }
+
+  CopyMem (&SmiHandlerProfileGetLatencyData, SmiHandlerProfileParameterGetLatencyData, sizeof (SmiHandlerProfileGetLatencyData));
+
+  //
+  // Sanity check
+  //
+  if (!SmmIsBufferOutsideSmmValid ((UINTN)SmiHandlerProfileGetLatencyData.DataBuffer, (UINTN)SmiHandlerProfileGetLatencyData.DataSize)) {
+    DEBUG ((DEBUG_ERROR, "SmiHandlerProfileHandlerGetLatencyData: SMI handler profile get latency data in SMRAM or overflow!\n"));
+    SmiHandlerProfileParameterGetLatencyData->Header.ReturnStatus = (UINT64)(INT64)(INTN)EFI_ACCESS_DENIED;
+    return;
+  }
+
+  RecordCount = mSmiHandlerProfileLatencyRecordCount;
+  if (RecordCount > SMI_HANDLER_PROFILE_LATENCY_RING_DEPTH) {
+    RecordCount = SMI_HANDLER_PROFILE_LATENCY_RING_DEPTH;
+  }
+
+  if (RecordCount > SmiHandlerProfileGetLatencyData.DataSize / sizeof (SMI_HANDLER_PROFILE_LATENCY_RECORD)) {
+    RecordCount = SmiHandlerProfileGetLatencyData.DataSize / sizeof (SMI_HANDLER_PROFILE_LATENCY_RECORD);
+  }
+
+  //
+  // Copy the records oldest first. The oldest record in the ring is the
+  // one the next record would overwrite.
+  //
+  DataBuffer  = (SMI_HANDLER_PROFILE_LATENCY_RECORD *)(UINTN)SmiHandlerProfileGetLatencyData.DataBuffer;
+  RecordIndex = mSmiHandlerProfileLatencyRecordCount - RecordCount;
+  for (Index = 0; Index < RecordCount; Index++) {
+    CopyMem (
+      &DataBuffer[Index],
+      &mSmiHandlerProfileLatencyRing[(RecordIndex + Index) % SMI_HANDLER_PROFILE_LATENCY_RING_DEPTH],
+      sizeof (SMI_HANDLER_PROFILE_LATENCY_RECORD)
+      );
+  }
+
+  SmiHandlerProfileGetLatencyData.DataSize         = RecordCount * sizeof (SMI_HANDLER_PROFILE_LATENCY_RECORD);
+  SmiHandlerProfileGetLatencyData.TotalRecordCount = mSmiHandlerProfileLatencyRecordCount;
+  CopyMem (SmiHandlerProfileParameterGetLatencyData, &SmiHandlerProfileGetLatencyData, sizeof (SmiHandlerProfileGetLatencyData));
+  SmiHandlerProfileParameterGetLatencyData->Header.ReturnStatus = 0;
+}
+
 /**
   Dispatch function for a Software SMI handler.
 
@@ -1048,6 +1192,15 @@ SmiHandlerProfileHandler (
 
       SmiHandlerProfileHandlerGetDataByOffset ((SMI_HANDLER_PROFILE_PARAMETER_GET_DATA_BY_OFFSET *)(UINTN)CommBuffer);
       break;
+    case SMI_HANDLER_PROFILE_COMMAND_GET_LATENCY_DATA:
+      DEBUG ((DEBUG_ERROR, "SmiHandlerProfileHandlerGetLatencyData\n"));
+      if (TempCommBufferSize != sizeof (SMI_HANDLER_PROFILE_PARAMETER_GET_LATENCY_DATA)) {
+        DEBUG ((DEBUG_ERROR, "SmiHandlerProfileHandler: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      SmiHandlerProfileHandlerGetLatencyData ((SMI_HANDLER_PROFILE_PARAMETER_GET_LATENCY_DATA *)(UINTN)CommBuffer);
+      break;
     default:
       break;
   }
@@ -1397,7 +1550,15 @@ SmmCoreInitializeSmiHandlerProfile (
   VOID        *Registration;
   EFI_HANDLE  Handle;
 
-  if ((PcdGet8 (PcdSmiHandlerProfilePropertyMask) & 0x1) != 0) {
+  if ((PcdGet8 (PcdSmiHandlerProfilePropertyMask) & 0x3) != 0) {
+    if ((PcdGet8 (PcdSmiHandlerProfilePropertyMask) & 0x2) != 0) {
+      mSmiHandlerProfileLatencyRing = AllocateZeroPool (SMI_HANDLER_PROFILE_LATENCY_RING_DEPTH * sizeof (SMI_HANDLER_PROFILE_LATENCY_RECORD));
+      ASSERT (mSmiHandlerProfileLatencyRing != NULL);
+      if (mSmiHandlerProfileLatencyRing != NULL) {
+        mSmiHandlerProfileLatencyEnabled = TRUE;
+      }
+    }
+
     InsertTailList (&mRootSmiEntryList, &mRootSmiEntry.AllEntries);
 
     Status = gSmst->SmmRegisterProtocolNotify (
@@ -42,6 +42,19 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include "Runtime.h"
 
+//
+// Number of entries in the sorted index over the virtual map. The index is
+// a fixed global because no memory can be allocated any more when
+// SetVirtualAddressMap() runs.
+//
+#define VIRTUAL_MAP_INDEX_ENTRIES  256
+
+typedef struct {
+  EFI_PHYSICAL_ADDRESS    PhysicalStart;
+  EFI_PHYSICAL_ADDRESS    PhysicalEnd;
+  EFI_VIRTUAL_ADDRESS     VirtualStart;
+} VIRTUAL_MAP_INDEX_ENTRY;
+
 //
 // Global Variables
 //
@@ -50,6 +63,15 @@ UINTN                  mVirtualMapDescriptorSize;
 UINTN                  mVirtualMapMaxIndex;
 VOID                   *mMyImageBase;
 
+//
+// Compact copy of the EFI_MEMORY_RUNTIME descriptors of mVirtualMap, sorted
+// by PhysicalStart, so ConvertPointer() can binary search instead of walking
+// the whole map per pointer. Zero entries means the index is not usable and
+// ConvertPointer() falls back to the linear walk of mVirtualMap.
+//
+VIRTUAL_MAP_INDEX_ENTRY  mVirtualMapIndex[VIRTUAL_MAP_INDEX_ENTRIES];
+UINTN                    mVirtualMapIndexCount = 0;
+
 //
 // The handle onto which the Runtime Architectural Protocol instance is installed
 //
@@ -131,6 +153,9 @@ RuntimeDriverConvertPointer (
   UINT64                 VirtEndOfRange;
   EFI_MEMORY_DESCRIPTOR  *VirtEntry;
   UINTN                  Index;
+  UINTN                  Low;
+  UINTN                  High;
+  UINTN                  Middle;
 
   //
   // Make sure ConvertAddress is a valid pointer
@@ -155,6 +180,33 @@ RuntimeDriverConvertPointer (
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // Binary search the sorted index built by SetVirtualAddressMap(), unless
+  // the virtual map did not fit in the index.
+  //
+  if (mVirtualMapIndexCount != 0) {
+    Low  = 0;
+    High = mVirtualMapIndexCount;
+    while (Low < High) {
+      Middle = (Low + High) / 2;
+      if (Address >= mVirtualMapIndex[Middle].PhysicalEnd) {
+        Low = Middle + 1;
+      } else {
+        High = Middle;
+      }
+    }
+
+    if ((Low < mVirtualMapIndexCount) && (Address >= mVirtualMapIndex[Low].PhysicalStart)) {
+      //
+      // Compute new address
+      //
+      *ConvertAddress = (VOID *)(Address - (UINTN)mVirtualMapIndex[Low].PhysicalStart + (UINTN)mVirtualMapIndex[Low].VirtualStart);
+      return EFI_SUCCESS;
+    }
+
+    return EFI_NOT_FOUND;
+  }
+
   VirtEntry = mVirtualMap;
   for (Index = 0; Index < mVirtualMapMaxIndex; Index++) {
     //
@@ -243,6 +295,9 @@ RuntimeDriverSetVirtualAddressMap (
   EFI_RUNTIME_IMAGE_ENTRY  *RuntimeImage;
   LIST_ENTRY               *Link;
   EFI_PHYSICAL_ADDRESS     VirtImageBase;
+  EFI_MEMORY_DESCRIPTOR    *VirtEntry;
+  UINTN                    Index;
+  UINTN                    InsertIndex;
 
   //
   // Can only switch to virtual addresses once the memory map is locked down,
@@ -272,6 +327,39 @@ RuntimeDriverSetVirtualAddressMap (
   mVirtualMapMaxIndex       = MemoryMapSize / DescriptorSize;
   mVirtualMap               = VirtualMap;
 
+  //
+  // Build a sorted index over the EFI_MEMORY_RUNTIME descriptors, so every
+  // ConvertPointer() call binary searches the runtime ranges instead of
+  // walking the whole map. The memory map is nearly sorted already, so the
+  // insertion position is found by scanning back from the tail. If there
+  // are more runtime descriptors than index entries, leave the index empty
+  // and let ConvertPointer() fall back to the linear walk.
+  //
+  mVirtualMapIndexCount = 0;
+  VirtEntry             = VirtualMap;
+  for (Index = 0; Index < mVirtualMapMaxIndex; Index++) {
+    if ((VirtEntry->Attribute & EFI_MEMORY_RUNTIME) == EFI_MEMORY_RUNTIME) {
+      if (mVirtualMapIndexCount == VIRTUAL_MAP_INDEX_ENTRIES) {
+        mVirtualMapIndexCount = 0;
+        break;
+      }
+
+      for (InsertIndex = mVirtualMapIndexCount;
+           (InsertIndex > 0) && (mVirtualMapIndex[InsertIndex - 1].PhysicalStart > VirtEntry->PhysicalStart);
+           InsertIndex--)
+      {
+        mVirtualMapIndex[InsertIndex] = mVirtualMapIndex[InsertIndex - 1];
+      }
+
+      mVirtualMapIndex[InsertIndex].PhysicalStart = VirtEntry->PhysicalStart;
+      mVirtualMapIndex[InsertIndex].PhysicalEnd   = VirtEntry->PhysicalStart + LShiftU64 (VirtEntry->NumberOfPages, EFI_PAGE_SHIFT);
+      mVirtualMapIndex[InsertIndex].VirtualStart  = VirtEntry->VirtualStart;
+      mVirtualMapIndexCount++;
+    }
+
+    VirtEntry = NEXT_MEMORY_DESCRIPTOR (VirtEntry, DescriptorSize);
+  }
+
   //
   // ReporstStatusCodeLib will check and make sure this service can be called in runtime mode.
   //
@@ -365,8 +453,9 @@ RuntimeDriverSetVirtualAddressMap (
   //
   // mVirtualMap is only valid during SetVirtualAddressMap() call
   //
-  mVirtualMap         = NULL;
-  mVirtualMapMaxIndex = 0;
+  mVirtualMap           = NULL;
+  mVirtualMapMaxIndex   = 0;
+  mVirtualMapIndexCount = 0;
 
   return EFI_SUCCESS;
 }
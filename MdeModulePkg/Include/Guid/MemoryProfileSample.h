@@ -0,0 +1,84 @@
+/** @file
+  Memory profile sampling data structure.
+
+  The sampling profile is a lightweight alternative to the full UEFI memory
+  profile: DXE Core records one out of every PcdMemoryProfileSampleRate
+  allocation or free actions into fixed-depth per-TPL rings, and a consumer
+  drains the accumulated records at runtime through the protocol defined
+  here.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _MEMORY_PROFILE_SAMPLE_H_
+#define _MEMORY_PROFILE_SAMPLE_H_
+
+#include <Guid/MemoryProfile.h>
+
+///
+/// One sampled allocation or free action.
+///
+typedef struct {
+  ///
+  /// Address of the caller of the memory service.
+  ///
+  PHYSICAL_ADDRESS    CallerAddress;
+  ///
+  /// Size in bytes for pool actions, or in pages for page actions.
+  ///
+  UINT64              Size;
+  ///
+  /// The MEMORY_PROFILE_ACTION that was sampled.
+  ///
+  UINT32              Action;
+  ///
+  /// The EFI_MEMORY_TYPE of the action, or EfiMaxMemoryType if unknown.
+  ///
+  UINT32              MemoryType;
+} MEMORY_PROFILE_SAMPLE_RECORD;
+
+typedef struct _EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL;
+
+/**
+  Drain sampled allocation records.
+
+  Copies up to the caller supplied number of records out of the sampling
+  rings, oldest first, and removes the copied records so the ring space can
+  be reused. Records dropped because a ring was full are counted and the
+  count is returned cumulatively.
+
+  @param[in]      This          The EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL instance.
+  @param[in, out] RecordCount   On entry, the number of records Records can hold.
+                                On return, the number of records copied.
+  @param[out]     Records       The buffer to copy the sampled records into.
+  @param[out]     DroppedCount  If not NULL, returns the cumulative number of
+                                samples dropped because a ring was full.
+
+  @retval EFI_SUCCESS            The records were drained successfully.
+  @retval EFI_INVALID_PARAMETER  RecordCount is NULL, or Records is NULL while
+                                 *RecordCount is not zero.
+  @retval EFI_UNSUPPORTED        Memory profile sampling is disabled.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_MEMORY_PROFILE_SAMPLE_DRAIN_RECORDS)(
+  IN     EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL  *This,
+  IN OUT UINTN                                 *RecordCount,
+  OUT    MEMORY_PROFILE_SAMPLE_RECORD          *Records  OPTIONAL,
+  OUT    UINT64                                *DroppedCount  OPTIONAL
+  );
+
+struct _EDKII_MEMORY_PROFILE_SAMPLE_PROTOCOL {
+  EDKII_MEMORY_PROFILE_SAMPLE_DRAIN_RECORDS    DrainRecords;
+};
+
+#define EDKII_MEMORY_PROFILE_SAMPLE_GUID  {\
+  0x9f2a563e, 0x7b40, 0x4c71, { 0xa1, 0x3d, 0x5e, 0xc9, 0x08, 0x27, 0xb6, 0x44 } \
+}
+
+extern EFI_GUID  gEdkiiMemoryProfileSampleGuid;
+
+#endif
@@ -110,6 +110,7 @@ typedef struct {
 //
 #define SMI_HANDLER_PROFILE_COMMAND_GET_INFO            0x1
 #define SMI_HANDLER_PROFILE_COMMAND_GET_DATA_BY_OFFSET  0x2
+#define SMI_HANDLER_PROFILE_COMMAND_GET_LATENCY_DATA    0x3
 
 typedef struct {
   UINT32    Command;
@@ -137,6 +138,58 @@ typedef struct {
   UINT64                                  DataOffset;
 } SMI_HANDLER_PROFILE_PARAMETER_GET_DATA_BY_OFFSET;
 
+//
+// One entry of the continuous SMI latency ring buffer.
+// The ring is maintained by SmmCore when BIT1 of
+// PcdSmiHandlerProfilePropertyMask is set, and records every SMI handler
+// invocation. The ring holds the most recent records only; older records
+// are overwritten.
+//
+typedef struct {
+  //
+  // The GUID to identify the type of the handler.
+  // Zero GUID means the root SMI handler.
+  //
+  EFI_GUID    HandlerType;
+  //
+  // The address of the SMI handler.
+  //
+  UINT64      Handler;
+  //
+  // The TSC value when the handler was invoked.
+  //
+  UINT64      StartTsc;
+  //
+  // The TSC cycles spent in the handler.
+  //
+  UINT64      Cycles;
+  //
+  // The TSC cycles spent waiting for all CPUs to rendezvous
+  // before the SMM core was entered for this SMI.
+  // Zero if the CPU driver does not report rendezvous time.
+  //
+  UINT64      RendezvousCycles;
+} SMI_HANDLER_PROFILE_LATENCY_RECORD;
+
+typedef struct {
+  SMI_HANDLER_PROFILE_PARAMETER_HEADER    Header;
+  //
+  // On input, data buffer size in bytes.
+  // On output, actual data buffer size copied in bytes.
+  //
+  UINT64                                  DataSize;
+  //
+  // Data buffer to hold an array of SMI_HANDLER_PROFILE_LATENCY_RECORD,
+  // copied oldest record first.
+  //
+  PHYSICAL_ADDRESS                        DataBuffer;
+  //
+  // On output, the total number of records produced since boot,
+  // including records already overwritten in the ring.
+  //
+  UINT64                                  TotalRecordCount;
+} SMI_HANDLER_PROFILE_PARAMETER_GET_LATENCY_DATA;
+
 #define SMI_HANDLER_PROFILE_GUID  {0x49174342, 0x7108, 0x409b, {0x8b, 0xbe, 0x65, 0xfd, 0xa8, 0x53, 0x89, 0xf5}}
 
 extern EFI_GUID  gSmiHandlerProfileGuid;
@@ -201,9 +254,35 @@ EFI_STATUS
   IN UINTN                          ContextSize OPTIONAL
   );
 
+/**
+  This function is called by the SMM CPU driver to report the time spent
+  waiting for all CPUs to rendezvous for the current SMI, to SmmCore.
+  The reported value is stamped into the SMI latency records produced
+  while dispatching the current SMI.
+
+  @param This              The protocol instance
+  @param RendezvousCycles  The TSC cycles spent waiting for all CPUs
+                           to rendezvous for the current SMI.
+
+  @retval EFI_SUCCESS      The information is recorded.
+  @retval EFI_UNSUPPORTED  The SMI latency ring is not enabled.
+**/
+typedef
+EFI_STATUS
+(EFIAPI  *SMI_HANDLER_PROFILE_RECORD_SMI_RENDEZVOUS)(
+  IN SMI_HANDLER_PROFILE_PROTOCOL   *This,
+  IN UINT64                         RendezvousCycles
+  );
+
 struct _SMI_HANDLER_PROFILE_PROTOCOL {
-  SMI_HANDLER_PROFILE_REGISTER_HANDLER      RegisterHandler;
-  SMI_HANDLER_PROFILE_UNREGISTER_HANDLER    UnregisterHandler;
+  SMI_HANDLER_PROFILE_REGISTER_HANDLER         RegisterHandler;
+  SMI_HANDLER_PROFILE_UNREGISTER_HANDLER       UnregisterHandler;
+  //
+  // RecordSmiRendezvous is an extension to the original two-member
+  // protocol. It is present when BIT1 of PcdSmiHandlerProfilePropertyMask
+  // is supported by SmmCore.
+  //
+  SMI_HANDLER_PROFILE_RECORD_SMI_RENDEZVOUS    RecordSmiRendezvous;
 };
 
 #endif
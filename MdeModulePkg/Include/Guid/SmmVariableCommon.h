@@ -77,6 +77,10 @@ typedef struct {
 // The payload for this function is SMM_VARIABLE_COMMUNICATE_GET_RUNTIME_CACHE_INFO
 //
 #define SMM_VARIABLE_FUNCTION_GET_RUNTIME_CACHE_INFO  14
+//
+// The payload for this function is SMM_VARIABLE_COMMUNICATE_BATCH_SET_VARIABLE
+//
+#define SMM_VARIABLE_FUNCTION_BATCH_SET_VARIABLE  15
 
 ///
 /// Size of SMM communicate header, without including the payload.
@@ -147,4 +151,19 @@ typedef struct {
   BOOLEAN    AuthenticatedVariableUsage;
 } SMM_VARIABLE_COMMUNICATE_GET_RUNTIME_CACHE_INFO;
 
+///
+/// This structure is used to communicate with SMI handler to set several
+/// variables in one communicate transaction. VariableCount entries of
+/// SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE follow the structure back to back.
+/// Each entry occupies OFFSET_OF (SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE, Name)
+/// + NameSize + DataSize bytes, and the next entry starts at the following
+/// offset aligned to sizeof (UINTN). Entries are processed in order until the
+/// first failure; VariablesSet returns the number of entries set successfully.
+///
+typedef struct {
+  UINTN    VariableCount;
+  UINTN    VariablesSet;
+  UINT8    Variables[1];
+} SMM_VARIABLE_COMMUNICATE_BATCH_SET_VARIABLE;
+
 #endif // _SMM_VARIABLE_COMMON_H_
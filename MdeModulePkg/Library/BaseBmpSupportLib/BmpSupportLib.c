@@ -338,17 +338,19 @@ TranslateBmpToGopBlt (
   DEBUG ((DEBUG_INFO, "BmpHeader->Size 0x%X\n", BmpHeader->Size));
 
   //
-  // Translate image from BMP to Blt buffer format
+  // Translate image from BMP to Blt buffer format. The pixel format is
+  // constant for the whole image, so dispatch on it per row instead of
+  // re-evaluating the switch for every single pixel.
   //
   BltBuffer = *GopBlt;
   for (Height = 0; Height < BmpHeader->PixelHeight; Height++) {
     Blt = &BltBuffer[(BmpHeader->PixelHeight - Height - 1) * BmpHeader->PixelWidth];
-    for (Width = 0; Width < BmpHeader->PixelWidth; Width++, Image++, Blt++) {
-      switch (BmpHeader->BitPerPixel) {
-        case 1:
-          //
-          // Translate 1-bit (2 colors) BMP to 24-bit color
-          //
+    switch (BmpHeader->BitPerPixel) {
+      case 1:
+        //
+        // Translate 1-bit (2 colors) BMP to 24-bit color
+        //
+        for (Width = 0; Width < BmpHeader->PixelWidth; Width++, Image++, Blt++) {
           for (Index = 0; Index < 8 && Width < BmpHeader->PixelWidth; Index++) {
             Blt->Red   = BmpColorMap[((*Image) >> (7 - Index)) & 0x1].Red;
             Blt->Green = BmpColorMap[((*Image) >> (7 - Index)) & 0x1].Green;
@@ -359,12 +361,15 @@ TranslateBmpToGopBlt (
 
           Blt--;
           Width--;
-          break;
+        }
+
+        break;
 
-        case 4:
-          //
-          // Translate 4-bit (16 colors) BMP Palette to 24-bit color
-          //
+      case 4:
+        //
+        // Translate 4-bit (16 colors) BMP Palette to 24-bit color
+        //
+        for (Width = 0; Width < BmpHeader->PixelWidth; Width++, Image++, Blt++) {
           Index      = (*Image) >> 4;
           Blt->Red   = BmpColorMap[Index].Red;
           Blt->Green = BmpColorMap[Index].Green;
@@ -377,48 +382,57 @@ TranslateBmpToGopBlt (
             Blt->Green = BmpColorMap[Index].Green;
             Blt->Blue  = BmpColorMap[Index].Blue;
           }
+        }
 
-          break;
+        break;
 
-        case 8:
-          //
-          // Translate 8-bit (256 colors) BMP Palette to 24-bit color
-          //
+      case 8:
+        //
+        // Translate 8-bit (256 colors) BMP Palette to 24-bit color
+        //
+        for (Width = 0; Width < BmpHeader->PixelWidth; Width++, Image++, Blt++) {
           Blt->Red   = BmpColorMap[*Image].Red;
           Blt->Green = BmpColorMap[*Image].Green;
           Blt->Blue  = BmpColorMap[*Image].Blue;
-          break;
+        }
 
-        case 24:
-          //
-          // It is 24-bit BMP.
-          //
+        break;
+
+      case 24:
+        //
+        // It is 24-bit BMP.
+        //
+        for (Width = 0; Width < BmpHeader->PixelWidth; Width++, Image++, Blt++) {
           Blt->Blue  = *Image++;
           Blt->Green = *Image++;
           Blt->Red   = *Image;
-          break;
+        }
+
+        break;
 
-        case 32:
-          //
-          // Conver 32 bit to 24bit bmp - just ignore the final byte of each pixel
+      case 32:
+        //
+        // Conver 32 bit to 24bit bmp - just ignore the final byte of each pixel
+        //
+        for (Width = 0; Width < BmpHeader->PixelWidth; Width++, Image++, Blt++) {
           Blt->Blue  = *Image++;
           Blt->Green = *Image++;
           Blt->Red   = *Image++;
-          break;
-
-        default:
-          //
-          // Other bit format BMP is not supported.
-          //
-          if (IsAllocated) {
-            FreePool (*GopBlt);
-            *GopBlt = NULL;
-          }
+        }
 
-          DEBUG ((DEBUG_ERROR, "Bmp Bit format not supported.  0x%X\n", BmpHeader->BitPerPixel));
-          return RETURN_UNSUPPORTED;
-          break;
-      }
+        break;
+
+      default:
+        //
+        // Other bit format BMP is not supported.
+        //
+        if (IsAllocated) {
+          FreePool (*GopBlt);
+          *GopBlt = NULL;
+        }
+
+        DEBUG ((DEBUG_ERROR, "Bmp Bit format not supported.  0x%X\n", BmpHeader->BitPerPixel));
+        return RETURN_UNSUPPORTED;
     }
 
     ImageIndex = (UINTN)Image - (UINTN)ImageHeader;
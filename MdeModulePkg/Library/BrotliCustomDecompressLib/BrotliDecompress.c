@@ -60,30 +60,40 @@ BrFree (
   Decompresses a Brotli compressed source buffer.
 
   Extracts decompressed data to its original form.
-  If the compressed source data specified by Source is successfully decompressed
-  into Destination, then EFI_SUCCESS is returned. If the compressed source data
+  If OutputCallback is NULL, the decompressed data is stored contiguously in
+  Destination. Otherwise OutputCallback is invoked for every decompressed
+  window and Destination is ignored and may be NULL.
+  If the compressed source data specified by Source is successfully decompressed,
+  then EFI_SUCCESS is returned. If the compressed source data
   specified by Source is not in a valid compressed data format,
   then EFI_INVALID_PARAMETER is returned.
 
-  @param  Source      The source buffer containing the compressed data.
-  @param  SourceSize  The size of source buffer.
-  @param  Destination The destination buffer to store the decompressed data.
-  @param  DestSize    The destination buffer size.
-  @param  BuffInfo    The pointer to the BROTLI_BUFF instance.
+  @param  Source         The source buffer containing the compressed data.
+  @param  SourceSize     The size of source buffer.
+  @param  Destination    The destination buffer to store the decompressed data.
+  @param  DestSize       The destination buffer size.
+  @param  OutputCallback The consumer callback for decompressed windows.
+                         This is an optional parameter that may be NULL.
+  @param  Context        Consumer context passed through to OutputCallback.
+  @param  BuffInfo       The pointer to the BROTLI_BUFF instance.
 
   @retval EFI_SUCCESS Decompression completed successfully, and
-                      the uncompressed buffer is returned in Destination.
+                      the uncompressed buffer was returned in Destination or
+                      delivered through OutputCallback.
   @retval EFI_INVALID_PARAMETER
                       The source buffer specified by Source is corrupted
                       (not in a valid compressed format).
+  @return Other       OutputCallback aborted decompression with this status.
 **/
 EFI_STATUS
 BrotliDecompress (
-  IN CONST VOID  *Source,
-  IN UINTN       SourceSize,
-  IN OUT VOID    *Destination,
-  IN OUT UINTN   DestSize,
-  IN VOID        *BuffInfo
+  IN CONST VOID              *Source,
+  IN UINTN                   SourceSize,
+  IN OUT VOID                *Destination OPTIONAL,
+  IN OUT UINTN               DestSize,
+  IN BROTLI_OUTPUT_CALLBACK  OutputCallback OPTIONAL,
+  IN VOID                    *Context OPTIONAL,
+  IN VOID                    *BuffInfo
   )
 {
   UINT8                *Input;
@@ -96,6 +106,7 @@ BrotliDecompress (
   VOID                 *Temp;
   BrotliDecoderResult  Result;
   BrotliDecoderState   *BroState;
+  EFI_STATUS           Status;
 
   TotalOut     = 0;
   AvailableOut = FILE_BUFFER_SIZE;
@@ -135,9 +146,24 @@ BrotliDecompress (
       SourceSize -= AvailableIn;
       NextIn      = Input;
     } else if (Result == BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT) {
-      CopyMem (Temp, Output, FILE_BUFFER_SIZE);
+      if (OutputCallback != NULL) {
+        //
+        // TotalOut already covers the window that just filled up, so the
+        // window starts FILE_BUFFER_SIZE bytes back in the output stream.
+        //
+        Status = OutputCallback (Context, Output, FILE_BUFFER_SIZE, TotalOut - FILE_BUFFER_SIZE);
+        if (EFI_ERROR (Status)) {
+          BrFree (BuffInfo, Input);
+          BrFree (BuffInfo, Output);
+          BrotliDecoderDestroyInstance (BroState);
+          return Status;
+        }
+      } else {
+        CopyMem (Temp, Output, FILE_BUFFER_SIZE);
+        Temp = (VOID *)((UINT8 *)Temp + FILE_BUFFER_SIZE);
+      }
+
       AvailableOut = FILE_BUFFER_SIZE;
-      Temp         = (VOID *)((UINT8 *)Temp +FILE_BUFFER_SIZE);
       NextOut      = Output;
     } else {
       break; /* Error or success. */
@@ -154,7 +180,22 @@ BrotliDecompress (
   }
 
   if (NextOut != Output) {
-    CopyMem (Temp, Output, (size_t)(NextOut - Output));
+    if (OutputCallback != NULL) {
+      Status = OutputCallback (
+                 Context,
+                 Output,
+                 (UINTN)(NextOut - Output),
+                 TotalOut - (UINTN)(NextOut - Output)
+                 );
+      if (EFI_ERROR (Status)) {
+        BrFree (BuffInfo, Input);
+        BrFree (BuffInfo, Output);
+        BrotliDecoderDestroyInstance (BroState);
+        return Status;
+      }
+    } else {
+      CopyMem (Temp, Output, (size_t)(NextOut - Output));
+    }
   }
 
   DestSize = TotalOut;
@@ -293,8 +334,68 @@ BrotliUefiDecompress (
              SourceSize - BROTLI_SCRATCH_MAX,
              Destination,
              DestSize,
+             NULL,
+             NULL,
              (VOID *)(&BroBuff)
              );
 
   return Status;
 }
+
+/**
+  Decompresses a Brotli compressed source buffer in streaming fashion.
+
+  Extracts decompressed data to its original form and delivers it in
+  consecutive windows to OutputCallback instead of requiring a destination
+  buffer for the whole uncompressed size. The decoder keeps its own sliding
+  window in the scratch buffer, so a delivered window is final and never
+  revisited. If OutputCallback returns an error, decompression stops and
+  that status is returned.
+
+  @param  Source         The source buffer containing the compressed data.
+  @param  SourceSize     The size of source buffer.
+  @param  OutputCallback The consumer callback invoked for every window of
+                         decompressed data, in stream order.
+  @param  Context        Consumer context passed through to OutputCallback.
+  @param  Scratch        A temporary scratch buffer of the size reported by
+                         BrotliUefiDecompressGetInfo().
+
+  @retval EFI_SUCCESS Decompression completed successfully, and the
+                      uncompressed data was delivered through OutputCallback.
+  @retval EFI_INVALID_PARAMETER
+                      The source buffer specified by Source is corrupted
+                      (not in a valid compressed format).
+  @return Other       OutputCallback aborted decompression with this status.
+**/
+EFI_STATUS
+EFIAPI
+BrotliUefiDecompressStream (
+  IN CONST VOID              *Source,
+  IN UINTN                   SourceSize,
+  IN BROTLI_OUTPUT_CALLBACK  OutputCallback,
+  IN VOID                    *Context OPTIONAL,
+  IN OUT VOID                *Scratch
+  )
+{
+  BROTLI_BUFF  BroBuff;
+  UINT64       GetSize;
+  UINT8        MaxOffset;
+
+  ASSERT (OutputCallback != NULL);
+
+  MaxOffset = BROTLI_SCRATCH_MAX;
+  GetSize   = BrGetDecodedSizeOfBuf ((UINT8 *)Source, MaxOffset - BROTLI_INFO_SIZE, MaxOffset);
+
+  BroBuff.Buff     = Scratch;
+  BroBuff.BuffSize = (UINTN)GetSize;
+
+  return BrotliDecompress (
+           (VOID *)((UINT8 *)Source + BROTLI_SCRATCH_MAX),
+           SourceSize - BROTLI_SCRATCH_MAX,
+           NULL,
+           0,
+           OutputCallback,
+           Context,
+           (VOID *)(&BroBuff)
+           );
+}
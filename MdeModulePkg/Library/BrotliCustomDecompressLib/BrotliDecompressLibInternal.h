@@ -44,4 +44,39 @@ BrotliUefiDecompress (
   IN OUT VOID    *Scratch
   );
 
+/**
+  Consumer callback for streaming Brotli decompression.
+
+  Invoked for every window of decompressed data, in order and without gaps.
+  The buffer is only valid for the duration of the call and must be copied
+  by the consumer if it is needed afterwards.
+
+  @param  Context     Consumer context passed to BrotliUefiDecompressStream().
+  @param  Buffer      The decompressed window.
+  @param  BufferSize  The size, in bytes, of the decompressed window.
+  @param  Offset      Offset of the window in the uncompressed data stream.
+
+  @retval EFI_SUCCESS The window was consumed; decompression continues.
+  @return Other       Decompression is aborted and the value is returned to
+                      the caller of BrotliUefiDecompressStream().
+**/
+typedef
+EFI_STATUS
+(EFIAPI *BROTLI_OUTPUT_CALLBACK)(
+  IN VOID        *Context,
+  IN CONST VOID  *Buffer,
+  IN UINTN       BufferSize,
+  IN UINTN       Offset
+  );
+
+EFI_STATUS
+EFIAPI
+BrotliUefiDecompressStream (
+  IN CONST VOID              *Source,
+  IN UINTN                   SourceSize,
+  IN BROTLI_OUTPUT_CALLBACK  OutputCallback,
+  IN VOID                    *Context OPTIONAL,
+  IN OUT VOID                *Scratch
+  );
+
 #endif
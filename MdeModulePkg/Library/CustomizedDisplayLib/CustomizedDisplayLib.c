@@ -735,14 +735,7 @@ ClearLines (
   IN UINTN  TextAttribute
   )
 {
-  CHAR16  *Buffer;
-  UINTN   Row;
-
-  //
-  // For now, allocate an arbitrarily long buffer
-  //
-  Buffer = AllocateZeroPool (0x10000);
-  ASSERT (Buffer != NULL);
+  UINTN  Row;
 
   //
   // Set foreground and background as defined
@@ -750,20 +743,15 @@ ClearLines (
   gST->ConOut->SetAttribute (gST->ConOut, TextAttribute);
 
   //
-  // Much faster to buffer the long string instead of print it a character at a time
-  //
-  LibSetUnicodeMem (Buffer, RightColumn - LeftColumn, L' ');
-
-  //
-  // Clear the desired area with the appropriate foreground/background
+  // Clear the desired area with the appropriate foreground/background.
+  // Printing an empty string with the line width pads the whole line
+  // from the preallocated space buffer, so no scratch buffer is needed.
   //
   for (Row = TopRow; Row <= BottomRow; Row++) {
-    PrintStringAt (LeftColumn, Row, Buffer);
+    PrintStringAtWithWidth (LeftColumn, Row, gLibEmptyString, RightColumn - LeftColumn);
   }
 
   gST->ConOut->SetCursorPosition (gST->ConOut, LeftColumn, TopRow);
-
-  FreePool (Buffer);
 }
 
 //
@@ -13,6 +13,9 @@ CHAR16                 *mLibUnknownString;
 extern EFI_HII_HANDLE  mCDLStringPackHandle;
 CHAR16                 *mSpaceBuffer;
 #define SPACE_BUFFER_SIZE  1000
+CHAR16                 *mPrintBuffer;
+CHAR16                 *mPrintBackupBuffer;
+#define PRINT_BUFFER_SIZE  0x10000
 
 //
 // Browser Global Strings
@@ -777,6 +780,16 @@ FreeLibStrings (
   FreePool (gInputErrorMessage);
 
   FreePool (mSpaceBuffer);
+
+  if (mPrintBuffer != NULL) {
+    FreePool (mPrintBuffer);
+    mPrintBuffer = NULL;
+  }
+
+  if (mPrintBackupBuffer != NULL) {
+    FreePool (mPrintBackupBuffer);
+    mPrintBackupBuffer = NULL;
+  }
 }
 
 /**
@@ -868,12 +881,19 @@ PrintInternal (
   UINTN   CharWidth;
 
   //
-  // For now, allocate an arbitrarily long buffer
+  // The form repaint path comes through here once for every visible row,
+  // so the arbitrarily long print buffers are allocated only once and
+  // then reused for each printed string.
   //
-  Buffer       = AllocateZeroPool (0x10000);
-  BackupBuffer = AllocateZeroPool (0x10000);
-  ASSERT (Buffer);
-  ASSERT (BackupBuffer);
+  if (mPrintBuffer == NULL) {
+    mPrintBuffer       = AllocateZeroPool (PRINT_BUFFER_SIZE);
+    mPrintBackupBuffer = AllocateZeroPool (PRINT_BUFFER_SIZE);
+    ASSERT (mPrintBuffer);
+    ASSERT (mPrintBackupBuffer);
+  }
+
+  Buffer       = mPrintBuffer;
+  BackupBuffer = mPrintBackupBuffer;
 
   if (Column != (UINTN)-1) {
     Out->SetCursorPosition (Out, Column, Row);
@@ -897,6 +917,12 @@ PrintInternal (
       BackupBuffer[Index] = Buffer[Index];
     }
 
+    //
+    // Terminate the current segment. The backup buffer is reused across
+    // calls, so content from an earlier print may sit beyond this point.
+    //
+    BackupBuffer[Index] = CHAR_NULL;
+
     if (Buffer[Index] == 0) {
       break;
     }
@@ -949,8 +975,6 @@ PrintInternal (
     Out->OutputString (Out, &mSpaceBuffer[SPACE_BUFFER_SIZE - Width + PrintWidth]);
   }
 
-  FreePool (Buffer);
-  FreePool (BackupBuffer);
   return TotalCount;
 }
 
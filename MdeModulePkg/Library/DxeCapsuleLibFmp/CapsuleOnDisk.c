@@ -963,8 +963,12 @@ GetFileImageInAlphabetFromDir (
       continue;
     }
 
+    //
+    // The buffer does not need to be zeroed: it is either fully initialized
+    // by the following read or freed on a short read.
+    //
     Size                                   = (UINTN)FileInfo->FileSize;
-    TempFilePtrBuf[FileCount].ImageAddress = AllocateZeroPool (Size);
+    TempFilePtrBuf[FileCount].ImageAddress = AllocatePool (Size);
     if (TempFilePtrBuf[FileCount].ImageAddress == NULL) {
       DEBUG ((DEBUG_ERROR, "Fail to allocate memory for capsule. Stop processing the rest.\n"));
       break;
@@ -1436,6 +1440,7 @@ RelocateCapsuleToDisk (
   UINTN                            DataSize;
   UINT64                           TotalImageSize;
   UINT64                           TotalImageNameSize;
+  UINT64                           TotalCapsuleSize;
   IMAGE_INFO                       *CapsuleOnDiskBuf;
   EFI_HANDLE                       Handle;
   EFI_HANDLE                       TempHandle;
@@ -1582,45 +1587,13 @@ RelocateCapsuleToDisk (
     goto EXIT;
   }
 
-  CapsuleDataBuf = AllocatePool ((UINTN)TempCodFileSize);
-  if (CapsuleDataBuf == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto EXIT;
-  }
-
-  //
-  // First UINT64 reserved for total image size, including capsule name capsule.
-  //
-  *(UINT64 *)CapsuleDataBuf = TotalImageSize + sizeof (EFI_CAPSULE_HEADER) + TotalImageNameSize;
-
-  //
-  // Line up all the Capsule on Disk and write to relocation disk at one time. It could save some time in disk write
-  //
-  for (Index = 0, CapsulePtr = CapsuleDataBuf + sizeof (UINT64); Index < CapsuleOnDiskNum; Index++) {
-    CopyMem (CapsulePtr, CapsuleOnDiskBuf[Index].ImageAddress, (UINTN)CapsuleOnDiskBuf[Index].FileInfo->FileSize);
-    CapsulePtr += CapsuleOnDiskBuf[Index].FileInfo->FileSize;
-  }
-
-  //
-  // Line the capsule header for capsule name capsule.
-  //
-  CopyGuid (&FileNameCapsuleHeader.CapsuleGuid, &gEdkiiCapsuleOnDiskNameGuid);
-  FileNameCapsuleHeader.CapsuleImageSize = (UINT32)TotalImageNameSize + sizeof (EFI_CAPSULE_HEADER);
-  FileNameCapsuleHeader.Flags            = CAPSULE_FLAGS_PERSIST_ACROSS_RESET;
-  FileNameCapsuleHeader.HeaderSize       = sizeof (EFI_CAPSULE_HEADER);
-  CopyMem (CapsulePtr, &FileNameCapsuleHeader, FileNameCapsuleHeader.HeaderSize);
-  CapsulePtr += FileNameCapsuleHeader.HeaderSize;
-
-  //
-  // Line up all the Capsule file names.
-  //
-  for (Index = 0; Index < CapsuleOnDiskNum; Index++) {
-    CopyMem (CapsulePtr, CapsuleOnDiskBuf[Index].FileInfo->FileName, StrSize (CapsuleOnDiskBuf[Index].FileInfo->FileName));
-    CapsulePtr += StrSize (CapsuleOnDiskBuf[Index].FileInfo->FileName);
-  }
-
   //
-  // 5. Flash all Capsules on Disk to TempCoD.tmp under RootDir
+  // 5. Stream all Capsules on Disk to TempCoD.tmp under RootDir.
+  // The capsule images already reside in memory, so they are written to the
+  // file directly from their load buffers instead of being lined up in one
+  // full-size staging buffer first. This avoids allocating and copying
+  // another TempCodFileSize bytes; only the small trailing capsule name
+  // capsule is staged.
   //
   Status = Fs->OpenVolume (Fs, &RootDir);
   if (EFI_ERROR (Status)) {
@@ -1655,20 +1628,80 @@ RelocateCapsuleToDisk (
   }
 
   //
-  // Always write at the begining of TempCap file
+  // First UINT64 reserved for total image size, including capsule name capsule.
+  //
+  TotalCapsuleSize = TotalImageSize + sizeof (EFI_CAPSULE_HEADER) + TotalImageNameSize;
+  DataSize         = sizeof (UINT64);
+  Status           = TempCodFile->Write (
+                                    TempCodFile,
+                                    &DataSize,
+                                    &TotalCapsuleSize
+                                    );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "RelocateCapsule: Write TemCoD.tmp error. %x\n", Status));
+    goto EXIT;
+  }
+
+  if (DataSize != sizeof (UINT64)) {
+    Status = EFI_DEVICE_ERROR;
+    goto EXIT;
+  }
+
+  //
+  // Write each Capsule on Disk directly from its load buffer.
+  //
+  for (Index = 0; Index < CapsuleOnDiskNum; Index++) {
+    DataSize = (UINTN)CapsuleOnDiskBuf[Index].FileInfo->FileSize;
+    Status   = TempCodFile->Write (
+                              TempCodFile,
+                              &DataSize,
+                              CapsuleOnDiskBuf[Index].ImageAddress
+                              );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "RelocateCapsule: Write TemCoD.tmp error. %x\n", Status));
+      goto EXIT;
+    }
+
+    if (DataSize != (UINTN)CapsuleOnDiskBuf[Index].FileInfo->FileSize) {
+      Status = EFI_DEVICE_ERROR;
+      goto EXIT;
+    }
+  }
+
+  //
+  // Stage the capsule name capsule: the capsule header followed by all the
+  // Capsule file names.
   //
-  DataSize = (UINTN)TempCodFileSize;
-  Status   = TempCodFile->Write (
-                            TempCodFile,
-                            &DataSize,
-                            CapsuleDataBuf
-                            );
+  DataSize       = sizeof (EFI_CAPSULE_HEADER) + (UINTN)TotalImageNameSize;
+  CapsuleDataBuf = AllocatePool (DataSize);
+  if (CapsuleDataBuf == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  CopyGuid (&FileNameCapsuleHeader.CapsuleGuid, &gEdkiiCapsuleOnDiskNameGuid);
+  FileNameCapsuleHeader.CapsuleImageSize = (UINT32)TotalImageNameSize + sizeof (EFI_CAPSULE_HEADER);
+  FileNameCapsuleHeader.Flags            = CAPSULE_FLAGS_PERSIST_ACROSS_RESET;
+  FileNameCapsuleHeader.HeaderSize       = sizeof (EFI_CAPSULE_HEADER);
+  CopyMem (CapsuleDataBuf, &FileNameCapsuleHeader, FileNameCapsuleHeader.HeaderSize);
+  CapsulePtr = CapsuleDataBuf + FileNameCapsuleHeader.HeaderSize;
+
+  for (Index = 0; Index < CapsuleOnDiskNum; Index++) {
+    CopyMem (CapsulePtr, CapsuleOnDiskBuf[Index].FileInfo->FileName, StrSize (CapsuleOnDiskBuf[Index].FileInfo->FileName));
+    CapsulePtr += StrSize (CapsuleOnDiskBuf[Index].FileInfo->FileName);
+  }
+
+  Status = TempCodFile->Write (
+                          TempCodFile,
+                          &DataSize,
+                          CapsuleDataBuf
+                          );
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "RelocateCapsule: Write TemCoD.tmp error. %x\n", Status));
     goto EXIT;
   }
 
-  if (DataSize != TempCodFileSize) {
+  if (DataSize != sizeof (EFI_CAPSULE_HEADER) + (UINTN)TotalImageNameSize) {
     Status = EFI_DEVICE_ERROR;
     goto EXIT;
   }
@@ -49,6 +49,15 @@ EFI_EVENT  mDxeCapsuleLibEndOfDxeEvent = NULL;
 
 EDKII_FIRMWARE_MANAGEMENT_PROGRESS_PROTOCOL  *mFmpProgress = NULL;
 
+//
+// Total number of FMP update targets addressed by the capsule currently
+// being processed, and the number of targets already dispatched. They are
+// used to aggregate the per-target progress into one pass of the progress
+// bar instead of restarting the bar for every target.
+//
+UINTN  mFmpTargetTotal     = 0;
+UINTN  mFmpTargetCompleted = 0;
+
 /**
   Initialize capsule related variables.
 **/
@@ -111,6 +120,42 @@ UpdateImageProgress (
   IN UINTN  Completion
   );
 
+/**
+  Function indicate the current completion progress of one update target,
+  scaled into the overall completion progress of the capsule so that a
+  capsule addressing many targets drives the progress bar from 0% to 100%
+  exactly once.
+
+  @param[in]  Completion  A value between 1 and 100 indicating the current
+                          completion progress of the current update target
+
+  @retval EFI_SUCESS             The capsule update progress was updated.
+  @retval EFI_INVALID_PARAMETER  Completion is greater than 100%.
+**/
+EFI_STATUS
+EFIAPI
+UpdateAggregatedImageProgress (
+  IN UINTN  Completion
+  )
+{
+  UINTN  Overall;
+
+  if (Completion > 100) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (mFmpTargetTotal <= 1) {
+    return UpdateImageProgress (Completion);
+  }
+
+  Overall = ((mFmpTargetCompleted * 100) + Completion) / mFmpTargetTotal;
+  if (Overall > 100) {
+    Overall = 100;
+  }
+
+  return UpdateImageProgress (Overall);
+}
+
 /**
   Return if this capsule is a capsule name capsule, based upon CapsuleHeader.
 
@@ -910,6 +955,86 @@ GetFmpImageInfoDescriptorVer (
   return FmpImageInfoDescriptorVer;
 }
 
+/**
+  Check FMP image data against a FMP instance before SetImage is attempted,
+  so that a payload which can never be applied is rejected before any flash
+  write is started on the target.
+
+  @param[in]  Handle        A FMP handle.
+  @param[in]  ImageHeader   The payload image header.
+  @param[in]  PayloadIndex  The index of the payload.
+
+  @retval EFI_SUCCESS  The payload may be applied to the target, or the FMP
+                       instance does not support CheckImage and validation
+                       is left to SetImage.
+  @retval EFI_ABORTED  The FMP instance reported the payload as not updatable.
+  @return The status of FMP->CheckImage.
+**/
+EFI_STATUS
+CheckFmpImageData (
+  IN EFI_HANDLE                                    Handle,
+  IN EFI_FIRMWARE_MANAGEMENT_CAPSULE_IMAGE_HEADER  *ImageHeader,
+  IN UINTN                                         PayloadIndex
+  )
+{
+  EFI_STATUS                        Status;
+  EFI_FIRMWARE_MANAGEMENT_PROTOCOL  *Fmp;
+  UINT8                             *Image;
+  UINT32                            ImageUpdatable;
+
+  Status = gBS->HandleProtocol (
+                  Handle,
+                  &gEfiFirmwareManagementProtocolGuid,
+                  (VOID **)&Fmp
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (ImageHeader->Version >= EFI_FIRMWARE_MANAGEMENT_CAPSULE_IMAGE_HEADER_INIT_VERSION) {
+    Image = (UINT8 *)(ImageHeader + 1);
+  } else {
+    //
+    // If the EFI_FIRMWARE_MANAGEMENT_CAPSULE_IMAGE_HEADER is version 1,
+    // Header should exclude UpdateHardwareInstance field, and
+    // ImageCapsuleSupport field if version is 2.
+    //
+    if (ImageHeader->Version == 1) {
+      Image = (UINT8 *)ImageHeader + OFFSET_OF (EFI_FIRMWARE_MANAGEMENT_CAPSULE_IMAGE_HEADER, UpdateHardwareInstance);
+    } else {
+      Image = (UINT8 *)ImageHeader + OFFSET_OF (EFI_FIRMWARE_MANAGEMENT_CAPSULE_IMAGE_HEADER, ImageCapsuleSupport);
+    }
+  }
+
+  ImageUpdatable = 0;
+  Status         = Fmp->CheckImage (
+                          Fmp,
+                          ImageHeader->UpdateImageIndex,          // ImageIndex
+                          Image,                                  // Image
+                          ImageHeader->UpdateImageSize,           // ImageSize
+                          &ImageUpdatable                         // ImageUpdatable
+                          );
+  DEBUG ((DEBUG_INFO, "Fmp->CheckImage (PayloadIndex - 0x%x) - %r, ImageUpdatable - 0x%x\n", PayloadIndex, Status, ImageUpdatable));
+
+  if (Status == EFI_UNSUPPORTED) {
+    //
+    // The FMP instance does not implement CheckImage.
+    // Leave the payload validation to SetImage.
+    //
+    return EFI_SUCCESS;
+  }
+
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if ((ImageUpdatable & IMAGE_UPDATABLE_VALID) == 0) {
+    return EFI_ABORTED;
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Set FMP image data.
 
@@ -991,10 +1116,11 @@ SetFmpImageData (
   DEBUG ((DEBUG_INFO, "\n"));
 
   //
-  // Before calling SetImage(), reset the progress bar to 0%
+  // Before calling SetImage(), reset the progress bar to the start of the
+  // slice the current target owns within the overall capsule progress.
   //
-  ProgressCallback = UpdateImageProgress;
-  Status           = UpdateImageProgress (0);
+  ProgressCallback = UpdateAggregatedImageProgress;
+  Status           = UpdateAggregatedImageProgress (0);
   if (EFI_ERROR (Status)) {
     ProgressCallback = NULL;
   }
@@ -1009,10 +1135,11 @@ SetFmpImageData (
                   &AbortReason                            // AbortReason
                   );
   //
-  // Set the progress bar to 100% after returning from SetImage()
+  // Set the progress bar to the end of the current target's slice after
+  // returning from SetImage()
   //
   if (ProgressCallback != NULL) {
-    UpdateImageProgress (100);
+    UpdateAggregatedImageProgress (100);
   }
 
   DEBUG ((DEBUG_INFO, "Fmp->SetImage - %r\n", Status));
@@ -1278,6 +1405,33 @@ ProcessFmpCapsuleImage (
 
   DumpAllFmpInfo ();
 
+  //
+  // Count the update targets addressed by this capsule up front, so that
+  // the per-target progress reported through DisplayUpdateProgressLib can
+  // be aggregated into one pass of the progress bar for the whole capsule.
+  //
+  mFmpTargetTotal     = 0;
+  mFmpTargetCompleted = 0;
+  for (Index = FmpCapsuleHeader->EmbeddedDriverCount; Index < ItemNum; Index++) {
+    ImageHeader = (EFI_FIRMWARE_MANAGEMENT_CAPSULE_IMAGE_HEADER *)((UINT8 *)FmpCapsuleHeader + ItemOffsetList[Index]);
+
+    UpdateHardwareInstance = 0;
+    if (ImageHeader->Version >= 2) {
+      UpdateHardwareInstance = ImageHeader->UpdateHardwareInstance;
+    }
+
+    Status = GetFmpHandleBufferByType (
+               &ImageHeader->UpdateImageTypeId,
+               UpdateHardwareInstance,
+               &NumberOfHandles,
+               NULL,
+               NULL
+               );
+    if (!EFI_ERROR (Status)) {
+      mFmpTargetTotal += NumberOfHandles;
+    }
+  }
+
   //
   // Check all the payload entry in capsule payload list
   //
@@ -1325,6 +1479,30 @@ ProcessFmpCapsuleImage (
           ImageHeader,
           CapFileName
           );
+        mFmpTargetCompleted++;
+        continue;
+      }
+
+      //
+      // Pre-verify the payload against this target. A payload rejected by
+      // CheckImage only fails this target and is skipped before any flash
+      // write is started; the remaining independent targets still update.
+      //
+      Status = CheckFmpImageData (
+                 HandleBuffer[Index2],
+                 ImageHeader,
+                 Index - FmpCapsuleHeader->EmbeddedDriverCount
+                 );
+      if (EFI_ERROR (Status)) {
+        RecordFmpCapsuleStatus (
+          HandleBuffer[Index2],
+          CapsuleHeader,
+          Status,
+          Index - FmpCapsuleHeader->EmbeddedDriverCount,
+          ImageHeader,
+          CapFileName
+          );
+        mFmpTargetCompleted++;
         continue;
       }
 
@@ -1333,6 +1511,7 @@ ProcessFmpCapsuleImage (
                  ImageHeader,
                  Index - FmpCapsuleHeader->EmbeddedDriverCount
                  );
+      mFmpTargetCompleted++;
       if (Status != EFI_SUCCESS) {
         Abort = TRUE;
       } else {
@@ -1360,6 +1539,9 @@ ProcessFmpCapsuleImage (
     }
   }
 
+  mFmpTargetTotal     = 0;
+  mFmpTargetCompleted = 0;
+
   if (NotReady) {
     return EFI_NOT_READY;
   }
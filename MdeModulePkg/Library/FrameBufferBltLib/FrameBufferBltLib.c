@@ -174,6 +174,21 @@ FrameBufferBltConfigure (
   Configure->Height            = FrameBufferInfo->VerticalResolution;
   Configure->PixelsPerScanLine = FrameBufferInfo->PixelsPerScanLine;
 
+  //
+  // A PixelBitMask layout that matches EFI_GRAPHICS_OUTPUT_BLT_PIXEL is
+  // handled as PixelBlueGreenRedReserved8BitPerColor so that the blt
+  // operations take the row-wide copy paths instead of converting the
+  // pixels one by one.
+  //
+  if ((Configure->PixelFormat == PixelBitMask) &&
+      (BytesPerPixel == sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)) &&
+      (BitMask->RedMask == mBgrPixelMasks.RedMask) &&
+      (BitMask->GreenMask == mBgrPixelMasks.GreenMask) &&
+      (BitMask->BlueMask == mBgrPixelMasks.BlueMask))
+  {
+    Configure->PixelFormat = PixelBlueGreenRedReserved8BitPerColor;
+  }
+
   return RETURN_SUCCESS;
 }
 
@@ -406,6 +421,25 @@ FrameBufferBltLibVideoToBltBuffer (
 
   WidthInBytes = Width * Configure->BytesPerPixel;
 
+  //
+  // When the frame buffer rows and the BltBuffer rows are both contiguous
+  // and no pixel conversion is needed, transfer the whole rectangle with a
+  // single wide copy.
+  //
+  if ((Configure->PixelFormat == PixelBlueGreenRedReserved8BitPerColor) &&
+      (SourceX == 0) && (DestinationX == 0) &&
+      (Width == Configure->PixelsPerScanLine) && (Delta == WidthInBytes))
+  {
+    Offset = SourceY * Configure->PixelsPerScanLine;
+    Offset = Configure->BytesPerPixel * Offset;
+    CopyMem (
+      (UINT8 *)BltBuffer + (DestinationY * Delta),
+      Configure->FrameBuffer + Offset,
+      WidthInBytes * Height
+      );
+    return RETURN_SUCCESS;
+  }
+
   //
   // Video to BltBuffer: Source is Video, destination is BltBuffer
   //
@@ -514,6 +548,25 @@ FrameBufferBltLibBufferToVideo (
 
   WidthInBytes = Width * Configure->BytesPerPixel;
 
+  //
+  // When the BltBuffer rows and the frame buffer rows are both contiguous
+  // and no pixel conversion is needed, transfer the whole rectangle with a
+  // single wide copy.
+  //
+  if ((Configure->PixelFormat == PixelBlueGreenRedReserved8BitPerColor) &&
+      (SourceX == 0) && (DestinationX == 0) &&
+      (Width == Configure->PixelsPerScanLine) && (Delta == WidthInBytes))
+  {
+    Offset = DestinationY * Configure->PixelsPerScanLine;
+    Offset = Configure->BytesPerPixel * Offset;
+    CopyMem (
+      Configure->FrameBuffer + Offset,
+      (UINT8 *)BltBuffer + (SourceY * Delta),
+      WidthInBytes * Height
+      );
+    return RETURN_SUCCESS;
+  }
+
   for (SrcY = SourceY, DstY = DestinationY;
        SrcY < (Height + SourceY);
        SrcY++, DstY++)
@@ -619,6 +672,17 @@ FrameBufferBltLibVideoToVideo (
   Destination = Configure->FrameBuffer + Offset;
 
   LineStride = Configure->BytesPerPixel * Configure->PixelsPerScanLine;
+
+  //
+  // When both rectangles span complete scan lines the rows are contiguous,
+  // so the whole rectangle moves with a single copy. CopyMem handles the
+  // overlapping source and destination.
+  //
+  if ((SourceX == 0) && (DestinationX == 0) && (Width == Configure->PixelsPerScanLine)) {
+    CopyMem (Destination, Source, WidthInBytes * Height);
+    return RETURN_SUCCESS;
+  }
+
   if (Destination > Source) {
     //
     // Copy from last line to avoid source is corrupted by copying
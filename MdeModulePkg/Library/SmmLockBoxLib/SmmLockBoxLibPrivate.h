@@ -20,9 +20,22 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define SMM_LOCK_BOX_SIGNATURE_32  SIGNATURE_64 ('L','O','C','K','B','_','3','2')
 #define SMM_LOCK_BOX_SIGNATURE_64  SIGNATURE_64 ('L','O','C','K','B','_','6','4')
 
+//
+// The number of buckets in the lockbox GUID hash table. Must be a power of 2.
+//
+#define SMM_LOCK_BOX_HASH_BUCKET_COUNT  32
+
 typedef struct {
   UINT64                  Signature;
   EFI_PHYSICAL_ADDRESS    LockBoxDataAddress;
+  //
+  // Address of an array of SMM_LOCK_BOX_HASH_BUCKET_COUNT LIST_ENTRY hash
+  // buckets chaining SMM_LOCK_BOX_DATA.HashLink, used to accelerate GUID
+  // lookup inside MM. Zero if the producer does not maintain the hash
+  // table. The LockBoxDataAddress queue remains the canonical structure
+  // and is the only one consumed across phases.
+  //
+  EFI_PHYSICAL_ADDRESS    LockBoxHashTableAddress;
 } SMM_LOCK_BOX_CONTEXT;
 
 //
@@ -39,6 +52,13 @@ typedef struct {
   UINT64                  Attributes;
   EFI_PHYSICAL_ADDRESS    SmramBuffer;
   LIST_ENTRY              Link;
+  //
+  // Link in the GUID hash bucket referenced by
+  // SMM_LOCK_BOX_CONTEXT.LockBoxHashTableAddress. Only used inside MM.
+  // It is appended after Link so the cross phase consumers walking Link
+  // are not affected.
+  //
+  LIST_ENTRY              HashLink;
 } SMM_LOCK_BOX_DATA;
 
 #pragma pack()
@@ -26,6 +26,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 SMM_LOCK_BOX_CONTEXT  mSmmLockBoxContext;
 LIST_ENTRY            mLockBoxQueue = INITIALIZE_LIST_HEAD_VARIABLE (mLockBoxQueue);
+LIST_ENTRY            mLockBoxHashTable[SMM_LOCK_BOX_HASH_BUCKET_COUNT];
 
 BOOLEAN  mSmmConfigurationTableInstalled        = FALSE;
 VOID     *mSmmLockBoxRegistrationSmmEndOfDxe    = NULL;
@@ -201,6 +202,7 @@ SmmLockBoxMmConstructor (
 {
   EFI_STATUS            Status;
   SMM_LOCK_BOX_CONTEXT  *SmmLockBoxContext;
+  UINTN                 Index;
 
   DEBUG ((DEBUG_INFO, "SmmLockBoxSmmLib SmmLockBoxMmConstructor - Enter\n"));
 
@@ -257,7 +259,12 @@ SmmLockBoxMmConstructor (
     mSmmLockBoxContext.Signature = SMM_LOCK_BOX_SIGNATURE_32;
   }
 
-  mSmmLockBoxContext.LockBoxDataAddress = (EFI_PHYSICAL_ADDRESS)(UINTN)&mLockBoxQueue;
+  for (Index = 0; Index < SMM_LOCK_BOX_HASH_BUCKET_COUNT; Index++) {
+    InitializeListHead (&mLockBoxHashTable[Index]);
+  }
+
+  mSmmLockBoxContext.LockBoxDataAddress      = (EFI_PHYSICAL_ADDRESS)(UINTN)&mLockBoxQueue;
+  mSmmLockBoxContext.LockBoxHashTableAddress = (EFI_PHYSICAL_ADDRESS)(UINTN)mLockBoxHashTable;
 
   Status = gMmst->MmInstallConfigurationTable (
                     gMmst,
@@ -363,6 +370,50 @@ InternalGetLockBoxQueue (
   return (LIST_ENTRY *)(UINTN)SmmLockBoxContext->LockBoxDataAddress;
 }
 
+/**
+  This function return SmmLockBox GUID hash table address.
+
+  @return SmmLockBox GUID hash table address, or NULL if the context
+          producer does not maintain one.
+**/
+LIST_ENTRY *
+InternalGetLockBoxHashTable (
+  VOID
+  )
+{
+  SMM_LOCK_BOX_CONTEXT  *SmmLockBoxContext;
+
+  SmmLockBoxContext = InternalGetSmmLockBoxContext ();
+  ASSERT (SmmLockBoxContext != NULL);
+  if (SmmLockBoxContext == NULL) {
+    return NULL;
+  }
+
+  return (LIST_ENTRY *)(UINTN)SmmLockBoxContext->LockBoxHashTableAddress;
+}
+
+/**
+  This function return the hash bucket index for a LockBox GUID.
+
+  @param Guid The guid to indentify the LockBox
+
+  @return Hash bucket index.
+**/
+UINTN
+InternalLockBoxGuidHash (
+  IN EFI_GUID  *Guid
+  )
+{
+  UINT32  Hash;
+
+  Hash = ReadUnaligned32 ((UINT32 *)Guid) ^
+         ReadUnaligned32 ((UINT32 *)Guid + 1) ^
+         ReadUnaligned32 ((UINT32 *)Guid + 2) ^
+         ReadUnaligned32 ((UINT32 *)Guid + 3);
+
+  return (UINTN)(Hash & (SMM_LOCK_BOX_HASH_BUCKET_COUNT - 1));
+}
+
 /**
   This function find LockBox by GUID.
 
@@ -378,6 +429,31 @@ InternalFindLockBoxByGuid (
   LIST_ENTRY         *Link;
   SMM_LOCK_BOX_DATA  *LockBox;
   LIST_ENTRY         *LockBoxQueue;
+  LIST_ENTRY         *HashBucket;
+
+  //
+  // Use the hash bucket when the context producer maintains one, so the
+  // lookup cost does not grow with the total number of lockboxes.
+  //
+  HashBucket = InternalGetLockBoxHashTable ();
+  if (HashBucket != NULL) {
+    HashBucket = &HashBucket[InternalLockBoxGuidHash (Guid)];
+    for (Link = HashBucket->ForwardLink;
+         Link != HashBucket;
+         Link = Link->ForwardLink)
+    {
+      LockBox = BASE_CR (
+                  Link,
+                  SMM_LOCK_BOX_DATA,
+                  HashLink
+                  );
+      if (CompareGuid (&LockBox->Guid, Guid)) {
+        return LockBox;
+      }
+    }
+
+    return NULL;
+  }
 
   LockBoxQueue = InternalGetLockBoxQueue ();
   ASSERT (LockBoxQueue != NULL);
@@ -426,6 +502,7 @@ SaveLockBox (
   EFI_PHYSICAL_ADDRESS  SmramBuffer;
   EFI_STATUS            Status;
   LIST_ENTRY            *LockBoxQueue;
+  LIST_ENTRY            *LockBoxHashTable;
 
   DEBUG ((DEBUG_INFO, "SmmLockBoxSmmLib SaveLockBox - Enter\n"));
 
@@ -503,6 +580,14 @@ SaveLockBox (
   ASSERT (LockBoxQueue != NULL);
   InsertTailList (LockBoxQueue, &LockBox->Link);
 
+  //
+  // Insert LockBox to the GUID hash bucket as well
+  //
+  LockBoxHashTable = InternalGetLockBoxHashTable ();
+  if (LockBoxHashTable != NULL) {
+    InsertTailList (&LockBoxHashTable[InternalLockBoxGuidHash (Guid)], &LockBox->HashLink);
+  }
+
   //
   // Done
   //
@@ -22,6 +22,14 @@ EFI_BOOT_MANAGER_LEGACY_BOOT                 mBmLegacyBoot              = NULL;
 EFI_GUID  mBmHardDriveBootVariableGuid = {
   0xfab7e9e1, 0x39dd, 0x4f2b, { 0x84, 0x08, 0xe2, 0x0e, 0x90, 0x6c, 0xb6, 0xde }
 };
+
+///
+/// This GUID is used for an EFI Variable that stores the front device path
+/// most recently used to expand a short-form file-path device path.
+///
+EFI_GUID  mBmFilePathBootVariableGuid = {
+  0x7a9c3f12, 0x5b28, 0x4e61, { 0x9d, 0x0a, 0x41, 0x86, 0x5c, 0x2f, 0xb3, 0x77 }
+};
 EFI_GUID  mBmAutoCreateBootOptionGuid = {
   0x8108ac4e, 0x9f11, 0x4d59, { 0x85, 0x0e, 0xe2, 0x1a, 0x52, 0x2c, 0x59, 0xb2 }
 };
@@ -651,6 +659,172 @@ BmExpandUsbDevicePath (
   return NextFullPath;
 }
 
+/**
+  Try to expand the short-form file-path device path using the front device
+  path stored in the 'FPDP' variable by a previous expansion. Only the cached
+  front path is connected, so the expansion does not require connecting every
+  device in the system.
+
+  @param FilePath      The short-form file-path device path.
+
+  @return The full device path built from the cached front path, or NULL when
+          there is no cache or the cached front path no longer produces a
+          simple file system.
+**/
+EFI_DEVICE_PATH_PROTOCOL *
+BmExpandFileDevicePathFromCache (
+  IN  EFI_DEVICE_PATH_PROTOCOL  *FilePath
+  )
+{
+  EFI_STATUS                Status;
+  EFI_DEVICE_PATH_PROTOCOL  *CachedFrontPath;
+  UINTN                     CachedFrontPathSize;
+  EFI_DEVICE_PATH_PROTOCOL  *Node;
+  EFI_HANDLE                Handle;
+  EFI_DEVICE_PATH_PROTOCOL  *NextFullPath;
+
+  GetVariable2 (L"FPDP", &mBmFilePathBootVariableGuid, (VOID **)&CachedFrontPath, &CachedFrontPathSize);
+  if (CachedFrontPath == NULL) {
+    return NULL;
+  }
+
+  //
+  // Delete the invalid 'FPDP' variable.
+  //
+  if (!IsDevicePathValid (CachedFrontPath, CachedFrontPathSize)) {
+    FreePool (CachedFrontPath);
+    Status = gRT->SetVariable (
+                    L"FPDP",
+                    &mBmFilePathBootVariableGuid,
+                    0,
+                    0,
+                    NULL
+                    );
+    ASSERT_EFI_ERROR (Status);
+    return NULL;
+  }
+
+  //
+  // Connect only the cached front path and check whether a simple file
+  // system is still produced exactly there.
+  //
+  NextFullPath = NULL;
+  Status       = EfiBootManagerConnectDevicePath (CachedFrontPath, NULL);
+  if (!EFI_ERROR (Status)) {
+    Node   = CachedFrontPath;
+    Status = gBS->LocateDevicePath (&gEfiSimpleFileSystemProtocolGuid, &Node, &Handle);
+    if (!EFI_ERROR (Status) && IsDevicePathEnd (Node)) {
+      NextFullPath = AppendDevicePath (CachedFrontPath, FilePath);
+    }
+  }
+
+  FreePool (CachedFrontPath);
+  return NextFullPath;
+}
+
+/**
+  Save the front part of an expanded file-path device path to the 'FPDP'
+  variable so the next boot can expand the same load option without
+  connecting every device in the system.
+
+  @param FullPath      The expanded device path pointing to a load option.
+  @param FilePath      The short-form file-path device path it was built from.
+**/
+VOID
+BmCacheFilePathDevicePath (
+  IN  EFI_DEVICE_PATH_PROTOCOL  *FullPath,
+  IN  EFI_DEVICE_PATH_PROTOCOL  *FilePath
+  )
+{
+  EFI_DEVICE_PATH_PROTOCOL  *FrontPath;
+  EFI_DEVICE_PATH_PROTOCOL  *CachedFrontPath;
+  UINTN                     CachedFrontPathSize;
+  UINTN                     FrontNodesSize;
+  UINTN                     FrontPathSize;
+
+  if (GetDevicePathSize (FullPath) <= GetDevicePathSize (FilePath)) {
+    return;
+  }
+
+  //
+  // The front path is FullPath with the trailing FilePath nodes removed.
+  //
+  FrontNodesSize = GetDevicePathSize (FullPath) - GetDevicePathSize (FilePath);
+  FrontPathSize  = FrontNodesSize + END_DEVICE_PATH_LENGTH;
+  FrontPath      = AllocatePool (FrontPathSize);
+  if (FrontPath == NULL) {
+    return;
+  }
+
+  CopyMem (FrontPath, FullPath, FrontNodesSize);
+  SetDevicePathEndNode ((UINT8 *)FrontPath + FrontNodesSize);
+
+  //
+  // Only write the variable when the cached front path changes.
+  // Failing to save only impacts performance next time expanding the short-form device path.
+  //
+  GetVariable2 (L"FPDP", &mBmFilePathBootVariableGuid, (VOID **)&CachedFrontPath, &CachedFrontPathSize);
+  if ((CachedFrontPath == NULL) ||
+      (CachedFrontPathSize != FrontPathSize) ||
+      (CompareMem (CachedFrontPath, FrontPath, FrontPathSize) != 0))
+  {
+    gRT->SetVariable (
+           L"FPDP",
+           &mBmFilePathBootVariableGuid,
+           EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_NON_VOLATILE,
+           FrontPathSize,
+           FrontPath
+           );
+  }
+
+  if (CachedFrontPath != NULL) {
+    FreePool (CachedFrontPath);
+  }
+
+  FreePool (FrontPath);
+}
+
+/**
+  Check whether FullPath is the expansion produced from the 'FPDP' cache,
+  i.e. whether its front part equals the cached front path.
+
+  @param FullPath      The expanded device path pointing to a load option.
+  @param FilePath      The short-form file-path device path it was built from.
+
+  @retval TRUE   FullPath was built from the cached front path.
+  @retval FALSE  FullPath was not built from the cached front path.
+**/
+BOOLEAN
+BmIsCachedFileFullPath (
+  IN EFI_DEVICE_PATH_PROTOCOL  *FullPath,
+  IN EFI_DEVICE_PATH_PROTOCOL  *FilePath
+  )
+{
+  EFI_DEVICE_PATH_PROTOCOL  *CachedFrontPath;
+  UINTN                     CachedFrontPathSize;
+  UINTN                     FrontNodesSize;
+  BOOLEAN                   Match;
+
+  if (GetDevicePathSize (FullPath) <= GetDevicePathSize (FilePath)) {
+    return FALSE;
+  }
+
+  GetVariable2 (L"FPDP", &mBmFilePathBootVariableGuid, (VOID **)&CachedFrontPath, &CachedFrontPathSize);
+  if (CachedFrontPath == NULL) {
+    return FALSE;
+  }
+
+  Match = FALSE;
+  if (IsDevicePathValid (CachedFrontPath, CachedFrontPathSize)) {
+    FrontNodesSize = GetDevicePathSize (FullPath) - GetDevicePathSize (FilePath);
+    Match          = (BOOLEAN)((FrontNodesSize + END_DEVICE_PATH_LENGTH == CachedFrontPathSize) &&
+                               (CompareMem (FullPath, CachedFrontPath, FrontNodesSize) == 0));
+  }
+
+  FreePool (CachedFrontPath);
+  return Match;
+}
+
 /**
   Expand File-path device path node to be full device path in platform.
 
@@ -676,6 +850,24 @@ BmExpandFileDevicePath (
   UINTN                     MediaType;
   EFI_DEVICE_PATH_PROTOCOL  *NextFullPath;
   BOOLEAN                   GetNext;
+  BOOLEAN                   ResumeFromCache;
+
+  //
+  // First try the front device path cached by a previous expansion so the
+  // common boot path avoids connecting every device in the system.
+  //
+  if (FullPath == NULL) {
+    NextFullPath = BmExpandFileDevicePathFromCache (FilePath);
+    if (NextFullPath != NULL) {
+      return NextFullPath;
+    }
+  }
+
+  //
+  // When the full path returned in last call was built from the cache, resume
+  // the enumeration from the beginning but skip the already-returned path.
+  //
+  ResumeFromCache = (BOOLEAN)((FullPath != NULL) && BmIsCachedFileFullPath (FullPath, FilePath));
 
   EfiBootManagerConnectAll ();
   Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiSimpleFileSystemProtocolGuid, NULL, &HandleCount, &Handles);
@@ -684,7 +876,7 @@ BmExpandFileDevicePath (
     Handles     = NULL;
   }
 
-  GetNext      = (BOOLEAN)(FullPath == NULL);
+  GetNext      = (BOOLEAN)((FullPath == NULL) || ResumeFromCache);
   NextFullPath = NULL;
   //
   // Enumerate all removable media devices followed by all fixed media devices,
@@ -704,6 +896,18 @@ BmExpandFileDevicePath (
       {
         NextFullPath = AppendDevicePath (DevicePathFromHandle (Handles[Index]), FilePath);
         if (GetNext) {
+          //
+          // Skip the path which was already returned from the cache in last call.
+          //
+          if (ResumeFromCache &&
+              (CompareMem (NextFullPath, FullPath, GetDevicePathSize (NextFullPath)) == 0))
+          {
+            ResumeFromCache = FALSE;
+            FreePool (NextFullPath);
+            NextFullPath = NULL;
+            continue;
+          }
+
           break;
         } else {
           GetNext = (BOOLEAN)(CompareMem (NextFullPath, FullPath, GetDevicePathSize (NextFullPath)) == 0);
@@ -722,6 +926,10 @@ BmExpandFileDevicePath (
     FreePool (Handles);
   }
 
+  if (NextFullPath != NULL) {
+    BmCacheFilePathDevicePath (NextFullPath, FilePath);
+  }
+
   return NextFullPath;
 }
 
@@ -29,6 +29,258 @@ STATIC EFI_UNICODE_COLLATION_PROTOCOL  *mUnicodeCollation = NULL;
   }                                   \
 }
 
+//
+// Partitions at or below this element count are finished with insertion sort.
+//
+#define USL_INSERTION_SORT_THRESHOLD  16
+
+/**
+  Swap two elements using the caller provided one-element buffer.
+
+  @param[in, out] Element1       Pointer to the first element.
+  @param[in, out] Element2       Pointer to the second element.
+  @param[in] ElementSize         Size of an element in bytes.
+  @param[in] SwapBuffer          Scratch buffer of at least ElementSize bytes.
+**/
+STATIC
+VOID
+InternalSortSwap (
+  IN OUT UINT8  *Element1,
+  IN OUT UINT8  *Element2,
+  IN UINTN      ElementSize,
+  IN VOID       *SwapBuffer
+  )
+{
+  CopyMem (SwapBuffer, Element1, ElementSize);
+  CopyMem (Element1, Element2, ElementSize);
+  CopyMem (Element2, SwapBuffer, ElementSize);
+}
+
+/**
+  Sort a small buffer of elements with insertion sort.
+
+  @param[in, out] BufferToSort   On call a Buffer of (possibly sorted) elements
+                                 on return a buffer of sorted elements.
+  @param[in] Count               The number of elements in the buffer to sort.
+  @param[in] ElementSize         Size of an element in bytes.
+  @param[in] CompareFunction     The function to call to perform the comparison
+                                 of any 2 elements.
+  @param[in] SwapBuffer          Scratch buffer of at least ElementSize bytes.
+**/
+STATIC
+VOID
+InternalInsertionSort (
+  IN OUT UINT8         *BufferToSort,
+  IN UINTN             Count,
+  IN UINTN             ElementSize,
+  IN SORT_COMPARE      CompareFunction,
+  IN VOID              *SwapBuffer
+  )
+{
+  UINTN  Index;
+  UINTN  InsertIndex;
+
+  for (Index = 1; Index < Count; Index++) {
+    CopyMem (SwapBuffer, BufferToSort + Index * ElementSize, ElementSize);
+    for (InsertIndex = Index;
+         (InsertIndex > 0) &&
+         (CompareFunction (BufferToSort + (InsertIndex - 1) * ElementSize, SwapBuffer) > 0);
+         InsertIndex--)
+    {
+      CopyMem (
+        BufferToSort + InsertIndex * ElementSize,
+        BufferToSort + (InsertIndex - 1) * ElementSize,
+        ElementSize
+        );
+    }
+
+    CopyMem (BufferToSort + InsertIndex * ElementSize, SwapBuffer, ElementSize);
+  }
+}
+
+/**
+  Restore the max-heap property for the subtree rooted at Root.
+
+  @param[in, out] BufferToSort   The buffer holding the heap.
+  @param[in] Root                Index of the subtree root to sift down.
+  @param[in] Count               The number of elements in the heap.
+  @param[in] ElementSize         Size of an element in bytes.
+  @param[in] CompareFunction     The function to call to perform the comparison
+                                 of any 2 elements.
+  @param[in] SwapBuffer          Scratch buffer of at least ElementSize bytes.
+**/
+STATIC
+VOID
+InternalHeapSiftDown (
+  IN OUT UINT8      *BufferToSort,
+  IN UINTN          Root,
+  IN UINTN          Count,
+  IN UINTN          ElementSize,
+  IN SORT_COMPARE   CompareFunction,
+  IN VOID           *SwapBuffer
+  )
+{
+  UINTN  Child;
+
+  while ((Child = 2 * Root + 1) < Count) {
+    if ((Child + 1 < Count) &&
+        (CompareFunction (BufferToSort + Child * ElementSize, BufferToSort + (Child + 1) * ElementSize) < 0))
+    {
+      Child++;
+    }
+
+    if (CompareFunction (BufferToSort + Root * ElementSize, BufferToSort + Child * ElementSize) >= 0) {
+      break;
+    }
+
+    InternalSortSwap (
+      BufferToSort + Root * ElementSize,
+      BufferToSort + Child * ElementSize,
+      ElementSize,
+      SwapBuffer
+      );
+    Root = Child;
+  }
+}
+
+/**
+  Sort a buffer of elements with heap sort.
+
+  Heap sort is used as the introsort fall back when quick sort partitioning
+  degenerates, which bounds the worst case at O(n*log(n)).
+
+  @param[in, out] BufferToSort   On call a Buffer of (possibly sorted) elements
+                                 on return a buffer of sorted elements.
+  @param[in] Count               The number of elements in the buffer to sort.
+  @param[in] ElementSize         Size of an element in bytes.
+  @param[in] CompareFunction     The function to call to perform the comparison
+                                 of any 2 elements.
+  @param[in] SwapBuffer          Scratch buffer of at least ElementSize bytes.
+**/
+STATIC
+VOID
+InternalHeapSort (
+  IN OUT UINT8      *BufferToSort,
+  IN UINTN          Count,
+  IN UINTN          ElementSize,
+  IN SORT_COMPARE   CompareFunction,
+  IN VOID           *SwapBuffer
+  )
+{
+  UINTN  Index;
+
+  for (Index = Count / 2; Index > 0; Index--) {
+    InternalHeapSiftDown (BufferToSort, Index - 1, Count, ElementSize, CompareFunction, SwapBuffer);
+  }
+
+  for (Index = Count - 1; Index > 0; Index--) {
+    InternalSortSwap (BufferToSort, BufferToSort + Index * ElementSize, ElementSize, SwapBuffer);
+    InternalHeapSiftDown (BufferToSort, 0, Index, ElementSize, CompareFunction, SwapBuffer);
+  }
+}
+
+/**
+  Sort a buffer of elements with introsort.
+
+  Quick sort with a median-of-three pivot is used until the partition is
+  small enough for insertion sort or the recursion depth indicates a
+  degenerate input, in which case heap sort finishes the partition. The
+  recursion always descends into the smaller partition and iterates on the
+  larger one, so the stack depth is bounded by log2(Count).
+
+  @param[in, out] BufferToSort   On call a Buffer of (possibly sorted) elements
+                                 on return a buffer of sorted elements.
+  @param[in] Count               The number of elements in the buffer to sort.
+  @param[in] ElementSize         Size of an element in bytes.
+  @param[in] CompareFunction     The function to call to perform the comparison
+                                 of any 2 elements.
+  @param[in] SwapBuffer          Scratch buffer of at least ElementSize bytes.
+  @param[in] DepthLimit          The remaining quick sort recursion depth
+                                 before falling back to heap sort.
+**/
+STATIC
+VOID
+InternalIntroSort (
+  IN OUT UINT8      *BufferToSort,
+  IN UINTN          Count,
+  IN UINTN          ElementSize,
+  IN SORT_COMPARE   CompareFunction,
+  IN VOID           *SwapBuffer,
+  IN UINTN          DepthLimit
+  )
+{
+  UINT8  *Pivot;
+  UINTN  Middle;
+  UINTN  StoreIndex;
+  UINTN  Index;
+
+  while (Count > USL_INSERTION_SORT_THRESHOLD) {
+    if (DepthLimit == 0) {
+      InternalHeapSort (BufferToSort, Count, ElementSize, CompareFunction, SwapBuffer);
+      return;
+    }
+
+    DepthLimit--;
+
+    //
+    // Move the median of the first, middle and last element to the last
+    // position and use it as the pivot for a Lomuto partition.
+    //
+    Middle = Count / 2;
+    if (CompareFunction (BufferToSort + Middle * ElementSize, BufferToSort) < 0) {
+      InternalSortSwap (BufferToSort + Middle * ElementSize, BufferToSort, ElementSize, SwapBuffer);
+    }
+
+    if (CompareFunction (BufferToSort + (Count - 1) * ElementSize, BufferToSort) < 0) {
+      InternalSortSwap (BufferToSort + (Count - 1) * ElementSize, BufferToSort, ElementSize, SwapBuffer);
+    }
+
+    if (CompareFunction (BufferToSort + Middle * ElementSize, BufferToSort + (Count - 1) * ElementSize) < 0) {
+      InternalSortSwap (BufferToSort + Middle * ElementSize, BufferToSort + (Count - 1) * ElementSize, ElementSize, SwapBuffer);
+    }
+
+    Pivot      = BufferToSort + (Count - 1) * ElementSize;
+    StoreIndex = 0;
+    for (Index = 0; Index < Count - 1; Index++) {
+      if (CompareFunction (BufferToSort + Index * ElementSize, Pivot) < 0) {
+        if (Index != StoreIndex) {
+          InternalSortSwap (
+            BufferToSort + Index * ElementSize,
+            BufferToSort + StoreIndex * ElementSize,
+            ElementSize,
+            SwapBuffer
+            );
+        }
+
+        StoreIndex++;
+      }
+    }
+
+    InternalSortSwap (BufferToSort + StoreIndex * ElementSize, Pivot, ElementSize, SwapBuffer);
+
+    //
+    // Recurse into the smaller partition and iterate on the larger one.
+    //
+    if (StoreIndex < Count - StoreIndex - 1) {
+      InternalIntroSort (BufferToSort, StoreIndex, ElementSize, CompareFunction, SwapBuffer, DepthLimit);
+      BufferToSort += (StoreIndex + 1) * ElementSize;
+      Count        -= StoreIndex + 1;
+    } else {
+      InternalIntroSort (
+        BufferToSort + (StoreIndex + 1) * ElementSize,
+        Count - StoreIndex - 1,
+        ElementSize,
+        CompareFunction,
+        SwapBuffer,
+        DepthLimit
+        );
+      Count = StoreIndex;
+    }
+  }
+
+  InternalInsertionSort (BufferToSort, Count, ElementSize, CompareFunction, SwapBuffer);
+}
+
 /**
   Function to perform a Quick Sort alogrithm on a buffer of comparable elements.
 
@@ -61,15 +313,20 @@ PerformQuickSort (
   ASSERT (BufferToSort     != NULL);
   ASSERT (CompareFunction  != NULL);
 
+  if ((Count < 2) || (ElementSize < 1)) {
+    return;
+  }
+
   Buffer = AllocateZeroPool (ElementSize);
   ASSERT (Buffer != NULL);
 
-  QuickSort (
-    BufferToSort,
+  InternalIntroSort (
+    (UINT8 *)BufferToSort,
     Count,
     ElementSize,
     CompareFunction,
-    Buffer
+    Buffer,
+    2 * (UINTN)(HighBitSet64 ((UINT64)Count) + 1)
     );
 
   FreePool (Buffer);
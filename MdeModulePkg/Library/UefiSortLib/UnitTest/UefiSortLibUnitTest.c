@@ -24,7 +24,8 @@
 #define UNIT_TEST_APP_NAME     "UefiSortLib Unit Tests"
 #define UNIT_TEST_APP_VERSION  "1.0"
 
-#define TEST_ARRAY_SIZE_9  9
+#define TEST_ARRAY_SIZE_9     9
+#define TEST_ARRAY_SIZE_1025  1025
 
 /**
   The function is called by PerformQuickSort to compare int values.
@@ -91,6 +92,58 @@ SortUINT32ArrayShouldSucceed (
   return UNIT_TEST_PASSED;
 }
 
+/**
+  Unit test for PerformQuickSort () API of the UefiSortLib with an array
+  large enough to exercise the partitioning paths of the sort.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+SortLargeUINT32ArrayShouldSucceed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT32  Index;
+  UINT32  Seed;
+  UINT32  *TestBuffer;
+
+  TestBuffer = AllocatePool (sizeof (UINT32) * TEST_ARRAY_SIZE_1025);
+  UT_ASSERT_NOT_NULL (TestBuffer);
+
+  //
+  // Fill the buffer with a deterministic pseudo random sequence.
+  //
+  Seed = 0x12345678;
+  for (Index = 0; Index < TEST_ARRAY_SIZE_1025; Index++) {
+    Seed              = Seed * 1103515245 + 12345;
+    TestBuffer[Index] = Seed;
+  }
+
+  PerformQuickSort (TestBuffer, TEST_ARRAY_SIZE_1025, sizeof (UINT32), (SORT_COMPARE)TestCompareFunction);
+
+  //
+  // TestCompareFunction sorts in descending order.
+  //
+  for (Index = 1; Index < TEST_ARRAY_SIZE_1025; Index++) {
+    UT_ASSERT_TRUE (TestBuffer[Index - 1] >= TestBuffer[Index]);
+  }
+
+  FreePool (TestBuffer);
+
+  return UNIT_TEST_PASSED;
+}
+
 /**
   Unit test for StringCompare () API of the UefiSortLib.
 
@@ -167,6 +220,7 @@ UnitTestingEntry (
   // --------------Suite--------Description------------Name--------------Function----------------Pre---Post---Context-----------
   //
   AddTestCase (SortTests, "Sort the Array", "Sort", SortUINT32ArrayShouldSucceed, NULL, NULL, NULL);
+  AddTestCase (SortTests, "Sort a large Array", "SortLarge", SortLargeUINT32ArrayShouldSucceed, NULL, NULL, NULL);
   AddTestCase (SortTests, "Compare the Buffer", "Compare", CompareSameBufferShouldSucceed, NULL, NULL, NULL);
 
   //
@@ -12,6 +12,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 extern EFI_GET_VARIABLE  mGetVariableHelper;
 extern UINT8             *mPolicyTable;
+extern UINT32            *mPolicyIndexOffsets;
+extern UINT32            *mPolicyIndexLinks;
 STATIC BOOLEAN           mIsVirtualAddrConverted;
 STATIC EFI_EVENT         mVariablePolicyLibVirtualAddressChangeEvent = NULL;
 
@@ -31,6 +33,8 @@ VariablePolicyLibVirtualAddressCallback (
   )
 {
   gRT->ConvertPointer (0, (VOID **)&mPolicyTable);
+  gRT->ConvertPointer (0, (VOID **)&mPolicyIndexOffsets);
+  gRT->ConvertPointer (0, (VOID **)&mPolicyIndexLinks);
   gRT->ConvertPointer (0, (VOID **)&mGetVariableHelper);
   mIsVirtualAddrConverted = TRUE;
 }
@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <Uefi.h>
 
+#include <Library/BaseLib.h>
 #include <Library/SafeIntLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/BaseMemoryLib.h>
@@ -47,6 +48,21 @@ STATIC  UINT32  mCurrentTableCount = 0;
 
 #define POLICY_TABLE_STEP_SIZE  0x1000
 
+// Hash index over the policy table, bucketed by namespace GUID, so that
+// policy evaluation only walks the entries that can match the target
+// variable's VendorGuid instead of the whole table.
+// Entries are kept as byte offsets into mPolicyTable (not pointers) so the
+// index stays valid when the table is reallocated or converted to a virtual
+// address. Buckets chain entries in registration order.
+UINT32          *mPolicyIndexOffsets  = NULL;
+UINT32          *mPolicyIndexLinks    = NULL;
+STATIC  UINT32  mPolicyIndexCapacity  = 0;
+STATIC  UINT32  mPolicyIndexBuckets[32];
+
+#define POLICY_INDEX_BUCKET_COUNT  (ARRAY_SIZE (mPolicyIndexBuckets))
+#define POLICY_INDEX_STEP_COUNT    64
+#define POLICY_INDEX_END           MAX_UINT32
+
 // NOTE: DO NOT USE THESE MACROS on any structure that has not been validated.
 //       Current table data has already been sanitized.
 #define GET_NEXT_POLICY(CurPolicy)  (VARIABLE_POLICY_ENTRY*)((UINT8*)CurPolicy + CurPolicy->Size)
@@ -292,6 +308,29 @@ Exit:
   return Result;
 }
 
+/**
+  This helper function calculates the index bucket that holds all policies
+  registered for a given namespace GUID.
+
+  @param[in]  Namespace     The namespace GUID to hash.
+
+  @retval     UINT32        Bucket number in mPolicyIndexBuckets.
+
+**/
+STATIC
+UINT32
+GetPolicyIndexBucket (
+  IN CONST  EFI_GUID  *Namespace
+  )
+{
+  UINT64  Hash;
+
+  Hash = ReadUnaligned64 ((CONST UINT64 *)Namespace) ^
+         ReadUnaligned64 ((CONST UINT64 *)Namespace + 1);
+
+  return (UINT32)(Hash ^ (Hash >> 32)) & (POLICY_INDEX_BUCKET_COUNT - 1);
+}
+
 /**
   This helper function walks the current policy table and returns a pointer
   to the best match, if any are found. Leverages EvaluatePolicyMatch() to
@@ -319,14 +358,17 @@ GetBestPolicyMatch (
   VARIABLE_POLICY_ENTRY  *CurrentEntry;
   UINT8                  MatchPriority;
   UINT8                  CurrentPriority;
-  UINTN                  Index;
+  UINT32                 IndexEntry;
 
   BestResult    = NULL;
   MatchPriority = MATCH_PRIORITY_EXACT;
 
-  // Walk all entries in the table, looking for matches.
-  CurrentEntry = (VARIABLE_POLICY_ENTRY *)mPolicyTable;
-  for (Index = 0; Index < mCurrentTableCount; Index++) {
+  // Walk the entries in the bucket for the target namespace, looking for matches.
+  // Any policy that can match VendorGuid hashes to this bucket, so the rest
+  // of the table does not need to be evaluated.
+  IndexEntry = mPolicyIndexBuckets[GetPolicyIndexBucket (VendorGuid)];
+  while (IndexEntry != POLICY_INDEX_END) {
+    CurrentEntry = (VARIABLE_POLICY_ENTRY *)(mPolicyTable + mPolicyIndexOffsets[IndexEntry]);
     // Check for a match.
     if (EvaluatePolicyMatch (CurrentEntry, VariableName, VendorGuid, &CurrentPriority)) {
       // If match is better, take it.
@@ -341,8 +383,8 @@ GetBestPolicyMatch (
       }
     }
 
-    // If we're still in the loop, move to the next entry.
-    CurrentEntry = GET_NEXT_POLICY (CurrentEntry);
+    // If we're still in the loop, move to the next entry in the bucket.
+    IndexEntry = mPolicyIndexLinks[IndexEntry];
   }
 
   // If a return priority was requested, return it.
@@ -380,6 +422,11 @@ RegisterVariablePolicy (
   UINT8                  MatchPriority;
   UINT32                 NewSize;
   UINT8                  *NewTable;
+  UINT32                 NewIndexCapacity;
+  UINT32                 *NewIndexOffsets;
+  UINT32                 *NewIndexLinks;
+  UINT32                 Bucket;
+  UINT32                 IndexEntry;
 
   if (!IsVariablePolicyLibInitialized ()) {
     return EFI_NOT_READY;
@@ -436,6 +483,58 @@ RegisterVariablePolicy (
     mPolicyTable = NewTable;
   }
 
+  // If the hash index is full, grow it as well before committing the policy.
+  if (mCurrentTableCount >= mPolicyIndexCapacity) {
+    Status = SafeUint32Add (mPolicyIndexCapacity, POLICY_INDEX_STEP_COUNT, &NewIndexCapacity);
+    if (EFI_ERROR (Status)) {
+      return EFI_ABORTED;
+    }
+
+    NewIndexOffsets = AllocateRuntimePool (NewIndexCapacity * sizeof (UINT32));
+    NewIndexLinks   = AllocateRuntimePool (NewIndexCapacity * sizeof (UINT32));
+    if ((NewIndexOffsets == NULL) || (NewIndexLinks == NULL)) {
+      if (NewIndexOffsets != NULL) {
+        FreePool (NewIndexOffsets);
+      }
+
+      if (NewIndexLinks != NULL) {
+        FreePool (NewIndexLinks);
+      }
+
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    if (mPolicyIndexOffsets != NULL) {
+      CopyMem (NewIndexOffsets, mPolicyIndexOffsets, mCurrentTableCount * sizeof (UINT32));
+      FreePool (mPolicyIndexOffsets);
+    }
+
+    if (mPolicyIndexLinks != NULL) {
+      CopyMem (NewIndexLinks, mPolicyIndexLinks, mCurrentTableCount * sizeof (UINT32));
+      FreePool (mPolicyIndexLinks);
+    }
+
+    mPolicyIndexOffsets  = NewIndexOffsets;
+    mPolicyIndexLinks    = NewIndexLinks;
+    mPolicyIndexCapacity = NewIndexCapacity;
+  }
+
+  // Link the new policy into the tail of its namespace bucket so that the
+  // bucket chain preserves registration order.
+  Bucket                                  = GetPolicyIndexBucket (&NewPolicy->Namespace);
+  mPolicyIndexOffsets[mCurrentTableCount] = mCurrentTableUsage;
+  mPolicyIndexLinks[mCurrentTableCount]   = POLICY_INDEX_END;
+  if (mPolicyIndexBuckets[Bucket] == POLICY_INDEX_END) {
+    mPolicyIndexBuckets[Bucket] = mCurrentTableCount;
+  } else {
+    IndexEntry = mPolicyIndexBuckets[Bucket];
+    while (mPolicyIndexLinks[IndexEntry] != POLICY_INDEX_END) {
+      IndexEntry = mPolicyIndexLinks[IndexEntry];
+    }
+
+    mPolicyIndexLinks[IndexEntry] = mCurrentTableCount;
+  }
+
   // Copy the policy into the table.
   CopyMem (mPolicyTable + mCurrentTableUsage, NewPolicy, NewPolicy->Size);
   mCurrentTableUsage += NewPolicy->Size;
@@ -791,12 +890,18 @@ InitVariablePolicyLib (
     mGetVariableHelper = GetVariableHelper;
 
     // Initialize the global state.
-    mInterfaceLocked    = FALSE;
-    mProtectionDisabled = FALSE;
-    mPolicyTable        = NULL;
-    mCurrentTableSize   = 0;
-    mCurrentTableUsage  = 0;
-    mCurrentTableCount  = 0;
+    mInterfaceLocked     = FALSE;
+    mProtectionDisabled  = FALSE;
+    mPolicyTable         = NULL;
+    mCurrentTableSize    = 0;
+    mCurrentTableUsage   = 0;
+    mCurrentTableCount   = 0;
+    mPolicyIndexOffsets  = NULL;
+    mPolicyIndexLinks    = NULL;
+    mPolicyIndexCapacity = 0;
+
+    // Mark all hash index buckets as empty.
+    SetMem (mPolicyIndexBuckets, sizeof (mPolicyIndexBuckets), 0xFF);
   }
 
   return Status;
@@ -846,17 +951,30 @@ DeinitVariablePolicyLib (
   }
 
   if (!EFI_ERROR (Status)) {
-    mGetVariableHelper  = NULL;
-    mInterfaceLocked    = FALSE;
-    mProtectionDisabled = FALSE;
-    mCurrentTableSize   = 0;
-    mCurrentTableUsage  = 0;
-    mCurrentTableCount  = 0;
+    mGetVariableHelper   = NULL;
+    mInterfaceLocked     = FALSE;
+    mProtectionDisabled  = FALSE;
+    mCurrentTableSize    = 0;
+    mCurrentTableUsage   = 0;
+    mCurrentTableCount   = 0;
+    mPolicyIndexCapacity = 0;
 
     if (mPolicyTable != NULL) {
       FreePool (mPolicyTable);
       mPolicyTable = NULL;
     }
+
+    if (mPolicyIndexOffsets != NULL) {
+      FreePool (mPolicyIndexOffsets);
+      mPolicyIndexOffsets = NULL;
+    }
+
+    if (mPolicyIndexLinks != NULL) {
+      FreePool (mPolicyIndexLinks);
+      mPolicyIndexLinks = NULL;
+    }
+
+    SetMem (mPolicyIndexBuckets, sizeof (mPolicyIndexBuckets), 0xFF);
   }
 
   return Status;
@@ -212,7 +212,6 @@ InstallAcpiTable (
 {
   EFI_ACPI_TABLE_INSTANCE  *AcpiTableInstance;
   EFI_STATUS               Status;
-  VOID                     *AcpiTableBufferConst;
   EFI_ACPI_TABLE_VERSION   Version;
 
   //
@@ -232,18 +231,19 @@ InstallAcpiTable (
   AcpiTableInstance = EFI_ACPI_TABLE_INSTANCE_FROM_THIS (This);
 
   //
-  // Install the ACPI table
+  // Install the ACPI table.  AddTableToList only reads from the caller's
+  // buffer and copies it into the table's own allocation, so no intermediate
+  // pool copy is needed.
   //
-  AcpiTableBufferConst = AllocateCopyPool (AcpiTableBufferSize, AcpiTableBuffer);
-  *TableKey            = 0;
-  Status               = AddTableToList (
-                           AcpiTableInstance,
-                           AcpiTableBufferConst,
-                           TRUE,
-                           Version,
-                           FALSE,
-                           TableKey
-                           );
+  *TableKey = 0;
+  Status    = AddTableToList (
+                AcpiTableInstance,
+                AcpiTableBuffer,
+                TRUE,
+                Version,
+                FALSE,
+                TableKey
+                );
   if (!EFI_ERROR (Status)) {
     Status = PublishTables (
                AcpiTableInstance,
@@ -251,8 +251,6 @@ InstallAcpiTable (
                );
   }
 
-  FreePool (AcpiTableBufferConst);
-
   //
   // Add a new table successfully, notify registed callback
   //
@@ -1133,7 +1131,11 @@ AddTableToList (
     }
   }
 
-  ChecksumCommonTables (AcpiTableInstance);
+  //
+  // The RSDP/RSDT/XSDT checksums are not updated here.  Every caller follows
+  // a successful add with PublishTables, which re-checksums the common tables
+  // once, so a batch of additions pays for a single checksum pass.
+  //
   return EFI_SUCCESS;
 }
 
@@ -1030,6 +1030,7 @@ CapsuleDataCoalesce (
   UINT8                          *FreeMemBase;
   UINT8                          *DestPtr;
   UINTN                          DestLength;
+  UINTN                          MaxBlockEnd;
   UINT8                          *RelocPtr;
   UINTN                          CapsuleTimes;
   UINT64                         SizeLeft;
@@ -1195,6 +1196,23 @@ CapsuleDataCoalesce (
 
   PrivateDataPtr = (EFI_CAPSULE_PEIM_PRIVATE_DATA *)NewCapsuleBase;
 
+  //
+  // Compute the highest address used by any capsule fragment. Fragments are
+  // never moved upward after this point (relocation targets lie below the
+  // destination region), so once the destination pointer passes this address
+  // no remaining fragment can obstruct a copy and the per-block obstruction
+  // scan below can be skipped.
+  //
+  MaxBlockEnd   = 0;
+  TempBlockDesc = BlockList;
+  while (TempBlockDesc->Length != 0) {
+    if (((UINTN)TempBlockDesc->Union.DataBlock + (UINTN)TempBlockDesc->Length) > MaxBlockEnd) {
+      MaxBlockEnd = (UINTN)TempBlockDesc->Union.DataBlock + (UINTN)TempBlockDesc->Length;
+    }
+
+    TempBlockDesc++;
+  }
+
   //
   // Move all the blocks to the top (high) of memory.
   // Relocate all the obstructing blocks. Note that the block descriptors
@@ -1214,44 +1232,53 @@ CapsuleDataCoalesce (
     }
 
     //
-    // See if any of the remaining capsule blocks are in the way
+    // See if any of the remaining capsule blocks are in the way. No block
+    // can be in the way once the destination pointer has passed the highest
+    // fragment address.
     //
-    TempBlockDesc = CurrentBlockDesc;
-    while (TempBlockDesc->Length != 0) {
-      //
-      // Is this block in the way of where we want to copy the current descriptor to?
-      //
-      if (IsOverlapped (
-            (UINT8 *)DestPtr,
-            (UINTN)DestLength,
-            (UINT8 *)(UINTN)TempBlockDesc->Union.DataBlock,
-            (UINTN)TempBlockDesc->Length
-            ))
-      {
+    if (MaxBlockEnd > (UINTN)DestPtr) {
+      TempBlockDesc = CurrentBlockDesc;
+      while (TempBlockDesc->Length != 0) {
         //
-        // Relocate the block
+        // Is this block in the way of where we want to copy the current descriptor to?
+        // The current block is left alone when it already sits exactly at its
+        // destination, instead of being relocated just to be copied back.
         //
-        RelocPtr = FindFreeMem (BlockList, FreeMemBase, FreeMemSize, (UINTN)TempBlockDesc->Length);
-        if (RelocPtr == NULL) {
-          return EFI_BUFFER_TOO_SMALL;
-        }
+        if (((TempBlockDesc != CurrentBlockDesc) ||
+             (TempBlockDesc->Union.DataBlock != (EFI_PHYSICAL_ADDRESS)(UINTN)DestPtr) ||
+             ((UINTN)TempBlockDesc->Length != DestLength)) &&
+            IsOverlapped (
+              (UINT8 *)DestPtr,
+              (UINTN)DestLength,
+              (UINT8 *)(UINTN)TempBlockDesc->Union.DataBlock,
+              (UINTN)TempBlockDesc->Length
+              ))
+        {
+          //
+          // Relocate the block
+          //
+          RelocPtr = FindFreeMem (BlockList, FreeMemBase, FreeMemSize, (UINTN)TempBlockDesc->Length);
+          if (RelocPtr == NULL) {
+            return EFI_BUFFER_TOO_SMALL;
+          }
+
+          CopyMem ((VOID *)RelocPtr, (VOID *)(UINTN)TempBlockDesc->Union.DataBlock, (UINTN)TempBlockDesc->Length);
+          DEBUG ((
+            DEBUG_INFO,
+            "Capsule reloc data block from 0x%8X to 0x%8X with size 0x%8X\n",
+            (UINTN)TempBlockDesc->Union.DataBlock,
+            (UINTN)RelocPtr,
+            (UINTN)TempBlockDesc->Length
+            ));
 
-        CopyMem ((VOID *)RelocPtr, (VOID *)(UINTN)TempBlockDesc->Union.DataBlock, (UINTN)TempBlockDesc->Length);
-        DEBUG ((
-          DEBUG_INFO,
-          "Capsule reloc data block from 0x%8X to 0x%8X with size 0x%8X\n",
-          (UINTN)TempBlockDesc->Union.DataBlock,
-          (UINTN)RelocPtr,
-          (UINTN)TempBlockDesc->Length
-          ));
+          TempBlockDesc->Union.DataBlock = (EFI_PHYSICAL_ADDRESS)(UINTN)RelocPtr;
+        }
 
-        TempBlockDesc->Union.DataBlock = (EFI_PHYSICAL_ADDRESS)(UINTN)RelocPtr;
+        //
+        // Next descriptor
+        //
+        TempBlockDesc++;
       }
-
-      //
-      // Next descriptor
-      //
-      TempBlockDesc++;
     }
 
     //
@@ -1294,15 +1321,29 @@ CapsuleDataCoalesce (
       //
       ASSERT (CurrentBlockDesc->Length <= SizeLeft);
 
-      CopyMem ((VOID *)DestPtr, (VOID *)(UINTN)(CurrentBlockDesc->Union.DataBlock), (UINTN)CurrentBlockDesc->Length);
-      DEBUG ((
-        DEBUG_INFO,
-        "Capsule coalesce block no.0x%lX from 0x%lX to 0x%lX with size 0x%lX\n",
-        (UINT64)CapsuleTimes,
-        CurrentBlockDesc->Union.DataBlock,
-        (UINT64)(UINTN)DestPtr,
-        CurrentBlockDesc->Length
-        ));
+      if ((UINTN)CurrentBlockDesc->Union.DataBlock == (UINTN)DestPtr) {
+        //
+        // The block already sits at its destination.
+        //
+        DEBUG ((
+          DEBUG_INFO,
+          "Capsule coalesce block no.0x%lX already in place at 0x%lX with size 0x%lX\n",
+          (UINT64)CapsuleTimes,
+          CurrentBlockDesc->Union.DataBlock,
+          CurrentBlockDesc->Length
+          ));
+      } else {
+        CopyMem ((VOID *)DestPtr, (VOID *)(UINTN)(CurrentBlockDesc->Union.DataBlock), (UINTN)CurrentBlockDesc->Length);
+        DEBUG ((
+          DEBUG_INFO,
+          "Capsule coalesce block no.0x%lX from 0x%lX to 0x%lX with size 0x%lX\n",
+          (UINT64)CapsuleTimes,
+          CurrentBlockDesc->Union.DataBlock,
+          (UINT64)(UINTN)DestPtr,
+          CurrentBlockDesc->Length
+          ));
+      }
+
       DestPtr  += CurrentBlockDesc->Length;
       SizeLeft -= CurrentBlockDesc->Length;
 
@@ -36,7 +36,9 @@ GRAPHICS_CONSOLE_DEV  mGraphicsConsoleDevTemplate = {
     FALSE
   },
   (GRAPHICS_CONSOLE_MODE_DATA *)NULL,
-  (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *)NULL
+  (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *)NULL,
+  (CHAR16 *)NULL,
+  0
 };
 
 GRAPHICS_CONSOLE_MODE_DATA  mGraphicsConsoleModeData[] = {
@@ -660,6 +662,10 @@ Error:
       FreePool (Private->LineBuffer);
     }
 
+    if (Private->DrawStringBuffer != NULL) {
+      FreePool (Private->DrawStringBuffer);
+    }
+
     if (Private->ModeData != NULL) {
       FreePool (Private->ModeData);
     }
@@ -748,6 +754,10 @@ GraphicsConsoleControllerDriverStop (
       FreePool (Private->LineBuffer);
     }
 
+    if (Private->DrawStringBuffer != NULL) {
+      FreePool (Private->DrawStringBuffer);
+    }
+
     if (Private->ModeData != NULL) {
       FreePool (Private->ModeData);
     }
@@ -1778,44 +1788,53 @@ DrawUnicodeWeightAtCursorN (
 {
   EFI_STATUS             Status;
   GRAPHICS_CONSOLE_DEV   *Private;
+  EFI_IMAGE_OUTPUT       ImageOutput;
   EFI_IMAGE_OUTPUT       *Blt;
   EFI_STRING             String;
-  EFI_FONT_DISPLAY_INFO  *FontInfo;
+  EFI_FONT_DISPLAY_INFO  FontInfo;
   EFI_UGA_DRAW_PROTOCOL  *UgaDraw;
   EFI_HII_ROW_INFO       *RowInfoArray;
   UINTN                  RowInfoArraySize;
 
   Private = GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS (This);
-  Blt     = (EFI_IMAGE_OUTPUT *)AllocateZeroPool (sizeof (EFI_IMAGE_OUTPUT));
-  if (Blt == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
 
+  ZeroMem (&ImageOutput, sizeof (ImageOutput));
+  Blt         = &ImageOutput;
   Blt->Width  = (UINT16)(Private->ModeData[This->Mode->Mode].GopWidth);
   Blt->Height = (UINT16)(Private->ModeData[This->Mode->Mode].GopHeight);
 
-  String = AllocateCopyPool ((Count + 1) * sizeof (CHAR16), UnicodeWeight);
-  if (String == NULL) {
-    FreePool (Blt);
-    return EFI_OUT_OF_RESOURCES;
+  //
+  // Reuse the per-device string buffer, growing it when the run is longer
+  // than any drawn before, so the common output path performs no pool
+  // allocation per call.
+  //
+  if ((Count + 1) * sizeof (CHAR16) > Private->DrawStringBufferSize) {
+    String = AllocatePool ((Count + 1) * sizeof (CHAR16));
+    if (String == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    if (Private->DrawStringBuffer != NULL) {
+      FreePool (Private->DrawStringBuffer);
+    }
+
+    Private->DrawStringBuffer     = String;
+    Private->DrawStringBufferSize = (Count + 1) * sizeof (CHAR16);
   }
 
+  String = Private->DrawStringBuffer;
+  CopyMem (String, UnicodeWeight, Count * sizeof (CHAR16));
+
   //
   // Set the end character
   //
   *(String + Count) = L'\0';
 
-  FontInfo = (EFI_FONT_DISPLAY_INFO *)AllocateZeroPool (sizeof (EFI_FONT_DISPLAY_INFO));
-  if (FontInfo == NULL) {
-    FreePool (Blt);
-    FreePool (String);
-    return EFI_OUT_OF_RESOURCES;
-  }
-
   //
   // Get current foreground and background colors.
   //
-  GetTextColors (This, &FontInfo->ForegroundColor, &FontInfo->BackgroundColor);
+  ZeroMem (&FontInfo, sizeof (FontInfo));
+  GetTextColors (This, &FontInfo.ForegroundColor, &FontInfo.BackgroundColor);
 
   if (Private->GraphicsOutput != NULL) {
     //
@@ -1827,7 +1846,7 @@ DrawUnicodeWeightAtCursorN (
                          mHiiFont,
                          EFI_HII_IGNORE_IF_NO_GLYPH | EFI_HII_DIRECT_TO_SCREEN | EFI_HII_IGNORE_LINE_BREAK,
                          String,
-                         FontInfo,
+                         &FontInfo,
                          &Blt,
                          This->Mode->CursorColumn * EFI_GLYPH_WIDTH + Private->ModeData[This->Mode->Mode].DeltaX,
                          This->Mode->CursorRow * EFI_GLYPH_HEIGHT + Private->ModeData[This->Mode->Mode].DeltaY,
@@ -1846,8 +1865,6 @@ DrawUnicodeWeightAtCursorN (
 
     Blt->Image.Bitmap = AllocateZeroPool (Blt->Width * Blt->Height * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
     if (Blt->Image.Bitmap == NULL) {
-      FreePool (Blt);
-      FreePool (String);
       return EFI_OUT_OF_RESOURCES;
     }
 
@@ -1860,7 +1877,7 @@ DrawUnicodeWeightAtCursorN (
                          mHiiFont,
                          EFI_HII_IGNORE_IF_NO_GLYPH | EFI_HII_IGNORE_LINE_BREAK,
                          String,
-                         FontInfo,
+                         &FontInfo,
                          &Blt,
                          This->Mode->CursorColumn * EFI_GLYPH_WIDTH + Private->ModeData[This->Mode->Mode].DeltaX,
                          This->Mode->CursorRow * EFI_GLYPH_HEIGHT + Private->ModeData[This->Mode->Mode].DeltaY,
@@ -1896,18 +1913,6 @@ DrawUnicodeWeightAtCursorN (
     Status = EFI_UNSUPPORTED;
   }
 
-  if (Blt != NULL) {
-    FreePool (Blt);
-  }
-
-  if (String != NULL) {
-    FreePool (String);
-  }
-
-  if (FontInfo != NULL) {
-    FreePool (FontInfo);
-  }
-
   return Status;
 }
 
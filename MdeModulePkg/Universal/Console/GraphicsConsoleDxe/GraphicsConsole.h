@@ -64,6 +64,13 @@ typedef struct {
   EFI_SIMPLE_TEXT_OUTPUT_MODE        SimpleTextOutputMode;
   GRAPHICS_CONSOLE_MODE_DATA         *ModeData;
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL      *LineBuffer;
+  //
+  // Reusable buffer for the NULL-terminated copy of the string run drawn by
+  // DrawUnicodeWeightAtCursorN (), grown on demand so no pool allocation is
+  // needed on every OutputString () call.
+  //
+  CHAR16                             *DrawStringBuffer;
+  UINTN                              DrawStringBufferSize;
 } GRAPHICS_CONSOLE_DEV;
 
 #define GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS(a) \
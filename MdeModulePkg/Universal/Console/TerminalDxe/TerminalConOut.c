@@ -80,10 +80,54 @@ CHAR16  mSetCursorPositionString[] = { ESC, '[', '0', '0', ';', '0', '0', 'H', 0
 CHAR16  mCursorForwardString[]     = { ESC, '[', '0', '0', 'C', 0 };
 CHAR16  mCursorBackwardString[]    = { ESC, '[', '0', '0', 'D', 0 };
 
+//
+// The size of the local buffer OutputString() uses to coalesce converted
+// characters into batched serial writes. One iteration appends at most a
+// UTF8 character (3 bytes) plus the TtyTerm CR LF wrap synchronization.
+//
+#define TERMINAL_OUTPUT_BUFFER_SIZE      128
+#define TERMINAL_OUTPUT_MAX_APPEND_SIZE  5
+
 //
 // Body of the ConOut functions
 //
 
+/**
+  Write the coalesced output bytes to the serial device in one request.
+
+  @param  TerminalDevice   Terminal device the buffer content belongs to.
+  @param  Buffer           The coalesced output bytes.
+  @param  Length           On input, the number of valid bytes in Buffer.
+                           On output, zero.
+
+  @retval EFI_SUCCESS      All bytes were sent to the serial device.
+  @return                  Error status of the serial write.
+
+**/
+EFI_STATUS
+TerminalFlushOutputBuffer (
+  IN     TERMINAL_DEV  *TerminalDevice,
+  IN     UINT8         *Buffer,
+  IN OUT UINTN         *Length
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       WriteLength;
+
+  if (*Length == 0) {
+    return EFI_SUCCESS;
+  }
+
+  WriteLength = *Length;
+  *Length     = 0;
+  Status      = TerminalDevice->SerialIo->Write (
+                                            TerminalDevice->SerialIo,
+                                            &WriteLength,
+                                            Buffer
+                                            );
+  return Status;
+}
+
 /**
   Implements EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL.Reset().
 
@@ -175,22 +219,23 @@ TerminalConOutOutputString (
   EFI_SIMPLE_TEXT_OUTPUT_MODE  *Mode;
   UINTN                        MaxColumn;
   UINTN                        MaxRow;
-  UINTN                        Length;
   UTF8_CHAR                    Utf8Char;
   CHAR8                        GraphicChar;
   CHAR8                        AsciiChar;
   EFI_STATUS                   Status;
   UINT8                        ValidBytes;
-  CHAR8                        CrLfStr[2];
+  UINT8                        OutputBuffer[TERMINAL_OUTPUT_BUFFER_SIZE];
+  UINTN                        OutputLength;
   //
   //  flag used to indicate whether condition happens which will cause
   //  return EFI_WARN_UNKNOWN_GLYPH
   //
   BOOLEAN  Warning;
 
-  ValidBytes = 0;
-  Warning    = FALSE;
-  AsciiChar  = 0;
+  ValidBytes   = 0;
+  Warning      = FALSE;
+  AsciiChar    = 0;
+  OutputLength = 0;
 
   //
   //  get Terminal device data structure pointer.
@@ -214,6 +259,18 @@ TerminalConOutOutputString (
           );
 
   for ( ; *WString != CHAR_NULL; WString++) {
+    //
+    // Coalesce converted characters into OutputBuffer and send them to the
+    // serial device in batches, instead of one write per character. Flush
+    // when the buffer cannot hold the bytes a single iteration may append.
+    //
+    if (OutputLength + TERMINAL_OUTPUT_MAX_APPEND_SIZE > sizeof (OutputBuffer)) {
+      Status = TerminalFlushOutputBuffer (TerminalDevice, OutputBuffer, &OutputLength);
+      if (EFI_ERROR (Status)) {
+        goto OutputError;
+      }
+    }
+
     switch (TerminalDevice->TerminalType) {
       case TerminalTypePcAnsi:
       case TerminalTypeVt100:
@@ -251,31 +308,15 @@ TerminalConOutOutputString (
           GraphicChar = AsciiChar;
         }
 
-        Length = 1;
-
-        Status = TerminalDevice->SerialIo->Write (
-                                             TerminalDevice->SerialIo,
-                                             &Length,
-                                             &GraphicChar
-                                             );
-
-        if (EFI_ERROR (Status)) {
-          goto OutputError;
-        }
+        OutputBuffer[OutputLength] = (UINT8)GraphicChar;
+        OutputLength++;
 
         break;
 
       case TerminalTypeVtUtf8:
         UnicodeToUtf8 (*WString, &Utf8Char, &ValidBytes);
-        Length = ValidBytes;
-        Status = TerminalDevice->SerialIo->Write (
-                                             TerminalDevice->SerialIo,
-                                             &Length,
-                                             (UINT8 *)&Utf8Char
-                                             );
-        if (EFI_ERROR (Status)) {
-          goto OutputError;
-        }
+        CopyMem (&OutputBuffer[OutputLength], &Utf8Char, ValidBytes);
+        OutputLength += ValidBytes;
 
         break;
     }
@@ -322,20 +363,10 @@ TerminalConOutOutputString (
             // the driver, but only if we're not in the middle of
             // printing an escape sequence.
             //
-            CrLfStr[0] = '\r';
-            CrLfStr[1] = '\n';
-
-            Length = sizeof (CrLfStr);
-
-            Status = TerminalDevice->SerialIo->Write (
-                                                 TerminalDevice->SerialIo,
-                                                 &Length,
-                                                 CrLfStr
-                                                 );
-
-            if (EFI_ERROR (Status)) {
-              goto OutputError;
-            }
+            OutputBuffer[OutputLength] = '\r';
+            OutputLength++;
+            OutputBuffer[OutputLength] = '\n';
+            OutputLength++;
           }
         }
 
@@ -343,6 +374,15 @@ TerminalConOutOutputString (
     }
   }
 
+  //
+  // Send whatever is still pending in the output buffer to the device in
+  // one last write.
+  //
+  Status = TerminalFlushOutputBuffer (TerminalDevice, OutputBuffer, &OutputLength);
+  if (EFI_ERROR (Status)) {
+    goto OutputError;
+  }
+
   if (Warning) {
     return EFI_WARN_UNKNOWN_GLYPH;
   }
@@ -791,6 +831,19 @@ TerminalConOutSetCursorPosition (
     } else {
       String = L"";  // No cursor motion necessary
     }
+  } else if (((UINTN)Mode->CursorColumn == Column) &&
+             ((UINTN)Mode->CursorRow == Row) &&
+             (Column != 0))
+  {
+    //
+    // The cursor is already where the caller wants it, so no control
+    // sequence is needed.  Skip this shortcut at column 0: after writing
+    // the last character of a line the driver wraps CursorColumn to 0
+    // immediately while the terminal defers the wrap until the next
+    // character, so at column 0 the two may disagree and the explicit
+    // sequence must still be sent.
+    //
+    String = L"";
   } else {
     mSetCursorPositionString[ROW_OFFSET + 0]    = (CHAR16)('0' + ((Row + 1) / 10));
     mSetCursorPositionString[ROW_OFFSET + 1]    = (CHAR16)('0' + ((Row + 1) % 10));
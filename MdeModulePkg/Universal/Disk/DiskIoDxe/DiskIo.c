@@ -186,6 +186,39 @@ DiskIoDriverBindingStart (
     goto ErrorExit;
   }
 
+  //
+  // Set up the opt-in read-ahead cache. It is an optional accelerator, so
+  // run without it when it is disabled or when memory is tight.
+  //
+  if ((PcdGet32 (PcdDiskIoReadCacheBlockNum) >= DISK_IO_READ_CACHE_LINE_BLOCK_NUM) &&
+      (Instance->BlockIo->Media->BlockSize != 0))
+  {
+    Instance->ReadCacheLineNum   = PcdGet32 (PcdDiskIoReadCacheBlockNum) / DISK_IO_READ_CACHE_LINE_BLOCK_NUM;
+    Instance->ReadCacheBlockSize = Instance->BlockIo->Media->BlockSize;
+    Instance->ReadCacheMediaId   = Instance->BlockIo->Media->MediaId;
+    Instance->ReadCacheLines     = AllocateZeroPool (Instance->ReadCacheLineNum * sizeof (DISK_IO_READ_CACHE_LINE));
+    Instance->ReadCacheData      = AllocateAlignedPages (
+                                     EFI_SIZE_TO_PAGES (Instance->ReadCacheLineNum * DISK_IO_READ_CACHE_LINE_BLOCK_NUM * Instance->ReadCacheBlockSize),
+                                     Instance->BlockIo->Media->IoAlign
+                                     );
+    if ((Instance->ReadCacheLines == NULL) || (Instance->ReadCacheData == NULL)) {
+      if (Instance->ReadCacheData != NULL) {
+        FreeAlignedPages (
+          Instance->ReadCacheData,
+          EFI_SIZE_TO_PAGES (Instance->ReadCacheLineNum * DISK_IO_READ_CACHE_LINE_BLOCK_NUM * Instance->ReadCacheBlockSize)
+          );
+        Instance->ReadCacheData = NULL;
+      }
+
+      if (Instance->ReadCacheLines != NULL) {
+        FreePool (Instance->ReadCacheLines);
+        Instance->ReadCacheLines = NULL;
+      }
+
+      Instance->ReadCacheLineNum = 0;
+    }
+  }
+
   //
   // Install protocol interfaces for the Disk IO device.
   //
@@ -209,6 +242,14 @@ DiskIoDriverBindingStart (
 
 ErrorExit:
   if (EFI_ERROR (Status)) {
+    if ((Instance != NULL) && (Instance->ReadCacheLineNum != 0)) {
+      FreeAlignedPages (
+        Instance->ReadCacheData,
+        EFI_SIZE_TO_PAGES (Instance->ReadCacheLineNum * DISK_IO_READ_CACHE_LINE_BLOCK_NUM * Instance->ReadCacheBlockSize)
+        );
+      FreePool (Instance->ReadCacheLines);
+    }
+
     if ((Instance != NULL) && (Instance->SharedWorkingBuffer != NULL)) {
       FreeAlignedPages (
         Instance->SharedWorkingBuffer,
@@ -325,6 +366,14 @@ DiskIoDriverBindingStop (
       EfiReleaseLock (&Instance->TaskQueueLock);
     } while (!AllTaskDone);
 
+    if (Instance->ReadCacheLineNum != 0) {
+      FreeAlignedPages (
+        Instance->ReadCacheData,
+        EFI_SIZE_TO_PAGES (Instance->ReadCacheLineNum * DISK_IO_READ_CACHE_LINE_BLOCK_NUM * Instance->ReadCacheBlockSize)
+        );
+      FreePool (Instance->ReadCacheLines);
+    }
+
     FreeAlignedPages (
       Instance->SharedWorkingBuffer,
       EFI_SIZE_TO_PAGES (PcdGet32 (PcdDiskIoDataBufferBlockNum) * Instance->BlockIo->Media->BlockSize)
@@ -813,6 +862,150 @@ DiskIo2RemoveCompletedTask (
   return QueueEmpty;
 }
 
+/**
+  Invalidate the read cache lines overlapping the given byte range.
+
+  @param Instance    Pointer to the DISK_IO_PRIVATE_DATA.
+  @param Offset      The starting byte offset of the range.
+  @param Length      The length in bytes of the range.
+**/
+VOID
+DiskIoInvalidateReadCache (
+  IN DISK_IO_PRIVATE_DATA  *Instance,
+  IN UINT64                Offset,
+  IN UINTN                 Length
+  )
+{
+  UINTN                    Index;
+  UINT64                   FirstLba;
+  UINT64                   LastLba;
+  DISK_IO_READ_CACHE_LINE  *Line;
+
+  if ((Instance->ReadCacheLineNum == 0) || (Length == 0)) {
+    return;
+  }
+
+  FirstLba = DivU64x32 (Offset, Instance->ReadCacheBlockSize);
+  LastLba  = DivU64x32 (Offset + Length - 1, Instance->ReadCacheBlockSize);
+
+  for (Index = 0; Index < Instance->ReadCacheLineNum; Index++) {
+    Line = &Instance->ReadCacheLines[Index];
+    if (Line->Valid && (Line->Lba <= LastLba) && (Line->Lba + Line->BlockNum > FirstLba)) {
+      Line->Valid = FALSE;
+    }
+  }
+}
+
+/**
+  Read a single device block through the read cache.
+
+  On a miss a whole cache line is read from the device, aligned down to the
+  line boundary, so that a sequential reader finds the following blocks in
+  memory instead of issuing one device round trip per block.
+
+  @param Instance    Pointer to the DISK_IO_PRIVATE_DATA.
+  @param MediaId     ID of the medium to access.
+  @param Lba         The block to read.
+  @param Buffer      The buffer to hold one block of data.
+
+  @retval EFI_SUCCESS      The block data was copied to Buffer.
+  @retval EFI_UNSUPPORTED  The cache is disabled or cannot serve the request;
+                           the caller shall read from the device directly.
+  @retval Others           The device reported an error while filling the line.
+**/
+EFI_STATUS
+DiskIoReadCacheBlock (
+  IN DISK_IO_PRIVATE_DATA  *Instance,
+  IN UINT32                MediaId,
+  IN UINT64                Lba,
+  OUT UINT8                *Buffer
+  )
+{
+  EFI_BLOCK_IO_PROTOCOL    *BlockIo;
+  EFI_BLOCK_IO_MEDIA       *Media;
+  DISK_IO_READ_CACHE_LINE  *Line;
+  DISK_IO_READ_CACHE_LINE  *Victim;
+  UINT8                    *LineData;
+  UINT64                   LineLba;
+  UINT32                   BlockNum;
+  UINTN                    Index;
+  EFI_STATUS               Status;
+
+  BlockIo = Instance->BlockIo;
+  Media   = BlockIo->Media;
+
+  if ((Instance->ReadCacheLineNum == 0) ||
+      (Media->BlockSize != Instance->ReadCacheBlockSize) ||
+      !Media->MediaPresent || (MediaId != Media->MediaId)
+      )
+  {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (Media->MediaId != Instance->ReadCacheMediaId) {
+    //
+    // The medium was replaced - drop all cached lines.
+    //
+    for (Index = 0; Index < Instance->ReadCacheLineNum; Index++) {
+      Instance->ReadCacheLines[Index].Valid = FALSE;
+    }
+
+    Instance->ReadCacheMediaId = Media->MediaId;
+  }
+
+  Instance->ReadCacheSequence++;
+
+  Victim = &Instance->ReadCacheLines[0];
+  for (Index = 0; Index < Instance->ReadCacheLineNum; Index++) {
+    Line = &Instance->ReadCacheLines[Index];
+    if (Line->Valid && (Lba >= Line->Lba) && (Lba < Line->Lba + Line->BlockNum)) {
+      Line->Sequence = Instance->ReadCacheSequence;
+      CopyMem (
+        Buffer,
+        Instance->ReadCacheData + (Index * DISK_IO_READ_CACHE_LINE_BLOCK_NUM + (UINTN)(Lba - Line->Lba)) * Instance->ReadCacheBlockSize,
+        Instance->ReadCacheBlockSize
+        );
+      return EFI_SUCCESS;
+    }
+
+    if (!Line->Valid) {
+      Victim = Line;
+    } else if (Victim->Valid && (Line->Sequence < Victim->Sequence)) {
+      Victim = Line;
+    }
+  }
+
+  LineLba  = Lba & ~((UINT64)DISK_IO_READ_CACHE_LINE_BLOCK_NUM - 1);
+  BlockNum = DISK_IO_READ_CACHE_LINE_BLOCK_NUM;
+  if (LineLba + BlockNum > Media->LastBlock + 1) {
+    BlockNum = (UINT32)(Media->LastBlock + 1 - LineLba);
+  }
+
+  Index    = Victim - Instance->ReadCacheLines;
+  LineData = Instance->ReadCacheData + Index * DISK_IO_READ_CACHE_LINE_BLOCK_NUM * Instance->ReadCacheBlockSize;
+
+  Victim->Valid = FALSE;
+  Status        = BlockIo->ReadBlocks (
+                             BlockIo,
+                             MediaId,
+                             LineLba,
+                             (UINTN)BlockNum * Instance->ReadCacheBlockSize,
+                             LineData
+                             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Victim->Valid    = TRUE;
+  Victim->Lba      = LineLba;
+  Victim->BlockNum = BlockNum;
+  Victim->Sequence = Instance->ReadCacheSequence;
+
+  CopyMem (Buffer, LineData + (UINTN)(Lba - LineLba) * Instance->ReadCacheBlockSize, Instance->ReadCacheBlockSize);
+
+  return EFI_SUCCESS;
+}
+
 /**
   Common routine to access the disk.
 
@@ -858,6 +1051,14 @@ DiskIo2ReadWriteDisk (
   Status   = EFI_SUCCESS;
   Blocking = (BOOLEAN)((Token == NULL) || (Token->Event == NULL));
 
+  if (Write) {
+    //
+    // Drop the cached lines covering the written range before any subtask
+    // is issued, so subsequent reads go back to the device.
+    //
+    DiskIoInvalidateReadCache (Instance, Offset, BufferSize);
+  }
+
   if (Blocking) {
     //
     // Wait till pending async task is completed.
@@ -942,13 +1143,25 @@ DiskIo2ReadWriteDisk (
       // Read
       //
       if (SubtaskBlocking) {
-        Status = BlockIo->ReadBlocks (
-                            BlockIo,
-                            MediaId,
-                            Subtask->Lba,
-                            (Subtask->Length % Media->BlockSize == 0) ? Subtask->Length : Media->BlockSize,
-                            (Subtask->WorkingBuffer != NULL) ? Subtask->WorkingBuffer : Subtask->Buffer
-                            );
+        Status = EFI_UNSUPPORTED;
+        if ((Subtask->WorkingBuffer != NULL) && (Subtask->Length < Media->BlockSize)) {
+          //
+          // Serve the single-block bounce read from the read cache, which
+          // also pulls in the following blocks for sequential readers.
+          //
+          Status = DiskIoReadCacheBlock (Instance, MediaId, Subtask->Lba, Subtask->WorkingBuffer);
+        }
+
+        if (Status == EFI_UNSUPPORTED) {
+          Status = BlockIo->ReadBlocks (
+                              BlockIo,
+                              MediaId,
+                              Subtask->Lba,
+                              (Subtask->Length % Media->BlockSize == 0) ? Subtask->Length : Media->BlockSize,
+                              (Subtask->WorkingBuffer != NULL) ? Subtask->WorkingBuffer : Subtask->Buffer
+                              );
+        }
+
         if (!EFI_ERROR (Status) && (Subtask->WorkingBuffer != NULL)) {
           CopyMem (Subtask->Buffer, Subtask->WorkingBuffer + Subtask->Offset, Subtask->Length);
         }
@@ -24,19 +24,44 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 
+//
+// Number of blocks held by one line of the read cache. A miss reads the whole
+// line from the device, so this is also the read-ahead distance for
+// sequential readers.
+//
+#define DISK_IO_READ_CACHE_LINE_BLOCK_NUM  8
+
+typedef struct {
+  BOOLEAN    Valid;
+  UINT64     Lba;          /// < first block held in the line
+  UINT32     BlockNum;     /// < number of valid blocks in the line
+  UINT64     Sequence;     /// < last access stamp for LRU eviction
+} DISK_IO_READ_CACHE_LINE;
+
 #define DISK_IO_PRIVATE_DATA_SIGNATURE  SIGNATURE_32 ('d', 's', 'k', 'I')
 typedef struct {
-  UINT32                    Signature;
+  UINT32                     Signature;
+
+  EFI_DISK_IO_PROTOCOL       DiskIo;
+  EFI_DISK_IO2_PROTOCOL      DiskIo2;
+  EFI_BLOCK_IO_PROTOCOL      *BlockIo;
+  EFI_BLOCK_IO2_PROTOCOL     *BlockIo2;
 
-  EFI_DISK_IO_PROTOCOL      DiskIo;
-  EFI_DISK_IO2_PROTOCOL     DiskIo2;
-  EFI_BLOCK_IO_PROTOCOL     *BlockIo;
-  EFI_BLOCK_IO2_PROTOCOL    *BlockIo2;
+  UINT8                      *SharedWorkingBuffer;
 
-  UINT8                     *SharedWorkingBuffer;
+  EFI_LOCK                   TaskQueueLock;
+  LIST_ENTRY                 TaskQueue;
 
-  EFI_LOCK                  TaskQueueLock;
-  LIST_ENTRY                TaskQueue;
+  //
+  // Per-device read-ahead cache serving unaligned reads, enabled when
+  // PcdDiskIoReadCacheBlockNum is not 0.
+  //
+  UINTN                      ReadCacheLineNum;
+  DISK_IO_READ_CACHE_LINE    *ReadCacheLines;
+  UINT8                      *ReadCacheData;
+  UINT32                     ReadCacheBlockSize;
+  UINT32                     ReadCacheMediaId;
+  UINT64                     ReadCacheSequence;
 } DISK_IO_PRIVATE_DATA;
 #define DISK_IO_PRIVATE_DATA_FROM_DISK_IO(a)   CR (a, DISK_IO_PRIVATE_DATA, DiskIo,  DISK_IO_PRIVATE_DATA_SIGNATURE)
 #define DISK_IO_PRIVATE_DATA_FROM_DISK_IO2(a)  CR (a, DISK_IO_PRIVATE_DATA, DiskIo2, DISK_IO_PRIVATE_DATA_SIGNATURE)
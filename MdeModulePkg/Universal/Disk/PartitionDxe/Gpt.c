@@ -161,6 +161,76 @@ PartitionSetCrc (
   IN OUT EFI_TABLE_HEADER  *Hdr
   );
 
+//
+// Context for one asynchronous probe read. The notify function reports the
+// completion through the per-read Done flag; each flag has a single writer
+// (the TPL_NOTIFY notify function), so no atomic update is needed.
+//
+typedef struct {
+  EFI_DISK_IO2_TOKEN    Token;
+  volatile BOOLEAN      Done;
+} GPT_PROBE_READ;
+
+/**
+  Validate a GPT partition table header which has already been read from disk.
+
+  Caution: This function may receive untrusted input.
+  The GPT partition table header is external input, so this routine
+  will do basic validation for GPT partition table header before return.
+
+  @param[in]  BlockIo       Parent BlockIo interface.
+  @param[in]  DiskIo        Disk Io protocol.
+  @param[in]  Lba           The Lba the header block was read from.
+  @param[in]  ReadStatus    The status of the read that filled PartHdrBlock.
+  @param[in]  PartHdrBlock  The header block read from Lba.
+  @param[out] PartHeader    Stores the partition table that is checked.
+
+  @retval TRUE      The partition table is valid
+  @retval FALSE     The partition table is not valid
+
+**/
+BOOLEAN
+PartitionValidGptTableBuffer (
+  IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
+  IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
+  IN  EFI_LBA                     Lba,
+  IN  EFI_STATUS                  ReadStatus,
+  IN  VOID                        *PartHdrBlock,
+  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader
+  );
+
+/**
+  Read the protective MBR block and the primary and backup GPT header blocks,
+  overlapping the reads through DiskIo2 when the parent stack supports it.
+
+  @param[in]  DiskIo            Disk Io protocol.
+  @param[in]  DiskIo2           Disk Io2 protocol, may be NULL.
+  @param[in]  MediaId           Media ID of the parent device.
+  @param[in]  BlockSize         Block size of the parent device.
+  @param[in]  LastBlock         Last Lba of the parent device.
+  @param[out] ProtectiveMbr     Buffer receiving the block holding the MBR.
+  @param[out] MbrStatus         Read status of the protective MBR block.
+  @param[out] PrimaryHdrBlock   Buffer receiving the primary GPT header block.
+  @param[out] PrimaryHdrStatus  Read status of the primary GPT header block.
+  @param[out] BackupHdrBlock    Buffer receiving the backup GPT header block.
+  @param[out] BackupHdrStatus   Read status of the backup GPT header block.
+
+**/
+VOID
+PartitionReadProbeBuffers (
+  IN  EFI_DISK_IO_PROTOCOL   *DiskIo,
+  IN  EFI_DISK_IO2_PROTOCOL  *DiskIo2,
+  IN  UINT32                 MediaId,
+  IN  UINT32                 BlockSize,
+  IN  EFI_LBA                LastBlock,
+  OUT VOID                   *ProtectiveMbr,
+  OUT EFI_STATUS             *MbrStatus,
+  OUT VOID                   *PrimaryHdrBlock,
+  OUT EFI_STATUS             *PrimaryHdrStatus,
+  OUT VOID                   *BackupHdrBlock,
+  OUT EFI_STATUS             *BackupHdrStatus
+  );
+
 /**
   Install child handles if the Handle supports GPT partition structure.
 
@@ -199,6 +269,11 @@ PartitionInstallGptChildHandles (
   MASTER_BOOT_RECORD           *ProtectiveMbr;
   EFI_PARTITION_TABLE_HEADER   *PrimaryHeader;
   EFI_PARTITION_TABLE_HEADER   *BackupHeader;
+  VOID                         *PrimaryHdrBlock;
+  VOID                         *BackupHdrBlock;
+  EFI_STATUS                   PrimaryHdrStatus;
+  EFI_STATUS                   BackupHdrStatus;
+  BOOLEAN                      BackupValid;
   EFI_PARTITION_ENTRY          *PartEntry;
   EFI_PARTITION_ENTRY          *Entry;
   EFI_PARTITION_ENTRY_STATUS   *PEntryStatus;
@@ -208,11 +283,13 @@ PartitionInstallGptChildHandles (
   UINT32                       MediaId;
   EFI_PARTITION_INFO_PROTOCOL  PartitionInfo;
 
-  ProtectiveMbr = NULL;
-  PrimaryHeader = NULL;
-  BackupHeader  = NULL;
-  PartEntry     = NULL;
-  PEntryStatus  = NULL;
+  ProtectiveMbr   = NULL;
+  PrimaryHeader   = NULL;
+  BackupHeader    = NULL;
+  PrimaryHdrBlock = NULL;
+  BackupHdrBlock  = NULL;
+  PartEntry       = NULL;
+  PEntryStatus    = NULL;
 
   BlockSize = BlockIo->Media->BlockSize;
   LastBlock = BlockIo->Media->LastBlock;
@@ -239,15 +316,35 @@ PartitionInstallGptChildHandles (
   }
 
   //
-  // Read the Protective MBR from LBA #0
+  // Allocate buffers for the primary and backup GPT header blocks
   //
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     0,
-                     BlockSize,
-                     ProtectiveMbr
-                     );
+  PrimaryHdrBlock = AllocateZeroPool (BlockSize);
+  if (PrimaryHdrBlock == NULL) {
+    goto Done;
+  }
+
+  BackupHdrBlock = AllocateZeroPool (BlockSize);
+  if (BackupHdrBlock == NULL) {
+    goto Done;
+  }
+
+  //
+  // Read the Protective MBR from LBA #0 together with both GPT header
+  // candidates; the reads are overlapped when DiskIo2 is available
+  //
+  PartitionReadProbeBuffers (
+    DiskIo,
+    DiskIo2,
+    MediaId,
+    BlockSize,
+    LastBlock,
+    ProtectiveMbr,
+    &Status,
+    PrimaryHdrBlock,
+    &PrimaryHdrStatus,
+    BackupHdrBlock,
+    &BackupHdrStatus
+    );
   if (EFI_ERROR (Status)) {
     GptValidStatus = Status;
     goto Done;
@@ -285,10 +382,10 @@ PartitionInstallGptChildHandles (
   //
   // Check primary and backup partition tables
   //
-  if (!PartitionValidGptTable (BlockIo, DiskIo, PRIMARY_PART_HEADER_LBA, PrimaryHeader)) {
+  if (!PartitionValidGptTableBuffer (BlockIo, DiskIo, PRIMARY_PART_HEADER_LBA, PrimaryHdrStatus, PrimaryHdrBlock, PrimaryHeader)) {
     DEBUG ((DEBUG_INFO, " Not Valid primary partition table\n"));
 
-    if (!PartitionValidGptTable (BlockIo, DiskIo, LastBlock, BackupHeader)) {
+    if (!PartitionValidGptTableBuffer (BlockIo, DiskIo, LastBlock, BackupHdrStatus, BackupHdrBlock, BackupHeader)) {
       DEBUG ((DEBUG_INFO, " Not Valid backup partition table\n"));
       goto Done;
     } else {
@@ -302,15 +399,27 @@ PartitionInstallGptChildHandles (
         DEBUG ((DEBUG_INFO, " Restore backup partition table success\n"));
       }
     }
-  } else if (!PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader)) {
-    DEBUG ((DEBUG_INFO, " Valid primary and !Valid backup partition table\n"));
-    DEBUG ((DEBUG_INFO, " Restore backup partition table by the primary\n"));
-    if (!PartitionRestoreGptTable (BlockIo, DiskIo, PrimaryHeader)) {
-      DEBUG ((DEBUG_INFO, " Restore backup partition table error\n"));
+  } else {
+    //
+    // The backup header block was prefetched from the last Lba; read the
+    // alternate location directly if the primary header points elsewhere
+    //
+    if (PrimaryHeader->AlternateLBA == LastBlock) {
+      BackupValid = PartitionValidGptTableBuffer (BlockIo, DiskIo, LastBlock, BackupHdrStatus, BackupHdrBlock, BackupHeader);
+    } else {
+      BackupValid = PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader);
     }
 
-    if (PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader)) {
-      DEBUG ((DEBUG_INFO, " Restore backup partition table success\n"));
+    if (!BackupValid) {
+      DEBUG ((DEBUG_INFO, " Valid primary and !Valid backup partition table\n"));
+      DEBUG ((DEBUG_INFO, " Restore backup partition table by the primary\n"));
+      if (!PartitionRestoreGptTable (BlockIo, DiskIo, PrimaryHeader)) {
+        DEBUG ((DEBUG_INFO, " Restore backup partition table error\n"));
+      }
+
+      if (PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader)) {
+        DEBUG ((DEBUG_INFO, " Restore backup partition table success\n"));
+      }
     }
   }
 
@@ -436,6 +545,14 @@ Done:
     FreePool (BackupHeader);
   }
 
+  if (PrimaryHdrBlock != NULL) {
+    FreePool (PrimaryHdrBlock);
+  }
+
+  if (BackupHdrBlock != NULL) {
+    FreePool (BackupHdrBlock);
+  }
+
   if (PartEntry != NULL) {
     FreePool (PartEntry);
   }
@@ -471,32 +588,75 @@ PartitionValidGptTable (
   OUT EFI_PARTITION_TABLE_HEADER  *PartHeader
   )
 {
-  EFI_STATUS                  Status;
+  BOOLEAN  Valid;
+  VOID     *PartHdrBlock;
+
+  PartHdrBlock = AllocateZeroPool (BlockIo->Media->BlockSize);
+  if (PartHdrBlock == NULL) {
+    DEBUG ((DEBUG_ERROR, "Allocate pool error\n"));
+    return FALSE;
+  }
+
+  //
+  // EFI_NOT_READY marks the block as not prefetched, so it is read from
+  // disk during validation
+  //
+  Valid = PartitionValidGptTableBuffer (BlockIo, DiskIo, Lba, EFI_NOT_READY, PartHdrBlock, PartHeader);
+  FreePool (PartHdrBlock);
+  return Valid;
+}
+
+/**
+  Validate a GPT partition table header which has already been read from disk.
+
+  Caution: This function may receive untrusted input.
+  The GPT partition table header is external input, so this routine
+  will do basic validation for GPT partition table header before return.
+
+  @param[in]  BlockIo       Parent BlockIo interface.
+  @param[in]  DiskIo        Disk Io protocol.
+  @param[in]  Lba           The Lba the header block was read from.
+  @param[in]  ReadStatus    The status of the read that filled PartHdrBlock.
+  @param[in]  PartHdrBlock  The header block read from Lba.
+  @param[out] PartHeader    Stores the partition table that is checked.
+
+  @retval TRUE      The partition table is valid
+  @retval FALSE     The partition table is not valid
+
+**/
+BOOLEAN
+PartitionValidGptTableBuffer (
+  IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
+  IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
+  IN  EFI_LBA                     Lba,
+  IN  EFI_STATUS                  ReadStatus,
+  IN  VOID                        *PartHdrBlock,
+  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader
+  )
+{
   UINT32                      BlockSize;
   EFI_PARTITION_TABLE_HEADER  *PartHdr;
   UINT32                      MediaId;
 
   BlockSize = BlockIo->Media->BlockSize;
   MediaId   = BlockIo->Media->MediaId;
-  PartHdr   = AllocateZeroPool (BlockSize);
+  PartHdr   = PartHdrBlock;
 
-  if (PartHdr == NULL) {
-    DEBUG ((DEBUG_ERROR, "Allocate pool error\n"));
-    return FALSE;
+  if (ReadStatus == EFI_NOT_READY) {
+    //
+    // The header block was not prefetched by the caller, so read the
+    // EFI Partition Table Header now
+    //
+    ReadStatus = DiskIo->ReadDisk (
+                           DiskIo,
+                           MediaId,
+                           MultU64x32 (Lba, BlockSize),
+                           BlockSize,
+                           PartHdr
+                           );
   }
 
-  //
-  // Read the EFI Partition Table Header
-  //
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     MultU64x32 (Lba, BlockSize),
-                     BlockSize,
-                     PartHdr
-                     );
-  if (EFI_ERROR (Status)) {
-    FreePool (PartHdr);
+  if (EFI_ERROR (ReadStatus)) {
     return FALSE;
   }
 
@@ -507,7 +667,6 @@ PartitionValidGptTable (
       )
   {
     DEBUG ((DEBUG_INFO, "Invalid efi partition table header\n"));
-    FreePool (PartHdr);
     return FALSE;
   }
 
@@ -515,21 +674,154 @@ PartitionValidGptTable (
   // Ensure the NumberOfPartitionEntries * SizeOfPartitionEntry doesn't overflow.
   //
   if (PartHdr->NumberOfPartitionEntries > DivU64x32 (MAX_UINTN, PartHdr->SizeOfPartitionEntry)) {
-    FreePool (PartHdr);
     return FALSE;
   }
 
   CopyMem (PartHeader, PartHdr, sizeof (EFI_PARTITION_TABLE_HEADER));
   if (!PartitionCheckGptEntryArrayCRC (BlockIo, DiskIo, PartHeader)) {
-    FreePool (PartHdr);
     return FALSE;
   }
 
   DEBUG ((DEBUG_INFO, " Valid efi partition table header\n"));
-  FreePool (PartHdr);
   return TRUE;
 }
 
+/**
+  Notify function for an asynchronous probe read, invoked when the read
+  completes.
+
+  @param[in]  Event    The event this notify function is registered to.
+  @param[in]  Context  The GPT_PROBE_READ of the completed read.
+
+**/
+VOID
+EFIAPI
+PartitionGptProbeReadNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  GPT_PROBE_READ  *Read;
+
+  Read       = Context;
+  Read->Done = TRUE;
+}
+
+/**
+  Read the protective MBR block and the primary and backup GPT header blocks,
+  overlapping the reads through DiskIo2 when the parent stack supports it.
+
+  @param[in]  DiskIo            Disk Io protocol.
+  @param[in]  DiskIo2           Disk Io2 protocol, may be NULL.
+  @param[in]  MediaId           Media ID of the parent device.
+  @param[in]  BlockSize         Block size of the parent device.
+  @param[in]  LastBlock         Last Lba of the parent device.
+  @param[out] ProtectiveMbr     Buffer receiving the block holding the MBR.
+  @param[out] MbrStatus         Read status of the protective MBR block.
+  @param[out] PrimaryHdrBlock   Buffer receiving the primary GPT header block.
+  @param[out] PrimaryHdrStatus  Read status of the primary GPT header block.
+  @param[out] BackupHdrBlock    Buffer receiving the backup GPT header block.
+  @param[out] BackupHdrStatus   Read status of the backup GPT header block.
+
+**/
+VOID
+PartitionReadProbeBuffers (
+  IN  EFI_DISK_IO_PROTOCOL   *DiskIo,
+  IN  EFI_DISK_IO2_PROTOCOL  *DiskIo2,
+  IN  UINT32                 MediaId,
+  IN  UINT32                 BlockSize,
+  IN  EFI_LBA                LastBlock,
+  OUT VOID                   *ProtectiveMbr,
+  OUT EFI_STATUS             *MbrStatus,
+  OUT VOID                   *PrimaryHdrBlock,
+  OUT EFI_STATUS             *PrimaryHdrStatus,
+  OUT VOID                   *BackupHdrBlock,
+  OUT EFI_STATUS             *BackupHdrStatus
+  )
+{
+  GPT_PROBE_READ  Reads[3];
+  UINT64          Offsets[3];
+  VOID            *Buffers[3];
+  EFI_STATUS      *ReadStatuses[3];
+  UINTN           Index;
+  EFI_STATUS      Status;
+
+  if (DiskIo2 == NULL) {
+    //
+    // Without DiskIo2 only the protective MBR is read here; the header
+    // blocks stay unread and are read on demand during validation.
+    // EFI_NOT_READY cannot be returned by ReadDisk(), so it safely marks
+    // them as not prefetched.
+    //
+    *MbrStatus        = DiskIo->ReadDisk (DiskIo, MediaId, 0, BlockSize, ProtectiveMbr);
+    *PrimaryHdrStatus = EFI_NOT_READY;
+    *BackupHdrStatus  = EFI_NOT_READY;
+    return;
+  }
+
+  Offsets[0]      = 0;
+  Buffers[0]      = ProtectiveMbr;
+  ReadStatuses[0] = MbrStatus;
+  Offsets[1]      = MultU64x32 (PRIMARY_PART_HEADER_LBA, BlockSize);
+  Buffers[1]      = PrimaryHdrBlock;
+  ReadStatuses[1] = PrimaryHdrStatus;
+  Offsets[2]      = MultU64x32 (LastBlock, BlockSize);
+  Buffers[2]      = BackupHdrBlock;
+  ReadStatuses[2] = BackupHdrStatus;
+
+  //
+  // Issue all reads before waiting for any of them, so the device can work
+  // on them concurrently
+  //
+  ZeroMem (Reads, sizeof (Reads));
+  for (Index = 0; Index < ARRAY_SIZE (Reads); Index++) {
+    Status = gBS->CreateEvent (
+                    EVT_NOTIFY_SIGNAL,
+                    TPL_NOTIFY,
+                    PartitionGptProbeReadNotify,
+                    &Reads[Index],
+                    &Reads[Index].Token.Event
+                    );
+    if (!EFI_ERROR (Status)) {
+      Status = DiskIo2->ReadDiskEx (
+                          DiskIo2,
+                          MediaId,
+                          Offsets[Index],
+                          &Reads[Index].Token,
+                          BlockSize,
+                          Buffers[Index]
+                          );
+      if (EFI_ERROR (Status)) {
+        gBS->CloseEvent (Reads[Index].Token.Event);
+        Reads[Index].Token.Event = NULL;
+      }
+    }
+
+    if (EFI_ERROR (Status)) {
+      //
+      // Fall back to a synchronous read when the request cannot be issued
+      //
+      *ReadStatuses[Index] = DiskIo->ReadDisk (DiskIo, MediaId, Offsets[Index], BlockSize, Buffers[Index]);
+    }
+  }
+
+  //
+  // Wait for every issued read to complete. Each Done flag is written only
+  // by the completion notify at TPL_NOTIFY and read here, so there is no
+  // read-modify-write to race with.
+  //
+  for (Index = 0; Index < ARRAY_SIZE (Reads); Index++) {
+    if (Reads[Index].Token.Event != NULL) {
+      while (!Reads[Index].Done) {
+        CpuPause ();
+      }
+
+      gBS->CloseEvent (Reads[Index].Token.Event);
+      *ReadStatuses[Index] = Reads[Index].Token.TransactionStatus;
+    }
+  }
+}
+
 /**
   Check if the CRC field in the Partition table header is valid
   for Partition entry array.
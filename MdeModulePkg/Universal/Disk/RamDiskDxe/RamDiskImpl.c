@@ -185,7 +185,10 @@ UnregisterAllRamDisks (
         // driver is responsible for freeing the allocated memory for the
         // RAM disk.
         //
-        FreePool ((VOID *)(UINTN)PrivateData->StartingAddr);
+        FreeAlignedPages (
+          (VOID *)(UINTN)PrivateData->StartingAddr,
+          EFI_SIZE_TO_PAGES ((UINTN)PrivateData->Size)
+          );
       }
 
       FreePool (PrivateData->DevicePath);
@@ -297,7 +300,8 @@ HiiCreateRamDisk (
 {
   EFI_STATUS                Status;
   UINTN                     BufferSize;
-  UINT64                    *StartingAddr;
+  UINTN                     Alignment;
+  VOID                      *StartingAddr;
   EFI_INPUT_KEY             Key;
   EFI_DEVICE_PATH_PROTOCOL  *DevicePath;
   RAM_DISK_PRIVATE_DATA     *PrivateData;
@@ -349,23 +353,30 @@ HiiCreateRamDisk (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  //
+  // Back the RAM disk with 2MB-aligned pages when the size permits so that
+  // the region can be mapped with large pages. This reduces TLB pressure
+  // when the OS later copies the disk content out of the region.
+  //
+  if (Size >= SIZE_2MB) {
+    Alignment = SIZE_2MB;
+  } else {
+    Alignment = EFI_PAGE_SIZE;
+  }
+
   if (MemoryType == RAM_DISK_BOOT_SERVICE_DATA_MEMORY) {
-    Status = gBS->AllocatePool (
-                    EfiBootServicesData,
-                    (UINTN)Size,
-                    (VOID **)&StartingAddr
-                    );
+    StartingAddr = AllocateAlignedPages (
+                     EFI_SIZE_TO_PAGES ((UINTN)Size),
+                     Alignment
+                     );
   } else if (MemoryType == RAM_DISK_RESERVED_MEMORY) {
-    Status = gBS->AllocatePool (
-                    EfiReservedMemoryType,
-                    (UINTN)Size,
-                    (VOID **)&StartingAddr
-                    );
-  } else {
-    Status = EFI_INVALID_PARAMETER;
+    StartingAddr = AllocateAlignedReservedPages (
+                     EFI_SIZE_TO_PAGES ((UINTN)Size),
+                     Alignment
+                     );
   }
 
-  if ((StartingAddr == NULL) || EFI_ERROR (Status)) {
+  if (StartingAddr == NULL) {
     do {
       CreatePopUp (
         EFI_LIGHTGRAY | EFI_BACKGROUND_BLUE,
@@ -389,7 +400,7 @@ HiiCreateRamDisk (
     FileHandle->Read (
                   FileHandle,
                   &BufferSize,
-                  (VOID *)(UINTN)StartingAddr
+                  StartingAddr
                   );
     if (BufferSize != FileInformation->FileSize) {
       do {
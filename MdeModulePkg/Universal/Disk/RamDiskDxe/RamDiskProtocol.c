@@ -845,7 +845,10 @@ RamDiskUnregister (
           // driver is responsible for freeing the allocated memory for the
           // RAM disk.
           //
-          FreePool ((VOID *)(UINTN)PrivateData->StartingAddr);
+          FreeAlignedPages (
+            (VOID *)(UINTN)PrivateData->StartingAddr,
+            EFI_SIZE_TO_PAGES ((UINTN)PrivateData->Size)
+            );
         }
 
         FreePool (PrivateData->DevicePath);
@@ -1016,8 +1016,7 @@ GetAedAdsData (
 /**
   Function used to serialise reads of Allocation Descriptors.
 
-  @param[in]      RecordingFlags  Flag to indicate the type of descriptor.
-  @param[in]      Ad              Allocation Descriptor pointer.
+  @param[in]      ExtentLength    Length of the extent to be read.
   @param[in, out] Buffer          Buffer to hold the next Allocation Descriptor.
   @param[in]      Length          Length of Buffer.
 
@@ -1028,16 +1027,11 @@ GetAedAdsData (
 **/
 EFI_STATUS
 GrowUpBufferToNextAd (
-  IN      UDF_FE_RECORDING_FLAGS  RecordingFlags,
-  IN      VOID                    *Ad,
-  IN OUT  VOID                    **Buffer,
-  IN      UINT64                  Length
+  IN      UINT32  ExtentLength,
+  IN OUT  VOID    **Buffer,
+  IN      UINT64  Length
   )
 {
-  UINT32  ExtentLength;
-
-  ExtentLength = GET_EXTENT_LENGTH (RecordingFlags, Ad);
-
   if (*Buffer == NULL) {
     *Buffer = AllocatePool (ExtentLength);
     if (*Buffer == NULL) {
@@ -1089,8 +1083,11 @@ ReadFile (
   VOID                    *DataBak;
   UINT64                  Length;
   VOID                    *Ad;
+  VOID                    *NextAd;
   UINT64                  AdOffset;
+  UINT64                  NextAdOffset;
   UINT64                  Lsn;
+  UINT64                  NextLsn;
   BOOLEAN                 DoFreeAed;
   UINT64                  FilePosition;
   UINT64                  Offset;
@@ -1099,6 +1096,7 @@ ReadFile (
   UINT64                  DataLength;
   BOOLEAN                 FinishedSeeking;
   UINT32                  ExtentLength;
+  UINT32                  NextExtentLength;
   UDF_FE_RECORDING_FLAGS  RecordingFlags;
 
   LogicalBlockSize = Volume->LogicalVolDesc.LogicalBlockSize;
@@ -1268,6 +1266,51 @@ ReadFile (
           goto Done;
         }
 
+        //
+        // Coalesce physically contiguous extents so that a single DiskIo
+        // request covers the whole run. Optical and USB media pay a high
+        // per-transaction cost, and large files are commonly recorded as
+        // many adjacent maximum-length extents.
+        //
+        while ((ExtentLength % LogicalBlockSize) == 0) {
+          NextAdOffset = AdOffset + AD_LENGTH (RecordingFlags);
+          Status       = GetAllocationDescriptor (
+                           RecordingFlags,
+                           Data,
+                           &NextAdOffset,
+                           Length,
+                           &NextAd
+                           );
+          if (EFI_ERROR (Status) ||
+              (GET_EXTENT_FLAGS (RecordingFlags, NextAd) == ExtentIsNextExtent))
+          {
+            break;
+          }
+
+          Status = GetAllocationDescriptorLsn (
+                     RecordingFlags,
+                     Volume,
+                     ParentIcb,
+                     NextAd,
+                     &NextLsn
+                     );
+          if (EFI_ERROR (Status)) {
+            break;
+          }
+
+          NextExtentLength = GET_EXTENT_LENGTH (RecordingFlags, NextAd);
+          if ((NextLsn != Lsn + (ExtentLength / LogicalBlockSize)) ||
+              (NextExtentLength > MAX_UINT32 - ExtentLength))
+          {
+            break;
+          }
+
+          ExtentLength += NextExtentLength;
+          AdOffset      = NextAdOffset;
+        }
+
+        Status = EFI_SUCCESS;
+
         switch (ReadFileInfo->Flags) {
           case ReadFileGetFileSize:
             ReadFileInfo->ReadLength += ExtentLength;
@@ -1277,8 +1320,7 @@ ReadFile (
             // Increase FileData (if necessary) to read next extent.
             //
             Status = GrowUpBufferToNextAd (
-                       RecordingFlags,
-                       Ad,
+                       ExtentLength,
                        &ReadFileInfo->FileData,
                        ReadFileInfo->ReadLength
                        );
@@ -1363,10 +1363,10 @@ EbcExecuteInstructions (
   IN OUT UINTN                 *InstructionCount
   )
 {
-  UINTN       ExecFunc;
-  EFI_STATUS  Status;
-  UINTN       InstructionsLeft;
-  UINTN       SavedInstructionCount;
+  CONST VM_TABLE_ENTRY  *TableEntry;
+  EFI_STATUS            Status;
+  UINTN                 InstructionsLeft;
+  UINTN                 SavedInstructionCount;
 
   Status = EFI_SUCCESS;
 
@@ -1385,12 +1385,12 @@ EbcExecuteInstructions (
   // call it if it's not null.
   //
   while (InstructionsLeft != 0) {
-    ExecFunc = (UINTN)mVmOpcodeTable[(*VmPtr->Ip & OPCODE_M_OPCODE)].ExecuteFunction;
-    if (ExecFunc == (UINTN)NULL) {
+    TableEntry = &mVmOpcodeTable[(*VmPtr->Ip & OPCODE_M_OPCODE)];
+    if (TableEntry->ExecuteFunction == NULL) {
       EbcDebugSignalException (EXCEPT_EBC_INVALID_OPCODE, EXCEPTION_FLAG_FATAL, VmPtr);
       return EFI_UNSUPPORTED;
     } else {
-      mVmOpcodeTable[(*VmPtr->Ip & OPCODE_M_OPCODE)].ExecuteFunction (VmPtr);
+      TableEntry->ExecuteFunction (VmPtr);
       *InstructionCount = *InstructionCount + 1;
     }
 
@@ -1419,7 +1419,7 @@ EbcExecute (
   IN VM_CONTEXT  *VmPtr
   )
 {
-  UINTN                             ExecFunc;
+  CONST VM_TABLE_ENTRY              *TableEntry;
   UINT8                             StackCorrupted;
   EFI_STATUS                        Status;
   EFI_EBC_SIMPLE_DEBUGGER_PROTOCOL  *EbcSimpleDebugger;
@@ -1480,8 +1480,8 @@ EbcExecute (
     // Use the opcode bits to index into the opcode dispatch table. If the
     // function pointer is null then generate an exception.
     //
-    ExecFunc = (UINTN)mVmOpcodeTable[(*VmPtr->Ip & OPCODE_M_OPCODE)].ExecuteFunction;
-    if (ExecFunc == (UINTN)NULL) {
+    TableEntry = &mVmOpcodeTable[(*VmPtr->Ip & OPCODE_M_OPCODE)];
+    if (TableEntry->ExecuteFunction == NULL) {
       EbcDebugSignalException (EXCEPT_EBC_INVALID_OPCODE, EXCEPTION_FLAG_FATAL, VmPtr);
       Status = EFI_UNSUPPORTED;
       goto Done;
@@ -1495,7 +1495,7 @@ EbcExecute (
     //
     MemoryFence ();
 
-    mVmOpcodeTable[(*VmPtr->Ip & OPCODE_M_OPCODE)].ExecuteFunction (VmPtr);
+    TableEntry->ExecuteFunction (VmPtr);
 
     MemoryFence ();
 
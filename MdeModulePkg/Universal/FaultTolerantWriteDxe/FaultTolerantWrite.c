@@ -158,6 +158,8 @@ FtwAllocate (
     return EFI_ABORTED;
   }
 
+  FtwHeader->WritesAllocated = FTW_VALID_STATE;
+
   DEBUG (
     (DEBUG_INFO,
      "Ftw: Allocate() success, Caller:%g, # %d\n",
@@ -331,6 +333,7 @@ FtwWrite (
   UINT8                               *MyBuffer;
   UINTN                               SpareBufferSize;
   UINT8                               *SpareBuffer;
+  BOOLEAN                             SpareErased;
   UINTN                               Index;
   UINT8                               *Ptr;
   EFI_PHYSICAL_ADDRESS                FvbPhysicalAddress;
@@ -526,15 +529,25 @@ FtwWrite (
     Ptr += MyLength;
   }
 
+  //
+  // When the spare block is still in the erased state, the erase below and
+  // the restore at the end of the write can both be skipped.  Each skipped
+  // erase saves a flash erase cycle, and the write then leaves the spare
+  // block erased again so consecutive writes keep taking the short path.
+  //
+  SpareErased = IsErasedFlashBuffer (SpareBuffer, SpareBufferSize);
+
   //
   // Write the memory buffer to spare block
   // Do not assume Spare Block and Target Block have same block size
   //
-  Status = FtwEraseSpareBlock (FtwDevice);
-  if (EFI_ERROR (Status)) {
-    FreePool (MyBuffer);
-    FreePool (SpareBuffer);
-    return EFI_ABORTED;
+  if (!SpareErased) {
+    Status = FtwEraseSpareBlock (FtwDevice);
+    if (EFI_ERROR (Status)) {
+      FreePool (MyBuffer);
+      FreePool (SpareBuffer);
+      return EFI_ABORTED;
+    }
   }
 
   Ptr = MyBuffer;
@@ -597,6 +610,7 @@ FtwWrite (
 
   //
   // Restore spare backup buffer into spare block , if no failure happened during FtwWrite.
+  // An erased spare block is restored by the erase alone.
   //
   Status = FtwEraseSpareBlock (FtwDevice);
   if (EFI_ERROR (Status)) {
@@ -604,22 +618,24 @@ FtwWrite (
     return EFI_ABORTED;
   }
 
-  Ptr = SpareBuffer;
-  for (Index = 0; Index < FtwDevice->NumberOfSpareBlock; Index += 1) {
-    MyLength = FtwDevice->SpareBlockSize;
-    Status   = FtwDevice->FtwBackupFvb->Write (
-                                          FtwDevice->FtwBackupFvb,
-                                          FtwDevice->FtwSpareLba + Index,
-                                          0,
-                                          &MyLength,
-                                          Ptr
-                                          );
-    if (EFI_ERROR (Status)) {
-      FreePool (SpareBuffer);
-      return EFI_ABORTED;
-    }
+  if (!SpareErased) {
+    Ptr = SpareBuffer;
+    for (Index = 0; Index < FtwDevice->NumberOfSpareBlock; Index += 1) {
+      MyLength = FtwDevice->SpareBlockSize;
+      Status   = FtwDevice->FtwBackupFvb->Write (
+                                            FtwDevice->FtwBackupFvb,
+                                            FtwDevice->FtwSpareLba + Index,
+                                            0,
+                                            &MyLength,
+                                            Ptr
+                                            );
+      if (EFI_ERROR (Status)) {
+        FreePool (SpareBuffer);
+        return EFI_ABORTED;
+      }
 
-    Ptr += MyLength;
+      Ptr += MyLength;
+    }
   }
 
   //
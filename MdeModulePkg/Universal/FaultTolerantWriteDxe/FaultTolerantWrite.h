@@ -78,6 +78,7 @@ typedef struct {
   EFI_LBA                                    FtwWorkSpaceLbaInSpare;  // Start LBA of working space in spare block.
   UINTN                                      FtwWorkSpaceBaseInSpare; // Offset into the FtwWorkSpaceLbaInSpare block.
   UINT8                                      *FtwWorkSpace;           // Point to Work Space in memory buffer
+  BOOLEAN                                    FtwWorkSpaceInSync;      // Whether the work space memory buffer matches the flash content.
   //
   // Following a buffer of FtwWorkSpace[FTW_WORK_SPACE_SIZE],
   // Allocated with EFI_FTW_DEVICE.
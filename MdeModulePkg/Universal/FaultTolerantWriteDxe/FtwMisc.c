@@ -585,6 +585,12 @@ FlushSpareBlockToWorkingBlock (
   UINT8                                    *Ptr;
   UINTN                                    Index;
 
+  //
+  // The working block, including the work space, is rewritten from the spare
+  // block content below, so the work space memory buffer goes out of sync.
+  //
+  FtwDevice->FtwWorkSpaceInSync = FALSE;
+
   //
   // Allocate a memory buffer
   //
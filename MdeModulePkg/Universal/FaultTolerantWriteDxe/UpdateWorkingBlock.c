@@ -263,27 +263,37 @@ WorkSpaceRefresh (
   UINTN       RemainingSpaceSize;
 
   //
-  // Initialize WorkSpace as FTW_ERASED_BYTE
+  // Re-read the work space from flash only when the memory buffer may be out
+  // of sync with the working block.  All record and state updates made by
+  // this driver are mirrored into the memory buffer, so it stays valid until
+  // the working block is rewritten from the spare block.
   //
-  SetMem (
-    FtwDevice->FtwWorkSpace,
-    FtwDevice->FtwWorkSpaceSize,
-    FTW_ERASED_BYTE
-    );
+  if (!FtwDevice->FtwWorkSpaceInSync) {
+    //
+    // Initialize WorkSpace as FTW_ERASED_BYTE
+    //
+    SetMem (
+      FtwDevice->FtwWorkSpace,
+      FtwDevice->FtwWorkSpaceSize,
+      FTW_ERASED_BYTE
+      );
 
-  //
-  // Read from working block
-  //
-  Status = ReadWorkSpaceData (
-             FtwDevice->FtwFvBlock,
-             FtwDevice->WorkBlockSize,
-             FtwDevice->FtwWorkSpaceLba,
-             FtwDevice->FtwWorkSpaceBase,
-             FtwDevice->FtwWorkSpaceSize,
-             FtwDevice->FtwWorkSpace
-             );
-  if (EFI_ERROR (Status)) {
-    return EFI_ABORTED;
+    //
+    // Read from working block
+    //
+    Status = ReadWorkSpaceData (
+               FtwDevice->FtwFvBlock,
+               FtwDevice->WorkBlockSize,
+               FtwDevice->FtwWorkSpaceLba,
+               FtwDevice->FtwWorkSpaceBase,
+               FtwDevice->FtwWorkSpaceSize,
+               FtwDevice->FtwWorkSpace
+               );
+    if (EFI_ERROR (Status)) {
+      return EFI_ABORTED;
+    }
+
+    FtwDevice->FtwWorkSpaceInSync = TRUE;
   }
 
   //
@@ -327,6 +337,8 @@ WorkSpaceRefresh (
       return EFI_ABORTED;
     }
 
+    FtwDevice->FtwWorkSpaceInSync = TRUE;
+
     Status = FtwGetLastWriteHeader (
                FtwDevice->FtwWorkSpaceHeader,
                FtwDevice->FtwWorkSpaceSize,
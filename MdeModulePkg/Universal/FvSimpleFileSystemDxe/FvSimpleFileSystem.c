@@ -273,6 +273,91 @@ FvFsReadFile (
   return Status;
 }
 
+/**
+  Get the extracted contents of a file, using the instance's extraction cache.
+
+  On a cache miss the file is read out of the FV (running section extraction,
+  e.g. LZMA decompression) and the resulting buffer is retained in the cache,
+  shared by all opens of the file. Least recently used buffers are freed when
+  the cache grows beyond FVFS_EXTRACTION_CACHE_SIZE; the buffer returned by
+  this call is never the one evicted.
+
+  @param  Instance                    A pointer to the FV_FILESYSTEM_INSTANCE containing the file.
+  @param  FvFileInfo                  A pointer to the FV_FILESYSTEM_FILE_INFO instance that is a struct
+                                      representing a file's info.
+  @param  FileBuffer                  Pointer to return the cached file contents. The buffer is owned
+                                      by the cache and must not be freed by the caller.
+  @param  FileSize                    Pointer to return the size of the cached file contents.
+
+  @retval EFI_SUCCESS                 The call completed successfully.
+  @retval EFI_OUT_OF_RESOURCES        There was not enough memory to read the file.
+  @retval Others                      The file could not be read out of the FV.
+
+**/
+EFI_STATUS
+FvFsGetFileCachedData (
+  IN     FV_FILESYSTEM_INSTANCE   *Instance,
+  IN     FV_FILESYSTEM_FILE_INFO  *FvFileInfo,
+  OUT VOID                        **FileBuffer,
+  OUT UINTN                       *FileSize
+  )
+{
+  EFI_STATUS               Status;
+  VOID                     *Buffer;
+  UINTN                    BufferSize;
+  LIST_ENTRY               *CacheLink;
+  FV_FILESYSTEM_FILE_INFO  *EvictFileInfo;
+
+  if (FvFileInfo->CachedData == NULL) {
+    BufferSize = (UINTN)FvFileInfo->FileInfo.FileSize;
+    Buffer     = AllocateZeroPool (BufferSize);
+    if (Buffer == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Status = FvFsReadFile (Instance->FvProtocol, FvFileInfo, &BufferSize, &Buffer);
+    if (EFI_ERROR (Status)) {
+      FreePool (Buffer);
+      return Status;
+    }
+
+    FvFileInfo->CachedData         = Buffer;
+    FvFileInfo->CachedDataSize     = BufferSize;
+    Instance->ExtractionCacheSize += BufferSize;
+    InsertHeadList (&Instance->ExtractionCacheHead, &FvFileInfo->CacheLink);
+
+    //
+    // Free least recently used buffers until the cache fits its bound again.
+    // The entry just inserted sits at the head of the list and is never
+    // freed here, so the pointer returned to the caller stays valid.
+    //
+    while (Instance->ExtractionCacheSize > FVFS_EXTRACTION_CACHE_SIZE) {
+      CacheLink = GetPreviousNode (&Instance->ExtractionCacheHead, &Instance->ExtractionCacheHead);
+      if (CacheLink == &FvFileInfo->CacheLink) {
+        break;
+      }
+
+      EvictFileInfo = FVFS_FILE_INFO_FROM_CACHE_LINK (CacheLink);
+      RemoveEntryList (&EvictFileInfo->CacheLink);
+      Instance->ExtractionCacheSize -= EvictFileInfo->CachedDataSize;
+      FreePool (EvictFileInfo->CachedData);
+      EvictFileInfo->CachedData     = NULL;
+      EvictFileInfo->CachedDataSize = 0;
+    }
+  } else {
+    //
+    // Cache hit: move the entry to the head of the LRU list.
+    //
+    RemoveEntryList (&FvFileInfo->CacheLink);
+    InsertHeadList (&Instance->ExtractionCacheHead, &FvFileInfo->CacheLink);
+  }
+
+  *FileBuffer = FvFileInfo->CachedData;
+  *FileSize   = FvFileInfo->CachedDataSize;
+
+  return EFI_SUCCESS;
+}
+
 /**
   Helper function for populating an EFI_FILE_INFO for a file.
 
@@ -697,16 +782,12 @@ FvSimpleFileSystemRead (
       return EFI_SUCCESS;
     }
   } else {
-    FileSize = (UINTN)File->FvFileInfo->FileInfo.FileSize;
-
-    FileBuffer = AllocateZeroPool (FileSize);
-    if (FileBuffer == NULL) {
-      return EFI_DEVICE_ERROR;
-    }
-
-    Status = FvFsReadFile (File->Instance->FvProtocol, File->FvFileInfo, &FileSize, &FileBuffer);
+    //
+    // File read: slice the requested range out of the cached extraction of
+    // the file, so repeated opens do not re-run section extraction.
+    //
+    Status = FvFsGetFileCachedData (Instance, File->FvFileInfo, &FileBuffer, &FileSize);
     if (EFI_ERROR (Status)) {
-      FreePool (FileBuffer);
       return EFI_DEVICE_ERROR;
     }
 
@@ -717,8 +798,6 @@ FvSimpleFileSystemRead (
     CopyMem (Buffer, (UINT8 *)FileBuffer + File->Position, *BufferSize);
     File->Position += *BufferSize;
 
-    FreePool (FileBuffer);
-
     return EFI_SUCCESS;
   }
 }
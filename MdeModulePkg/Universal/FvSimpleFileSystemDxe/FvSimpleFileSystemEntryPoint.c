@@ -457,6 +457,7 @@ FvSimpleFileSystemDriverStart (
   Instance->Signature  = FVFS_INSTANCE_SIGNATURE;
   InitializeListHead (&Instance->FileInfoHead);
   InitializeListHead (&Instance->FileHead);
+  InitializeListHead (&Instance->ExtractionCacheHead);
   CopyMem (&Instance->SimpleFs, &mSimpleFsTemplate, sizeof (mSimpleFsTemplate));
 
   Status = gBS->InstallProtocolInterface (
@@ -617,6 +618,11 @@ FvSimpleFileSystemDriverStop (
       FvFileInfo = FVFS_FILE_INFO_FROM_LINK (DelEntry);
 
       RemoveEntryList (DelEntry);
+
+      if (FvFileInfo->CachedData != NULL) {
+        FreePool (FvFileInfo->CachedData);
+      }
+
       FreePool (FvFileInfo);
     }
   }
@@ -44,6 +44,8 @@ struct _FV_FILESYSTEM_INSTANCE {
   UINT32                             Signature;
   LIST_ENTRY                         FileInfoHead;
   LIST_ENTRY                         FileHead;
+  LIST_ENTRY                         ExtractionCacheHead;
+  UINTN                              ExtractionCacheSize;
   EFI_DRIVER_BINDING_PROTOCOL        *DriverBinding;
   EFI_FIRMWARE_VOLUME2_PROTOCOL      *FvProtocol;
   EFI_SIMPLE_FILE_SYSTEM_PROTOCOL    SimpleFs;
@@ -67,11 +69,18 @@ struct _FV_FILESYSTEM_FILE {
 };
 
 //
-// Struct representing the info of a file.
+// Struct representing the info of a file. CachedData holds the extracted
+// file contents after the first read, so that subsequent opens and reads
+// do not re-run section extraction (e.g. LZMA decompression). The cached
+// buffers of an instance are linked through CacheLink in LRU order and
+// bounded by FVFS_EXTRACTION_CACHE_SIZE.
 //
 struct _FV_FILESYSTEM_FILE_INFO {
   UINT32             Signature;
   LIST_ENTRY         Link;
+  LIST_ENTRY         CacheLink;
+  VOID               *CachedData;
+  UINTN              CachedDataSize;
   EFI_GUID           NameGuid;
   EFI_FV_FILETYPE    Type;
   EFI_FILE_INFO      FileInfo;
@@ -81,6 +90,13 @@ struct _FV_FILESYSTEM_FILE_INFO {
 #define FVFS_FILE_INFO_SIGNATURE  SIGNATURE_32 ('f', 'v', 'i', 'n')
 #define FVFS_INSTANCE_SIGNATURE   SIGNATURE_32 ('f', 'v', 'f', 's')
 
+//
+// Upper bound, per FV, on the total size of extracted file buffers kept in
+// the extraction cache. Least recently used buffers are freed when the
+// bound is exceeded.
+//
+#define FVFS_EXTRACTION_CACHE_SIZE  SIZE_8MB
+
 #define FVFS_INSTANCE_FROM_SIMPLE_FS_THIS(This)  CR ( \
           This,                                       \
           FV_FILESYSTEM_INSTANCE,                     \
@@ -102,6 +118,13 @@ struct _FV_FILESYSTEM_FILE_INFO {
           FVFS_FILE_INFO_SIGNATURE                    \
           )
 
+#define FVFS_FILE_INFO_FROM_CACHE_LINK(This)  CR (    \
+          This,                                       \
+          FV_FILESYSTEM_FILE_INFO,                    \
+          CacheLink,                                  \
+          FVFS_FILE_INFO_SIGNATURE                    \
+          )
+
 #define FVFS_FILE_FROM_LINK(FileLink)  CR (FileLink, FV_FILESYSTEM_FILE, Link, FVFS_FILE_SIGNATURE)
 
 #define FVFS_GET_FIRST_FILE(Instance)  FVFS_FILE_FROM_LINK (GetFirstNode (&Instance->FileHead))
@@ -400,6 +400,9 @@ OutputConfigBody (
                                  MAX_STRING_LENGTH. On output, the  buffer length
                                  might be updated.
   @param  AppendString           NULL-terminated Unicode string.
+  @param  MultiStringLen         On input, the current length of MultiString in
+                                 characters, not counting the NULL terminator.
+                                 On output, updated to cover AppendString.
 
   @retval EFI_INVALID_PARAMETER  Any incoming parameter is invalid.
   @retval EFI_SUCCESS            AppendString is append to the end of MultiString
@@ -408,19 +411,20 @@ OutputConfigBody (
 EFI_STATUS
 AppendToMultiString (
   IN OUT EFI_STRING  *MultiString,
-  IN EFI_STRING      AppendString
+  IN EFI_STRING      AppendString,
+  IN OUT UINTN       *MultiStringLen
   )
 {
   UINTN  AppendStringSize;
   UINTN  MultiStringSize;
   UINTN  MaxLen;
 
-  if ((MultiString == NULL) || (*MultiString == NULL) || (AppendString == NULL)) {
+  if ((MultiString == NULL) || (*MultiString == NULL) || (AppendString == NULL) || (MultiStringLen == NULL)) {
     return EFI_INVALID_PARAMETER;
   }
 
   AppendStringSize = StrSize (AppendString);
-  MultiStringSize  = StrSize (*MultiString);
+  MultiStringSize  = (*MultiStringLen + 1) * sizeof (CHAR16);
   MaxLen           = MAX_STRING_LENGTH / sizeof (CHAR16);
 
   //
@@ -439,9 +443,11 @@ AppendToMultiString (
   }
 
   //
-  // Append the incoming string
+  // Append the incoming string at the tracked tail so a long multi-string
+  // is not rescanned from its head on every append.
   //
-  StrCatS (*MultiString, MaxLen, AppendString);
+  StrCpyS (*MultiString + *MultiStringLen, MaxLen - *MultiStringLen, AppendString);
+  *MultiStringLen += AppendStringSize / sizeof (CHAR16) - 1;
 
   return EFI_SUCCESS;
 }
@@ -474,9 +480,7 @@ GetValueOfNumber (
 {
   EFI_STRING  TmpPtr;
   UINTN       Length;
-  EFI_STRING  Str;
   UINT8       *Buf;
-  EFI_STATUS  Status;
   UINT8       DigitUint8;
   UINTN       Index;
   CHAR16      TemStr[2];
@@ -485,8 +489,6 @@ GetValueOfNumber (
     return EFI_INVALID_PARAMETER;
   }
 
-  Buf = NULL;
-
   TmpPtr = StringPtr;
   while (*StringPtr != L'\0' && *StringPtr != L'&') {
     StringPtr++;
@@ -495,26 +497,20 @@ GetValueOfNumber (
   *Len   = StringPtr - TmpPtr;
   Length = *Len + 1;
 
-  Str = (EFI_STRING)AllocateZeroPool (Length * sizeof (CHAR16));
-  if (Str == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto Exit;
-  }
-
-  CopyMem (Str, TmpPtr, *Len * sizeof (CHAR16));
-  *(Str + *Len) = L'\0';
-
   Length = (Length + 1) / 2;
   Buf    = (UINT8 *)AllocateZeroPool (Length);
   if (Buf == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto Exit;
+    return EFI_OUT_OF_RESOURCES;
   }
 
+  //
+  // Convert the hex digits in place from the tail of the <Number>, so no
+  // intermediate copy of the string is needed.
+  //
   Length = *Len;
   ZeroMem (TemStr, sizeof (TemStr));
   for (Index = 0; Index < Length; Index++) {
-    TemStr[0]  = Str[Length - Index - 1];
+    TemStr[0]  = TmpPtr[Length - Index - 1];
     DigitUint8 = (UINT8)StrHexToUint64 (TemStr);
     if ((Index & 1) == 0) {
       Buf[Index/2] = DigitUint8;
@@ -524,14 +520,8 @@ GetValueOfNumber (
   }
 
   *Number = Buf;
-  Status  = EFI_SUCCESS;
-
-Exit:
-  if (Str != NULL) {
-    FreePool (Str);
-  }
 
-  return Status;
+  return EFI_SUCCESS;
 }
 
 /**
@@ -4862,6 +4852,7 @@ HiiConfigRoutingExtractConfig (
   UINTN                           ConigStringSize;
   UINTN                           ConigStringSizeNewsize;
   EFI_STRING                      ConfigStringPtr;
+  UINTN                           ResultsLen;
 
   if ((This == NULL) || (Progress == NULL) || (Results == NULL)) {
     return EFI_INVALID_PARAMETER;
@@ -4906,6 +4897,8 @@ HiiConfigRoutingExtractConfig (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  ResultsLen = 0;
+
   while (*StringPtr != 0 && StrnCmp (StringPtr, L"GUID=", StrLen (L"GUID=")) == 0) {
     //
     // If parsing error, set Progress to the beginning of the <MultiConfigRequest>
@@ -5148,11 +5141,11 @@ HiiConfigRoutingExtractConfig (
 
 NextConfigString:
     if (!FirstElement) {
-      Status = AppendToMultiString (Results, L"&");
+      Status = AppendToMultiString (Results, L"&", &ResultsLen);
       ASSERT_EFI_ERROR (Status);
     }
 
-    Status = AppendToMultiString (Results, AccessResults);
+    Status = AppendToMultiString (Results, AccessResults, &ResultsLen);
     ASSERT_EFI_ERROR (Status);
 
     FirstElement = FALSE;
@@ -5247,6 +5240,7 @@ HiiConfigRoutingExportConfig (
   UINT8                           *DevicePathPkg;
   UINT8                           *CurrentDevicePath;
   BOOLEAN                         IfrDataParsedFlag;
+  UINTN                           ResultsLen;
 
   if ((This == NULL) || (Results == NULL)) {
     return EFI_INVALID_PARAMETER;
@@ -5263,6 +5257,8 @@ HiiConfigRoutingExportConfig (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  ResultsLen = 0;
+
   NumberConfigAccessHandles = 0;
   Status                    = gBS->LocateHandleBuffer (
                                      ByProtocol,
@@ -5384,11 +5380,11 @@ HiiConfigRoutingExportConfig (
       // which separates the first <ConfigAltResp> and the following ones.
       //
       if (!FirstElement) {
-        Status = AppendToMultiString (Results, L"&");
+        Status = AppendToMultiString (Results, L"&", &ResultsLen);
         ASSERT_EFI_ERROR (Status);
       }
 
-      Status = AppendToMultiString (Results, AccessResults);
+      Status = AppendToMultiString (Results, AccessResults, &ResultsLen);
       ASSERT_EFI_ERROR (Status);
 
       FirstElement = FALSE;
@@ -5684,6 +5680,7 @@ HiiBlockToConfig (
   UINTN                      Index;
   UINT8                      *TemBuffer;
   CHAR16                     *TemString;
+  UINTN                      ConfigLen;
 
   TmpBuffer = NULL;
 
@@ -5713,6 +5710,8 @@ HiiBlockToConfig (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  ConfigLen = 0;
+
   //
   // Jump <ConfigHdr>
   //
@@ -5739,7 +5738,7 @@ HiiBlockToConfig (
   if (*StringPtr == 0) {
     *Progress = StringPtr;
 
-    AppendToMultiString (Config, ConfigRequest);
+    AppendToMultiString (Config, ConfigRequest, &ConfigLen);
     HiiToLower (*Config);
 
     return EFI_SUCCESS;
@@ -5759,7 +5758,7 @@ HiiBlockToConfig (
   }
 
   TemString[StringPtr - ConfigRequest] = '\0';
-  AppendToMultiString (Config, TemString);
+  AppendToMultiString (Config, TemString, &ConfigLen);
   FreePool (TemString);
 
   //
@@ -5885,7 +5884,7 @@ HiiBlockToConfig (
     StrCatS (ConfigElement, Length, L"VALUE=");
     StrCatS (ConfigElement, Length, ValueStr);
 
-    AppendToMultiString (Config, ConfigElement);
+    AppendToMultiString (Config, ConfigElement, &ConfigLen);
 
     FreePool (ConfigElement);
     FreePool (ValueStr);
@@ -5899,7 +5898,7 @@ HiiBlockToConfig (
       break;
     }
 
-    AppendToMultiString (Config, L"&");
+    AppendToMultiString (Config, L"&", &ConfigLen);
     StringPtr++;
   }
 
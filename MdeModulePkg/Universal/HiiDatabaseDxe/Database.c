@@ -1541,6 +1541,7 @@ AdjustStringPackage (
       StringPackage->StringPkgHdr->Header.Length += Skip2BlockSize;
       PackageList->PackageListHdr.PackageLength  += Skip2BlockSize;
       StringPackage->MaxStringId                  = MaxStringId;
+      InvalidateStringIdIndex (StringPackage);
     }
   }
 
@@ -1676,6 +1677,7 @@ RemoveStringPackages (
 
     RemoveEntryList (&Package->StringEntry);
     PackageList->PackageListHdr.PackageLength -= Package->StringPkgHdr->Header.Length;
+    InvalidateStringIdIndex (Package);
     FreePool (Package->StringBlock);
     FreePool (Package->StringPkgHdr);
     //
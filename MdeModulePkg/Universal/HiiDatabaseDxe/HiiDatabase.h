@@ -149,6 +149,20 @@ typedef struct {
 //
 // String Package definitions
 //
+
+//
+// Locates the string block which defines one string id, so that a lookup
+// does not have to decode the SIBT block stream from the start. One entry
+// exists per string id; the array is built on first lookup and discarded
+// whenever the block stream is re-created.
+//
+typedef struct {
+  UINT8            *StringBlockAddr;
+  UINTN            StringTextOffset;
+  EFI_STRING_ID    StartStringId;
+  UINT8            BlockType;
+} HII_STRING_ID_INDEX_ENTRY;
+
 #define HII_STRING_PACKAGE_SIGNATURE  SIGNATURE_32 ('h','i','s','p')
 typedef struct _HII_STRING_PACKAGE_INSTANCE {
   UINTN                         Signature;
@@ -158,6 +172,7 @@ typedef struct _HII_STRING_PACKAGE_INSTANCE {
   LIST_ENTRY                    FontInfoList;          // local font info list
   UINT8                         FontId;
   EFI_STRING_ID                 MaxStringId;           // record StringId
+  HII_STRING_ID_INDEX_ENTRY     *StringIdIndex;        // string id -> block, built on demand
 } HII_STRING_PACKAGE_INSTANCE;
 
 //
@@ -535,6 +550,20 @@ FindStringBlock (
   OUT EFI_STRING_ID                *StartStringId OPTIONAL
   );
 
+/**
+  Discard the string id index of a string package.
+
+  The index must be invalidated whenever the string block stream of the
+  package is re-created; it is rebuilt on the next indexed lookup.
+
+  @param  StringPackage           Hii string package instance.
+
+**/
+VOID
+InvalidateStringIdIndex (
+  IN  HII_STRING_PACKAGE_INSTANCE  *StringPackage
+  );
+
 /**
   Parse all glyph blocks to find a glyph block specified by CharValue.
   If CharValue = (CHAR16) (-1), collect all default character cell information
@@ -225,6 +225,302 @@ GetStringFontInfo (
   return EFI_NOT_FOUND;
 }
 
+/**
+  Discard the string id index of a string package.
+
+  The index must be invalidated whenever the string block stream of the
+  package is re-created; it is rebuilt on the next indexed lookup.
+
+  @param  StringPackage           Hii string package instance.
+
+**/
+VOID
+InvalidateStringIdIndex (
+  IN  HII_STRING_PACKAGE_INSTANCE  *StringPackage
+  )
+{
+  ASSERT (StringPackage != NULL);
+
+  if (StringPackage->StringIdIndex != NULL) {
+    FreePool (StringPackage->StringIdIndex);
+    StringPackage->StringIdIndex = NULL;
+  }
+}
+
+/**
+  Build the string id index of a string package.
+
+  Decode the SIBT block stream once and record, for every string id up to
+  MaxStringId, the address of the block which defines it, the block type,
+  the offset of the string text within the block and the first string id
+  covered by the block. Later lookups then locate a string block directly
+  instead of decoding the stream from the start.
+
+  The index is an optimization only; if it cannot be built (out of
+  resources, or an unrecognized block type is met), StringIdIndex is left
+  NULL and lookups fall back to the linear walk.
+
+  This is a internal function.
+
+  @param  StringPackage           Hii string package instance.
+
+**/
+VOID
+BuildStringIdIndex (
+  IN  HII_STRING_PACKAGE_INSTANCE  *StringPackage
+  )
+{
+  HII_STRING_ID_INDEX_ENTRY  *StringIdIndex;
+  HII_STRING_ID_INDEX_ENTRY  *IndexEntry;
+  UINT8                      *BlockHdr;
+  EFI_STRING_ID              CurrentStringId;
+  EFI_STRING_ID              DuplicateId;
+  UINTN                      BlockSize;
+  UINTN                      Index;
+  UINT8                      *StringTextPtr;
+  UINTN                      Offset;
+  UINT16                     StringCount;
+  UINT16                     SkipCount;
+  UINT8                      Length8;
+  EFI_HII_SIBT_EXT2_BLOCK    Ext2;
+  UINT32                     Length32;
+  UINTN                      StringSize;
+
+  ASSERT (StringPackage != NULL);
+  ASSERT (StringPackage->StringIdIndex == NULL);
+
+  if (StringPackage->MaxStringId == 0) {
+    return;
+  }
+
+  StringIdIndex = AllocateZeroPool (StringPackage->MaxStringId * sizeof (HII_STRING_ID_INDEX_ENTRY));
+  if (StringIdIndex == NULL) {
+    return;
+  }
+
+  CurrentStringId = 1;
+  StringSize      = 0;
+  BlockHdr        = StringPackage->StringBlock;
+  BlockSize       = 0;
+
+  while ((*BlockHdr != EFI_HII_SIBT_END) && (CurrentStringId <= StringPackage->MaxStringId)) {
+    switch (*BlockHdr) {
+      case EFI_HII_SIBT_STRING_SCSU:
+        Offset     = sizeof (EFI_HII_STRING_BLOCK);
+        IndexEntry = &StringIdIndex[CurrentStringId - 1];
+        IndexEntry->StringBlockAddr  = BlockHdr;
+        IndexEntry->StringTextOffset = Offset;
+        IndexEntry->StartStringId    = CurrentStringId;
+        IndexEntry->BlockType        = *BlockHdr;
+        BlockSize += Offset + AsciiStrSize ((CHAR8 *)(BlockHdr + Offset));
+        CurrentStringId++;
+        break;
+
+      case EFI_HII_SIBT_STRING_SCSU_FONT:
+        Offset     = sizeof (EFI_HII_SIBT_STRING_SCSU_FONT_BLOCK) - sizeof (UINT8);
+        IndexEntry = &StringIdIndex[CurrentStringId - 1];
+        IndexEntry->StringBlockAddr  = BlockHdr;
+        IndexEntry->StringTextOffset = Offset;
+        IndexEntry->StartStringId    = CurrentStringId;
+        IndexEntry->BlockType        = *BlockHdr;
+        BlockSize += Offset + AsciiStrSize ((CHAR8 *)(BlockHdr + Offset));
+        CurrentStringId++;
+        break;
+
+      case EFI_HII_SIBT_STRINGS_SCSU:
+        CopyMem (&StringCount, BlockHdr + sizeof (EFI_HII_STRING_BLOCK), sizeof (UINT16));
+        StringTextPtr = (UINT8 *)((UINTN)BlockHdr + sizeof (EFI_HII_SIBT_STRINGS_SCSU_BLOCK) - sizeof (UINT8));
+        BlockSize    += StringTextPtr - BlockHdr;
+
+        for (Index = 0; (Index < StringCount) && (CurrentStringId <= StringPackage->MaxStringId); Index++) {
+          IndexEntry = &StringIdIndex[CurrentStringId - 1];
+          IndexEntry->StringBlockAddr  = BlockHdr;
+          IndexEntry->StringTextOffset = StringTextPtr - BlockHdr;
+          IndexEntry->StartStringId    = CurrentStringId;
+          IndexEntry->BlockType        = *BlockHdr;
+          BlockSize    += AsciiStrSize ((CHAR8 *)StringTextPtr);
+          StringTextPtr = StringTextPtr + AsciiStrSize ((CHAR8 *)StringTextPtr);
+          CurrentStringId++;
+        }
+
+        break;
+
+      case EFI_HII_SIBT_STRINGS_SCSU_FONT:
+        CopyMem (
+          &StringCount,
+          (UINT8 *)((UINTN)BlockHdr + sizeof (EFI_HII_STRING_BLOCK) + sizeof (UINT8)),
+          sizeof (UINT16)
+          );
+        StringTextPtr = (UINT8 *)((UINTN)BlockHdr + sizeof (EFI_HII_SIBT_STRINGS_SCSU_FONT_BLOCK) - sizeof (UINT8));
+        BlockSize    += StringTextPtr - BlockHdr;
+
+        for (Index = 0; (Index < StringCount) && (CurrentStringId <= StringPackage->MaxStringId); Index++) {
+          IndexEntry = &StringIdIndex[CurrentStringId - 1];
+          IndexEntry->StringBlockAddr  = BlockHdr;
+          IndexEntry->StringTextOffset = StringTextPtr - BlockHdr;
+          IndexEntry->StartStringId    = CurrentStringId;
+          IndexEntry->BlockType        = *BlockHdr;
+          BlockSize    += AsciiStrSize ((CHAR8 *)StringTextPtr);
+          StringTextPtr = StringTextPtr + AsciiStrSize ((CHAR8 *)StringTextPtr);
+          CurrentStringId++;
+        }
+
+        break;
+
+      case EFI_HII_SIBT_STRING_UCS2:
+        Offset     = sizeof (EFI_HII_STRING_BLOCK);
+        IndexEntry = &StringIdIndex[CurrentStringId - 1];
+        IndexEntry->StringBlockAddr  = BlockHdr;
+        IndexEntry->StringTextOffset = Offset;
+        IndexEntry->StartStringId    = CurrentStringId;
+        IndexEntry->BlockType        = *BlockHdr;
+        GetUnicodeStringTextOrSize (NULL, BlockHdr + Offset, &StringSize);
+        BlockSize += Offset + StringSize;
+        CurrentStringId++;
+        break;
+
+      case EFI_HII_SIBT_STRING_UCS2_FONT:
+        Offset     = sizeof (EFI_HII_SIBT_STRING_UCS2_FONT_BLOCK) - sizeof (CHAR16);
+        IndexEntry = &StringIdIndex[CurrentStringId - 1];
+        IndexEntry->StringBlockAddr  = BlockHdr;
+        IndexEntry->StringTextOffset = Offset;
+        IndexEntry->StartStringId    = CurrentStringId;
+        IndexEntry->BlockType        = *BlockHdr;
+        GetUnicodeStringTextOrSize (NULL, BlockHdr + Offset, &StringSize);
+        BlockSize += Offset + StringSize;
+        CurrentStringId++;
+        break;
+
+      case EFI_HII_SIBT_STRINGS_UCS2:
+        Offset        = sizeof (EFI_HII_SIBT_STRINGS_UCS2_BLOCK) - sizeof (CHAR16);
+        StringTextPtr = BlockHdr + Offset;
+        BlockSize    += Offset;
+        CopyMem (&StringCount, BlockHdr + sizeof (EFI_HII_STRING_BLOCK), sizeof (UINT16));
+        for (Index = 0; (Index < StringCount) && (CurrentStringId <= StringPackage->MaxStringId); Index++) {
+          IndexEntry = &StringIdIndex[CurrentStringId - 1];
+          IndexEntry->StringBlockAddr  = BlockHdr;
+          IndexEntry->StringTextOffset = StringTextPtr - BlockHdr;
+          IndexEntry->StartStringId    = CurrentStringId;
+          IndexEntry->BlockType        = *BlockHdr;
+          GetUnicodeStringTextOrSize (NULL, StringTextPtr, &StringSize);
+          BlockSize    += StringSize;
+          StringTextPtr = StringTextPtr + StringSize;
+          CurrentStringId++;
+        }
+
+        break;
+
+      case EFI_HII_SIBT_STRINGS_UCS2_FONT:
+        Offset        = sizeof (EFI_HII_SIBT_STRINGS_UCS2_FONT_BLOCK) - sizeof (CHAR16);
+        StringTextPtr = BlockHdr + Offset;
+        BlockSize    += Offset;
+        CopyMem (
+          &StringCount,
+          (UINT8 *)((UINTN)BlockHdr + sizeof (EFI_HII_STRING_BLOCK) + sizeof (UINT8)),
+          sizeof (UINT16)
+          );
+        for (Index = 0; (Index < StringCount) && (CurrentStringId <= StringPackage->MaxStringId); Index++) {
+          IndexEntry = &StringIdIndex[CurrentStringId - 1];
+          IndexEntry->StringBlockAddr  = BlockHdr;
+          IndexEntry->StringTextOffset = StringTextPtr - BlockHdr;
+          IndexEntry->StartStringId    = CurrentStringId;
+          IndexEntry->BlockType        = *BlockHdr;
+          GetUnicodeStringTextOrSize (NULL, StringTextPtr, &StringSize);
+          BlockSize    += StringSize;
+          StringTextPtr = StringTextPtr + StringSize;
+          CurrentStringId++;
+        }
+
+        break;
+
+      case EFI_HII_SIBT_DUPLICATE:
+        //
+        // The duplicate block refers to a previously defined string id, so
+        // its index entry is a copy of the referenced entry.
+        //
+        CopyMem (
+          &DuplicateId,
+          BlockHdr + sizeof (EFI_HII_STRING_BLOCK),
+          sizeof (EFI_STRING_ID)
+          );
+        if ((DuplicateId > 0) && (DuplicateId < CurrentStringId)) {
+          CopyMem (
+            &StringIdIndex[CurrentStringId - 1],
+            &StringIdIndex[DuplicateId - 1],
+            sizeof (HII_STRING_ID_INDEX_ENTRY)
+            );
+        }
+
+        BlockSize += sizeof (EFI_HII_SIBT_DUPLICATE_BLOCK);
+        CurrentStringId++;
+        break;
+
+      case EFI_HII_SIBT_SKIP1:
+        SkipCount = (UINT16)(*(UINT8 *)((UINTN)BlockHdr + sizeof (EFI_HII_STRING_BLOCK)));
+        for (Index = 0; (Index < SkipCount) && (CurrentStringId + Index <= StringPackage->MaxStringId); Index++) {
+          IndexEntry = &StringIdIndex[CurrentStringId + Index - 1];
+          IndexEntry->StringBlockAddr  = BlockHdr;
+          IndexEntry->StringTextOffset = 0;
+          IndexEntry->StartStringId    = CurrentStringId;
+          IndexEntry->BlockType        = *BlockHdr;
+        }
+
+        CurrentStringId = (UINT16)(CurrentStringId + SkipCount);
+        BlockSize      += sizeof (EFI_HII_SIBT_SKIP1_BLOCK);
+        break;
+
+      case EFI_HII_SIBT_SKIP2:
+        CopyMem (&SkipCount, BlockHdr + sizeof (EFI_HII_STRING_BLOCK), sizeof (UINT16));
+        for (Index = 0; (Index < SkipCount) && (CurrentStringId + Index <= StringPackage->MaxStringId); Index++) {
+          IndexEntry = &StringIdIndex[CurrentStringId + Index - 1];
+          IndexEntry->StringBlockAddr  = BlockHdr;
+          IndexEntry->StringTextOffset = 0;
+          IndexEntry->StartStringId    = CurrentStringId;
+          IndexEntry->BlockType        = *BlockHdr;
+        }
+
+        CurrentStringId = (UINT16)(CurrentStringId + SkipCount);
+        BlockSize      += sizeof (EFI_HII_SIBT_SKIP2_BLOCK);
+        break;
+
+      case EFI_HII_SIBT_EXT1:
+        CopyMem (
+          &Length8,
+          (UINT8 *)((UINTN)BlockHdr + sizeof (EFI_HII_STRING_BLOCK) + sizeof (UINT8)),
+          sizeof (UINT8)
+          );
+        BlockSize += Length8;
+        break;
+
+      case EFI_HII_SIBT_EXT2:
+        CopyMem (&Ext2, BlockHdr, sizeof (EFI_HII_SIBT_EXT2_BLOCK));
+        BlockSize += Ext2.Length;
+        break;
+
+      case EFI_HII_SIBT_EXT4:
+        CopyMem (
+          &Length32,
+          (UINT8 *)((UINTN)BlockHdr + sizeof (EFI_HII_STRING_BLOCK) + sizeof (UINT8)),
+          sizeof (UINT32)
+          );
+        BlockSize += Length32;
+        break;
+
+      default:
+        //
+        // Unrecognized block type; give up and leave lookups on the
+        // linear walk.
+        //
+        FreePool (StringIdIndex);
+        return;
+    }
+
+    BlockHdr = StringPackage->StringBlock + BlockSize;
+  }
+
+  StringPackage->StringIdIndex = StringIdIndex;
+}
+
 /**
   Parse all string blocks to find a String block specified by StringId.
   If StringId = (EFI_STRING_ID) (-1), find out all EFI_HII_SIBT_FONT blocks
@@ -283,6 +579,7 @@ FindStringBlock (
   UINT32                   Length32;
   UINTN                    StringSize;
   CHAR16                   Zero;
+  HII_STRING_ID_INDEX_ENTRY  *IndexEntry;
 
   ASSERT (StringPackage != NULL);
   ASSERT (StringPackage->Signature == HII_STRING_PACKAGE_SIGNATURE);
@@ -295,6 +592,38 @@ FindStringBlock (
     if (StringId > StringPackage->MaxStringId) {
       return EFI_NOT_FOUND;
     }
+
+    //
+    // Locate the string block through the string id index instead of
+    // decoding the block stream from the start. The index is built on the
+    // first lookup; when it is unavailable (out of resources, or the stream
+    // contains a block the index builder does not recognize), fall through
+    // to the linear walk below.
+    //
+    if (StringPackage->StringIdIndex == NULL) {
+      BuildStringIdIndex (StringPackage);
+    }
+
+    if (StringPackage->StringIdIndex != NULL) {
+      IndexEntry = &StringPackage->StringIdIndex[StringId - 1];
+      if (IndexEntry->StringBlockAddr != NULL) {
+        *BlockType        = IndexEntry->BlockType;
+        *StringBlockAddr  = IndexEntry->StringBlockAddr;
+        *StringTextOffset = IndexEntry->StringTextOffset;
+        if (StartStringId != NULL) {
+          *StartStringId = IndexEntry->StartStringId;
+        }
+
+        //
+        // A skip block reserves the string id but defines no string.
+        //
+        if ((IndexEntry->BlockType == EFI_HII_SIBT_SKIP1) || (IndexEntry->BlockType == EFI_HII_SIBT_SKIP2)) {
+          return EFI_NOT_FOUND;
+        }
+
+        return EFI_SUCCESS;
+      }
+    }
   } else {
     ASSERT (Private != NULL && Private->Signature == HII_DATABASE_PRIVATE_DATA_SIGNATURE);
     if ((StringId == 0) && (LastStringId != NULL)) {
@@ -856,6 +1185,7 @@ InsertLackStringBlock (
   FreePool (StringPackage->StringBlock);
   StringPackage->StringBlock                  = StringBlock;
   StringPackage->StringPkgHdr->Header.Length += NewBlockSize - OldBlockSize;
+  InvalidateStringIdIndex (StringPackage);
 
   return EFI_SUCCESS;
 }
@@ -1027,6 +1357,7 @@ SetStringWorker (
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock                  = Block;
       StringPackage->StringPkgHdr->Header.Length += (UINT32)(BlockSize - OldBlockSize);
+      InvalidateStringIdIndex (StringPackage);
       break;
 
     case EFI_HII_SIBT_STRING_UCS2:
@@ -1061,6 +1392,7 @@ SetStringWorker (
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock                  = Block;
       StringPackage->StringPkgHdr->Header.Length += (UINT32)(BlockSize - OldBlockSize);
+      InvalidateStringIdIndex (StringPackage);
       break;
 
     default:
@@ -1113,6 +1445,7 @@ SetStringWorker (
   FreePool (StringPackage->StringBlock);
   StringPackage->StringBlock                  = Block;
   StringPackage->StringPkgHdr->Header.Length += Ext2.Length;
+  InvalidateStringIdIndex (StringPackage);
 
   return EFI_SUCCESS;
 }
@@ -1301,6 +1634,7 @@ HiiNewString (
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock                     = StringBlock;
       StringPackage->StringPkgHdr->Header.Length    += Ucs2BlockSize;
+      InvalidateStringIdIndex (StringPackage);
       PackageListNode->PackageListHdr.PackageLength += Ucs2BlockSize;
     }
   }
@@ -1437,6 +1771,7 @@ HiiNewString (
     FreePool (StringPackage->StringBlock);
     StringPackage->StringBlock                     = StringBlock;
     StringPackage->StringPkgHdr->Header.Length    += Ucs2BlockSize;
+    InvalidateStringIdIndex (StringPackage);
     PackageListNode->PackageListHdr.PackageLength += Ucs2BlockSize;
   } else {
     //
@@ -1480,6 +1815,7 @@ HiiNewString (
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock                     = StringBlock;
       StringPackage->StringPkgHdr->Header.Length    += Ucs2FontBlockSize;
+      InvalidateStringIdIndex (StringPackage);
       PackageListNode->PackageListHdr.PackageLength += Ucs2FontBlockSize;
     } else {
       //
@@ -1542,6 +1878,7 @@ HiiNewString (
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock                     = StringBlock;
       StringPackage->StringPkgHdr->Header.Length    += FontBlockSize + Ucs2FontBlockSize;
+      InvalidateStringIdIndex (StringPackage);
       PackageListNode->PackageListHdr.PackageLength += FontBlockSize + Ucs2FontBlockSize;
 
       //
@@ -479,6 +479,17 @@ InitializeMemoryTest (
   Private->MonoPattern  = GenericMemoryTestMonoPattern;
   Private->MonoTestSize = GENERIC_CACHELINE_SIZE;
 
+  //
+  // When the platform reports that the memory configuration is unchanged
+  // from the last boot, the extended memory already passed the pattern test
+  // on that boot, so take the zero touch path: the ranges are only promoted
+  // to tested system memory in GenMemoryTestFinished().
+  //
+  if ((Private->BootMode == BOOT_ASSUMING_NO_CONFIGURATION_CHANGES) && (Level != IGNORE)) {
+    DEBUG ((DEBUG_INFO, "GenericMemoryTest: memory configuration unchanged, skip pattern test\n"));
+    Private->CoverLevel = IGNORE;
+  }
+
   //
   // Initialize several internal link list
   //
@@ -865,6 +876,7 @@ GENERIC_MEMORY_TEST_PRIVATE  mGenericMemoryTestPrivate = {
   NULL,
   0,
   0,
+  0,
   {
     NULL,
     NULL
@@ -912,7 +924,8 @@ GenericMemoryTestEntryPoint (
     return EFI_NOT_FOUND;
   }
 
-  BootMode = Hob.HandoffInformationTable->BootMode;
+  BootMode                          = Hob.HandoffInformationTable->BootMode;
+  mGenericMemoryTestPrivate.BootMode = BootMode;
 
   //
   // Get the platform boot mode and create the default memory test coverage
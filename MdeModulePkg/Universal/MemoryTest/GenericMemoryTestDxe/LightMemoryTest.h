@@ -104,6 +104,12 @@ typedef struct {
   //
   UINT64                              BaseMemorySize;
 
+  //
+  // boot mode of this boot, used to take the zero touch path when the
+  // platform reports an unchanged memory configuration
+  //
+  EFI_BOOT_MODE                       BootMode;
+
   //
   // memory range list
   //
@@ -36,6 +36,15 @@ PEI_PCD_DATABASE  *mPeiPcdDbBinary = NULL;
 UINTN             mDxePcdDbSize    = 0;
 DXE_PCD_DATABASE  *mDxePcdDbBinary = NULL;
 
+//
+// Copies of the PEI and DXE ExMapTables sorted by {ExGuidIndex, ExTokenNumber},
+// built once at database initialization so dynamic-ex token lookup can binary
+// search instead of scanning. The original tables are left untouched because
+// token enumeration depends on their build-generated order.
+//
+DYNAMICEX_MAPPING  *mPeiExMapSorted = NULL;
+DYNAMICEX_MAPPING  *mDxeExMapSorted = NULL;
+
 /**
   Get Local Token Number by Token Number.
 
@@ -847,6 +856,86 @@ UpdatePcdDatabase (
   return EFI_NOT_FOUND;
 }
 
+/**
+  Compare two DYNAMICEX_MAPPING entries by {ExGuidIndex, ExTokenNumber}.
+
+  @param Buffer1  Pointer to the first DYNAMICEX_MAPPING entry.
+  @param Buffer2  Pointer to the second DYNAMICEX_MAPPING entry.
+
+  @retval 0   Buffer1 equal to Buffer2.
+  @return <0  Buffer1 sorts before Buffer2.
+  @return >0  Buffer1 sorts after Buffer2.
+
+**/
+INTN
+EFIAPI
+ExMapCompare (
+  IN CONST VOID  *Buffer1,
+  IN CONST VOID  *Buffer2
+  )
+{
+  CONST DYNAMICEX_MAPPING  *Map1;
+  CONST DYNAMICEX_MAPPING  *Map2;
+
+  Map1 = (CONST DYNAMICEX_MAPPING *)Buffer1;
+  Map2 = (CONST DYNAMICEX_MAPPING *)Buffer2;
+
+  if (Map1->ExGuidIndex != Map2->ExGuidIndex) {
+    return (Map1->ExGuidIndex < Map2->ExGuidIndex) ? -1 : 1;
+  }
+
+  if (Map1->ExTokenNumber != Map2->ExTokenNumber) {
+    return (Map1->ExTokenNumber < Map2->ExTokenNumber) ? -1 : 1;
+  }
+
+  return 0;
+}
+
+/**
+  Find a dynamic-ex mapping entry in a sorted ExMapTable copy.
+
+  @param SortedExMap   ExMapTable copy sorted by {ExGuidIndex, ExTokenNumber}.
+  @param Count         Number of entries in SortedExMap.
+  @param ExGuidIndex   Index of the token space guid in the guid table.
+  @param ExTokenNumber Dynamic-ex PCD token number.
+
+  @return The matching entry, or NULL if no entry matches.
+
+**/
+DYNAMICEX_MAPPING *
+FindExMapEntry (
+  IN DYNAMICEX_MAPPING  *SortedExMap,
+  IN UINTN              Count,
+  IN UINT16             ExGuidIndex,
+  IN UINT32             ExTokenNumber
+  )
+{
+  DYNAMICEX_MAPPING  *Entry;
+  UINTN              Low;
+  UINTN              High;
+  UINTN              Middle;
+
+  Low  = 0;
+  High = Count;
+  while (Low < High) {
+    Middle = (Low + High) / 2;
+    Entry  = &SortedExMap[Middle];
+    if ((Entry->ExGuidIndex == ExGuidIndex) && (Entry->ExTokenNumber == ExTokenNumber)) {
+      return Entry;
+    }
+
+    if ((Entry->ExGuidIndex < ExGuidIndex) ||
+        ((Entry->ExGuidIndex == ExGuidIndex) && (Entry->ExTokenNumber < ExTokenNumber)))
+    {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  return NULL;
+}
+
 /**
   Initialize the PCD database in DXE phase.
 
@@ -865,6 +954,7 @@ BuildPcdDxeDataBase (
   UINT32             PcdDxeDbLen;
   VOID               *PcdDxeDb;
   EFI_STATUS         Status;
+  DYNAMICEX_MAPPING  TempMapping;
 
   //
   // Assign PCD Entries with default value to PCD DATABASE
@@ -933,6 +1023,28 @@ BuildPcdDxeDataBase (
   mDxeExMapTableEmpty = (mPcdDatabase.DxeDb->ExTokenCount == 0) ? TRUE : FALSE;
   mPeiDatabaseEmpty   = (mPeiLocalTokenCount == 0) ? TRUE : FALSE;
 
+  //
+  // Build sorted copies of the ExMapTables so GetExPcdTokenNumber() can
+  // binary search them instead of scanning on every dynamic-ex access.
+  //
+  if (!mPeiExMapTableEmpty) {
+    mPeiExMapSorted = AllocateCopyPool (
+                        mPeiExMapppingTableSize,
+                        (UINT8 *)mPcdDatabase.PeiDb + mPcdDatabase.PeiDb->ExMapTableOffset
+                        );
+    ASSERT (mPeiExMapSorted != NULL);
+    QuickSort (mPeiExMapSorted, mPcdDatabase.PeiDb->ExTokenCount, sizeof (DYNAMICEX_MAPPING), ExMapCompare, &TempMapping);
+  }
+
+  if (!mDxeExMapTableEmpty) {
+    mDxeExMapSorted = AllocateCopyPool (
+                        mDxeExMapppingTableSize,
+                        (UINT8 *)mPcdDatabase.DxeDb + mPcdDatabase.DxeDb->ExMapTableOffset
+                        );
+    ASSERT (mDxeExMapSorted != NULL);
+    QuickSort (mDxeExMapSorted, mPcdDatabase.DxeDb->ExTokenCount, sizeof (DYNAMICEX_MAPPING), ExMapCompare, &TempMapping);
+  }
+
   TmpTokenSpaceBufferCount = mPcdDatabase.PeiDb->ExTokenCount + mPcdDatabase.DxeDb->ExTokenCount;
   TmpTokenSpaceBuffer      = (EFI_GUID **)AllocateZeroPool (TmpTokenSpaceBufferCount * sizeof (EFI_GUID *));
 
@@ -1587,14 +1699,12 @@ GetExPcdTokenNumber (
   IN UINT32          ExTokenNumber
   )
 {
-  UINT32             Index;
-  DYNAMICEX_MAPPING  *ExMap;
+  DYNAMICEX_MAPPING  *ExMapEntry;
   EFI_GUID           *GuidTable;
   EFI_GUID           *MatchGuid;
   UINTN              MatchGuidIdx;
 
-  if (!mPeiDatabaseEmpty) {
-    ExMap     = (DYNAMICEX_MAPPING *)((UINT8 *)mPcdDatabase.PeiDb + mPcdDatabase.PeiDb->ExMapTableOffset);
+  if (!mPeiDatabaseEmpty && (mPeiExMapSorted != NULL)) {
     GuidTable = (EFI_GUID *)((UINT8 *)mPcdDatabase.PeiDb + mPcdDatabase.PeiDb->GuidTableOffset);
 
     MatchGuid = ScanGuid (GuidTable, mPeiGuidTableSize, Guid);
@@ -1602,17 +1712,13 @@ GetExPcdTokenNumber (
     if (MatchGuid != NULL) {
       MatchGuidIdx = MatchGuid - GuidTable;
 
-      for (Index = 0; Index < mPcdDatabase.PeiDb->ExTokenCount; Index++) {
-        if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
-            (MatchGuidIdx == ExMap[Index].ExGuidIndex))
-        {
-          return ExMap[Index].TokenNumber;
-        }
+      ExMapEntry = FindExMapEntry (mPeiExMapSorted, mPcdDatabase.PeiDb->ExTokenCount, (UINT16)MatchGuidIdx, ExTokenNumber);
+      if (ExMapEntry != NULL) {
+        return ExMapEntry->TokenNumber;
       }
     }
   }
 
-  ExMap     = (DYNAMICEX_MAPPING *)((UINT8 *)mPcdDatabase.DxeDb + mPcdDatabase.DxeDb->ExMapTableOffset);
   GuidTable = (EFI_GUID *)((UINT8 *)mPcdDatabase.DxeDb + mPcdDatabase.DxeDb->GuidTableOffset);
 
   MatchGuid = ScanGuid (GuidTable, mDxeGuidTableSize, Guid);
@@ -1624,11 +1730,10 @@ GetExPcdTokenNumber (
 
   MatchGuidIdx = MatchGuid - GuidTable;
 
-  for (Index = 0; Index < mPcdDatabase.DxeDb->ExTokenCount; Index++) {
-    if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
-        (MatchGuidIdx == ExMap[Index].ExGuidIndex))
-    {
-      return ExMap[Index].TokenNumber;
+  if (mDxeExMapSorted != NULL) {
+    ExMapEntry = FindExMapEntry (mDxeExMapSorted, mPcdDatabase.DxeDb->ExTokenCount, (UINT16)MatchGuidIdx, ExTokenNumber);
+    if (ExMapEntry != NULL) {
+      return ExMapEntry->TokenNumber;
     }
   }
 
@@ -24,6 +24,130 @@ EFI_REGULAR_EXPRESSION_PROTOCOL  mProtocolInstance = {
 
 #define CHAR16_ENCODING  ONIG_ENCODING_UTF16_LE
 
+//
+// Number of compiled patterns kept by the regex compilation cache.
+//
+#define REGEX_COMPILE_CACHE_SIZE  8
+
+typedef struct {
+  CHAR16            *Pattern;
+  OnigSyntaxType    *Syntax;
+  regex_t           *Regex;
+  UINT64            LastUse;
+} REGEX_COMPILE_CACHE_ENTRY;
+
+STATIC REGEX_COMPILE_CACHE_ENTRY  mRegexCompileCache[REGEX_COMPILE_CACHE_SIZE];
+STATIC UINT64                     mRegexCompileCacheUse = 0;
+
+/**
+  Return a compiled regex object for (Pattern, OnigSyntax).
+
+  Callers match the same handful of patterns many times, and compilation
+  dominates the per-match cost, so compiled objects are kept in a small
+  cache with least-recently-used eviction. The returned object is owned by
+  the cache and must not be freed by the caller; it stays valid until this
+  function is called again.
+
+  @param Pattern     A pointer to a NULL terminated string that represents the
+                     regular expression.
+  @param OnigSyntax  The Oniguruma syntax to compile the pattern with.
+  @param OnigRegex   On return, points to the compiled regex object.
+
+  @retval  EFI_SUCCESS           A cached or newly compiled object is returned.
+  @retval  EFI_DEVICE_ERROR      Regex compilation failed.
+  @retval  EFI_OUT_OF_RESOURCES  No memory to cache the compiled object.
+
+**/
+STATIC
+EFI_STATUS
+OnigurumaGetCompiledRegex (
+  IN  CHAR16          *Pattern,
+  IN  OnigSyntaxType  *OnigSyntax,
+  OUT regex_t         **OnigRegex
+  )
+{
+  REGEX_COMPILE_CACHE_ENTRY  *Entry;
+  REGEX_COMPILE_CACHE_ENTRY  *Victim;
+  UINTN                      Index;
+  regex_t                    *Regex;
+  OnigUChar                  *Start;
+  INT32                      OnigResult;
+  OnigErrorInfo              ErrorInfo;
+  OnigUChar                  ErrorMessage[ONIG_MAX_ERROR_MESSAGE_LEN];
+
+  //
+  // Look for a previous compilation of (Pattern, OnigSyntax)
+  //
+  for (Index = 0; Index < ARRAY_SIZE (mRegexCompileCache); Index++) {
+    Entry = &mRegexCompileCache[Index];
+    if ((Entry->Regex != NULL) &&
+        (Entry->Syntax == OnigSyntax) &&
+        (StrCmp (Entry->Pattern, Pattern) == 0))
+    {
+      Entry->LastUse = ++mRegexCompileCacheUse;
+      *OnigRegex     = Entry->Regex;
+      return EFI_SUCCESS;
+    }
+  }
+
+  //
+  // Compile pattern
+  //
+  Start      = (OnigUChar *)Pattern;
+  OnigResult = onig_new (
+                 &Regex,
+                 Start,
+                 Start + onigenc_str_bytelen_null (CHAR16_ENCODING, Start),
+                 ONIG_OPTION_DEFAULT,
+                 CHAR16_ENCODING,
+                 OnigSyntax,
+                 &ErrorInfo
+                 );
+
+  if (OnigResult != ONIG_NORMAL) {
+    onig_error_code_to_str (ErrorMessage, OnigResult, &ErrorInfo);
+    DEBUG ((DEBUG_ERROR, "Regex compilation failed: %a\n", ErrorMessage));
+    return EFI_DEVICE_ERROR;
+  }
+
+  //
+  // Cache the compiled object in an unused slot, or evict the least
+  // recently used entry.
+  //
+  Victim = &mRegexCompileCache[0];
+  for (Index = 0; Index < ARRAY_SIZE (mRegexCompileCache); Index++) {
+    Entry = &mRegexCompileCache[Index];
+    if (Entry->Regex == NULL) {
+      Victim = Entry;
+      break;
+    }
+
+    if (Entry->LastUse < Victim->LastUse) {
+      Victim = Entry;
+    }
+  }
+
+  if (Victim->Regex != NULL) {
+    onig_free (Victim->Regex);
+    FreePool (Victim->Pattern);
+    Victim->Regex   = NULL;
+    Victim->Pattern = NULL;
+  }
+
+  Victim->Pattern = AllocateCopyPool (StrSize (Pattern), Pattern);
+  if (Victim->Pattern == NULL) {
+    onig_free (Regex);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Victim->Syntax  = OnigSyntax;
+  Victim->Regex   = Regex;
+  Victim->LastUse = ++mRegexCompileCacheUse;
+
+  *OnigRegex = Regex;
+  return EFI_SUCCESS;
+}
+
 /**
   Call the Oniguruma regex match API.
 
@@ -79,7 +203,6 @@ OnigurumaMatch (
   OnigSyntaxType  *OnigSyntax;
   OnigRegion      *Region;
   INT32           OnigResult;
-  OnigErrorInfo   ErrorInfo;
   OnigUChar       ErrorMessage[ONIG_MAX_ERROR_MESSAGE_LEN];
   UINT32          Index;
   OnigUChar       *Start;
@@ -101,23 +224,13 @@ OnigurumaMatch (
   }
 
   //
-  // Compile pattern
+  // Get a compiled form of the pattern, reusing a cached compilation when
+  // the same pattern was matched before. The compiled object is owned by
+  // the cache and must not be freed here.
   //
-  Start      = (OnigUChar *)Pattern;
-  OnigResult = onig_new (
-                 &OnigRegex,
-                 Start,
-                 Start + onigenc_str_bytelen_null (CHAR16_ENCODING, Start),
-                 ONIG_OPTION_DEFAULT,
-                 CHAR16_ENCODING,
-                 OnigSyntax,
-                 &ErrorInfo
-                 );
-
-  if (OnigResult != ONIG_NORMAL) {
-    onig_error_code_to_str (ErrorMessage, OnigResult, &ErrorInfo);
-    DEBUG ((DEBUG_ERROR, "Regex compilation failed: %a\n", ErrorMessage));
-    return EFI_DEVICE_ERROR;
+  Status = OnigurumaGetCompiledRegex (Pattern, OnigSyntax, &OnigRegex);
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
   //
@@ -126,7 +239,6 @@ OnigurumaMatch (
   Start  = (OnigUChar *)String;
   Region = onig_region_new ();
   if (Region == NULL) {
-    onig_free (OnigRegex);
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -148,7 +260,6 @@ OnigurumaMatch (
       onig_error_code_to_str (ErrorMessage, OnigResult);
       DEBUG ((DEBUG_ERROR, "Regex match failed: %a\n", ErrorMessage));
       onig_region_free (Region, 1);
-      onig_free (OnigRegex);
       return EFI_DEVICE_ERROR;
     }
   }
@@ -188,7 +299,6 @@ OnigurumaMatch (
   }
 
   onig_region_free (Region, 1);
-  onig_free (OnigRegex);
 
   return Status;
 }
@@ -70,6 +70,19 @@ RscHandlerNotification (
   }
 
   CallbackEntry->EndPointer = CallbackEntry->StatusCodeDataBuffer;
+
+  //
+  // Report status codes dropped because the handler's buffer was full.
+  //
+  if (CallbackEntry->DroppedStatusCodes != 0) {
+    DEBUG ((
+      DEBUG_WARN,
+      "ReportStatusCodeRouter: dropped %d status code(s) for handler %p\n",
+      CallbackEntry->DroppedStatusCodes,
+      CallbackEntry->RscHandlerCallback
+      ));
+    CallbackEntry->DroppedStatusCodes = 0;
+  }
 }
 
 /**
@@ -280,8 +293,11 @@ ReportDispatcher (
 
     //
     // If data buffer is about to be used up (7/8 here), try to reallocate a buffer with double size, if not at TPL_HIGH_LEVEL.
+    // The buffer is bounded by RSC_HANDLER_MAX_BUFFER_SIZE so a handler that never drains cannot grow it without limit.
     //
-    if (CallbackEntry->EndPointer > (CallbackEntry->StatusCodeDataBuffer + (CallbackEntry->BufferSize / 8) * 7)) {
+    if ((CallbackEntry->EndPointer > (CallbackEntry->StatusCodeDataBuffer + (CallbackEntry->BufferSize / 8) * 7)) &&
+        (CallbackEntry->BufferSize < RSC_HANDLER_MAX_BUFFER_SIZE))
+    {
       if (EfiGetCurrentTpl () < TPL_HIGH_LEVEL) {
         NewBuffer = ReallocatePool (
                       CallbackEntry->BufferSize,
@@ -299,10 +315,11 @@ ReportDispatcher (
     }
 
     //
-    // If data buffer is used up, do not report for this time.
+    // If data buffer is used up, count the dropped status code and do not report for this time.
     //
     if (CallbackEntry->EndPointer > (CallbackEntry->StatusCodeDataBuffer + CallbackEntry->BufferSize)) {
       CallbackEntry->EndPointer = FailSafeEndPointer;
+      CallbackEntry->DroppedStatusCodes++;
       continue;
     }
 
@@ -27,6 +27,13 @@
 
 #define RSC_HANDLER_CALLBACK_ENTRY_SIGNATURE  SIGNATURE_32 ('r', 'h', 'c', 'e')
 
+//
+// Upper bound for a handler's status code data buffer. Once a buffer has
+// grown to this size, further status codes that do not fit are dropped and
+// counted instead of growing the buffer.
+//
+#define RSC_HANDLER_MAX_BUFFER_SIZE  (EFI_PAGE_SIZE * 16)
+
 typedef struct {
   UINTN                       Signature;
   EFI_RSC_HANDLER_CALLBACK    RscHandlerCallback;
@@ -35,6 +42,7 @@ typedef struct {
   EFI_PHYSICAL_ADDRESS        StatusCodeDataBuffer;
   UINTN                       BufferSize;
   EFI_PHYSICAL_ADDRESS        EndPointer;
+  UINT32                      DroppedStatusCodes;
   LIST_ENTRY                  Node;
 } RSC_HANDLER_CALLBACK_ENTRY;
 
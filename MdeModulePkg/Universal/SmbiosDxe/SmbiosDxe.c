@@ -19,6 +19,15 @@ SMBIOS_INSTANCE  mPrivateData;
 UINTN  mPreAllocatedPages      = 0;
 UINTN  mPre64BitAllocatedPages = 0;
 
+//
+// While a pre-existing SMBIOS table is replayed record by record through
+// SmbiosAdd, per-record table rebuilds are deferred and the whole batch is
+// published with a single construction pass.
+//
+BOOLEAN  mDeferTableConstruction   = FALSE;
+BOOLEAN  mDeferredSmbios32BitTable = FALSE;
+BOOLEAN  mDeferredSmbios64BitTable = FALSE;
+
 //
 // Chassis for SMBIOS entry point structure that is to be installed into EFI system config table.
 //
@@ -1052,6 +1061,7 @@ SmbiosCreateTable (
   UINT8                           *BufferPointer;
   UINTN                           RecordSize;
   UINTN                           NumOfStr;
+  UINTN                           NewPages;
   EFI_STATUS                      Status;
   EFI_SMBIOS_HANDLE               SmbiosHandle;
   EFI_SMBIOS_PROTOCOL             *SmbiosProtocol;
@@ -1171,11 +1181,18 @@ SmbiosCreateTable (
       mPreAllocatedPages                = 0;
     }
 
+    //
+    // Grow the allocation to twice what the table needs now, so that a run of
+    // record-by-record additions does not free and re-allocate the table for
+    // every page of growth. The 32-bit table length is capped at 64KB, which
+    // bounds the over-allocation to 16 pages.
+    //
+    NewPages        = EFI_SIZE_TO_PAGES ((UINT32)EntryPointStructure->TableLength) * 2;
     PhysicalAddress = 0xffffffff;
     Status          = gBS->AllocatePages (
                              AllocateMaxAddress,
                              EfiRuntimeServicesData,
-                             EFI_SIZE_TO_PAGES (EntryPointStructure->TableLength),
+                             NewPages,
                              &PhysicalAddress
                              );
     if (EFI_ERROR (Status)) {
@@ -1184,7 +1201,7 @@ SmbiosCreateTable (
       return EFI_OUT_OF_RESOURCES;
     } else {
       EntryPointStructure->TableAddress = (UINT32)PhysicalAddress;
-      mPreAllocatedPages                = EFI_SIZE_TO_PAGES (EntryPointStructure->TableLength);
+      mPreAllocatedPages                = NewPages;
     }
   }
 
@@ -1247,6 +1264,7 @@ SmbiosCreate64BitTable (
   UINT8                           *BufferPointer;
   UINTN                           RecordSize;
   UINTN                           NumOfStr;
+  UINTN                           NewPages;
   EFI_STATUS                      Status;
   EFI_SMBIOS_HANDLE               SmbiosHandle;
   EFI_SMBIOS_PROTOCOL             *SmbiosProtocol;
@@ -1343,19 +1361,25 @@ SmbiosCreate64BitTable (
       mPre64BitAllocatedPages                   = 0;
     }
 
-    Status = gBS->AllocatePages (
-                    AllocateAnyPages,
-                    EfiRuntimeServicesData,
-                    EFI_SIZE_TO_PAGES (Smbios30EntryPointStructure->TableMaximumSize),
-                    &PhysicalAddress
-                    );
+    //
+    // Grow the allocation to twice what the table needs now, so that a run of
+    // record-by-record additions does not free and re-allocate the table for
+    // every page of growth.
+    //
+    NewPages = EFI_SIZE_TO_PAGES (Smbios30EntryPointStructure->TableMaximumSize) * 2;
+    Status   = gBS->AllocatePages (
+                      AllocateAnyPages,
+                      EfiRuntimeServicesData,
+                      NewPages,
+                      &PhysicalAddress
+                      );
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "SmbiosCreateTable() could not allocate SMBIOS 64-bit table\n"));
       Smbios30EntryPointStructure->TableAddress = 0;
       return EFI_OUT_OF_RESOURCES;
     } else {
       Smbios30EntryPointStructure->TableAddress = PhysicalAddress;
-      mPre64BitAllocatedPages                   = EFI_SIZE_TO_PAGES (Smbios30EntryPointStructure->TableMaximumSize);
+      mPre64BitAllocatedPages                   = NewPages;
     }
   }
 
@@ -1416,6 +1440,22 @@ SmbiosTableConstruction (
   UINT8       *Eps64Bit;
   EFI_STATUS  Status;
 
+  if (mDeferTableConstruction) {
+    //
+    // Record which tables need a rebuild and publish them in one pass when
+    // the batch import completes.
+    //
+    if (Smbios32BitTable) {
+      mDeferredSmbios32BitTable = TRUE;
+    }
+
+    if (Smbios64BitTable) {
+      mDeferredSmbios64BitTable = TRUE;
+    }
+
+    return;
+  }
+
   if (Smbios32BitTable) {
     Status = SmbiosCreateTable ((VOID **)&Eps);
     if (!EFI_ERROR (Status)) {
@@ -1711,7 +1751,20 @@ RetrieveSmbiosFromHob (
         if (GenericHeader->Length >= UNIVERSAL_PAYLOAD_SIZEOF_THROUGH_FIELD (UNIVERSAL_PAYLOAD_SMBIOS_TABLE, SmBiosEntryPoint)) {
           if (mIsSmbiosTableValid[Index].IsValid ((VOID *)(UINTN)SmBiosTableAdress->SmBiosEntryPoint, &TableAddress, &TableMaximumSize)) {
             Smbios.Raw = TableAddress;
-            Status     = ParseAndAddExistingSmbiosTable (ImageHandle, Smbios, TableMaximumSize);
+            //
+            // Replaying the pre-existing table goes through SmbiosAdd once per
+            // record; defer the per-record table rebuilds and publish the
+            // imported records with a single construction pass.
+            //
+            mDeferTableConstruction = TRUE;
+            Status                  = ParseAndAddExistingSmbiosTable (ImageHandle, Smbios, TableMaximumSize);
+            mDeferTableConstruction = FALSE;
+            if (mDeferredSmbios32BitTable || mDeferredSmbios64BitTable) {
+              SmbiosTableConstruction (mDeferredSmbios32BitTable, mDeferredSmbios64BitTable);
+              mDeferredSmbios32BitTable = FALSE;
+              mDeferredSmbios64BitTable = FALSE;
+            }
+
             if (EFI_ERROR (Status)) {
               DEBUG ((DEBUG_ERROR, "RetrieveSmbiosFromHob: Failed to parse preinstalled tables from Guid Hob\n"));
               Status = EFI_UNSUPPORTED;
@@ -168,6 +168,20 @@ UpdateVariableStore (
     if ((DataPtr + DataSize) > (FvVolHdr + mNvFvHeaderCache->FvLength)) {
       return EFI_OUT_OF_RESOURCES;
     }
+
+    //
+    // In write-back mode, defer the flash program: update only the memory
+    // copy of the store and record that it must be committed later.
+    //
+    if (mVariableModuleGlobal->NvWriteBack) {
+      CopyMem (
+        (UINT8 *)mNvVariableCache + ((UINTN)DataPtr - (UINTN)mVariableModuleGlobal->VariableGlobal.NonVolatileVariableBase),
+        Buffer,
+        DataSize
+        );
+      mVariableModuleGlobal->NvCacheDirty = TRUE;
+      return EFI_SUCCESS;
+    }
   } else {
     //
     // Data Pointer should point to the actual Address where data is to be
@@ -497,6 +511,38 @@ InitializeVariableQuota (
   CalculateCommonUserVariableTotalSize ();
 }
 
+/**
+  Commit deferred non-volatile variable updates from the memory copy of the
+  store to flash in a single fault tolerant write.
+
+  @retval EFI_SUCCESS    The store content in flash matches mNvVariableCache.
+  @return Others         The fault tolerant write failed.
+
+**/
+EFI_STATUS
+CommitNvVariableCache (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  if (!mVariableModuleGlobal->NvCacheDirty) {
+    return EFI_SUCCESS;
+  }
+
+  Status = FtwVariableSpace (
+             mVariableModuleGlobal->VariableGlobal.NonVolatileVariableBase,
+             mNvVariableCache
+             );
+  if (!EFI_ERROR (Status)) {
+    mVariableModuleGlobal->NvCacheDirty = FALSE;
+  } else {
+    DEBUG ((DEBUG_ERROR, "Variable: commit of deferred NV writes failed: %r\n", Status));
+  }
+
+  return Status;
+}
+
 /**
 
   Variable store garbage collection and reclaim operation.
@@ -556,6 +602,18 @@ Reclaim (
 
   VariableStoreHeader = (VARIABLE_STORE_HEADER *)((UINTN)VariableBase);
 
+  if (!IsVolatile && !mVariableModuleGlobal->VariableGlobal.EmuNvMode) {
+    //
+    // The NV reclaim below rebuilds the store from its flash content and
+    // reuses mNvVariableCache as the scratch buffer, so any deferred
+    // write-back content must be committed to flash first.
+    //
+    Status = CommitNvVariableCache ();
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
   CommonVariableTotalSize     = 0;
   CommonUserVariableTotalSize = 0;
   HwErrVariableTotalSize      = 0;
@@ -818,6 +876,14 @@ Done:
     Status = DoneStatus;
   }
 
+  if (!IsVolatile) {
+    //
+    // The reclaim has rewritten the layout of mNvVariableCache, so the
+    // lookup index over it is stale now.
+    //
+    VariableIndexInvalidate ();
+  }
+
   return Status;
 }
 
@@ -2562,15 +2628,23 @@ VariableServiceGetNextVariableName (
   VariableStoreHeader[VariableStoreTypeHob]      = (VARIABLE_STORE_HEADER *)(UINTN)mVariableModuleGlobal->VariableGlobal.HobVariableBase;
   VariableStoreHeader[VariableStoreTypeNv]       = mNvVariableCache;
 
+  //
+  // Pass the previously returned variable as a hint, so that a sequential
+  // enumeration resumes where it stopped instead of re-finding the current
+  // position with a linear scan.  The hint is re-validated against the
+  // current store content before it is used.
+  //
   Status =  VariableServiceGetNextVariableInternal (
               VariableName,
               VendorGuid,
               VariableStoreHeader,
+              mVariableModuleGlobal->GetNextVariableHint,
               &VariablePtr,
               AuthFormat
               );
   if (!EFI_ERROR (Status)) {
-    VarNameSize = NameSizeOfVariable (VariablePtr, AuthFormat);
+    mVariableModuleGlobal->GetNextVariableHint = VariablePtr;
+    VarNameSize                                = NameSizeOfVariable (VariablePtr, AuthFormat);
     ASSERT (VarNameSize != 0);
     if (VarNameSize <= *VariableNameSize) {
       CopyMem (
@@ -3201,7 +3275,8 @@ VariableServiceQueryVariableInfo (
 }
 
 /**
-  This function reclaims variable storage if free size is below the threshold.
+  This function reclaims variable storage if free size is below the threshold
+  or if the space held by deleted variables is worth a store rewrite.
 
   Caution: This function may be invoked at SMM mode.
   Care must be taken to make sure not security issue.
@@ -3212,10 +3287,13 @@ ReclaimForOS (
   VOID
   )
 {
-  EFI_STATUS      Status;
-  UINTN           RemainingCommonRuntimeVariableSpace;
-  UINTN           RemainingHwErrVariableSpace;
-  STATIC BOOLEAN  Reclaimed;
+  EFI_STATUS       Status;
+  UINTN            RemainingCommonRuntimeVariableSpace;
+  UINTN            RemainingHwErrVariableSpace;
+  UINTN            ReclaimableSize;
+  VARIABLE_HEADER  *Variable;
+  VARIABLE_HEADER  *NextVariable;
+  STATIC BOOLEAN   Reclaimed;
 
   //
   // This function will be called only once at EndOfDxe or ReadyToBoot event.
@@ -3237,12 +3315,31 @@ ReclaimForOS (
   RemainingHwErrVariableSpace = PcdGet32 (PcdHwErrStorageSize) - mVariableModuleGlobal->HwErrVariableTotalSize;
 
   //
-  // Check if the free area is below a threshold.
+  // Sum the space held by deleted and superseded variables.  When at least
+  // one maximum size variable's worth of space can be recovered, compact the
+  // store here so that a later runtime SetVariable does not have to pay the
+  // full store rewrite latency when space runs out.
+  //
+  ReclaimableSize = 0;
+  Variable        = GetStartPointer (mNvVariableCache);
+  while (IsValidVariableHeader (Variable, GetEndPointer (mNvVariableCache))) {
+    NextVariable = GetNextVariablePtr (Variable, mVariableModuleGlobal->VariableGlobal.AuthFormat);
+    if (Variable->State != VAR_ADDED) {
+      ReclaimableSize += (UINTN)NextVariable - (UINTN)Variable;
+    }
+
+    Variable = NextVariable;
+  }
+
+  //
+  // Check if the free area is below a threshold or the reclaimable space is
+  // above one.
   //
   if (((RemainingCommonRuntimeVariableSpace < mVariableModuleGlobal->MaxVariableSize) ||
        (RemainingCommonRuntimeVariableSpace < mVariableModuleGlobal->MaxAuthVariableSize)) ||
       ((PcdGet32 (PcdHwErrStorageSize) != 0) &&
-       (RemainingHwErrVariableSpace < PcdGet32 (PcdMaxHardwareErrorVariableSize))))
+       (RemainingHwErrVariableSpace < PcdGet32 (PcdMaxHardwareErrorVariableSize))) ||
+      (ReclaimableSize > GetNonVolatileMaxVariableSize ()))
   {
     Status = Reclaim (
                mVariableModuleGlobal->VariableGlobal.NonVolatileVariableBase,
@@ -121,8 +121,39 @@ typedef struct {
   CHAR8                                 *PlatformLang;
   CHAR8                                 Lang[ISO_639_2_ENTRY_SIZE + 1];
   EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL    *FvbInstance;
+  //
+  // The variable returned by the previous GetNextVariableName call, used as
+  // a position hint when the next call resumes from that variable.  Always
+  // re-validated against the current store content before use.
+  //
+  VARIABLE_HEADER                       *GetNextVariableHint;
+  //
+  // TRUE if non-volatile variable writes only update the memory copy of the
+  // store (mNvVariableCache) and are committed to flash in one batch by
+  // CommitNvVariableCache().  Only enabled by the DXE driver during boot
+  // when PcdEnableVariableNvWriteBack is set.
+  //
+  BOOLEAN                               NvWriteBack;
+  //
+  // TRUE when mNvVariableCache holds updates that have not been written to
+  // flash yet.
+  //
+  BOOLEAN                               NvCacheDirty;
 } VARIABLE_MODULE_GLOBAL;
 
+/**
+  Commit deferred non-volatile variable updates from the memory copy of the
+  store to flash in a single fault tolerant write.
+
+  @retval EFI_SUCCESS    The store content in flash matches mNvVariableCache.
+  @return Others         The fault tolerant write failed.
+
+**/
+EFI_STATUS
+CommitNvVariableCache (
+  VOID
+  );
+
 /**
   Flush the HOB variable to flash.
 
@@ -262,6 +262,11 @@ VariableClassAddressChangeEvent (
   EfiConvertPointer (0x0, (VOID **)&mVariableModuleGlobal->VariableGlobal.NonVolatileVariableBase);
   EfiConvertPointer (0x0, (VOID **)&mVariableModuleGlobal->VariableGlobal.VolatileVariableBase);
   EfiConvertPointer (0x0, (VOID **)&mVariableModuleGlobal->VariableGlobal.HobVariableBase);
+  //
+  // Drop the enumeration position hint instead of converting it; the next
+  // GetNextVariableName call simply re-finds its position.
+  //
+  mVariableModuleGlobal->GetNextVariableHint = NULL;
   EfiConvertPointer (0x0, (VOID **)&mVariableModuleGlobal);
   EfiConvertPointer (0x0, (VOID **)&mNvVariableCache);
   EfiConvertPointer (0x0, (VOID **)&mNvFvHeaderCache);
@@ -315,6 +320,16 @@ OnReadyToBoot (
     InitializeVariableQuota ();
   }
 
+  if (mVariableModuleGlobal->NvWriteBack) {
+    //
+    // Stop deferring variable writes and commit everything accumulated in
+    // mNvVariableCache to flash in one batch before the OS takes over.
+    //
+    mVariableModuleGlobal->NvWriteBack = FALSE;
+    Status                             = CommitNvVariableCache ();
+    ASSERT_EFI_ERROR (Status);
+  }
+
   ReclaimForOS ();
   if (FeaturePcdGet (PcdVariableCollectStatistics)) {
     if (mVariableModuleGlobal->VariableGlobal.AuthFormat) {
@@ -492,6 +507,13 @@ FtwNotificationEvent (
   //
   VariableWriteServiceInitializeDxe ();
 
+  //
+  // With the write service fully initialized, boot time variable writes may
+  // be deferred to mNvVariableCache and committed in one batch at ready to
+  // boot, if the platform opted in.
+  //
+  mVariableModuleGlobal->NvWriteBack = FeaturePcdGet (PcdEnableVariableNvWriteBack);
+
   //
   // Close the notify event to avoid install gEfiVariableWriteArchProtocolGuid again.
   //
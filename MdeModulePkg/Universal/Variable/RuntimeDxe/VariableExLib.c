@@ -108,6 +108,7 @@ VariableExLibFindNextVariable (
              VariableName,
              VendorGuid,
              VariableStoreHeader,
+             NULL,
              &VariablePtr,
              mVariableModuleGlobal->VariableGlobal.AuthFormat
              );
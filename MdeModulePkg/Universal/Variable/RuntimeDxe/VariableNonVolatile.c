@@ -322,6 +322,12 @@ InitNonVolatileVariableStore (
   mNvVariableCache                                              = (VARIABLE_STORE_HEADER *)(UINTN)VariableStoreBase;
   mVariableModuleGlobal->VariableGlobal.AuthFormat              = (BOOLEAN)(CompareGuid (&mNvVariableCache->Signature, &gEfiAuthenticatedVariableGuid));
 
+  //
+  // Index the non-volatile variable cache so boot time lookups do not have
+  // to walk the whole store.
+  //
+  VariableIndexRegisterStore (mNvVariableCache);
+
   mVariableModuleGlobal->MaxVariableSize     = PcdGet32 (PcdMaxVariableSize);
   mVariableModuleGlobal->MaxAuthVariableSize = ((PcdGet32 (PcdMaxAuthVariableSize) != 0) ? PcdGet32 (PcdMaxAuthVariableSize) : mVariableModuleGlobal->MaxVariableSize);
 
@@ -445,6 +445,175 @@ VariableCompareTimeStampInternal (
   return (BOOLEAN)(FirstTime->Second <= SecondTime->Second);
 }
 
+//
+// Boot time name/GUID lookup index over one registered variable store (the
+// non-volatile variable cache).  The table mirrors the store layout in order,
+// so a hash filtered walk of the index observes the same variable sequence as
+// a linear walk of the store and therefore returns the same result.  Variable
+// state is read from the variable header at lookup time, so state transitions
+// (VAR_ADDED/VAR_IN_DELETED_TRANSITION/VAR_DELETED) need no index maintenance;
+// only a reclaim, which rewrites the store layout, invalidates the index.
+// The index is not used at runtime: the table pointers are not converted by
+// SetVirtualAddressMap and no memory services are available to maintain it.
+//
+typedef struct {
+  UINT32             NameGuidHash;
+  VARIABLE_HEADER    *Variable;
+} VARIABLE_INDEX_ENTRY;
+
+STATIC VARIABLE_STORE_HEADER  *mVariableIndexStore = NULL;
+STATIC VARIABLE_INDEX_ENTRY   *mVariableIndexTable = NULL;
+STATIC UINTN                  mVariableIndexCount  = 0;
+STATIC UINTN                  mVariableIndexMax    = 0;
+STATIC VARIABLE_HEADER        *mVariableIndexNext  = NULL;
+
+/**
+  Compute the lookup hash over a variable name and vendor GUID.
+
+  @param[in] VariableName   Pointer to the variable name.
+  @param[in] NameSize       Size of the variable name in bytes, including the
+                            terminating NULL character.
+  @param[in] VendorGuid     Pointer to the vendor GUID.
+
+  @return The 32-bit hash of the (name, GUID) pair.
+
+**/
+STATIC
+UINT32
+VariableIndexHash (
+  IN CHAR16    *VariableName,
+  IN UINTN     NameSize,
+  IN EFI_GUID  *VendorGuid
+  )
+{
+  UINT32  Hash;
+  UINT8   *Byte;
+  UINTN   Index;
+
+  //
+  // FNV-1a over the name bytes and the vendor GUID.
+  //
+  Hash = 0x811C9DC5;
+  Byte = (UINT8 *)VariableName;
+  for (Index = 0; Index < NameSize; Index++) {
+    Hash = (Hash ^ Byte[Index]) * 0x01000193;
+  }
+
+  Byte = (UINT8 *)VendorGuid;
+  for (Index = 0; Index < sizeof (EFI_GUID); Index++) {
+    Hash = (Hash ^ Byte[Index]) * 0x01000193;
+  }
+
+  return Hash;
+}
+
+/**
+  Register the variable store covered by the boot time lookup index.
+
+  The index table is sized for the worst case variable count the store can
+  hold, so it never needs to grow afterwards.  If the allocation fails the
+  index simply stays disabled and lookups use the linear scan.
+
+  @param[in] VariableStoreHeader  Pointer to the variable store to be indexed.
+
+**/
+VOID
+VariableIndexRegisterStore (
+  IN VARIABLE_STORE_HEADER  *VariableStoreHeader
+  )
+{
+  UINTN  MaxEntryCount;
+
+  if (mVariableIndexTable != NULL) {
+    FreePool (mVariableIndexTable);
+    mVariableIndexTable = NULL;
+  }
+
+  //
+  // No variable can be smaller than its header, so the store can never hold
+  // more variables than this.
+  //
+  MaxEntryCount = (VariableStoreHeader->Size - sizeof (VARIABLE_STORE_HEADER)) / sizeof (VARIABLE_HEADER);
+
+  mVariableIndexStore = VariableStoreHeader;
+  mVariableIndexTable = AllocatePool (MaxEntryCount * sizeof (VARIABLE_INDEX_ENTRY));
+  mVariableIndexMax   = (mVariableIndexTable != NULL) ? MaxEntryCount : 0;
+  mVariableIndexCount = 0;
+  mVariableIndexNext  = GetStartPointer (VariableStoreHeader);
+}
+
+/**
+  Invalidate the boot time lookup index after the indexed store is rewritten.
+
+  The table allocation is kept; the index is rebuilt from the store on the
+  next indexed lookup.
+
+**/
+VOID
+VariableIndexInvalidate (
+  VOID
+  )
+{
+  if (mVariableIndexStore == NULL) {
+    return;
+  }
+
+  mVariableIndexCount = 0;
+  mVariableIndexNext  = GetStartPointer (mVariableIndexStore);
+}
+
+/**
+  Bring the boot time lookup index up to date with the indexed store.
+
+  New variables are only ever appended at the end of the store, so catching
+  up means resuming the walk from where the previous one stopped.
+
+  @param[in] AuthFormat  TRUE indicates authenticated variables are used.
+                         FALSE indicates authenticated variables are not used.
+
+  @retval TRUE   The index covers every variable currently in the store.
+  @retval FALSE  The index is not available.
+
+**/
+STATIC
+BOOLEAN
+VariableIndexCatchUp (
+  IN BOOLEAN  AuthFormat
+  )
+{
+  VARIABLE_HEADER  *Variable;
+  VARIABLE_HEADER  *EndPtr;
+
+  if (mVariableIndexTable == NULL) {
+    return FALSE;
+  }
+
+  EndPtr   = GetEndPointer (mVariableIndexStore);
+  Variable = mVariableIndexNext;
+  while (IsValidVariableHeader (Variable, EndPtr)) {
+    if (mVariableIndexCount == mVariableIndexMax) {
+      //
+      // Cannot happen for a well formed store; treat it as corruption and
+      // fall back to the linear scan.
+      //
+      ASSERT (mVariableIndexCount < mVariableIndexMax);
+      return FALSE;
+    }
+
+    mVariableIndexTable[mVariableIndexCount].NameGuidHash = VariableIndexHash (
+                                                              GetVariableNamePtr (Variable, AuthFormat),
+                                                              NameSizeOfVariable (Variable, AuthFormat),
+                                                              GetVendorGuidPtr (Variable, AuthFormat)
+                                                              );
+    mVariableIndexTable[mVariableIndexCount].Variable = Variable;
+    mVariableIndexCount++;
+    Variable = GetNextVariablePtr (Variable, AuthFormat);
+  }
+
+  mVariableIndexNext = Variable;
+  return TRUE;
+}
+
 /**
   Find the variable in the specified variable store.
 
@@ -470,6 +639,8 @@ FindVariableEx (
 {
   VARIABLE_HEADER  *InDeletedVariable;
   VOID             *Point;
+  UINT32           NameGuidHash;
+  UINTN            Index;
 
   PtrTrack->InDeletedTransitionPtr = NULL;
 
@@ -478,6 +649,57 @@ FindVariableEx (
   //
   InDeletedVariable = NULL;
 
+  //
+  // A non-empty name lookup in the indexed store can use the boot time hash
+  // index instead of walking every variable header.  Walking the index in
+  // order with a hash filter preserves the linear scan semantics, including
+  // the in-deleted-transition bookkeeping, because skipped entries can never
+  // match the (name, GUID) pair being looked up.  The runtime access check
+  // of the linear scan passes trivially here since the index is only used
+  // before runtime.
+  //
+  if ((VariableName[0] != 0) &&
+      !AtRuntime () &&
+      (mVariableIndexStore != NULL) &&
+      (PtrTrack->StartPtr == GetStartPointer (mVariableIndexStore)) &&
+      (PtrTrack->EndPtr == GetEndPointer (mVariableIndexStore)) &&
+      VariableIndexCatchUp (AuthFormat))
+  {
+    NameGuidHash = VariableIndexHash (VariableName, StrSize (VariableName), VendorGuid);
+    for (Index = 0; Index < mVariableIndexCount; Index++) {
+      if (mVariableIndexTable[Index].NameGuidHash != NameGuidHash) {
+        continue;
+      }
+
+      PtrTrack->CurrPtr = mVariableIndexTable[Index].Variable;
+      if ((PtrTrack->CurrPtr->State != VAR_ADDED) &&
+          (PtrTrack->CurrPtr->State != (VAR_IN_DELETED_TRANSITION & VAR_ADDED)))
+      {
+        continue;
+      }
+
+      if (!CompareGuid (VendorGuid, GetVendorGuidPtr (PtrTrack->CurrPtr, AuthFormat))) {
+        continue;
+      }
+
+      Point = (VOID *)GetVariableNamePtr (PtrTrack->CurrPtr, AuthFormat);
+      ASSERT (NameSizeOfVariable (PtrTrack->CurrPtr, AuthFormat) != 0);
+      if (CompareMem (VariableName, Point, NameSizeOfVariable (PtrTrack->CurrPtr, AuthFormat)) != 0) {
+        continue;
+      }
+
+      if (PtrTrack->CurrPtr->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED)) {
+        InDeletedVariable = PtrTrack->CurrPtr;
+      } else {
+        PtrTrack->InDeletedTransitionPtr = InDeletedVariable;
+        return EFI_SUCCESS;
+      }
+    }
+
+    PtrTrack->CurrPtr = InDeletedVariable;
+    return (PtrTrack->CurrPtr == NULL) ? EFI_NOT_FOUND : EFI_SUCCESS;
+  }
+
   for ( PtrTrack->CurrPtr = PtrTrack->StartPtr
         ; IsValidVariableHeader (PtrTrack->CurrPtr, PtrTrack->EndPtr)
         ; PtrTrack->CurrPtr = GetNextVariablePtr (PtrTrack->CurrPtr, AuthFormat)
@@ -528,6 +750,9 @@ FindVariableEx (
   @param[in]  VendorGuid        Variable Vendor Guid.
   @param[in]  VariableStoreList A list of variable stores that should be used to get the next variable.
                                 The maximum number of entries is the max value of VARIABLE_STORE_TYPE.
+  @param[in]  VariableHint      If not NULL, the variable header a sequential caller got back from
+                                the previous call.  When it still matches VariableName and
+                                VendorGuid, the linear re-find of the current position is skipped.
   @param[out] VariablePtr       Pointer to variable header address.
   @param[in]  AuthFormat        TRUE indicates authenticated variables are used.
                                 FALSE indicates authenticated variables are not used.
@@ -545,6 +770,7 @@ VariableServiceGetNextVariableInternal (
   IN  CHAR16                 *VariableName,
   IN  EFI_GUID               *VendorGuid,
   IN  VARIABLE_STORE_HEADER  **VariableStoreList,
+  IN  VARIABLE_HEADER        *VariableHint  OPTIONAL,
   OUT VARIABLE_HEADER        **VariablePtr,
   IN  BOOLEAN                AuthFormat
   )
@@ -563,19 +789,56 @@ VariableServiceGetNextVariableInternal (
 
   ZeroMem (&Variable, sizeof (Variable));
 
-  // Check if the variable exists in the given variable store list
-  for (StoreType = (VARIABLE_STORE_TYPE)0; StoreType < VariableStoreTypeMax; StoreType++) {
-    if (VariableStoreList[StoreType] == NULL) {
-      continue;
+  //
+  // Check the hint before re-finding the current position.  The hint is
+  // trusted only after it has been validated against the store list and
+  // found to still carry the (name, GUID) pair being resumed from; any
+  // mismatch, for instance after the store was reclaimed, falls back to
+  // the regular search below.
+  //
+  if ((VariableHint != NULL) && (VariableName[0] != 0) && (VendorGuid != NULL)) {
+    for (StoreType = (VARIABLE_STORE_TYPE)0; StoreType < VariableStoreTypeMax; StoreType++) {
+      if (VariableStoreList[StoreType] == NULL) {
+        continue;
+      }
+
+      if ((VariableHint >= GetStartPointer (VariableStoreList[StoreType])) &&
+          (VariableHint < GetEndPointer (VariableStoreList[StoreType])))
+      {
+        break;
+      }
     }
 
-    Variable.StartPtr = GetStartPointer (VariableStoreList[StoreType]);
-    Variable.EndPtr   = GetEndPointer (VariableStoreList[StoreType]);
-    Variable.Volatile = (BOOLEAN)(StoreType == VariableStoreTypeVolatile);
+    if ((StoreType < VariableStoreTypeMax) &&
+        IsValidVariableHeader (VariableHint, GetEndPointer (VariableStoreList[StoreType])) &&
+        ((VariableHint->State == VAR_ADDED) || (VariableHint->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED))) &&
+        CompareGuid (VendorGuid, GetVendorGuidPtr (VariableHint, AuthFormat)) &&
+        (NameSizeOfVariable (VariableHint, AuthFormat) != 0) &&
+        (CompareMem (VariableName, GetVariableNamePtr (VariableHint, AuthFormat), NameSizeOfVariable (VariableHint, AuthFormat)) == 0))
+    {
+      Variable.StartPtr = GetStartPointer (VariableStoreList[StoreType]);
+      Variable.EndPtr   = GetEndPointer (VariableStoreList[StoreType]);
+      Variable.Volatile = (BOOLEAN)(StoreType == VariableStoreTypeVolatile);
+      Variable.CurrPtr  = VariableHint;
+      Status            = EFI_SUCCESS;
+    }
+  }
+
+  // Check if the variable exists in the given variable store list
+  if (Variable.CurrPtr == NULL) {
+    for (StoreType = (VARIABLE_STORE_TYPE)0; StoreType < VariableStoreTypeMax; StoreType++) {
+      if (VariableStoreList[StoreType] == NULL) {
+        continue;
+      }
+
+      Variable.StartPtr = GetStartPointer (VariableStoreList[StoreType]);
+      Variable.EndPtr   = GetEndPointer (VariableStoreList[StoreType]);
+      Variable.Volatile = (BOOLEAN)(StoreType == VariableStoreTypeVolatile);
 
-    Status = FindVariableEx (VariableName, VendorGuid, FALSE, &Variable, AuthFormat);
-    if (!EFI_ERROR (Status)) {
-      break;
+      Status = FindVariableEx (VariableName, VendorGuid, FALSE, &Variable, AuthFormat);
+      if (!EFI_ERROR (Status)) {
+        break;
+      }
     }
   }
 
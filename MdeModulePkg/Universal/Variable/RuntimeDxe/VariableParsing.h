@@ -280,6 +280,33 @@ FindVariableEx (
   IN     BOOLEAN                 AuthFormat
   );
 
+/**
+  Register the variable store covered by the boot time lookup index.
+
+  The index table is sized for the worst case variable count the store can
+  hold, so it never needs to grow afterwards.  If the allocation fails the
+  index simply stays disabled and lookups use the linear scan.
+
+  @param[in] VariableStoreHeader  Pointer to the variable store to be indexed.
+
+**/
+VOID
+VariableIndexRegisterStore (
+  IN VARIABLE_STORE_HEADER  *VariableStoreHeader
+  );
+
+/**
+  Invalidate the boot time lookup index after the indexed store is rewritten.
+
+  The table allocation is kept; the index is rebuilt from the store on the
+  next indexed lookup.
+
+**/
+VOID
+VariableIndexInvalidate (
+  VOID
+  );
+
 /**
   This code finds the next available variable.
 
@@ -290,6 +317,9 @@ FindVariableEx (
   @param[in]  VendorGuid        Variable Vendor Guid.
   @param[in]  VariableStoreList A list of variable stores that should be used to get the next variable.
                                 The maximum number of entries is the max value of VARIABLE_STORE_TYPE.
+  @param[in]  VariableHint      If not NULL, the variable header a sequential caller got back from
+                                the previous call.  When it still matches VariableName and
+                                VendorGuid, the linear re-find of the current position is skipped.
   @param[out] VariablePtr       Pointer to variable header address.
   @param[in]  AuthFormat        TRUE indicates authenticated variables are used.
                                 FALSE indicates authenticated variables are not used.
@@ -307,6 +337,7 @@ VariableServiceGetNextVariableInternal (
   IN  CHAR16                 *VariableName,
   IN  EFI_GUID               *VendorGuid,
   IN  VARIABLE_STORE_HEADER  **VariableStoreList,
+  IN  VARIABLE_HEADER        *VariableHint  OPTIONAL,
   OUT VARIABLE_HEADER        **VariablePtr,
   IN  BOOLEAN                AuthFormat
   );
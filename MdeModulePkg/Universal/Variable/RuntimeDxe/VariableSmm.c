@@ -462,6 +462,7 @@ SmmVariableHandler (
   EFI_STATUS                                               Status;
   SMM_VARIABLE_COMMUNICATE_HEADER                          *SmmVariableFunctionHeader;
   SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE                 *SmmVariableHeader;
+  SMM_VARIABLE_COMMUNICATE_BATCH_SET_VARIABLE              *BatchSetVariable;
   SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME          *GetNextVariableName;
   SMM_VARIABLE_COMMUNICATE_QUERY_VARIABLE_INFO             *QueryVariableInfo;
   SMM_VARIABLE_COMMUNICATE_GET_PAYLOAD_SIZE                *GetPayloadSize;
@@ -473,6 +474,8 @@ SmmVariableHandler (
   VARIABLE_RUNTIME_CACHE_CONTEXT                           *VariableCacheContext;
   VARIABLE_STORE_HEADER                                    *VariableCache;
   UINTN                                                    InfoSize;
+  UINTN                                                    EntrySize;
+  UINTN                                                    BatchIndex;
   UINTN                                                    NameBufferSize;
   UINTN                                                    CommBufferPayloadSize;
   UINTN                                                    TempCommBufferSize;
@@ -665,6 +668,89 @@ SmmVariableHandler (
                  );
       break;
 
+    case SMM_VARIABLE_FUNCTION_BATCH_SET_VARIABLE:
+      if (CommBufferPayloadSize < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_BATCH_SET_VARIABLE, Variables)) {
+        DEBUG ((DEBUG_ERROR, "BatchSetVariable: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      //
+      // Copy the input communicate buffer payload to pre-allocated SMM variable buffer payload.
+      //
+      CopyMem (mVariableBufferPayload, SmmVariableFunctionHeader->Data, CommBufferPayloadSize);
+      BatchSetVariable               = (SMM_VARIABLE_COMMUNICATE_BATCH_SET_VARIABLE *)mVariableBufferPayload;
+      BatchSetVariable->VariablesSet = 0;
+
+      Status   = EFI_SUCCESS;
+      InfoSize = OFFSET_OF (SMM_VARIABLE_COMMUNICATE_BATCH_SET_VARIABLE, Variables);
+      for (BatchIndex = 0; BatchIndex < BatchSetVariable->VariableCount; BatchIndex++) {
+        //
+        // The fixed part of each entry must lie completely inside the payload.
+        //
+        if ((InfoSize > CommBufferPayloadSize) ||
+            (CommBufferPayloadSize - InfoSize < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE, Name)))
+        {
+          DEBUG ((DEBUG_ERROR, "BatchSetVariable: Entry exceed communication buffer size limit!\n"));
+          Status = EFI_ACCESS_DENIED;
+          goto EXIT;
+        }
+
+        SmmVariableHeader = (SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE *)(mVariableBufferPayload + InfoSize);
+        if (((UINTN)(~0) - SmmVariableHeader->DataSize < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE, Name)) ||
+            ((UINTN)(~0) - SmmVariableHeader->NameSize < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE, Name) + SmmVariableHeader->DataSize))
+        {
+          //
+          // Prevent EntrySize overflow happen
+          //
+          Status = EFI_ACCESS_DENIED;
+          goto EXIT;
+        }
+
+        EntrySize = OFFSET_OF (SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE, Name)
+                    + SmmVariableHeader->DataSize + SmmVariableHeader->NameSize;
+
+        //
+        // SMRAM range check already covered before
+        // Data buffer should not contain SMM range
+        //
+        if (EntrySize > CommBufferPayloadSize - InfoSize) {
+          DEBUG ((DEBUG_ERROR, "BatchSetVariable: Data size exceed communication buffer size limit!\n"));
+          Status = EFI_ACCESS_DENIED;
+          goto EXIT;
+        }
+
+        //
+        // The VariableSpeculationBarrier() call here is to ensure the previous
+        // range/content checks for the CommBuffer have been completed before the
+        // subsequent consumption of the CommBuffer content.
+        //
+        VariableSpeculationBarrier ();
+        if ((SmmVariableHeader->NameSize < sizeof (CHAR16)) || (SmmVariableHeader->Name[SmmVariableHeader->NameSize/sizeof (CHAR16) - 1] != L'\0')) {
+          //
+          // Make sure VariableName is A Null-terminated string.
+          //
+          Status = EFI_ACCESS_DENIED;
+          goto EXIT;
+        }
+
+        Status = VariableServiceSetVariable (
+                   SmmVariableHeader->Name,
+                   &SmmVariableHeader->Guid,
+                   SmmVariableHeader->Attributes,
+                   SmmVariableHeader->DataSize,
+                   (UINT8 *)SmmVariableHeader->Name + SmmVariableHeader->NameSize
+                   );
+        if (EFI_ERROR (Status)) {
+          break;
+        }
+
+        BatchSetVariable->VariablesSet++;
+        InfoSize += ALIGN_VALUE (EntrySize, sizeof (UINTN));
+      }
+
+      CopyMem (SmmVariableFunctionHeader->Data, mVariableBufferPayload, OFFSET_OF (SMM_VARIABLE_COMMUNICATE_BATCH_SET_VARIABLE, Variables));
+      break;
+
     case SMM_VARIABLE_FUNCTION_QUERY_VARIABLE_INFO:
       if (CommBufferPayloadSize < sizeof (SMM_VARIABLE_COMMUNICATE_QUERY_VARIABLE_INFO)) {
         DEBUG ((DEBUG_ERROR, "QueryVariableInfo: SMM communication buffer size invalid!\n"));
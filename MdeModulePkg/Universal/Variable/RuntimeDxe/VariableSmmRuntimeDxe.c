@@ -53,6 +53,7 @@ VARIABLE_INFO_ENTRY             *mVariableInfo                       = NULL;
 VARIABLE_STORE_HEADER           *mVariableRuntimeHobCacheBuffer      = NULL;
 VARIABLE_STORE_HEADER           *mVariableRuntimeNvCacheBuffer       = NULL;
 VARIABLE_STORE_HEADER           *mVariableRuntimeVolatileCacheBuffer = NULL;
+VARIABLE_HEADER                 *mGetNextVariableHint                = NULL;
 UINTN                           mVariableBufferSize;
 UINTN                           mVariableRuntimeHobCacheBufferSize;
 UINTN                           mVariableRuntimeNvCacheBufferSize;
@@ -917,15 +918,23 @@ GetNextVariableNameInRuntimeCache (
     VariableStoreHeader[VariableStoreTypeHob]      = mVariableRuntimeHobCacheBuffer;
     VariableStoreHeader[VariableStoreTypeNv]       = mVariableRuntimeNvCacheBuffer;
 
+    //
+    // Pass the previously returned variable as a hint, so that a sequential
+    // enumeration resumes where it stopped instead of re-finding the current
+    // position with a linear scan over the cached stores.  The hint is
+    // re-validated against the current cache content before it is used.
+    //
     Status =  VariableServiceGetNextVariableInternal (
                 VariableName,
                 VendorGuid,
                 VariableStoreHeader,
+                mGetNextVariableHint,
                 &VariablePtr,
                 mVariableAuthFormat
                 );
     if (!EFI_ERROR (Status)) {
-      VarNameSize = NameSizeOfVariable (VariablePtr, mVariableAuthFormat);
+      mGetNextVariableHint = VariablePtr;
+      VarNameSize          = NameSizeOfVariable (VariablePtr, mVariableAuthFormat);
       ASSERT (VarNameSize != 0);
       if (VarNameSize <= *VariableNameSize) {
         CopyMem (VariableName, GetVariableNamePtr (VariablePtr, mVariableAuthFormat), VarNameSize);
@@ -1361,6 +1370,11 @@ VariableAddressChangeEvent (
   EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableRuntimeHobCacheBuffer);
   EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableRuntimeNvCacheBuffer);
   EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableRuntimeVolatileCacheBuffer);
+  //
+  // Drop the enumeration position hint instead of converting it; the next
+  // GetNextVariableName call simply re-finds its position.
+  //
+  mGetNextVariableHint = NULL;
 }
 
 /**
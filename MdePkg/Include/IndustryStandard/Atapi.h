@@ -680,6 +680,12 @@ typedef union {
 #define ATA_CMD_WRITE_DMA_WITH_RETRY  0xcb                     ///< defined from ATA-1, obsoleted from ATA-
 #define ATA_CMD_WRITE_DMA_EXT         0x35                     ///< defined from ATA-6
 
+//
+// Class 5: Native Command Queuing
+//
+#define ATA_CMD_READ_FPDMA_QUEUED   0x60                       ///< defined from SATA 1.0a
+#define ATA_CMD_WRITE_FPDMA_QUEUED  0x61                       ///< defined from SATA 1.0a
+
 //
 //  ATA Security commands
 //
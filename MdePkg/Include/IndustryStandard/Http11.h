@@ -75,6 +75,22 @@
 ///
 #define HTTP_HEADER_ACCEPT_RANGES  "Accept-Ranges"
 
+///
+/// Range Request Header
+/// The Range request-header field requests that the server transfer
+/// only the indicated sub-range(s) of the selected representation,
+/// as defined in RFC 7233.
+///
+#define HTTP_HEADER_RANGE  "Range"
+
+///
+/// Content-Range Response Header
+/// The Content-Range entity-header field is sent in a 206 (Partial
+/// Content) response to indicate which sub-range of the selected
+/// representation is enclosed in the message body.
+///
+#define HTTP_HEADER_CONTENT_RANGE  "Content-Range"
+
 ///
 /// Accept-Encoding Request Header
 /// The Accept-Encoding request-header field is similar to Accept,
@@ -8,6 +8,76 @@
 
 #include "BaseLibInternals.h"
 
+//
+// Bit tricks for scanning four CHAR16 characters at a time: the expression
+// UNICODE_WORD_HAS_ZERO_LANE (Word) is non-zero exactly when at least one
+// 16-bit lane of Word is zero. Aligned 64-bit reads cannot cross a page
+// boundary, so reading whole words never faults past the Null-terminator.
+//
+#define UNICODE_LANE_ONES   0x0001000100010001ULL
+#define UNICODE_LANE_HIGHS  0x8000800080008000ULL
+
+#define UNICODE_WORD_HAS_ZERO_LANE(Word) \
+  ((((Word) - UNICODE_LANE_ONES) & ~(Word) & UNICODE_LANE_HIGHS) != 0)
+
+/**
+  Returns a pointer to the first occurrence of Char in a Null-terminated
+  Unicode string, or to the Null-terminator if Char does not occur.
+
+  This internal function scans four CHAR16 characters at a time once the
+  string pointer is aligned on a 64-bit boundary.
+
+  @param  String  A pointer to a Null-terminated Unicode string.
+  @param  Char    The Unicode character to locate.
+
+  @return A pointer to the first occurrence of Char in String, or to the
+          Null-terminator of String if Char does not occur.
+
+**/
+CONST CHAR16 *
+InternalStrSearchChar (
+  IN      CONST CHAR16  *String,
+  IN      CHAR16        Char
+  )
+{
+  UINT64  Word;
+  UINT64  CharWord;
+
+  //
+  // Scan CHAR16-by-CHAR16 until String is aligned on a 64-bit boundary.
+  //
+  while (((UINTN)String & (sizeof (UINT64) - 1)) != 0) {
+    if ((*String == L'\0') || (*String == Char)) {
+      return String;
+    }
+
+    String++;
+  }
+
+  //
+  // Scan four CHAR16 at a time. XOR-ing with Char replicated into every
+  // lane turns an occurrence of Char into a zero lane.
+  //
+  CharWord = (UINT64)(UINT16)Char * UNICODE_LANE_ONES;
+  for ( ; ; String += sizeof (UINT64) / sizeof (CHAR16)) {
+    Word = *(CONST UINT64 *)String;
+    if (UNICODE_WORD_HAS_ZERO_LANE (Word) ||
+        UNICODE_WORD_HAS_ZERO_LANE (Word ^ CharWord))
+    {
+      break;
+    }
+  }
+
+  //
+  // Locate the hit within the word found above.
+  //
+  while ((*String != L'\0') && (*String != Char)) {
+    String++;
+  }
+
+  return String;
+}
+
 /**
   Returns the length of a Null-terminated Unicode string.
 
@@ -31,19 +101,52 @@ StrLen (
   IN      CONST CHAR16  *String
   )
 {
-  UINTN  Length;
+  UINTN   Length;
+  UINT64  Word;
 
   ASSERT (String != NULL);
   ASSERT (((UINTN)String & BIT0) == 0);
 
-  for (Length = 0; *String != L'\0'; String++, Length++) {
+  //
+  // Scan CHAR16-by-CHAR16 until String is aligned on a 64-bit boundary.
+  //
+  Length = 0;
+  while ((((UINTN)String & (sizeof (UINT64) - 1)) != 0) && (*String != L'\0')) {
+    String++;
+    Length++;
+  }
+
+  if (*String != L'\0') {
     //
-    // If PcdMaximumUnicodeStringLength is not zero,
-    // length should not more than PcdMaximumUnicodeStringLength
+    // Scan four CHAR16 at a time until the word holding the
+    // Null-terminator is found.
     //
-    if (PcdGet32 (PcdMaximumUnicodeStringLength) != 0) {
-      ASSERT (Length < PcdGet32 (PcdMaximumUnicodeStringLength));
+    for ( ; ; String += sizeof (UINT64) / sizeof (CHAR16), Length += sizeof (UINT64) / sizeof (CHAR16)) {
+      Word = *(CONST UINT64 *)String;
+      if (UNICODE_WORD_HAS_ZERO_LANE (Word)) {
+        break;
+      }
+
+      //
+      // If PcdMaximumUnicodeStringLength is not zero,
+      // length should not more than PcdMaximumUnicodeStringLength
+      //
+      if (PcdGet32 (PcdMaximumUnicodeStringLength) != 0) {
+        ASSERT (Length < PcdGet32 (PcdMaximumUnicodeStringLength));
+      }
     }
+
+    //
+    // Count the remaining characters in the terminating word.
+    //
+    while (*String != L'\0') {
+      String++;
+      Length++;
+    }
+  }
+
+  if (PcdGet32 (PcdMaximumUnicodeStringLength) != 0) {
+    ASSERT (Length <= PcdGet32 (PcdMaximumUnicodeStringLength));
   }
 
   return Length;
@@ -111,12 +214,40 @@ StrCmp (
   IN      CONST CHAR16  *SecondString
   )
 {
+  UINT64  FirstWord;
+  UINT64  SecondWord;
+
   //
   // ASSERT both strings are less long than PcdMaximumUnicodeStringLength
   //
   ASSERT (StrSize (FirstString) != 0);
   ASSERT (StrSize (SecondString) != 0);
 
+  //
+  // When both strings share the same misalignment, compare four CHAR16 at
+  // a time once they reach a 64-bit boundary. Any word that differs or
+  // contains the Null-terminator is resolved by the trailing
+  // CHAR16-by-CHAR16 loop.
+  //
+  if ((((UINTN)FirstString ^ (UINTN)SecondString) & (sizeof (UINT64) - 1)) == 0) {
+    while ((((UINTN)FirstString & (sizeof (UINT64) - 1)) != 0) &&
+           (*FirstString != L'\0') && (*FirstString == *SecondString))
+    {
+      FirstString++;
+      SecondString++;
+    }
+
+    if (((UINTN)FirstString & (sizeof (UINT64) - 1)) == 0) {
+      for ( ; ; FirstString += sizeof (UINT64) / sizeof (CHAR16), SecondString += sizeof (UINT64) / sizeof (CHAR16)) {
+        FirstWord  = *(CONST UINT64 *)FirstString;
+        SecondWord = *(CONST UINT64 *)SecondString;
+        if ((FirstWord != SecondWord) || UNICODE_WORD_HAS_ZERO_LANE (FirstWord)) {
+          break;
+        }
+      }
+    }
+  }
+
   while ((*FirstString != L'\0') && (*FirstString == *SecondString)) {
     FirstString++;
     SecondString++;
@@ -241,6 +372,15 @@ StrStr (
   }
 
   while (*String != L'\0') {
+    //
+    // Skip ahead to the next occurrence of the first search character;
+    // most candidate positions are rejected here four CHAR16 at a time.
+    //
+    String = InternalStrSearchChar (String, *SearchString);
+    if (*String == L'\0') {
+      return NULL;
+    }
+
     SearchStringTmp = SearchString;
     FirstMatch      = String;
 
@@ -77,15 +77,21 @@ CompareGuid (
 {
   UINT64  LowPartOfGuid1;
   UINT64  LowPartOfGuid2;
-  UINT64  HighPartOfGuid1;
-  UINT64  HighPartOfGuid2;
 
-  LowPartOfGuid1  = ReadUnaligned64 ((CONST UINT64 *)Guid1);
-  LowPartOfGuid2  = ReadUnaligned64 ((CONST UINT64 *)Guid2);
-  HighPartOfGuid1 = ReadUnaligned64 ((CONST UINT64 *)Guid1 + 1);
-  HighPartOfGuid2 = ReadUnaligned64 ((CONST UINT64 *)Guid2 + 1);
+  //
+  // GUID comparisons in linear scans (protocol database walks, FFS searches,
+  // HOB traversal) are dominated by mismatches, so only read the high 64 bits
+  // once the low 64 bits are known to match. ReadUnaligned64 is a cross-module
+  // call on most toolchains, and this halves those calls on the mismatch path.
+  //
+  LowPartOfGuid1 = ReadUnaligned64 ((CONST UINT64 *)Guid1);
+  LowPartOfGuid2 = ReadUnaligned64 ((CONST UINT64 *)Guid2);
+
+  if (LowPartOfGuid1 != LowPartOfGuid2) {
+    return FALSE;
+  }
 
-  return (BOOLEAN)(LowPartOfGuid1 == LowPartOfGuid2 && HighPartOfGuid1 == HighPartOfGuid2);
+  return (BOOLEAN)(ReadUnaligned64 ((CONST UINT64 *)Guid1 + 1) == ReadUnaligned64 ((CONST UINT64 *)Guid2 + 1));
 }
 
 /**
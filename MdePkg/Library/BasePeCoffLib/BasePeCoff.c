@@ -935,6 +935,7 @@ PeCoffLoaderRelocateImage (
   PHYSICAL_ADDRESS                     BaseAddress;
   UINT32                               NumberOfRvaAndSizes;
   UINT32                               TeStrippedOffset;
+  UINT64                               MaxFixupOffset;
 
   ASSERT (ImageContext != NULL);
 
@@ -1069,16 +1070,25 @@ PeCoffLoaderRelocateImage (
         return RETURN_LOAD_ERROR;
       }
 
+      //
+      // Every fixup in this block is a 12-bit offset from the block's page,
+      // so derive the image-bounds limit for those offsets once per block.
+      // Checking against it directly keeps the per-entry work to a compare
+      // and an add instead of a PeCoffLoaderImageAddress() call per fixup.
+      //
+      MaxFixupOffset = ImageContext->ImageSize + TeStrippedOffset - RelocBase->VirtualAddress;
+
       //
       // Run this relocation record
       //
       while ((UINTN)Reloc < (UINTN)RelocEnd) {
-        Fixup = PeCoffLoaderImageAddress (ImageContext, RelocBase->VirtualAddress + (*Reloc & 0xFFF), TeStrippedOffset);
-        if (Fixup == NULL) {
+        if ((*Reloc & 0xFFF) >= MaxFixupOffset) {
           ImageContext->ImageError = IMAGE_ERROR_FAILED_RELOCATION;
           return RETURN_LOAD_ERROR;
         }
 
+        Fixup = FixupBase + (*Reloc & 0xFFF);
+
         switch ((*Reloc) >> 12) {
           case EFI_IMAGE_REL_BASED_ABSOLUTE:
             break;
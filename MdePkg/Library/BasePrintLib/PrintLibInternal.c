@@ -676,6 +676,28 @@ BasePrintLibSPrintMarker (
       break;
     }
 
+    //
+    // Copy runs of ordinary format characters in a tight loop. Ordinary
+    // characters use none of the flag, width, precision, or argument handling
+    // below, so the run is emitted directly instead of one character per pass
+    // through the full conversion machinery.
+    //
+    if ((FormatCharacter != '%') && (FormatCharacter != '\r') && (FormatCharacter != '\n')) {
+      do {
+        LengthToReturn += BytesPerOutputCharacter;
+        if (((Flags & COUNT_ONLY_NO_PRINT) == 0) && (Buffer != NULL)) {
+          Buffer = BasePrintLibFillBuffer (Buffer, EndBuffer, 1, FormatCharacter, BytesPerOutputCharacter);
+        }
+
+        Format         += BytesPerFormatCharacter;
+        FormatCharacter = ((*Format & 0xff) | ((BytesPerFormatCharacter == 1) ? 0 : (*(Format + 1) << 8))) & FormatMask;
+      } while ((FormatCharacter != 0) &&
+               (FormatCharacter != '%') && (FormatCharacter != '\r') && (FormatCharacter != '\n') &&
+               ((Buffer == NULL) || (Buffer < EndBuffer)));
+
+      continue;
+    }
+
     //
     // Clear all the flag bits except those that may have been passed in
     //
@@ -556,12 +556,11 @@ Decode (
   SCRATCH_DATA  *Sd
   )
 {
-  UINT16  BytesRemain;
+  UINT32  BytesToCopy;
+  UINT32  ChunkSize;
   UINT32  DataIdx;
   UINT16  CharC;
 
-  BytesRemain = (UINT16)(-1);
-
   DataIdx = 0;
 
   for ( ; ;) {
@@ -594,31 +593,51 @@ Decode (
       //
       // Get string length
       //
-      BytesRemain = CharC;
+      BytesToCopy = CharC;
 
       //
       // Locate string position
       //
       DataIdx = Sd->mOutBuf - DecodeP (Sd) - 1;
 
+      if (Sd->mOutBuf >= Sd->mOrigSize) {
+        goto Done;
+      }
+
       //
-      // Write BytesRemain of bytes into mDstBase
+      // A string can only reference data already produced, so an index at
+      // or beyond the output cursor means the position value wrapped around
+      // on corrupted source data.
       //
-      BytesRemain--;
+      if (DataIdx >= Sd->mOutBuf) {
+        Sd->mBadTableFlag = (UINT16)BAD_TABLE;
+        goto Done;
+      }
 
-      while ((INT16)(BytesRemain) >= 0) {
-        if (Sd->mOutBuf >= Sd->mOrigSize) {
-          goto Done;
-        }
+      //
+      // Truncate the string to the room left in the output buffer.
+      //
+      if (BytesToCopy > Sd->mOrigSize - Sd->mOutBuf) {
+        BytesToCopy = Sd->mOrigSize - Sd->mOutBuf;
+      }
 
-        if (DataIdx >= Sd->mOrigSize) {
-          Sd->mBadTableFlag = (UINT16)BAD_TABLE;
-          goto Done;
+      //
+      // Expand the string with block copies instead of one byte at a time.
+      // The string may overlap its own expansion when its distance is
+      // shorter than its length; the output is then periodic in the
+      // distance, so copying at most (mOutBuf - DataIdx) bytes per pass
+      // from the original index stays within already-produced data and
+      // doubles the copyable span on every pass.
+      //
+      while (BytesToCopy > 0) {
+        ChunkSize = Sd->mOutBuf - DataIdx;
+        if (ChunkSize > BytesToCopy) {
+          ChunkSize = BytesToCopy;
         }
 
-        Sd->mDstBase[Sd->mOutBuf++] = Sd->mDstBase[DataIdx++];
-
-        BytesRemain--;
+        CopyMem (Sd->mDstBase + Sd->mOutBuf, Sd->mDstBase + DataIdx, ChunkSize);
+        Sd->mOutBuf += ChunkSize;
+        BytesToCopy -= ChunkSize;
       }
 
       //
@@ -0,0 +1,653 @@
+/** @file
+  DXE Debug library instance that buffers messages in memory and drains them
+  to the serial port from a periodic timer callback, so DEBUG() callers are
+  not stalled by the UART baud rate.  The buffer is flushed synchronously on
+  DebugAssert() and at ExitBootServices() so no message is lost on the paths
+  where it matters.
+
+  NOTE: Each module that links this instance owns a private message buffer
+  and flush timer, so messages from different modules may interleave on the
+  serial port at a coarser granularity than with the synchronous instances.
+  Before the library constructor has run, or if the buffer cannot be
+  allocated, output falls back to synchronous writes.
+
+  Copyright (c) 2006 - 2019, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include <Uefi.h>
+#include <Library/DebugLib.h>
+#include <Library/BaseLib.h>
+#include <Library/PrintLib.h>
+#include <Library/PcdLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/SerialPortLib.h>
+#include <Library/DebugPrintErrorLevelLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+//
+// Define the maximum debug and assert message length that this library supports
+//
+#define MAX_DEBUG_MESSAGE_LENGTH  0x100
+
+//
+// Period of the flush timer in 100 ns units (10 ms), and the maximum number
+// of bytes written to the serial port from a single timer callback so each
+// callback stays short.
+//
+#define FLUSH_TIMER_PERIOD       100000
+#define MAX_BYTES_PER_FLUSH      256
+
+//
+// VA_LIST can not initialize to NULL for all compiler, so we use this to
+// indicate a null VA_LIST
+//
+VA_LIST  mVaListNull;
+
+//
+// Circular message buffer.  mBufferHead is the next byte to drain and
+// mBufferCount the number of pending bytes; both are only updated at
+// TPL_HIGH_LEVEL.  mBuffer is NULL until the constructor has run, and is
+// reset to NULL once buffering must stop, which routes output back to
+// synchronous SerialPortWrite() calls.
+//
+STATIC UINT8      *mBuffer = NULL;
+STATIC UINTN      mBufferSize;
+STATIC UINTN      mBufferHead;
+STATIC UINTN      mBufferCount;
+STATIC BOOLEAN    mMessagesDropped;
+STATIC EFI_EVENT  mFlushTimerEvent;
+STATIC EFI_EVENT  mExitBootServicesEvent;
+
+/**
+  Appends data to the message buffer, dropping the oldest buffered bytes if
+  there is not enough free space.  Falls back to a synchronous serial port
+  write when buffering is not active.
+
+  @param  Data    The data to append.
+  @param  Length  The number of bytes to append.
+
+**/
+STATIC
+VOID
+BufferedWrite (
+  IN CONST UINT8  *Data,
+  IN UINTN        Length
+  )
+{
+  EFI_TPL  OldTpl;
+  UINTN    Drop;
+  UINTN    Tail;
+  UINTN    Contiguous;
+
+  if (mBuffer == NULL) {
+    SerialPortWrite ((UINT8 *)Data, Length);
+    return;
+  }
+
+  //
+  // Keep only the tail of a message larger than the whole buffer
+  //
+  if (Length > mBufferSize) {
+    Data            += Length - mBufferSize;
+    Length           = mBufferSize;
+    mMessagesDropped = TRUE;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  //
+  // Drop the oldest buffered bytes to make room for the new message
+  //
+  if (Length > mBufferSize - mBufferCount) {
+    Drop             = Length - (mBufferSize - mBufferCount);
+    mBufferHead      = (mBufferHead + Drop) % mBufferSize;
+    mBufferCount    -= Drop;
+    mMessagesDropped = TRUE;
+  }
+
+  Tail       = (mBufferHead + mBufferCount) % mBufferSize;
+  Contiguous = mBufferSize - Tail;
+  if (Contiguous > Length) {
+    Contiguous = Length;
+  }
+
+  CopyMem (&mBuffer[Tail], Data, Contiguous);
+  if (Length > Contiguous) {
+    CopyMem (mBuffer, Data + Contiguous, Length - Contiguous);
+  }
+
+  mBufferCount += Length;
+
+  gBS->RestoreTPL (OldTpl);
+}
+
+/**
+  Drains up to MaxBytes buffered bytes to the serial port.  The buffer state
+  is only touched at TPL_HIGH_LEVEL; the serial port writes are issued at the
+  caller's TPL so interrupts are not blocked for the duration of the UART
+  transfer.
+
+  @param  MaxBytes  The maximum number of bytes to write to the serial port.
+
+**/
+STATIC
+VOID
+BufferedFlush (
+  IN UINTN  MaxBytes
+  )
+{
+  UINT8    Chunk[64];
+  EFI_TPL  OldTpl;
+  UINTN    Length;
+  BOOLEAN  Dropped;
+
+  if (mBuffer == NULL) {
+    return;
+  }
+
+  while (MaxBytes > 0) {
+    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+    Dropped          = mMessagesDropped;
+    mMessagesDropped = FALSE;
+
+    Length = mBufferCount;
+    if (Length > sizeof (Chunk)) {
+      Length = sizeof (Chunk);
+    }
+
+    if (Length > MaxBytes) {
+      Length = MaxBytes;
+    }
+
+    //
+    // Only drain up to the physical end of the buffer in one pass
+    //
+    if (Length > mBufferSize - mBufferHead) {
+      Length = mBufferSize - mBufferHead;
+    }
+
+    CopyMem (Chunk, &mBuffer[mBufferHead], Length);
+    mBufferHead   = (mBufferHead + Length) % mBufferSize;
+    mBufferCount -= Length;
+
+    gBS->RestoreTPL (OldTpl);
+
+    if (Dropped) {
+      SerialPortWrite ((UINT8 *)"[DebugLib: buffered messages dropped]\r\n", 39);
+    }
+
+    if (Length == 0) {
+      break;
+    }
+
+    SerialPortWrite (Chunk, Length);
+    MaxBytes -= Length;
+  }
+}
+
+/**
+  Periodic timer callback that trickles buffered messages to the serial port.
+
+  @param[in]  Event   The Event that is being processed.
+  @param[in]  Context The Event Context.
+
+**/
+STATIC
+VOID
+EFIAPI
+FlushTimerNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  BufferedFlush (MAX_BYTES_PER_FLUSH);
+}
+
+/**
+  Flushes all buffered messages and disables buffering before the firmware
+  hands the platform over to the OS, so late messages go straight to the
+  serial port.
+
+  @param[in]  Event   The Event that is being processed.
+  @param[in]  Context The Event Context.
+
+**/
+STATIC
+VOID
+EFIAPI
+ExitBootServicesNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  gBS->SetTimer (mFlushTimerEvent, TimerCancel, 0);
+  BufferedFlush ((UINTN)-1);
+  mBuffer = NULL;
+}
+
+/**
+  The constructor function initializes the Serial Port library, allocates the
+  message buffer, and starts the periodic flush timer.  If the buffer or the
+  events cannot be created the library degrades to synchronous output.
+
+  @param[in]  ImageHandle   The firmware allocated handle for the EFI image.
+  @param[in]  SystemTable   A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS   The constructor completed successfully.
+  @return Other         The serial port failed to initialize.
+
+**/
+EFI_STATUS
+EFIAPI
+DxeBufferedDebugLibSerialPortConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Buffer;
+
+  Status = SerialPortInitialize ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Buffer = AllocatePool (PcdGet32 (PcdDebugBufferedMessageBufferSize));
+  if (Buffer == NULL) {
+    return EFI_SUCCESS;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  FlushTimerNotify,
+                  NULL,
+                  &mFlushTimerEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    FreePool (Buffer);
+    return EFI_SUCCESS;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_SIGNAL_EXIT_BOOT_SERVICES,
+                  TPL_NOTIFY,
+                  ExitBootServicesNotify,
+                  NULL,
+                  &mExitBootServicesEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (mFlushTimerEvent);
+    FreePool (Buffer);
+    return EFI_SUCCESS;
+  }
+
+  mBufferSize      = PcdGet32 (PcdDebugBufferedMessageBufferSize);
+  mBufferHead      = 0;
+  mBufferCount     = 0;
+  mMessagesDropped = FALSE;
+  mBuffer          = Buffer;
+
+  gBS->SetTimer (mFlushTimerEvent, TimerPeriodic, FLUSH_TIMER_PERIOD);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  The destructor function flushes any buffered messages and frees the
+  resources owned by the library before the hosting module unloads.
+
+  @param[in]  ImageHandle   The firmware allocated handle for the EFI image.
+  @param[in]  SystemTable   A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS   The destructor completed successfully.
+
+**/
+EFI_STATUS
+EFIAPI
+DxeBufferedDebugLibSerialPortDestructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  UINT8  *Buffer;
+
+  if (mBuffer == NULL) {
+    return EFI_SUCCESS;
+  }
+
+  gBS->SetTimer (mFlushTimerEvent, TimerCancel, 0);
+  BufferedFlush ((UINTN)-1);
+
+  Buffer  = mBuffer;
+  mBuffer = NULL;
+
+  gBS->CloseEvent (mFlushTimerEvent);
+  gBS->CloseEvent (mExitBootServicesEvent);
+  FreePool (Buffer);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Prints a debug message to the debug output device if the specified error level is enabled.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and the
+  associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel  The error level of the debug message.
+  @param  Format      Format string for the debug message to print.
+  @param  ...         Variable argument list whose contents are accessed
+                      based on the format string specified by Format.
+
+**/
+VOID
+EFIAPI
+DebugPrint (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  ...
+  )
+{
+  VA_LIST  Marker;
+
+  VA_START (Marker, Format);
+  DebugVPrint (ErrorLevel, Format, Marker);
+  VA_END (Marker);
+}
+
+/**
+  Prints a debug message to the debug output device if the specified
+  error level is enabled base on Null-terminated format string and a
+  VA_LIST argument list or a BASE_LIST argument list.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and
+  the associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel      The error level of the debug message.
+  @param  Format          Format string for the debug message to print.
+  @param  VaListMarker    VA_LIST marker for the variable argument list.
+  @param  BaseListMarker  BASE_LIST marker for the variable argument list.
+
+**/
+VOID
+DebugPrintMarker (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  IN  VA_LIST      VaListMarker,
+  IN  BASE_LIST    BaseListMarker
+  )
+{
+  CHAR8  Buffer[MAX_DEBUG_MESSAGE_LENGTH];
+
+  //
+  // If Format is NULL, then ASSERT().
+  //
+  ASSERT (Format != NULL);
+
+  //
+  // Check driver debug mask value and global mask
+  //
+  if ((ErrorLevel & GetDebugPrintErrorLevel ()) == 0) {
+    return;
+  }
+
+  //
+  // Convert the DEBUG() message to an ASCII String
+  //
+  if (BaseListMarker == NULL) {
+    AsciiVSPrint (Buffer, sizeof (Buffer), Format, VaListMarker);
+  } else {
+    AsciiBSPrint (Buffer, sizeof (Buffer), Format, BaseListMarker);
+  }
+
+  //
+  // Append the print string to the message buffer
+  //
+  BufferedWrite ((UINT8 *)Buffer, AsciiStrLen (Buffer));
+}
+
+/**
+  Prints a debug message to the debug output device if the specified
+  error level is enabled.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and
+  the associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel    The error level of the debug message.
+  @param  Format        Format string for the debug message to print.
+  @param  VaListMarker  VA_LIST marker for the variable argument list.
+
+**/
+VOID
+EFIAPI
+DebugVPrint (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  IN  VA_LIST      VaListMarker
+  )
+{
+  DebugPrintMarker (ErrorLevel, Format, VaListMarker, NULL);
+}
+
+/**
+  Prints a debug message to the debug output device if the specified
+  error level is enabled.
+  This function use BASE_LIST which would provide a more compatible
+  service than VA_LIST.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and
+  the associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel      The error level of the debug message.
+  @param  Format          Format string for the debug message to print.
+  @param  BaseListMarker  BASE_LIST marker for the variable argument list.
+
+**/
+VOID
+EFIAPI
+DebugBPrint (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  IN  BASE_LIST    BaseListMarker
+  )
+{
+  DebugPrintMarker (ErrorLevel, Format, mVaListNull, BaseListMarker);
+}
+
+/**
+  Prints an assert message containing a filename, line number, and description.
+  This may be followed by a breakpoint or a dead loop.
+
+  Print a message of the form "ASSERT <FileName>(<LineNumber>): <Description>\n"
+  to the debug output device.  If DEBUG_PROPERTY_ASSERT_BREAKPOINT_ENABLED bit of
+  PcdDebugProperyMask is set then CpuBreakpoint() is called. Otherwise, if
+  DEBUG_PROPERTY_ASSERT_DEADLOOP_ENABLED bit of PcdDebugProperyMask is set then
+  CpuDeadLoop() is called.  If neither of these bits are set, then this function
+  returns immediately after the message is printed to the debug output device.
+  DebugAssert() must actively prevent recursion.  If DebugAssert() is called while
+  processing another DebugAssert(), then DebugAssert() must return immediately.
+
+  If FileName is NULL, then a <FileName> string of "(NULL) Filename" is printed.
+  If Description is NULL, then a <Description> string of "(NULL) Description" is printed.
+
+  @param  FileName     The pointer to the name of the source file that generated the assert condition.
+  @param  LineNumber   The line number in the source file that generated the assert condition
+  @param  Description  The pointer to the description of the assert condition.
+
+**/
+VOID
+EFIAPI
+DebugAssert (
+  IN CONST CHAR8  *FileName,
+  IN UINTN        LineNumber,
+  IN CONST CHAR8  *Description
+  )
+{
+  CHAR8  Buffer[MAX_DEBUG_MESSAGE_LENGTH];
+
+  //
+  // Generate the ASSERT() message in Ascii format
+  //
+  AsciiSPrint (Buffer, sizeof (Buffer), "ASSERT [%a] %a(%d): %a\n", gEfiCallerBaseName, FileName, LineNumber, Description);
+
+  //
+  // Drain all buffered messages and send the assert message synchronously,
+  // so the serial log is complete if the breakpoint or dead loop is taken
+  //
+  BufferedFlush ((UINTN)-1);
+  SerialPortWrite ((UINT8 *)Buffer, AsciiStrLen (Buffer));
+
+  //
+  // Generate a Breakpoint, DeadLoop, or NOP based on PCD settings
+  //
+  if ((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_ASSERT_BREAKPOINT_ENABLED) != 0) {
+    CpuBreakpoint ();
+  } else if ((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_ASSERT_DEADLOOP_ENABLED) != 0) {
+    CpuDeadLoop ();
+  }
+}
+
+/**
+  Fills a target buffer with PcdDebugClearMemoryValue, and returns the target buffer.
+
+  This function fills Length bytes of Buffer with the value specified by
+  PcdDebugClearMemoryValue, and returns Buffer.
+
+  If Buffer is NULL, then ASSERT().
+  If Length is greater than (MAX_ADDRESS - Buffer + 1), then ASSERT().
+
+  @param   Buffer  The pointer to the target buffer to be filled with PcdDebugClearMemoryValue.
+  @param   Length  The number of bytes in Buffer to fill with zeros PcdDebugClearMemoryValue.
+
+  @return  Buffer  The pointer to the target buffer filled with PcdDebugClearMemoryValue.
+
+**/
+VOID *
+EFIAPI
+DebugClearMemory (
+  OUT VOID  *Buffer,
+  IN UINTN  Length
+  )
+{
+  //
+  // If Buffer is NULL, then ASSERT().
+  //
+  ASSERT (Buffer != NULL);
+
+  //
+  // SetMem() checks for the the ASSERT() condition on Length and returns Buffer
+  //
+  return SetMem (Buffer, Length, PcdGet8 (PcdDebugClearMemoryValue));
+}
+
+/**
+  Returns TRUE if ASSERT() macros are enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugAssertEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if DEBUG() macros are enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_DEBUG_PRINT_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_DEBUG_PRINT_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_DEBUG_PRINT_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugPrintEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_DEBUG_PRINT_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if DEBUG_CODE() macros are enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_DEBUG_CODE_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_DEBUG_CODE_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_DEBUG_CODE_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugCodeEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_DEBUG_CODE_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if DEBUG_CLEAR_MEMORY() macro is enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugClearMemoryEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if any one of the bit is set both in ErrorLevel and PcdFixedDebugPrintErrorLevel.
+
+  This function compares the bit mask of ErrorLevel and PcdFixedDebugPrintErrorLevel.
+
+  @retval  TRUE    Current ErrorLevel is supported.
+  @retval  FALSE   Current ErrorLevel is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+DebugPrintLevelEnabled (
+  IN  CONST UINTN  ErrorLevel
+  )
+{
+  return (BOOLEAN)((ErrorLevel & PcdGet32 (PcdFixedDebugPrintErrorLevel)) != 0);
+}
@@ -14,9 +14,28 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/UefiLib.h>
 #include <Library/DebugLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
 
 VOID  *mHobList = NULL;
 
+///
+/// Entry of the GUID HOB index: the first GUID extension HOB carrying Name.
+///
+typedef struct {
+  EFI_GUID    Name;
+  VOID        *Hob;
+} GUID_HOB_INDEX_ENTRY;
+
+///
+/// Index of the GUID extension HOBs, sorted by GUID and built lazily on the
+/// first GetFirstGuidHob() call.  The HOB list is read-only in the DXE phase,
+/// so the index never goes stale once built, and a missing GUID in the index
+/// means the GUID HOB is not present at all.
+///
+GUID_HOB_INDEX_ENTRY  *mGuidHobIndex     = NULL;
+UINTN                 mGuidHobIndexCount = 0;
+BOOLEAN               mGuidHobIndexValid = FALSE;
+
 /**
   Returns the pointer to the HOB list.
 
@@ -185,6 +204,124 @@ GetNextGuidHob (
   return GuidHob.Raw;
 }
 
+/**
+  Builds the GUID HOB index from the HOB list.
+
+  This function walks the HOB list once and records the first instance of
+  each GUID extension HOB in an array sorted by GUID.  If the pool memory
+  for the index is not available, the index is left unbuilt and lookups
+  keep walking the HOB list.
+
+**/
+VOID
+InternalBuildGuidHobIndex (
+  VOID
+  )
+{
+  EFI_PEI_HOB_POINTERS  Hob;
+  UINTN                 Count;
+  UINTN                 Low;
+  UINTN                 High;
+  UINTN                 Middle;
+  INTN                  Result;
+
+  Count = 0;
+  for (Hob.Raw = GetHobList (); !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    if (Hob.Header->HobType == EFI_HOB_TYPE_GUID_EXTENSION) {
+      Count++;
+    }
+  }
+
+  if (Count != 0) {
+    mGuidHobIndex = AllocatePool (sizeof (GUID_HOB_INDEX_ENTRY) * Count);
+    if (mGuidHobIndex == NULL) {
+      return;
+    }
+  }
+
+  for (Hob.Raw = GetHobList (); !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    if (Hob.Header->HobType != EFI_HOB_TYPE_GUID_EXTENSION) {
+      continue;
+    }
+
+    //
+    // Binary search for the insertion point.  Only the first instance of
+    // each GUID is recorded, which is the one GetFirstGuidHob() returns.
+    //
+    Low  = 0;
+    High = mGuidHobIndexCount;
+    while (Low < High) {
+      Middle = (Low + High) / 2;
+      Result = CompareMem (&Hob.Guid->Name, &mGuidHobIndex[Middle].Name, sizeof (EFI_GUID));
+      if (Result == 0) {
+        break;
+      }
+
+      if (Result < 0) {
+        High = Middle;
+      } else {
+        Low = Middle + 1;
+      }
+    }
+
+    if (Low < High) {
+      //
+      // Already indexed by an earlier instance.
+      //
+      continue;
+    }
+
+    CopyMem (
+      &mGuidHobIndex[Low + 1],
+      &mGuidHobIndex[Low],
+      sizeof (GUID_HOB_INDEX_ENTRY) * (mGuidHobIndexCount - Low)
+      );
+    CopyGuid (&mGuidHobIndex[Low].Name, &Hob.Guid->Name);
+    mGuidHobIndex[Low].Hob = Hob.Raw;
+    mGuidHobIndexCount++;
+  }
+
+  mGuidHobIndexValid = TRUE;
+}
+
+/**
+  Searches the GUID HOB index for the first instance of a GUID HOB.
+
+  @param  Guid          The GUID to match with in the HOB list.
+
+  @return The first instance of the matched GUID HOB, or NULL if the GUID
+          is not present in the HOB list.
+
+**/
+VOID *
+InternalGetGuidHobFromIndex (
+  IN CONST EFI_GUID  *Guid
+  )
+{
+  UINTN  Low;
+  UINTN  High;
+  UINTN  Middle;
+  INTN   Result;
+
+  Low  = 0;
+  High = mGuidHobIndexCount;
+  while (Low < High) {
+    Middle = (Low + High) / 2;
+    Result = CompareMem (Guid, &mGuidHobIndex[Middle].Name, sizeof (EFI_GUID));
+    if (Result == 0) {
+      return mGuidHobIndex[Middle].Hob;
+    }
+
+    if (Result < 0) {
+      High = Middle;
+    } else {
+      Low = Middle + 1;
+    }
+  }
+
+  return NULL;
+}
+
 /**
   Returns the first instance of the matched GUID HOB among the whole HOB list.
 
@@ -212,6 +349,14 @@ GetFirstGuidHob (
   VOID  *HobList;
 
   HobList = GetHobList ();
+  if (!mGuidHobIndexValid) {
+    InternalBuildGuidHobIndex ();
+  }
+
+  if (mGuidHobIndexValid) {
+    return InternalGetGuidHobFromIndex (Guid);
+  }
+
   return GetNextGuidHob (Guid, HobList);
 }
 
@@ -533,37 +533,57 @@ UefiDevicePathLibAppendDevicePathNode (
   IN CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePathNode  OPTIONAL
   )
 {
-  EFI_DEVICE_PATH_PROTOCOL  *TempDevicePath;
-  EFI_DEVICE_PATH_PROTOCOL  *NextNode;
   EFI_DEVICE_PATH_PROTOCOL  *NewDevicePath;
+  EFI_DEVICE_PATH_PROTOCOL  *EndNode;
   UINTN                     NodeLength;
+  UINTN                     Size1;
+  UINTN                     Size;
 
   if (DevicePathNode == NULL) {
     return DuplicateDevicePath ((DevicePath != NULL) ? DevicePath : &mUefiDevicePathLibEndDevicePath);
   }
 
   //
-  // Build a Node that has a terminator on it
+  // Reject a malformed node whose length field is smaller than the node
+  // header, as IsDevicePathValid () would when the node travels through
+  // AppendDevicePath ().
   //
   NodeLength = DevicePathNodeLength (DevicePathNode);
-
-  TempDevicePath = AllocatePool (NodeLength + END_DEVICE_PATH_LENGTH);
-  if (TempDevicePath == NULL) {
+  if (NodeLength < sizeof (EFI_DEVICE_PATH_PROTOCOL)) {
     return NULL;
   }
 
-  TempDevicePath = CopyMem (TempDevicePath, DevicePathNode, NodeLength);
-  //
-  // Add and end device path node to convert Node to device path
-  //
-  NextNode = NextDevicePathNode (TempDevicePath);
-  SetDevicePathEndNode (NextNode);
+  if (DevicePath == NULL) {
+    Size1 = END_DEVICE_PATH_LENGTH;
+  } else {
+    if (!IsDevicePathValid (DevicePath, 0)) {
+      return NULL;
+    }
+
+    Size1 = GetDevicePathSize (DevicePath);
+  }
+
   //
-  // Append device paths
+  // Build the new device path directly in its final buffer. Appending a node
+  // is the hot path of bus driver enumeration, so avoid the temporary
+  // node-plus-terminator path and the second allocation and copy that
+  // AppendDevicePath would perform.
   //
-  NewDevicePath = AppendDevicePath (DevicePath, TempDevicePath);
+  Size          = Size1 + NodeLength;
+  NewDevicePath = AllocatePool (Size);
+
+  if (NewDevicePath != NULL) {
+    if (DevicePath != NULL) {
+      CopyMem (NewDevicePath, DevicePath, Size1 - END_DEVICE_PATH_LENGTH);
+    }
 
-  FreePool (TempDevicePath);
+    CopyMem ((UINT8 *)NewDevicePath + (Size1 - END_DEVICE_PATH_LENGTH), DevicePathNode, NodeLength);
+    //
+    // Add an end device path node after the appended node
+    //
+    EndNode = (EFI_DEVICE_PATH_PROTOCOL *)((UINT8 *)NewDevicePath + (Size - END_DEVICE_PATH_LENGTH));
+    SetDevicePathEndNode (EndNode);
+  }
 
   return NewDevicePath;
 }
@@ -230,17 +230,12 @@ ArpOnFrameRcvdDpc (
     MergeFlag             = TRUE;
   }
 
-  if (!IsTarget) {
-    //
-    // This arp packet isn't targeted to us, skip now.
-    //
-    goto RECYCLE_RXDATA;
-  }
-
   if (!MergeFlag) {
     //
-    // Add the triplet <protocol type, sender protocol address, sender hardware address>
-    // to the translation table.
+    // Check whether the sender answers one of the pending requests. This is
+    // checked before the target address test, so a gratuitous announcement
+    // sent by the very host being resolved completes the pending request
+    // immediately instead of waiting for a retry round trip.
     //
     CacheEntry = ArpFindNextCacheEntryInTable (
                    &ArpService->PendingRequestTable,
@@ -249,9 +244,10 @@ ArpOnFrameRcvdDpc (
                    &SenderAddress[Protocol],
                    NULL
                    );
-    if (CacheEntry == NULL) {
+    if ((CacheEntry == NULL) && IsTarget) {
       //
-      // Allocate a new CacheEntry.
+      // Allocate a new CacheEntry to add the triplet <protocol type, sender
+      // protocol address, sender hardware address> to the translation table.
       //
       CacheEntry = ArpAllocCacheEntry (NULL);
       if (CacheEntry == NULL) {
@@ -259,28 +255,37 @@ ArpOnFrameRcvdDpc (
       }
     }
 
-    if (!IsListEmpty (&CacheEntry->List)) {
-      RemoveEntryList (&CacheEntry->List);
-    }
+    if (CacheEntry != NULL) {
+      if (!IsListEmpty (&CacheEntry->List)) {
+        RemoveEntryList (&CacheEntry->List);
+      }
 
-    //
-    // Fill the addresses into the CacheEntry.
-    //
-    ArpFillAddressInCacheEntry (
-      CacheEntry,
-      &SenderAddress[Hardware],
-      &SenderAddress[Protocol]
-      );
+      //
+      // Fill the addresses into the CacheEntry.
+      //
+      ArpFillAddressInCacheEntry (
+        CacheEntry,
+        &SenderAddress[Hardware],
+        &SenderAddress[Protocol]
+        );
 
-    //
-    // Inform the user.
-    //
-    ArpAddressResolved (CacheEntry, NULL, NULL);
+      //
+      // Inform the user.
+      //
+      ArpAddressResolved (CacheEntry, NULL, NULL);
 
+      //
+      // Add this entry into the ResolvedCacheTable
+      //
+      InsertHeadList (&ArpService->ResolvedCacheTable, &CacheEntry->List);
+    }
+  }
+
+  if (!IsTarget) {
     //
-    // Add this entry into the ResolvedCacheTable
+    // This arp packet isn't targeted to us, skip now.
     //
-    InsertHeadList (&ArpService->ResolvedCacheTable, &CacheEntry->List);
+    goto RECYCLE_RXDATA;
   }
 
   if (Head->OpCode == ARP_OPCODE_REQUEST) {
@@ -807,6 +807,26 @@ EfiDhcp4Start (
     goto ON_ERROR;
   }
 
+  //
+  // When starting from scratch, seed the INIT-REBOOT path with the lease
+  // this driver cached earlier in this boot, if there is one for this
+  // NIC. One REQUEST/ACK exchange then replaces the DISCOVER sequence;
+  // a NAK or an unanswered REQUEST falls back to Dhcp4Init.
+  //
+  // Never seed a session that registered a Dhcp4Callback: such consumers
+  // (PXE, HTTP boot) collect and select offers through the Dhcp4RcvdOffer
+  // and Dhcp4SelectOffer events of the Dhcp4Selecting state, and a
+  // session that jumps straight to Dhcp4Rebooting completes without ever
+  // firing them, leaving the consumer without the offer it requires.
+  //
+  if ((DhcpSb->DhcpState == Dhcp4Init) &&
+      (DhcpSb->ActiveConfig.Dhcp4Callback == NULL) &&
+      DhcpLoadLeaseCache (DhcpSb))
+  {
+    DhcpSb->DhcpState      = Dhcp4InitReboot;
+    DhcpSb->LeaseFromCache = TRUE;
+  }
+
   DhcpSb->IoStatus = EFI_ALREADY_STARTED;
 
   if (EFI_ERROR (Status = DhcpInitRequest (DhcpSb))) {
@@ -1033,6 +1053,12 @@ EfiDhcp4Release (
       Status = EFI_DEVICE_ERROR;
       goto ON_EXIT;
     }
+
+    //
+    // The lease has been given back to the server, don't offer it to
+    // later sessions.
+    //
+    DhcpClearLeaseCache ();
   }
 
   DhcpCleanLease (DhcpSb);
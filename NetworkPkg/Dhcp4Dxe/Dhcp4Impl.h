@@ -22,6 +22,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DebugLib.h>
 #include <Library/UefiDriverEntryPoint.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 #include <Library/UefiLib.h>
 #include <Library/BaseLib.h>
 #include <Library/NetLib.h>
@@ -48,6 +49,22 @@ typedef struct _DHCP_PROTOCOL  DHCP_PROTOCOL;
 #define DHCP_CONFIGED    1
 #define DHCP_DESTROY     2
 
+//
+// The last acquired lease is saved in a volatile variable under
+// gEfiCallerIdGuid. When a later DHCP session on the same NIC starts
+// from scratch, the cached lease seeds the INIT-REBOOT path (RFC 2131)
+// so one REQUEST/ACK exchange replaces the full DISCOVER sequence.
+//
+#define DHCP_LEASE_CACHE_VARIABLE_NAME  L"Dhcp4LeaseCache"
+
+typedef struct {
+  EFI_MAC_ADDRESS    Mac;
+  UINT8              HwLen;
+  IP4_ADDR           ClientAddr;
+  IP4_ADDR           Netmask;
+  IP4_ADDR           ServerAddr;
+} DHCP_LEASE_CACHE;
+
 struct _DHCP_PROTOCOL {
   UINT32                              Signature;
   EFI_DHCP4_PROTOCOL                  Dhcp4Protocol;
@@ -91,6 +108,8 @@ struct _DHCP_SERVICE {
   IP4_ADDR                        Netmask;
   IP4_ADDR                        ServerAddr;
 
+  BOOLEAN                         LeaseFromCache; // ClientAddr was seeded from the lease cache variable
+
   EFI_DHCP4_PACKET                *LastOffer; // The last received offer
   EFI_DHCP4_PACKET                *Selected;
   DHCP_PARAMETER                  *Para;
@@ -359,6 +359,112 @@ DhcpConfigLeaseIoPort (
   return EFI_SUCCESS;
 }
 
+/**
+  Save the acquired lease to the volatile lease cache variable.
+
+  The variable is best effort: a failure to save only costs a later
+  session the INIT-REBOOT shortcut, so the status is ignored.
+
+  @param  DhcpSb                The DHCP service instance.
+
+**/
+VOID
+DhcpSaveLeaseCache (
+  IN DHCP_SERVICE  *DhcpSb
+  )
+{
+  DHCP_LEASE_CACHE  Cache;
+
+  ZeroMem (&Cache, sizeof (DHCP_LEASE_CACHE));
+  CopyMem (&Cache.Mac, &DhcpSb->Mac, sizeof (EFI_MAC_ADDRESS));
+
+  Cache.HwLen      = DhcpSb->HwLen;
+  Cache.ClientAddr = DhcpSb->ClientAddr;
+  Cache.Netmask    = DhcpSb->Netmask;
+  Cache.ServerAddr = DhcpSb->ServerAddr;
+
+  gRT->SetVariable (
+         DHCP_LEASE_CACHE_VARIABLE_NAME,
+         &gEfiCallerIdGuid,
+         EFI_VARIABLE_BOOTSERVICE_ACCESS,
+         sizeof (DHCP_LEASE_CACHE),
+         &Cache
+         );
+}
+
+/**
+  Load the cached lease for the service's NIC, if there is one.
+
+  On a hit, the service's client address and the active configure's
+  ClientAddress are set from the cache, ready for an INIT-REBOOT
+  REQUEST. The cache is rejected if it was recorded for another NIC.
+
+  @param  DhcpSb                The DHCP service instance.
+
+  @retval TRUE                  The cached lease is loaded into the service.
+  @retval FALSE                 No usable lease is cached for this NIC.
+
+**/
+BOOLEAN
+DhcpLoadLeaseCache (
+  IN OUT DHCP_SERVICE  *DhcpSb
+  )
+{
+  DHCP_LEASE_CACHE  Cache;
+  UINTN             Size;
+  EFI_STATUS        Status;
+  IP4_ADDR          Ip;
+
+  Size   = sizeof (DHCP_LEASE_CACHE);
+  Status = gRT->GetVariable (
+                  DHCP_LEASE_CACHE_VARIABLE_NAME,
+                  &gEfiCallerIdGuid,
+                  NULL,
+                  &Size,
+                  &Cache
+                  );
+
+  if (EFI_ERROR (Status) || (Size != sizeof (DHCP_LEASE_CACHE))) {
+    return FALSE;
+  }
+
+  if ((Cache.HwLen != DhcpSb->HwLen) ||
+      (CompareMem (&Cache.Mac, &DhcpSb->Mac, sizeof (EFI_MAC_ADDRESS)) != 0) ||
+      (Cache.ClientAddr == 0))
+  {
+    return FALSE;
+  }
+
+  DhcpSb->ClientAddr = Cache.ClientAddr;
+
+  //
+  // The REQUEST sent in Dhcp4Rebooting takes its requested IP option
+  // from the active configure's ClientAddress, so set it as well.
+  //
+  Ip = HTONL (Cache.ClientAddr);
+  CopyMem (&DhcpSb->ActiveConfig.ClientAddress, &Ip, sizeof (EFI_IPv4_ADDRESS));
+
+  return TRUE;
+}
+
+/**
+  Delete the volatile lease cache variable.
+
+**/
+VOID
+DhcpClearLeaseCache (
+  VOID
+  )
+{
+  gRT->SetVariable (
+         DHCP_LEASE_CACHE_VARIABLE_NAME,
+         &gEfiCallerIdGuid,
+         EFI_VARIABLE_BOOTSERVICE_ACCESS,
+         0,
+         NULL
+         );
+}
+
 /**
   Update the lease states when a new lease is acquired. It will not only
   save the acquired the address and lease time, it will also create a UDP
@@ -375,6 +481,8 @@ DhcpLeaseAcquired (
   IN OUT DHCP_SERVICE  *DhcpSb
   )
 {
+  EFI_STATUS  Status;
+
   DhcpSb->ClientAddr = EFI_NTOHL (DhcpSb->Selected->Dhcp4.Header.YourAddr);
 
   if (DhcpSb->Para != NULL) {
@@ -411,7 +519,20 @@ DhcpLeaseAcquired (
     DhcpComputeLease (DhcpSb, DhcpSb->Para);
   }
 
-  return DhcpSetState (DhcpSb, Dhcp4Bound, TRUE);
+  DhcpSb->LeaseFromCache = FALSE;
+
+  Status = DhcpSetState (DhcpSb, Dhcp4Bound, TRUE);
+
+  //
+  // Cache the confirmed lease so a later session on this NIC can
+  // reacquire it through INIT-REBOOT. BOOTP replies carry no lease
+  // to confirm, don't cache them.
+  //
+  if (!EFI_ERROR (Status) && !DHCP_IS_BOOTP (DhcpSb->Para)) {
+    DhcpSaveLeaseCache (DhcpSb);
+  }
+
+  return Status;
 }
 
 /**
@@ -446,10 +567,11 @@ DhcpCleanLease (
     DhcpSb->Para = NULL;
   }
 
-  DhcpSb->Lease        = 0;
-  DhcpSb->T1           = 0;
-  DhcpSb->T2           = 0;
-  DhcpSb->ExtraRefresh = FALSE;
+  DhcpSb->Lease          = 0;
+  DhcpSb->T1             = 0;
+  DhcpSb->T2             = 0;
+  DhcpSb->ExtraRefresh   = FALSE;
+  DhcpSb->LeaseFromCache = FALSE;
 
   if (DhcpSb->LeaseIoPort != NULL) {
     UdpIoFreeIo (DhcpSb->LeaseIoPort);
@@ -868,6 +990,12 @@ DhcpHandleReboot (
   if (Para->DhcpType == DHCP_MSG_NAK) {
     DhcpCallUser (DhcpSb, Dhcp4RcvdNak, Packet, NULL);
 
+    //
+    // The server rejected the address, the cached lease is stale.
+    //
+    DhcpClearLeaseCache ();
+    DhcpSb->LeaseFromCache = FALSE;
+
     DhcpSb->ClientAddr = 0;
     DhcpSb->DhcpState  = Dhcp4Init;
 
@@ -1497,7 +1625,22 @@ DhcpOnTimerTick (
       }
     }
 
-    if (++DhcpSb->CurRetry < DhcpSb->MaxRetries) {
+    if ((DhcpSb->DhcpState == Dhcp4Rebooting) && DhcpSb->LeaseFromCache) {
+      //
+      // The cached lease wasn't confirmed within the first timeout.
+      // Drop it and restart from DISCOVER instead of burning the
+      // remaining retries on an address no server will acknowledge.
+      //
+      DhcpClearLeaseCache ();
+      DhcpSb->LeaseFromCache = FALSE;
+
+      DhcpSb->ClientAddr = 0;
+      DhcpSb->DhcpState  = Dhcp4Init;
+
+      if (EFI_ERROR (DhcpInitRequest (DhcpSb))) {
+        goto END_SESSION;
+      }
+    } else if (++DhcpSb->CurRetry < DhcpSb->MaxRetries) {
       //
       // Still has another try
       //
@@ -166,6 +166,40 @@ DhcpCleanLease (
   IN DHCP_SERVICE  *DhcpSb
   );
 
+/**
+  Save the acquired lease to the volatile lease cache variable.
+
+  @param  DhcpSb                The DHCP service instance.
+
+**/
+VOID
+DhcpSaveLeaseCache (
+  IN DHCP_SERVICE  *DhcpSb
+  );
+
+/**
+  Load the cached lease for the service's NIC, if there is one.
+
+  @param  DhcpSb                The DHCP service instance.
+
+  @retval TRUE                  The cached lease is loaded into the service.
+  @retval FALSE                 No usable lease is cached for this NIC.
+
+**/
+BOOLEAN
+DhcpLoadLeaseCache (
+  IN OUT DHCP_SERVICE  *DhcpSb
+  );
+
+/**
+  Delete the volatile lease cache variable.
+
+**/
+VOID
+DhcpClearLeaseCache (
+  VOID
+  );
+
 /**
   Release the net buffer when packet is sent.
 
@@ -2221,46 +2221,35 @@ DnsOnTimerUpdate (
   Item6 = NULL;
 
   //
-  // Iterate through all the DNS4 cache list.
+  // Age the DNS4 cache list in one pass. An entry whose remaining lifetime
+  // is used up is evicted on the way; this also covers entries cached from
+  // TTL-0 answers, which the former decrement-then-compare scheme wrapped
+  // around and kept forever.
   //
   NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns4CacheList) {
     Item4 = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
-    Item4->DnsCache.Timeout--;
-  }
-
-  Entry = mDriverData->Dns4CacheList.ForwardLink;
-  while (Entry != &mDriverData->Dns4CacheList) {
-    Item4 = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
-    if (Item4->DnsCache.Timeout == 0) {
+    if (Item4->DnsCache.Timeout <= 1) {
       RemoveEntryList (&Item4->AllCacheLink);
       FreePool (Item4->DnsCache.HostName);
       FreePool (Item4->DnsCache.IpAddress);
       FreePool (Item4);
-      Entry = mDriverData->Dns4CacheList.ForwardLink;
     } else {
-      Entry = Entry->ForwardLink;
+      Item4->DnsCache.Timeout--;
     }
   }
 
   //
-  // Iterate through all the DNS6 cache list.
+  // Age the DNS6 cache list the same way.
   //
   NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns6CacheList) {
     Item6 = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
-    Item6->DnsCache.Timeout--;
-  }
-
-  Entry = mDriverData->Dns6CacheList.ForwardLink;
-  while (Entry != &mDriverData->Dns6CacheList) {
-    Item6 = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
-    if (Item6->DnsCache.Timeout == 0) {
+    if (Item6->DnsCache.Timeout <= 1) {
       RemoveEntryList (&Item6->AllCacheLink);
       FreePool (Item6->DnsCache.HostName);
       FreePool (Item6->DnsCache.IpAddress);
       FreePool (Item6);
-      Entry = mDriverData->Dns6CacheList.ForwardLink;
     } else {
-      Entry = Entry->ForwardLink;
+      Item6->DnsCache.Timeout--;
     }
   }
 }
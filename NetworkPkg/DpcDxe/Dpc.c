@@ -33,6 +33,15 @@ EFI_DPC_PROTOCOL  mDpc = {
 UINTN  mDpcQueueDepth    = 0;
 UINTN  mMaxDpcQueueDepth = 0;
 
+//
+// Global variables used to measure the per-TPL DPC queue depths and the
+// largest batch of DPCs handed to a single dispatch pass.  These are kept
+// in addition to the depths across all TPLs to show which priority lane
+// is backing up when diagnosing dispatch latency.
+//
+UINTN  mDpcQueueDepthByTpl[TPL_HIGH_LEVEL + 1];
+UINTN  mMaxDpcDispatchBatch = 0;
+
 //
 // Free list of DPC entries.  As DPCs are queued, entries are removed from this
 // free list.  As DPC entries are dispatched, DPC entries are added to the free list.
@@ -176,9 +185,10 @@ DpcQueueDpc (
   InsertTailList (&mDpcQueue[DpcTpl], &DpcEntry->ListEntry);
 
   //
-  // Increment the measured DPC queue depth across all TPLs
+  // Increment the measured DPC queue depth across all TPLs and for DpcTpl
   //
   mDpcQueueDepth++;
+  mDpcQueueDepthByTpl[DpcTpl]++;
 
   //
   // Measure the maximum DPC queue depth across all TPLs
@@ -196,6 +206,34 @@ Done:
   return ReturnStatus;
 }
 
+/**
+  Move all the entries from SrcList to the end of DstList.
+
+  The caller is responsible for serializing access to both lists, typically
+  by raising the TPL level to TPL_HIGH_LEVEL.
+
+  @param  SrcList  The list the entries are moved from.  It is empty on return.
+  @param  DstList  The list the entries are appended to.
+
+**/
+VOID
+DpcMoveList (
+  IN OUT LIST_ENTRY  *SrcList,
+  IN OUT LIST_ENTRY  *DstList
+  )
+{
+  if (IsListEmpty (SrcList)) {
+    return;
+  }
+
+  SrcList->ForwardLink->BackLink = DstList->BackLink;
+  DstList->BackLink->ForwardLink = SrcList->ForwardLink;
+  SrcList->BackLink->ForwardLink = DstList;
+  DstList->BackLink              = SrcList->BackLink;
+
+  InitializeListHead (SrcList);
+}
+
 /**
   Dispatch the queue of DPCs.  ALL DPCs that have been queued with a DpcTpl
   value greater than or equal to the current TPL are invoked in the order that
@@ -218,12 +256,18 @@ DpcDispatchDpc (
   EFI_TPL     OriginalTpl;
   EFI_TPL     Tpl;
   DPC_ENTRY   *DpcEntry;
+  LIST_ENTRY  DispatchList;
+  LIST_ENTRY  InvokedList;
+  UINTN       BatchDepth;
 
   //
   // Assume that no DPCs will be invoked
   //
   ReturnStatus = EFI_NOT_FOUND;
 
+  InitializeListHead (&DispatchList);
+  InitializeListHead (&InvokedList);
+
   //
   // Raise the TPL level to TPL_HIGH_LEVEL for DPC list operation and save the
   // current TPL value so it can be restored when this function returns.
@@ -243,19 +287,23 @@ DpcDispatchDpc (
       //
       while (!IsListEmpty (&mDpcQueue[Tpl])) {
         //
-        // Retrieve the first DPC entry from the DPC queue specified by Tpl
+        // Detach the whole DPC queue for this TPL in a single critical
+        // section, instead of raising and restoring the TPL level once
+        // per queued DPC.
         //
-        DpcEntry = (DPC_ENTRY *)(GetFirstNode (&mDpcQueue[Tpl]));
+        DpcMoveList (&mDpcQueue[Tpl], &DispatchList);
 
         //
-        // Remove the first DPC entry from the DPC queue specified by Tpl
+        // Account for the detached batch in the measured DPC queue depths
+        // while still at TPL_HIGH_LEVEL.
         //
-        RemoveEntryList (&DpcEntry->ListEntry);
+        BatchDepth               = mDpcQueueDepthByTpl[Tpl];
+        mDpcQueueDepth          -= BatchDepth;
+        mDpcQueueDepthByTpl[Tpl] = 0;
 
-        //
-        // Decrement the measured DPC Queue Depth across all TPLs
-        //
-        mDpcQueueDepth--;
+        if (BatchDepth > mMaxDpcDispatchBatch) {
+          mMaxDpcDispatchBatch = BatchDepth;
+        }
 
         //
         // Lower the TPL to TPL value of the current DPC queue
@@ -263,14 +311,21 @@ DpcDispatchDpc (
         gBS->RestoreTPL (Tpl);
 
         //
-        // Invoke the DPC passing in its context
+        // Invoke the detached DPCs in the order that they were queued,
+        // passing in their contexts
         //
-        (DpcEntry->DpcProcedure)(DpcEntry->DpcContext);
+        while (!IsListEmpty (&DispatchList)) {
+          DpcEntry = (DPC_ENTRY *)(GetFirstNode (&DispatchList));
+          RemoveEntryList (&DpcEntry->ListEntry);
+          InsertTailList (&InvokedList, &DpcEntry->ListEntry);
 
-        //
-        // At least one DPC has been invoked, so set the return status to EFI_SUCCESS
-        //
-        ReturnStatus = EFI_SUCCESS;
+          (DpcEntry->DpcProcedure)(DpcEntry->DpcContext);
+
+          //
+          // At least one DPC has been invoked, so set the return status to EFI_SUCCESS
+          //
+          ReturnStatus = EFI_SUCCESS;
+        }
 
         //
         // Raise the TPL level back to TPL_HIGH_LEVEL for DPC list operations
@@ -278,9 +333,9 @@ DpcDispatchDpc (
         gBS->RaiseTPL (TPL_HIGH_LEVEL);
 
         //
-        // Add the invoked DPC entry to the DPC free list
+        // Return the invoked DPC entries to the DPC free list in one batch
         //
-        InsertTailList (&mDpcEntryFreeList, &DpcEntry->ListEntry);
+        DpcMoveList (&InvokedList, &mDpcEntryFreeList);
       }
     }
   }
@@ -653,6 +653,61 @@ HttpBootCreateHttpIo (
   return EFI_SUCCESS;
 }
 
+/**
+  Create an auxiliary HttpIo for one connection of a ranged download.
+
+  The connection is configured exactly like the driver's main download
+  connection, but its lifetime is owned by the ranged download.
+
+  @param[in]    Private        The pointer to the driver's private data.
+  @param[out]   HttpIo         The HTTP_IO to create and configure.
+
+  @retval EFI_SUCCESS          Successfully created.
+  @retval Others               Failed to create HttpIo.
+
+**/
+EFI_STATUS
+HttpBootCreateRangeHttpIo (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  OUT HTTP_IO                    *HttpIo
+  )
+{
+  HTTP_IO_CONFIG_DATA  ConfigData;
+  EFI_HANDLE           ImageHandle;
+  UINT32               TimeoutValue;
+
+  ASSERT (Private != NULL);
+
+  //
+  // Get HTTP timeout value
+  //
+  TimeoutValue = PcdGet32 (PcdHttpIoTimeout);
+
+  ZeroMem (&ConfigData, sizeof (HTTP_IO_CONFIG_DATA));
+  if (!Private->UsingIpv6) {
+    ConfigData.Config4.HttpVersion    = HttpVersion11;
+    ConfigData.Config4.RequestTimeOut = TimeoutValue;
+    IP4_COPY_ADDRESS (&ConfigData.Config4.LocalIp, &Private->StationIp.v4);
+    IP4_COPY_ADDRESS (&ConfigData.Config4.SubnetMask, &Private->SubnetMask.v4);
+    ImageHandle = Private->Ip4Nic->ImageHandle;
+  } else {
+    ConfigData.Config6.HttpVersion    = HttpVersion11;
+    ConfigData.Config6.RequestTimeOut = TimeoutValue;
+    IP6_COPY_ADDRESS (&ConfigData.Config6.LocalIp, &Private->StationIp.v6);
+    ImageHandle = Private->Ip6Nic->ImageHandle;
+  }
+
+  return HttpIoCreateIo (
+           ImageHandle,
+           Private->Controller,
+           Private->UsingIpv6 ? IP_VERSION_6 : IP_VERSION_4,
+           &ConfigData,
+           HttpBootHttpIoCallback,
+           (VOID *)Private,
+           HttpIo
+           );
+}
+
 /**
   Release all the resource of a cache item.
 
@@ -951,6 +1006,7 @@ HttpBootGetBootFile (
   CHAR16                   *Url;
   BOOLEAN                  IdentityMode;
   UINTN                    ReceivedSize;
+  EFI_HTTP_HEADER          *HttpHeader;
 
   ASSERT (Private != NULL);
   ASSERT (Private->HttpCreated);
@@ -979,6 +1035,17 @@ HttpBootGetBootFile (
       FreePool (Url);
       return Status;
     }
+
+    //
+    // Try the ranged multi-connection download for large files. It
+    // returns EFI_UNSUPPORTED when it cannot be set up, in which case
+    // the single connection download below is used.
+    //
+    Status = HttpBootGetBootFileRanged (Private, BufferSize, Buffer, ImageType);
+    if (Status != EFI_UNSUPPORTED) {
+      FreePool (Url);
+      return Status;
+    }
   }
 
   //
@@ -1140,6 +1207,18 @@ HttpBootGetBootFile (
     goto ERROR_5;
   }
 
+  //
+  // Record whether the server accepts byte-range requests for this
+  // resource, the ranged multi-connection download depends on it.
+  //
+  HttpHeader = HttpFindHeader (
+                 ResponseData->HeaderCount,
+                 ResponseData->Headers,
+                 HTTP_HEADER_ACCEPT_RANGES
+                 );
+  Private->RangeSupported = (BOOLEAN)((HttpHeader != NULL) &&
+                                      (AsciiStrCmp (HttpHeader->FieldValue, "bytes") == 0));
+
   //
   // 3.2 Cache the response header.
   //
@@ -1350,3 +1429,331 @@ ERROR_1:
 
   return Status;
 }
+
+/**
+  Download the boot file over several parallel range-request connections.
+
+  The file is split into PcdHttpBootRangeConnections contiguous ranges
+  and one GET with a Range header is issued per connection, the first
+  range over the driver's existing keep-alive connection and the others
+  over auxiliary connections. The responses are drained round-robin
+  directly into the caller's buffer, so each connection's TCP window
+  stays open and the aggregate approaches N windows per round trip.
+
+  @param[in]       Private         The pointer to the driver's private data.
+  @param[in, out]  BufferSize      On input the size of Buffer in bytes. On output the
+                                   amount of data transferred to Buffer.
+  @param[out]      Buffer          The memory buffer to transfer the file to.
+  @param[out]      ImageType       The image type of the downloaded file.
+
+  @retval EFI_SUCCESS              The file was loaded.
+  @retval EFI_UNSUPPORTED          The ranged download could not be set up, the caller
+                                   should fall back to the single connection download.
+  @retval Others                   Unexpected error happened.
+
+**/
+EFI_STATUS
+HttpBootGetBootFileRanged (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  IN OUT UINTN                   *BufferSize,
+  OUT UINT8                      *Buffer,
+  OUT HTTP_BOOT_IMAGE_TYPE       *ImageType
+  )
+{
+  EFI_STATUS             Status;
+  UINT32                 NumConn;
+  UINT32                 TotalConn;
+  UINT32                 Index;
+  UINT32                 Index2;
+  UINT64                 ChunkSize;
+  UINT64                 ContentLength;
+  UINT64                 RangeLen;
+  UINTN                  Active;
+  UINTN                  HdrIndex;
+  HTTP_BOOT_RANGE_CONN   *Conns;
+  HTTP_BOOT_RANGE_CONN   *Conn;
+  HTTP_IO                *HttpIo;
+  CHAR8                  *HostName;
+  UINTN                  UrlSize;
+  CHAR16                 *Url;
+  EFI_HTTP_HEADER        *HttpHeader;
+  HTTP_IO_RESPONSE_DATA  ResponseBody;
+
+  ASSERT (Private != NULL);
+  ASSERT (Private->HttpCreated);
+  ASSERT (Buffer != NULL);
+
+  ContentLength = Private->BootFileSize;
+
+  NumConn = PcdGet32 (PcdHttpBootRangeConnections);
+  if (NumConn > HTTP_BOOT_RANGE_CONN_MAX) {
+    NumConn = HTTP_BOOT_RANGE_CONN_MAX;
+  }
+
+  if ((NumConn < 2) || !Private->RangeSupported ||
+      (ContentLength < HTTP_BOOT_RANGE_MIN_FILE_SIZE) ||
+      (*BufferSize < ContentLength))
+  {
+    return EFI_UNSUPPORTED;
+  }
+
+  //
+  // NumConn may shrink if the download degrades to a single stream,
+  // TotalConn keeps the allocated connection count for the cleanup.
+  //
+  TotalConn = NumConn;
+  Conns     = NULL;
+  HostName  = NULL;
+
+  UrlSize = AsciiStrSize (Private->BootFileUri);
+  Url     = AllocatePool (UrlSize * sizeof (CHAR16));
+  if (Url == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  AsciiStrToUnicodeStrS (Private->BootFileUri, Url, UrlSize);
+
+  Status = HttpUrlGetHostName (
+             Private->BootFileUri,
+             Private->BootFileUriParser,
+             &HostName
+             );
+  if (EFI_ERROR (Status)) {
+    Status = EFI_UNSUPPORTED;
+    goto ON_EXIT;
+  }
+
+  Conns = AllocateZeroPool (NumConn * sizeof (HTTP_BOOT_RANGE_CONN));
+  if (Conns == NULL) {
+    Status = EFI_UNSUPPORTED;
+    goto ON_EXIT;
+  }
+
+  //
+  // Split the file into NumConn contiguous ranges, the last range takes
+  // the remainder, and prepare one request per range. Everything that
+  // can fail is done before the first request goes on the wire, so the
+  // caller can still fall back to the single connection download.
+  //
+  ChunkSize = DivU64x32 (ContentLength, NumConn);
+
+  for (Index = 0; Index < NumConn; Index++) {
+    Conn        = &Conns[Index];
+    Conn->Start = MultU64x32 (ChunkSize, Index);
+    Conn->End   = (Index == NumConn - 1) ? (ContentLength - 1) : (Conn->Start + ChunkSize - 1);
+
+    AsciiSPrint (
+      Conn->RangeValue,
+      HTTP_BOOT_RANGE_VALUE_LEN,
+      "bytes=%ld-%ld",
+      Conn->Start,
+      Conn->End
+      );
+
+    Conn->HttpIoHeader = HttpIoCreateHeader (4);
+    if (Conn->HttpIoHeader == NULL) {
+      Status = EFI_UNSUPPORTED;
+      goto ON_EXIT;
+    }
+
+    Status = HttpIoSetHeader (Conn->HttpIoHeader, HTTP_HEADER_HOST, HostName);
+    if (!EFI_ERROR (Status)) {
+      Status = HttpIoSetHeader (Conn->HttpIoHeader, HTTP_HEADER_ACCEPT, "*/*");
+    }
+
+    if (!EFI_ERROR (Status)) {
+      Status = HttpIoSetHeader (Conn->HttpIoHeader, HTTP_HEADER_USER_AGENT, HTTP_USER_AGENT_EFI_HTTP_BOOT);
+    }
+
+    if (!EFI_ERROR (Status)) {
+      Status = HttpIoSetHeader (Conn->HttpIoHeader, HTTP_HEADER_RANGE, Conn->RangeValue);
+    }
+
+    if (EFI_ERROR (Status)) {
+      Status = EFI_UNSUPPORTED;
+      goto ON_EXIT;
+    }
+
+    Conn->RequestData.Method = HttpMethodGet;
+    Conn->RequestData.Url    = Url;
+
+    if (Index > 0) {
+      Status = HttpBootCreateRangeHttpIo (Private, &Conn->HttpIo);
+      if (EFI_ERROR (Status)) {
+        Status = EFI_UNSUPPORTED;
+        goto ON_EXIT;
+      }
+
+      Conn->HttpIoCreated = TRUE;
+    }
+  }
+
+  //
+  // Send one range GET per connection. The first range rides on the
+  // driver's keep-alive connection. From here on errors are reported
+  // to the caller, the main connection's request is already consumed.
+  //
+  for (Index = 0; Index < NumConn; Index++) {
+    Conn   = &Conns[Index];
+    HttpIo = (Index == 0) ? &Private->HttpIo : &Conn->HttpIo;
+
+    Status = HttpIoSendRequest (
+               HttpIo,
+               &Conn->RequestData,
+               Conn->HttpIoHeader->HeaderCount,
+               Conn->HttpIoHeader->Headers,
+               0,
+               NULL
+               );
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+  }
+
+  //
+  // Receive the response headers. Every connection must answer with 206
+  // Partial Content carrying exactly the requested range. If the server
+  // answers the first request with 200 despite advertising range
+  // support, degrade to a single full-file stream on that connection.
+  //
+  for (Index = 0; Index < NumConn; Index++) {
+    Conn   = &Conns[Index];
+    HttpIo = (Index == 0) ? &Private->HttpIo : &Conn->HttpIo;
+
+    Status = HttpIoRecvResponse (HttpIo, TRUE, &Conn->ResponseData);
+    if (EFI_ERROR (Status) || EFI_ERROR (Conn->ResponseData.Status)) {
+      if (EFI_ERROR (Conn->ResponseData.Status)) {
+        Status = Conn->ResponseData.Status;
+      }
+
+      goto ON_EXIT;
+    }
+
+    if ((Index == 0) && (Conn->ResponseData.Response.StatusCode == HTTP_STATUS_200_OK)) {
+      Conn->End = ContentLength - 1;
+
+      for (Index2 = 1; Index2 < NumConn; Index2++) {
+        if (Conns[Index2].HttpIoCreated) {
+          HttpIoDestroyIo (&Conns[Index2].HttpIo);
+          Conns[Index2].HttpIoCreated = FALSE;
+        }
+      }
+
+      NumConn = 1;
+      break;
+    }
+
+    if (Conn->ResponseData.Response.StatusCode != HTTP_STATUS_206_PARTIAL_CONTENT) {
+      HttpBootPrintErrorMessage (Conn->ResponseData.Response.StatusCode);
+      Status = EFI_DEVICE_ERROR;
+      goto ON_EXIT;
+    }
+
+    HttpHeader = HttpFindHeader (
+                   Conn->ResponseData.HeaderCount,
+                   Conn->ResponseData.Headers,
+                   HTTP_HEADER_CONTENT_LENGTH
+                   );
+    if ((HttpHeader == NULL) ||
+        (AsciiStrDecimalToUint64 (HttpHeader->FieldValue) != (Conn->End - Conn->Start + 1)))
+    {
+      Status = EFI_DEVICE_ERROR;
+      goto ON_EXIT;
+    }
+  }
+
+  //
+  // The per-response Content-Length callbacks have clobbered the
+  // progress data with the range sizes, reset it to the whole file.
+  //
+  Private->FileSize     = ContentLength;
+  Private->ReceivedSize = 0;
+  Private->Percentage   = 0;
+
+  //
+  // Drain the connections round-robin directly into the caller's
+  // buffer. Each receive call returns as soon as its connection has
+  // data, so all TCP windows are kept open concurrently.
+  //
+  Active = NumConn;
+
+  while (Active > 0) {
+    for (Index = 0; Index < NumConn; Index++) {
+      Conn = &Conns[Index];
+      if (Conn->Done) {
+        continue;
+      }
+
+      HttpIo   = (Index == 0) ? &Private->HttpIo : &Conn->HttpIo;
+      RangeLen = Conn->End - Conn->Start + 1;
+
+      ZeroMem (&ResponseBody, sizeof (HTTP_IO_RESPONSE_DATA));
+      ResponseBody.Body       = (CHAR8 *)Buffer + Conn->Start + Conn->Received;
+      ResponseBody.BodyLength = (UINTN)(RangeLen - Conn->Received);
+
+      Status = HttpIoRecvResponse (HttpIo, FALSE, &ResponseBody);
+      if (EFI_ERROR (Status) || EFI_ERROR (ResponseBody.Status)) {
+        if (EFI_ERROR (ResponseBody.Status)) {
+          Status = ResponseBody.Status;
+        }
+
+        goto ON_EXIT;
+      }
+
+      Conn->Received += ResponseBody.BodyLength;
+
+      if (Private->HttpBootCallback != NULL) {
+        Status = Private->HttpBootCallback->Callback (
+                                              Private->HttpBootCallback,
+                                              HttpBootHttpEntityBody,
+                                              TRUE,
+                                              (UINT32)ResponseBody.BodyLength,
+                                              ResponseBody.Body
+                                              );
+        if (EFI_ERROR (Status)) {
+          goto ON_EXIT;
+        }
+      }
+
+      if (Conn->Received == RangeLen) {
+        Conn->Done = TRUE;
+        Active--;
+      }
+    }
+  }
+
+  *BufferSize = (UINTN)ContentLength;
+  *ImageType  = Private->ImageType;
+  Status      = EFI_SUCCESS;
+
+ON_EXIT:
+  if (Conns != NULL) {
+    for (Index = 0; Index < TotalConn; Index++) {
+      if (Conns[Index].HttpIoCreated) {
+        HttpIoDestroyIo (&Conns[Index].HttpIo);
+      }
+
+      if (Conns[Index].HttpIoHeader != NULL) {
+        HttpIoFreeHeader (Conns[Index].HttpIoHeader);
+      }
+
+      if (Conns[Index].ResponseData.Headers != NULL) {
+        for (HdrIndex = 0; HdrIndex < Conns[Index].ResponseData.HeaderCount; HdrIndex++) {
+          FreePool (Conns[Index].ResponseData.Headers[HdrIndex].FieldName);
+          FreePool (Conns[Index].ResponseData.Headers[HdrIndex].FieldValue);
+        }
+
+        FreePool (Conns[Index].ResponseData.Headers);
+      }
+    }
+
+    FreePool (Conns);
+  }
+
+  if (HostName != NULL) {
+    FreePool (HostName);
+  }
+
+  FreePool (Url);
+  return Status;
+}
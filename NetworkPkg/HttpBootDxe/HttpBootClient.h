@@ -13,6 +13,31 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define HTTP_BOOT_BLOCK_SIZE           1500
 #define HTTP_USER_AGENT_EFI_HTTP_BOOT  "UefiHttpBoot/1.0"
 
+//
+// Limits for the ranged multi-connection download. Files below the
+// minimum size are downloaded over a single connection, the extra
+// round trips wouldn't pay off.
+//
+#define HTTP_BOOT_RANGE_CONN_MAX       8
+#define HTTP_BOOT_RANGE_MIN_FILE_SIZE  SIZE_8MB
+#define HTTP_BOOT_RANGE_VALUE_LEN      48
+
+//
+// State of one connection of a ranged multi-connection download.
+//
+typedef struct {
+  HTTP_IO                  HttpIo;        // Auxiliary connection, unused for the first range.
+  BOOLEAN                  HttpIoCreated;
+  EFI_HTTP_REQUEST_DATA    RequestData;
+  CHAR8                    RangeValue[HTTP_BOOT_RANGE_VALUE_LEN];
+  HTTP_IO_HEADER           *HttpIoHeader;
+  HTTP_IO_RESPONSE_DATA    ResponseData;
+  UINT64                   Start;         // First byte offset of the range.
+  UINT64                   End;           // Last byte offset of the range.
+  UINT64                   Received;      // Body bytes received so far.
+  BOOLEAN                  Done;
+} HTTP_BOOT_RANGE_CONN;
+
 //
 // Record the data length and start address of a data block.
 //
@@ -118,6 +143,29 @@ HttpBootGetBootFile (
   OUT HTTP_BOOT_IMAGE_TYPE       *ImageType
   );
 
+/**
+  Download the boot file over several parallel range-request connections.
+
+  @param[in]       Private         The pointer to the driver's private data.
+  @param[in, out]  BufferSize      On input the size of Buffer in bytes. On output the
+                                   amount of data transferred to Buffer.
+  @param[out]      Buffer          The memory buffer to transfer the file to.
+  @param[out]      ImageType       The image type of the downloaded file.
+
+  @retval EFI_SUCCESS              The file was loaded.
+  @retval EFI_UNSUPPORTED          The ranged download could not be set up, the caller
+                                   should fall back to the single connection download.
+  @retval Others                   Unexpected error happened.
+
+**/
+EFI_STATUS
+HttpBootGetBootFileRanged (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  IN OUT UINTN                   *BufferSize,
+  OUT UINT8                      *Buffer,
+  OUT HTTP_BOOT_IMAGE_TYPE       *ImageType
+  );
+
 /**
   Clean up all cached data.
 
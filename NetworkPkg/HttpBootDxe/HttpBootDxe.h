@@ -210,6 +210,7 @@ struct _HTTP_BOOT_PRIVATE_DATA {
   UINTN                                        BootFileSize;
   BOOLEAN                                      NoGateway;
   HTTP_BOOT_IMAGE_TYPE                         ImageType;
+  BOOLEAN                                      RangeSupported;
 
   //
   // URI string extracted from the input FilePath parameter.
@@ -984,7 +984,6 @@ HttpResponseWorker (
   UINTN             BufferSize;
   UINTN             StatusCode;
   CHAR8             *Tmp;
-  CHAR8             *HeaderTmp;
   CHAR8             *StatusCodeStr;
   UINTN             BodyLen;
   HTTP_PROTOCOL     *HttpInstance;
@@ -1174,15 +1173,12 @@ HttpResponseWorker (
     }
 
     if (SizeofHeaders != 0) {
-      HeaderTmp = AllocateZeroPool (SizeofHeaders);
-      if (HeaderTmp == NULL) {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto Error2;
-      }
-
-      CopyMem (HeaderTmp, Tmp, SizeofHeaders);
-      FreePool (HttpHeaders);
-      HttpHeaders = HeaderTmp;
+      //
+      // Drop the status line by shifting the remaining header fields to the
+      // front of the buffer. CopyMem() handles the overlapping copy, so no
+      // intermediate allocation is needed.
+      //
+      CopyMem (HttpHeaders, Tmp, SizeofHeaders);
 
       //
       // Check whether the EFI_HTTP_UTILITIES_PROTOCOL is available.
@@ -1084,7 +1084,14 @@ HttpConfigureTcp4 (
   Tcp4Option->KeepAliveTime     = HTTP_KEEP_ALIVE_TIME;
   Tcp4Option->KeepAliveInterval = HTTP_KEEP_ALIVE_INTERVAL;
   Tcp4Option->EnableNagle       = TRUE;
-  Tcp4CfgData->ControlOption    = Tcp4Option;
+
+  //
+  // Enable window scaling and selective acknowledgment, so a large
+  // download can fill a long fat pipe.
+  //
+  Tcp4Option->EnableWindowScaling = TRUE;
+  Tcp4Option->EnableSelectiveAck  = TRUE;
+  Tcp4CfgData->ControlOption      = Tcp4Option;
 
   if ((HttpInstance->State == HTTP_STATE_TCP_CONNECTED) ||
       (HttpInstance->State == HTTP_STATE_TCP_CLOSED))
@@ -1168,6 +1175,13 @@ HttpConfigureTcp6 (
   Tcp6Option->KeepAliveInterval = HTTP_KEEP_ALIVE_INTERVAL;
   Tcp6Option->EnableNagle       = TRUE;
 
+  //
+  // Enable window scaling and selective acknowledgment, so a large
+  // download can fill a long fat pipe.
+  //
+  Tcp6Option->EnableWindowScaling = TRUE;
+  Tcp6Option->EnableSelectiveAck  = TRUE;
+
   if ((HttpInstance->State == HTTP_STATE_TCP_CONNECTED) ||
       (HttpInstance->State == HTTP_STATE_TCP_CLOSED))
   {
@@ -1828,19 +1842,22 @@ HttpTcpReceiveHeader (
   CHAR8              **EndofHeader;
   CHAR8              **HttpHeaders;
   CHAR8              *Buffer;
+  UINTN              BufferCapacity;
+  UINTN              PrevSize;
   NET_FRAGMENT       Fragment;
 
   ASSERT (HttpInstance != NULL);
 
-  EndofHeader   = HttpInstance->EndofHeader;
-  HttpHeaders   = HttpInstance->HttpHeaders;
-  Tcp4          = HttpInstance->Tcp4;
-  Tcp6          = HttpInstance->Tcp6;
-  Buffer        = NULL;
-  Rx4Token      = NULL;
-  Rx6Token      = NULL;
-  Fragment.Len  = 0;
-  Fragment.Bulk = NULL;
+  EndofHeader    = HttpInstance->EndofHeader;
+  HttpHeaders    = HttpInstance->HttpHeaders;
+  Tcp4           = HttpInstance->Tcp4;
+  Tcp6           = HttpInstance->Tcp6;
+  Buffer         = NULL;
+  BufferCapacity = 0;
+  Rx4Token       = NULL;
+  Rx6Token       = NULL;
+  Fragment.Len   = 0;
+  Fragment.Bulk  = NULL;
 
   if (HttpInstance->LocalAddressIsIPv6) {
     ASSERT (Tcp6 != NULL);
@@ -1913,33 +1930,45 @@ HttpTcpReceiveHeader (
       }
 
       //
-      // Append the response string along with a Null-terminator.
+      // Append the response string along with a Null-terminator. The
+      // accumulation buffer is grown geometrically, so a header split over
+      // many TCP segments does not cost one allocation plus a copy of
+      // everything received so far per segment.
       //
-      *BufferSize = *SizeofHeaders + Fragment.Len;
-      Buffer      = AllocatePool (*BufferSize + 1);
-      if (Buffer == NULL) {
-        Status = EFI_OUT_OF_RESOURCES;
-        return Status;
-      }
+      PrevSize    = *SizeofHeaders;
+      *BufferSize = PrevSize + Fragment.Len;
+      if (*BufferSize + 1 > BufferCapacity) {
+        BufferCapacity = MAX (*BufferSize + 1, 2 * BufferCapacity);
+        Buffer         = AllocatePool (BufferCapacity);
+        if (Buffer == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          return Status;
+        }
+
+        if (*HttpHeaders != NULL) {
+          CopyMem (Buffer, *HttpHeaders, PrevSize);
+          FreePool (*HttpHeaders);
+        }
 
-      if (*HttpHeaders != NULL) {
-        CopyMem (Buffer, *HttpHeaders, *SizeofHeaders);
-        FreePool (*HttpHeaders);
+        *HttpHeaders = Buffer;
       }
 
-      CopyMem (
-        Buffer + *SizeofHeaders,
-        Fragment.Bulk,
-        Fragment.Len
-        );
-      *(Buffer + *BufferSize) = '\0';
-      *HttpHeaders            = Buffer;
-      *SizeofHeaders          = *BufferSize;
+      CopyMem (*HttpHeaders + PrevSize, Fragment.Bulk, Fragment.Len);
+      *(*HttpHeaders + *BufferSize) = '\0';
+      *SizeofHeaders                = *BufferSize;
 
       //
-      // Check whether we received end of HTTP headers.
+      // Check whether we received end of HTTP headers. The bytes before the
+      // old tail were already scanned, so resume just in front of it in case
+      // the delimiter straddles the segment boundary.
       //
-      *EndofHeader = AsciiStrStr (*HttpHeaders, HTTP_END_OF_HDR_STR);
+      if (PrevSize >= AsciiStrLen (HTTP_END_OF_HDR_STR)) {
+        PrevSize = PrevSize - AsciiStrLen (HTTP_END_OF_HDR_STR) + 1;
+      } else {
+        PrevSize = 0;
+      }
+
+      *EndofHeader = AsciiStrStr (*HttpHeaders + PrevSize, HTTP_END_OF_HDR_STR);
     }
 
     //
@@ -2013,33 +2042,45 @@ HttpTcpReceiveHeader (
       }
 
       //
-      // Append the response string along with a Null-terminator.
+      // Append the response string along with a Null-terminator. The
+      // accumulation buffer is grown geometrically, so a header split over
+      // many TCP segments does not cost one allocation plus a copy of
+      // everything received so far per segment.
       //
-      *BufferSize = *SizeofHeaders + Fragment.Len;
-      Buffer      = AllocatePool (*BufferSize + 1);
-      if (Buffer == NULL) {
-        Status = EFI_OUT_OF_RESOURCES;
-        return Status;
-      }
+      PrevSize    = *SizeofHeaders;
+      *BufferSize = PrevSize + Fragment.Len;
+      if (*BufferSize + 1 > BufferCapacity) {
+        BufferCapacity = MAX (*BufferSize + 1, 2 * BufferCapacity);
+        Buffer         = AllocatePool (BufferCapacity);
+        if (Buffer == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          return Status;
+        }
+
+        if (*HttpHeaders != NULL) {
+          CopyMem (Buffer, *HttpHeaders, PrevSize);
+          FreePool (*HttpHeaders);
+        }
 
-      if (*HttpHeaders != NULL) {
-        CopyMem (Buffer, *HttpHeaders, *SizeofHeaders);
-        FreePool (*HttpHeaders);
+        *HttpHeaders = Buffer;
       }
 
-      CopyMem (
-        Buffer + *SizeofHeaders,
-        Fragment.Bulk,
-        Fragment.Len
-        );
-      *(Buffer + *BufferSize) = '\0';
-      *HttpHeaders            = Buffer;
-      *SizeofHeaders          = *BufferSize;
+      CopyMem (*HttpHeaders + PrevSize, Fragment.Bulk, Fragment.Len);
+      *(*HttpHeaders + *BufferSize) = '\0';
+      *SizeofHeaders                = *BufferSize;
 
       //
-      // Check whether we received end of HTTP headers.
+      // Check whether we received end of HTTP headers. The bytes before the
+      // old tail were already scanned, so resume just in front of it in case
+      // the delimiter straddles the segment boundary.
       //
-      *EndofHeader = AsciiStrStr (*HttpHeaders, HTTP_END_OF_HDR_STR);
+      if (PrevSize >= AsciiStrLen (HTTP_END_OF_HDR_STR)) {
+        PrevSize = PrevSize - AsciiStrLen (HTTP_END_OF_HDR_STR) + 1;
+      } else {
+        PrevSize = 0;
+      }
+
+      *EndofHeader = AsciiStrStr (*HttpHeaders + PrevSize, HTTP_END_OF_HDR_STR);
     }
 
     //
@@ -28,8 +28,23 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define ISCSI_MAX_CONNS_PER_SESSION  1
 
 #define DEFAULT_MAX_RECV_DATA_SEG_LEN  8192
-#define MAX_RECV_DATA_SEG_LEN_IN_FFP   65536
-#define DEFAULT_MAX_OUTSTANDING_R2T    1
+
+//
+// The MaxRecvDataSegmentLength declared for the Full Feature Phase. It is
+// kept equal to the MaxBurstLength default so a read burst fits in a single
+// Data-In PDU, instead of being split into 64KB PDUs each costing a separate
+// header round through the receive path. Targets with a smaller send limit
+// simply send smaller PDUs, the key is declarative per direction.
+//
+#define MAX_RECV_DATA_SEG_LEN_IN_FFP  262144
+
+//
+// Offer more than one outstanding R2T per task, so the target can solicit
+// the next burst while the data for the previous one is still in flight.
+// The result function is Minimum, targets supporting only one negotiate
+// this back down.
+//
+#define DEFAULT_MAX_OUTSTANDING_R2T  4
 
 #define ISCSI_VERSION_MAX  0x00
 #define ISCSI_VERSION_MIN  0x00
@@ -198,6 +198,12 @@ struct _IP6_SERVICE {
   UINT32                             RetransTimer;
   LIST_ENTRY                         NeighborTable;
 
+  //
+  // Hash index over NeighborTable, keyed by the neighbor's IPv6 address,
+  // so the per-packet next hop lookup doesn't walk the whole table.
+  //
+  LIST_ENTRY                         NeighborHashTable[IP6_NEIGHBOR_HASH_SIZE];
+
   LIST_ENTRY                         OnlinkPrefix;
   LIST_ENTRY                         AutonomousPrefix;
 
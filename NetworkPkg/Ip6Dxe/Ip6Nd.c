@@ -529,6 +529,7 @@ Ip6CreateNeighborEntry (
   }
 
   InsertHeadList (&IpSb->NeighborTable, &Entry->Link);
+  InsertHeadList (&IpSb->NeighborHashTable[IP6_NEIGHBOR_HASH (Ip6Address)], &Entry->HashLink);
 
   //
   // If corresponding default router entry exists, establish the relationship.
@@ -557,6 +558,7 @@ Ip6FindNeighborEntry (
   IN EFI_IPv6_ADDRESS  *Ip6Address
   )
 {
+  LIST_ENTRY          *Head;
   LIST_ENTRY          *Entry;
   LIST_ENTRY          *Next;
   IP6_NEIGHBOR_ENTRY  *Neighbor;
@@ -564,11 +566,17 @@ Ip6FindNeighborEntry (
   NET_CHECK_SIGNATURE (IpSb, IP6_SERVICE_SIGNATURE);
   ASSERT (Ip6Address != NULL);
 
-  NET_LIST_FOR_EACH_SAFE (Entry, Next, &IpSb->NeighborTable) {
-    Neighbor = NET_LIST_USER_STRUCT (Entry, IP6_NEIGHBOR_ENTRY, Link);
+  //
+  // Only the hash bucket the address belongs to needs to be searched,
+  // and a found entry is promoted to the head of its bucket.
+  //
+  Head = &IpSb->NeighborHashTable[IP6_NEIGHBOR_HASH (Ip6Address)];
+
+  NET_LIST_FOR_EACH_SAFE (Entry, Next, Head) {
+    Neighbor = NET_LIST_USER_STRUCT (Entry, IP6_NEIGHBOR_ENTRY, HashLink);
     if (EFI_IP6_EQUAL (Ip6Address, &Neighbor->Neighbor)) {
       RemoveEntryList (Entry);
-      InsertHeadList (&IpSb->NeighborTable, Entry);
+      InsertHeadList (Head, Entry);
 
       return Neighbor;
     }
@@ -658,6 +666,7 @@ Ip6FreeNeighborEntry (
     }
 
     RemoveEntryList (&NeighborCache->Link);
+    RemoveEntryList (&NeighborCache->HashLink);
     FreePool (NeighborCache);
   }
 
@@ -2757,6 +2766,7 @@ Ip6DelNeighbor (
   }
 
   RemoveEntryList (&Neighbor->Link);
+  RemoveEntryList (&Neighbor->HashLink);
   FreePool (Neighbor);
 
   return EFI_SUCCESS;
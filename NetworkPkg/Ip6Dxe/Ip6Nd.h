@@ -47,9 +47,19 @@ enum {
   IP6_ND_LENGTH           = 24,
   IP6_RA_LENGTH           = 16,
   IP6_REDITECT_LENGTH     = 40,
-  IP6_DAD_ENTRY_SIGNATURE = SIGNATURE_32 ('I', 'P', 'D', 'E')
+  IP6_DAD_ENTRY_SIGNATURE = SIGNATURE_32 ('I', 'P', 'D', 'E'),
+
+  IP6_NEIGHBOR_HASH_SIZE = 32
 };
 
+//
+// Hash a neighbor's IPv6 address into the neighbor hash table. The low
+// bytes hold the interface identifier, which distinguishes the on-link
+// neighbors that share a common prefix.
+//
+#define IP6_NEIGHBOR_HASH(Ip6) \
+  (((Ip6)->Addr[12] ^ (Ip6)->Addr[13] ^ (Ip6)->Addr[14] ^ (Ip6)->Addr[15]) % IP6_NEIGHBOR_HASH_SIZE)
+
 typedef
 VOID
 (*IP6_ARP_CALLBACK) (
@@ -125,6 +135,7 @@ typedef struct _IP6_DELAY_JOIN_LIST {
 
 typedef struct _IP6_NEIGHBOR_ENTRY {
   LIST_ENTRY                Link;
+  LIST_ENTRY                HashLink;
   LIST_ENTRY                ArpList;
   INTN                      RefCnt;
   BOOLEAN                   IsRouter;
@@ -1617,7 +1617,8 @@ NetblockChecksum (
   IN UINT32  Len
   )
 {
-  register UINT32  Sum;
+  register UINT64  Sum;
+  UINT64           Chunk;
 
   Sum = 0;
 
@@ -1628,6 +1629,29 @@ NetblockChecksum (
     Sum += *(Bulk + Len - 1);
   }
 
+  //
+  // Accumulate eight bytes at a time with end-around carry. A one's
+  // complement sum folds to the same 16-bit checksum no matter how wide
+  // the words it was accumulated in are, so the wide accumulation only
+  // cuts the loop iterations.
+  //
+  while (Len >= 8) {
+    Chunk = ReadUnaligned64 ((UINT64 *)Bulk);
+    Sum  += Chunk;
+    if (Sum < Chunk) {
+      Sum++;
+    }
+
+    Bulk += 8;
+    Len  -= 8;
+  }
+
+  //
+  // Fold the wide sum to 32 bits first, so the remaining word additions
+  // cannot overflow the accumulator.
+  //
+  Sum = (Sum & 0xffffffff) + (Sum >> 32);
+
   while (Len > 1) {
     Sum  += *(UINT16 *)Bulk;
     Bulk += 2;
@@ -512,6 +512,11 @@ MnpInitializeDeviceData (
   InitializeListHead (&MnpDeviceData->AllTxBufList);
   MnpDeviceData->TxBufCount = 0;
 
+  //
+  // Initialize the pool of recycled Rx wrap structures.
+  //
+  InitializeListHead (&MnpDeviceData->FreeRxWrapList);
+
   //
   // Create the system poll timer.
   //
@@ -619,6 +624,7 @@ MnpDestroyDeviceData (
   LIST_ENTRY       *Entry;
   LIST_ENTRY       *NextEntry;
   MNP_TX_BUF_WRAP  *TxBufWrap;
+  MNP_RXDATA_WRAP  *RxDataWrap;
 
   NET_CHECK_SIGNATURE (MnpDeviceData, MNP_DEVICE_DATA_SIGNATURE);
 
@@ -653,6 +659,17 @@ MnpDestroyDeviceData (
   ASSERT (IsListEmpty (&MnpDeviceData->AllTxBufList));
   ASSERT (MnpDeviceData->TxBufCount == 0);
 
+  //
+  // Free the recycled Rx wrap pool.
+  //
+  NET_LIST_FOR_EACH_SAFE (Entry, NextEntry, &MnpDeviceData->FreeRxWrapList) {
+    RxDataWrap = NET_LIST_USER_STRUCT (Entry, MNP_RXDATA_WRAP, WrapEntry);
+    RemoveEntryList (Entry);
+    gBS->CloseEvent (RxDataWrap->RxData.RecycleEvent);
+    FreePool (RxDataWrap);
+  }
+  ASSERT (IsListEmpty (&MnpDeviceData->FreeRxWrapList));
+
   //
   // Free the RxNbufCache.
   //
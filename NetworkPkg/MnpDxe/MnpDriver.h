@@ -64,6 +64,13 @@ typedef struct {
   LIST_ENTRY                     AllTxBufList;
   UINT32                         TxBufCount;
 
+  //
+  // List of free MNP_RXDATA_WRAP, recycled with their events created,
+  // to avoid the per-packet allocation and event creation on the
+  // receive hot path.
+  //
+  LIST_ENTRY                     FreeRxWrapList;
+
   NET_BUF_QUEUE                  FreeNbufQue;
   INTN                           NbufCnt;
 
@@ -22,6 +22,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define MNP_MAX_NET_BUFFER_NUM       65536
 #define MNP_TX_BUFFER_INCREASEMENT   32     // Same as the recycling Q length for xmit_done in UNDI command.
 #define MNP_MAX_TX_BUFFER_NUM        65536
+#define MNP_RX_BURST_MAX             32     // Max frames drained from Snp per poll invocation.
 
 #define MNP_MAX_RCVD_PACKET_QUE_SIZE  256
 
@@ -445,17 +445,17 @@ MnpRecycleRxData (
   MnpFreeNbuf (MnpDeviceData, RxDataWrap->Nbuf);
   RxDataWrap->Nbuf = NULL;
 
-  //
-  // Close the recycle event.
-  //
-  gBS->CloseEvent (RxDataWrap->RxData.RecycleEvent);
-
   //
   // Remove this Wrap entry from the list.
   //
   RemoveEntryList (&RxDataWrap->WrapEntry);
 
-  FreePool (RxDataWrap);
+  //
+  // Return the wrap to the free pool keeping its recycle event, so the
+  // next received packet does not pay for an allocation and an event
+  // creation.
+  //
+  InsertTailList (&MnpDeviceData->FreeRxWrapList, &RxDataWrap->WrapEntry);
 }
 
 /**
@@ -704,14 +704,45 @@ MnpWrapRxData (
 {
   EFI_STATUS       Status;
   MNP_RXDATA_WRAP  *RxDataWrap;
+  MNP_DEVICE_DATA  *MnpDeviceData;
+  EFI_EVENT        RecycleEvent;
 
-  //
-  // Allocate memory.
-  //
-  RxDataWrap = AllocatePool (sizeof (MNP_RXDATA_WRAP));
-  if (RxDataWrap == NULL) {
-    DEBUG ((DEBUG_ERROR, "MnpDispatchPacket: Failed to allocate a MNP_RXDATA_WRAP.\n"));
-    return NULL;
+  MnpDeviceData = Instance->MnpServiceData->MnpDeviceData;
+
+  if (!IsListEmpty (&MnpDeviceData->FreeRxWrapList)) {
+    //
+    // Reuse a recycled wrap together with its recycle event.
+    //
+    RxDataWrap = NET_LIST_HEAD (&MnpDeviceData->FreeRxWrapList, MNP_RXDATA_WRAP, WrapEntry);
+    RemoveEntryList (&RxDataWrap->WrapEntry);
+
+    RecycleEvent = RxDataWrap->RxData.RecycleEvent;
+  } else {
+    //
+    // Allocate memory.
+    //
+    RxDataWrap = AllocatePool (sizeof (MNP_RXDATA_WRAP));
+    if (RxDataWrap == NULL) {
+      DEBUG ((DEBUG_ERROR, "MnpDispatchPacket: Failed to allocate a MNP_RXDATA_WRAP.\n"));
+      return NULL;
+    }
+
+    //
+    // Create the recycle event.
+    //
+    Status = gBS->CreateEvent (
+                    EVT_NOTIFY_SIGNAL,
+                    TPL_NOTIFY,
+                    MnpRecycleRxData,
+                    RxDataWrap,
+                    &RecycleEvent
+                    );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "MnpDispatchPacket: gBS->CreateEvent failed, %r.\n", Status));
+
+      FreePool (RxDataWrap);
+      return NULL;
+    }
   }
 
   RxDataWrap->Instance = Instance;
@@ -720,23 +751,7 @@ MnpWrapRxData (
   // Fill the RxData in RxDataWrap,
   //
   CopyMem (&RxDataWrap->RxData, RxData, sizeof (RxDataWrap->RxData));
-
-  //
-  // Create the recycle event.
-  //
-  Status = gBS->CreateEvent (
-                  EVT_NOTIFY_SIGNAL,
-                  TPL_NOTIFY,
-                  MnpRecycleRxData,
-                  RxDataWrap,
-                  &RxDataWrap->RxData.RecycleEvent
-                  );
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "MnpDispatchPacket: gBS->CreateEvent failed, %r.\n", Status));
-
-    FreePool (RxDataWrap);
-    return NULL;
-  }
+  RxDataWrap->RxData.RecycleEvent = RecycleEvent;
 
   return RxDataWrap;
 }
@@ -1099,14 +1114,21 @@ MnpSystemPoll (
   )
 {
   MNP_DEVICE_DATA  *MnpDeviceData;
+  UINTN            Index;
 
   MnpDeviceData = (MNP_DEVICE_DATA *)Context;
   NET_CHECK_SIGNATURE (MnpDeviceData, MNP_DEVICE_DATA_SIGNATURE);
 
   //
-  // Try to receive packets from Snp.
+  // Try to receive packets from Snp. Snp->Receive() returns a single frame
+  // per call, so drain a burst of frames per poll tick to amortize the
+  // per-poll overhead when frames arrive faster than the timer fires.
   //
-  MnpReceivePacket (MnpDeviceData);
+  for (Index = 0; Index < MNP_RX_BURST_MAX; Index++) {
+    if (EFI_ERROR (MnpReceivePacket (MnpDeviceData))) {
+      break;
+    }
+  }
 
   //
   // Dispatch the DPC queued by the NotifyFunction of rx token's events.
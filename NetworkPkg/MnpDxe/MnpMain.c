@@ -756,6 +756,7 @@ MnpPoll (
   EFI_STATUS         Status;
   MNP_INSTANCE_DATA  *Instance;
   EFI_TPL            OldTpl;
+  UINTN              Index;
 
   if (This == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -771,9 +772,19 @@ MnpPoll (
   }
 
   //
-  // Try to receive packets.
+  // Try to receive packets. Snp->Receive() returns a single frame per call,
+  // so keep draining a burst of frames once the first one is received. The
+  // status of the first call decides the return value, the extra frames are
+  // a best-effort drain.
   //
   Status = MnpReceivePacket (Instance->MnpServiceData->MnpDeviceData);
+  if (!EFI_ERROR (Status)) {
+    for (Index = 1; Index < MNP_RX_BURST_MAX; Index++) {
+      if (EFI_ERROR (MnpReceivePacket (Instance->MnpServiceData->MnpDeviceData))) {
+        break;
+      }
+    }
+  }
 
   //
   // Dispatch the DPC queued by the NotifyFunction of rx token's events.
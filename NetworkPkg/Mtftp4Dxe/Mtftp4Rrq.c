@@ -249,6 +249,7 @@ Mtftp4RrqHandleData (
 {
   EFI_STATUS  Status;
   UINT16      BlockNum;
+  UINT16      Gap;
   INTN        Expected;
 
   *Completed = FALSE;
@@ -259,11 +260,23 @@ Mtftp4RrqHandleData (
   ASSERT (Expected >= 0);
 
   //
-  // If we are active (Master) and received an unexpected packet, transmit
-  // the ACK for the block we received, then restart receiving the
-  // expected one. If we are passive (Slave), save the block.
+  // If we are active (Master) and received an unexpected packet, buffer
+  // the block when it falls inside the negotiated window so a single
+  // lost packet doesn't discard the rest of the window, then transmit
+  // the ACK for the last block received in order to make the server
+  // roll back to the hole. If we are passive (Slave), save the block.
   //
   if (Instance->Master && (Expected != BlockNum)) {
+    Gap = (UINT16)(BlockNum - (UINT16)Expected);
+
+    if (Gap < Instance->WindowSize) {
+      Status = Mtftp4RrqSaveBlock (Instance, Packet, Len);
+
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+    }
+
     //
     // If Expected is 0, (UINT16) (Expected - 1) is also the expected Ack number (65535).
     //
@@ -196,22 +196,28 @@ Mtftp4RemoveBlockNum (
     //
     if (Range->Start > Num) {
       return EFI_NOT_FOUND;
-    } else if (Range->Start == Num) {
-      Range->Start++;
+    }
 
-      //
-      // Note that: RFC 1350 does not mention block counter roll-over,
-      // but several TFTP hosts implement the roll-over be able to accept
-      // transfers of unlimited size. There is no consensus, however, whether
-      // the counter should wrap around to zero or to one. Many implementations
-      // wrap to zero, because this is the simplest to implement. Here we choose
-      // this solution.
-      //
-      *BlockCounter = Num;
-
-      if (Range->Round > 0) {
-        *BlockCounter += Range->Bound +  MultU64x32 ((UINTN)(Range->Round -1), (UINT32)(Range->Bound + 1)) + 1;
-      }
+    //
+    // Note that: RFC 1350 does not mention block counter roll-over,
+    // but several TFTP hosts implement the roll-over be able to accept
+    // transfers of unlimited size. There is no consensus, however, whether
+    // the counter should wrap around to zero or to one. Many implementations
+    // wrap to zero, because this is the simplest to implement. Here we choose
+    // this solution.
+    //
+    // The continuous counter is computed for mid-hole removals as well,
+    // it decides where an out-of-order block lands in the user buffer.
+    // The whole hole [Start, End] shares the Start's roll-over round.
+    //
+    *BlockCounter = Num;
+
+    if (Range->Round > 0) {
+      *BlockCounter += Range->Bound +  MultU64x32 ((UINTN)(Range->Round -1), (UINT32)(Range->Bound + 1)) + 1;
+    }
+
+    if (Range->Start == Num) {
+      Range->Start++;
 
       if (Range->Start > Range->Bound) {
         Range->Start = 0;
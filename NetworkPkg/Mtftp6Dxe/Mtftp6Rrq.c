@@ -219,6 +219,7 @@ Mtftp6RrqHandleData (
 {
   EFI_STATUS  Status;
   UINT16      BlockNum;
+  UINT16      Gap;
   INTN        Expected;
 
   *IsCompleted = FALSE;
@@ -229,11 +230,23 @@ Mtftp6RrqHandleData (
   ASSERT (Expected >= 0);
 
   //
-  // If we are active (Master) and received an unexpected packet, transmit
-  // the ACK for the block we received, then restart receiving the
-  // expected one. If we are passive (Slave), save the block.
+  // If we are active (Master) and received an unexpected packet, buffer
+  // the block when it falls inside the negotiated window so a single
+  // lost packet doesn't discard the rest of the window, then transmit
+  // the ACK for the last block received in order to make the server
+  // roll back to the hole. If we are passive (Slave), save the block.
   //
   if (Instance->IsMaster && (Expected != BlockNum)) {
+    Gap = (UINT16)(BlockNum - (UINT16)Expected);
+
+    if (Gap < Instance->WindowSize) {
+      Status = Mtftp6RrqSaveBlock (Instance, Packet, Len, UdpPacket);
+
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+    }
+
     //
     // Free the received packet before send new packet in ReceiveNotify,
     // since the udpio might need to be reconfigured.
@@ -160,6 +160,27 @@ TcpSynBuildOption (
     TcpPutUint32 (Data, TCP_OPTION_WS_FAST | TcpComputeScale (Tcb));
   }
 
+  //
+  // Build the SACK-Permitted option, under the same conditions
+  // as the window scale option.
+  //
+  if (!TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_NO_SACK) &&
+      (!TCP_FLG_ON (TCPSEG_NETBUF (Nbuf)->Flag, TCP_FLG_ACK) ||
+       TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_RCVD_SACK_PERMITTED))
+      )
+  {
+    Data = NetbufAllocSpace (
+             Nbuf,
+             TCP_OPTION_SACK_PERMITTED_ALIGNED_LEN,
+             NET_BUF_HEAD
+             );
+
+    ASSERT (Data != NULL);
+
+    Len += TCP_OPTION_SACK_PERMITTED_ALIGNED_LEN;
+    TcpPutUint32 (Data, TCP_OPTION_SACK_PERMITTED_FAST);
+  }
+
   //
   // Build the MSS option.
   //
@@ -187,11 +208,13 @@ TcpBuildOption (
   IN NET_BUF  *Nbuf
   )
 {
-  UINT8   *Data;
-  UINT16  Len;
+  UINT8    *Data;
+  UINT16   Len;
+  BOOLEAN  NoData;
 
   ASSERT ((Tcb != NULL) && (Nbuf != NULL) && (Nbuf->Tcp == NULL));
-  Len = 0;
+  Len    = 0;
+  NoData = (BOOLEAN)(Nbuf->TotalSize == 0);
 
   //
   // Build the Timestamp option.
@@ -214,6 +237,98 @@ TcpBuildOption (
     TcpPutUint32 (Data + 8, Tcb->TsRecent);
   }
 
+  //
+  // Build the SACK option from the out-of-order reassembly queue. The
+  // option is only appended to segments carrying no data, so that a full
+  // sized data segment never grows beyond the negotiated MSS.
+  //
+  if (TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_SND_SACK) &&
+      !TCP_FLG_ON (TCPSEG_NETBUF (Nbuf)->Flag, TCP_FLG_RST) &&
+      NoData && !IsListEmpty (&Tcb->RcvQue)
+      )
+  {
+    Len += TcpBuildSackOption (Tcb, Nbuf);
+  }
+
+  return Len;
+}
+
+/**
+  Build the SACK option from the out-of-order reassembly queue.
+
+  @param[in]  Tcb     Pointer to the TCP_CB of this TCP instance.
+  @param[in]  Nbuf    Pointer to the buffer to store the options.
+
+  @return             The length of the SACK option field, 0 if the
+                      reassembly queue contains no block to report.
+
+**/
+UINT16
+TcpBuildSackOption (
+  IN TCP_CB   *Tcb,
+  IN NET_BUF  *Nbuf
+  )
+{
+  LIST_ENTRY  *Entry;
+  NET_BUF     *Node;
+  TCP_SEG     *Seg;
+  TCP_SEQNO   Left[TCP_OPTION_MAX_SACK_BLOCK];
+  TCP_SEQNO   Right[TCP_OPTION_MAX_SACK_BLOCK];
+  UINT32      Count;
+  UINT32      Index;
+  UINT8       *Data;
+  UINT16      Len;
+
+  ASSERT ((Tcb != NULL) && (Nbuf != NULL));
+
+  //
+  // Coalesce the segments on the reassembly queue into SACK blocks. The
+  // queue is kept sorted by sequence number, so contiguous segments fold
+  // into a single block.
+  //
+  Count = 0;
+
+  NET_LIST_FOR_EACH (Entry, &Tcb->RcvQue) {
+    Node = NET_LIST_USER_STRUCT (Entry, NET_BUF, List);
+    Seg  = TCPSEG_NETBUF (Node);
+
+    if ((Count != 0) && TCP_SEQ_LEQ (Seg->Seq, Right[Count - 1])) {
+      if (TCP_SEQ_GT (Seg->End, Right[Count - 1])) {
+        Right[Count - 1] = Seg->End;
+      }
+
+      continue;
+    }
+
+    if (Count == TCP_OPTION_MAX_SACK_BLOCK) {
+      break;
+    }
+
+    Left[Count]  = Seg->Seq;
+    Right[Count] = Seg->End;
+    Count++;
+  }
+
+  if (Count == 0) {
+    return 0;
+  }
+
+  Len = (UINT16)(TCP_OPTION_SACK_HEAD_ALIGNED_LEN + Count * TCP_OPTION_SACK_BLOCK_LEN);
+
+  Data = NetbufAllocSpace (Nbuf, Len, NET_BUF_HEAD);
+  ASSERT (Data != NULL);
+
+  TcpPutUint32 (
+    Data,
+    (TCP_OPTION_NOP << 24) | (TCP_OPTION_NOP << 16) | (TCP_OPTION_SACK << 8) |
+    (2 + Count * TCP_OPTION_SACK_BLOCK_LEN)
+    );
+
+  for (Index = 0; Index < Count; Index++) {
+    TcpPutUint32 (Data + 4 + Index * TCP_OPTION_SACK_BLOCK_LEN, Left[Index]);
+    TcpPutUint32 (Data + 8 + Index * TCP_OPTION_SACK_BLOCK_LEN, Right[Index]);
+  }
+
   return Len;
 }
 
@@ -297,6 +412,18 @@ TcpParseOption (
         Cur += TCP_OPTION_WS_LEN;
         break;
 
+      case TCP_OPTION_SACK_PERMITTED:
+        Len = Head[Cur + 1];
+
+        if ((Len != TCP_OPTION_SACK_PERMITTED_LEN) || (TotalLen - Cur < TCP_OPTION_SACK_PERMITTED_LEN)) {
+          return -1;
+        }
+
+        TCP_SET_FLG (Option->Flag, TCP_OPTION_RCVD_SACK_PERMITTED);
+
+        Cur += TCP_OPTION_SACK_PERMITTED_LEN;
+        break;
+
       case TCP_OPTION_TS:
         Len = Head[Cur + 1];
 
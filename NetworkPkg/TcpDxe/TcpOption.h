@@ -13,16 +13,22 @@
 //
 // Supported TCP option types and their length.
 //
-#define TCP_OPTION_EOP             0  ///< End Of oPtion
-#define TCP_OPTION_NOP             1  ///< No-Option.
-#define TCP_OPTION_MSS             2  ///< Maximum Segment Size
-#define TCP_OPTION_WS              3  ///< Window scale
-#define TCP_OPTION_TS              8  ///< Timestamp
-#define TCP_OPTION_MSS_LEN         4  ///< Length of MSS option
-#define TCP_OPTION_WS_LEN          3  ///< Length of window scale option
-#define TCP_OPTION_TS_LEN          10 ///< Length of timestamp option
-#define TCP_OPTION_WS_ALIGNED_LEN  4  ///< Length of window scale option, aligned
-#define TCP_OPTION_TS_ALIGNED_LEN  12 ///< Length of timestamp option, aligned
+#define TCP_OPTION_EOP                         0  ///< End Of oPtion
+#define TCP_OPTION_NOP                         1  ///< No-Option.
+#define TCP_OPTION_MSS                         2  ///< Maximum Segment Size
+#define TCP_OPTION_WS                          3  ///< Window scale
+#define TCP_OPTION_SACK_PERMITTED              4  ///< SACK-Permitted
+#define TCP_OPTION_SACK                        5  ///< Selective ACKnowledgment
+#define TCP_OPTION_TS                          8  ///< Timestamp
+#define TCP_OPTION_MSS_LEN                     4  ///< Length of MSS option
+#define TCP_OPTION_WS_LEN                      3  ///< Length of window scale option
+#define TCP_OPTION_SACK_PERMITTED_LEN          2  ///< Length of SACK-Permitted option
+#define TCP_OPTION_SACK_BLOCK_LEN              8  ///< Length of one SACK block
+#define TCP_OPTION_TS_LEN                      10 ///< Length of timestamp option
+#define TCP_OPTION_WS_ALIGNED_LEN              4  ///< Length of window scale option, aligned
+#define TCP_OPTION_SACK_PERMITTED_ALIGNED_LEN  4  ///< Length of SACK-Permitted option, aligned
+#define TCP_OPTION_SACK_HEAD_ALIGNED_LEN       4  ///< Length of SACK option head, aligned
+#define TCP_OPTION_TS_ALIGNED_LEN              12 ///< Length of timestamp option, aligned
 
 //
 // recommend format of timestamp window scale
@@ -39,14 +45,21 @@
 
 #define TCP_OPTION_MSS_FAST  ((TCP_OPTION_MSS << 24) | (TCP_OPTION_MSS_LEN << 16))
 
+#define TCP_OPTION_SACK_PERMITTED_FAST  ((TCP_OPTION_NOP << 24) |            \
+                                        (TCP_OPTION_NOP << 16) |             \
+                                        (TCP_OPTION_SACK_PERMITTED << 8) |   \
+                                        TCP_OPTION_SACK_PERMITTED_LEN)
+
 //
 // Other misc definitions
 //
-#define TCP_OPTION_RCVD_MSS  0x01
-#define TCP_OPTION_RCVD_WS   0x02
-#define TCP_OPTION_RCVD_TS   0x04
-#define TCP_OPTION_MAX_WS    14            ///< Maximum window scale value
-#define TCP_OPTION_MAX_WIN   0xffff        ///< Max window size in TCP header
+#define TCP_OPTION_RCVD_MSS             0x01
+#define TCP_OPTION_RCVD_WS              0x02
+#define TCP_OPTION_RCVD_TS              0x04
+#define TCP_OPTION_RCVD_SACK_PERMITTED  0x08
+#define TCP_OPTION_MAX_WS               14      ///< Maximum window scale value
+#define TCP_OPTION_MAX_WIN              0xffff  ///< Max window size in TCP header
+#define TCP_OPTION_MAX_SACK_BLOCK       3       ///< Max SACK blocks that fit beside a timestamp option
 
 ///
 /// The structure to store the parse option value.
@@ -103,6 +116,22 @@ TcpBuildOption (
   IN NET_BUF  *Nbuf
   );
 
+/**
+  Build the SACK option from the out-of-order reassembly queue.
+
+  @param[in]  Tcb     Pointer to the TCP_CB of this TCP instance.
+  @param[in]  Nbuf    Pointer to the buffer to store the options.
+
+  @return             The length of the SACK option field, 0 if the
+                      reassembly queue contains no block to report.
+
+**/
+UINT16
+TcpBuildSackOption (
+  IN TCP_CB   *Tcb,
+  IN NET_BUF  *Nbuf
+  );
+
 /**
   Parse the supported options.
 
@@ -55,21 +55,24 @@
 //
 // TCP control flags
 //
-#define TCP_CTRL_NO_NAGLE      0x0001   ///< Disable Nagle algorithm
-#define TCP_CTRL_NO_KEEPALIVE  0x0002   ///< Disable keepalive timer.
-#define TCP_CTRL_NO_WS         0x0004   ///< Disable window scale option.
-#define TCP_CTRL_RCVD_WS       0x0008   ///< Received a wnd scale option in syn.
-#define TCP_CTRL_NO_TS         0x0010   ///< Disable Timestamp option.
-#define TCP_CTRL_RCVD_TS       0x0020   ///< Received a Timestamp option in syn.
-#define TCP_CTRL_SND_TS        0x0040   ///< Send Timestamp option to remote.
-#define TCP_CTRL_SND_URG       0x0080   ///< In urgent send mode.
-#define TCP_CTRL_RCVD_URG      0x0100   ///< In urgent receive mode.
-#define TCP_CTRL_SND_PSH       0x0200   ///< In PUSH send mode.
-#define TCP_CTRL_FIN_SENT      0x0400   ///< FIN is sent.
-#define TCP_CTRL_FIN_ACKED     0x0800   ///< FIN is ACKed.
-#define TCP_CTRL_TIMER_ON      0x1000   ///< At least one of the timer is on.
-#define TCP_CTRL_RTT_ON        0x2000   ///< The RTT measurement is on.
-#define TCP_CTRL_ACK_NOW       0x4000   ///< Send the ACK now, don't delay.
+#define TCP_CTRL_NO_NAGLE             0x0001   ///< Disable Nagle algorithm
+#define TCP_CTRL_NO_KEEPALIVE         0x0002   ///< Disable keepalive timer.
+#define TCP_CTRL_NO_WS                0x0004   ///< Disable window scale option.
+#define TCP_CTRL_RCVD_WS              0x0008   ///< Received a wnd scale option in syn.
+#define TCP_CTRL_NO_TS                0x0010   ///< Disable Timestamp option.
+#define TCP_CTRL_RCVD_TS              0x0020   ///< Received a Timestamp option in syn.
+#define TCP_CTRL_SND_TS               0x0040   ///< Send Timestamp option to remote.
+#define TCP_CTRL_SND_URG              0x0080   ///< In urgent send mode.
+#define TCP_CTRL_RCVD_URG             0x0100   ///< In urgent receive mode.
+#define TCP_CTRL_SND_PSH              0x0200   ///< In PUSH send mode.
+#define TCP_CTRL_FIN_SENT             0x0400   ///< FIN is sent.
+#define TCP_CTRL_FIN_ACKED            0x0800   ///< FIN is ACKed.
+#define TCP_CTRL_TIMER_ON             0x1000   ///< At least one of the timer is on.
+#define TCP_CTRL_RTT_ON               0x2000   ///< The RTT measurement is on.
+#define TCP_CTRL_ACK_NOW              0x4000   ///< Send the ACK now, don't delay.
+#define TCP_CTRL_NO_SACK              0x8000   ///< Disable the SACK option.
+#define TCP_CTRL_RCVD_SACK_PERMITTED  0x10000  ///< Received a SACK-Permitted option in syn.
+#define TCP_CTRL_SND_SACK             0x20000  ///< Send the SACK option to remote.
 
 //
 // Timer related values
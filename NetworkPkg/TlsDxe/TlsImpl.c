@@ -66,25 +66,33 @@ TlsEncryptPacket (
     BufferInSize += (*FragmentTable)[Index].FragmentLength;
   }
 
-  //
-  // Allocate buffer for processing data.
-  //
-  BufferIn = AllocateZeroPool (BufferInSize);
-  if (BufferIn == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto ERROR;
-  }
+  if (*FragmentCount == 1) {
+    //
+    // Single fragment is the common case, process it in place instead of
+    // coalescing it into a scratch buffer.
+    //
+    BufferIn = (*FragmentTable)[0].FragmentBuffer;
+  } else {
+    //
+    // Allocate buffer for processing data.
+    //
+    BufferIn = AllocatePool (BufferInSize);
+    if (BufferIn == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto ERROR;
+    }
 
-  //
-  // Copy all TLS plain record header and payload into BufferIn.
-  //
-  for (Index = 0; Index < *FragmentCount; Index++) {
-    CopyMem (
-      (BufferIn + BytesCopied),
-      (*FragmentTable)[Index].FragmentBuffer,
-      (*FragmentTable)[Index].FragmentLength
-      );
-    BytesCopied += (*FragmentTable)[Index].FragmentLength;
+    //
+    // Copy all TLS plain record header and payload into BufferIn.
+    //
+    for (Index = 0; Index < *FragmentCount; Index++) {
+      CopyMem (
+        (BufferIn + BytesCopied),
+        (*FragmentTable)[Index].FragmentBuffer,
+        (*FragmentTable)[Index].FragmentLength
+        );
+      BytesCopied += (*FragmentTable)[Index].FragmentLength;
+    }
   }
 
   //
@@ -103,9 +111,11 @@ TlsEncryptPacket (
   }
 
   //
-  // Allocate enough buffer to hold TLS Ciphertext.
+  // Allocate enough buffer to hold TLS Ciphertext. Only the leading
+  // BufferOutSize bytes are handed to the caller, so the buffer does not
+  // need to be zeroed.
   //
-  BufferOut = AllocateZeroPool (RecordCount * (TLS_RECORD_HEADER_LENGTH + TLS_CIPHERTEXT_RECORD_MAX_PAYLOAD_LENGTH));
+  BufferOut = AllocatePool (RecordCount * (TLS_RECORD_HEADER_LENGTH + TLS_CIPHERTEXT_RECORD_MAX_PAYLOAD_LENGTH));
   if (BufferOut == NULL) {
     Status = EFI_OUT_OF_RESOURCES;
     goto ERROR;
@@ -142,7 +152,10 @@ TlsEncryptPacket (
     TempRecordHeader = (TLS_RECORD_HEADER *)((UINT8 *)TempRecordHeader + ThisMessageSize);
   }
 
-  FreePool (BufferIn);
+  if (*FragmentCount > 1) {
+    FreePool (BufferIn);
+  }
+
   BufferIn = NULL;
 
   //
@@ -162,7 +175,7 @@ TlsEncryptPacket (
 
 ERROR:
 
-  if (BufferIn != NULL) {
+  if ((BufferIn != NULL) && (*FragmentCount > 1)) {
     FreePool (BufferIn);
     BufferIn = NULL;
   }
@@ -232,25 +245,33 @@ TlsDecryptPacket (
     BufferInSize += (*FragmentTable)[Index].FragmentLength;
   }
 
-  //
-  // Allocate buffer for processing data
-  //
-  BufferIn = AllocateZeroPool (BufferInSize);
-  if (BufferIn == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto ERROR;
-  }
+  if (*FragmentCount == 1) {
+    //
+    // Single fragment is the common case, process it in place instead of
+    // coalescing it into a scratch buffer.
+    //
+    BufferIn = (*FragmentTable)[0].FragmentBuffer;
+  } else {
+    //
+    // Allocate buffer for processing data
+    //
+    BufferIn = AllocatePool (BufferInSize);
+    if (BufferIn == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto ERROR;
+    }
 
-  //
-  // Copy all TLS plain record header and payload to BufferIn
-  //
-  for (Index = 0; Index < *FragmentCount; Index++) {
-    CopyMem (
-      (BufferIn + BytesCopied),
-      (*FragmentTable)[Index].FragmentBuffer,
-      (*FragmentTable)[Index].FragmentLength
-      );
-    BytesCopied += (*FragmentTable)[Index].FragmentLength;
+    //
+    // Copy all TLS plain record header and payload to BufferIn
+    //
+    for (Index = 0; Index < *FragmentCount; Index++) {
+      CopyMem (
+        (BufferIn + BytesCopied),
+        (*FragmentTable)[Index].FragmentBuffer,
+        (*FragmentTable)[Index].FragmentLength
+        );
+      BytesCopied += (*FragmentTable)[Index].FragmentLength;
+    }
   }
 
   //
@@ -269,9 +290,11 @@ TlsDecryptPacket (
   }
 
   //
-  // Allocate enough buffer to hold TLS Plaintext.
+  // Allocate enough buffer to hold TLS Plaintext. Only the leading
+  // BufferOutSize bytes are handed to the caller, so the buffer does not
+  // need to be zeroed.
   //
-  BufferOut = AllocateZeroPool (RecordCount * (TLS_RECORD_HEADER_LENGTH + TLS_PLAINTEXT_RECORD_MAX_PAYLOAD_LENGTH));
+  BufferOut = AllocatePool (RecordCount * (TLS_RECORD_HEADER_LENGTH + TLS_PLAINTEXT_RECORD_MAX_PAYLOAD_LENGTH));
   if (BufferOut == NULL) {
     Status = EFI_OUT_OF_RESOURCES;
     goto ERROR;
@@ -316,7 +339,10 @@ TlsDecryptPacket (
     TempRecordHeader = (TLS_RECORD_HEADER *)((UINT8 *)TempRecordHeader + TLS_RECORD_HEADER_LENGTH + ThisPlainMessageSize);
   }
 
-  FreePool (BufferIn);
+  if (*FragmentCount > 1) {
+    FreePool (BufferIn);
+  }
+
   BufferIn = NULL;
 
   //
@@ -336,7 +362,7 @@ TlsDecryptPacket (
 
 ERROR:
 
-  if (BufferIn != NULL) {
+  if ((BufferIn != NULL) && (*FragmentCount > 1)) {
     FreePool (BufferIn);
     BufferIn = NULL;
   }
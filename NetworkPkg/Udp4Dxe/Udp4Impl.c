@@ -268,6 +268,7 @@ Udp4CreateService (
   EFI_STATUS           Status;
   IP_IO_OPEN_DATA      OpenData;
   EFI_IP4_CONFIG_DATA  *Ip4ConfigData;
+  UINT32               Index;
 
   ZeroMem (Udp4Service, sizeof (UDP4_SERVICE_DATA));
 
@@ -279,6 +280,12 @@ Udp4CreateService (
 
   InitializeListHead (&Udp4Service->ChildrenList);
 
+  for (Index = 0; Index < UDP4_PORT_HASH_SIZE; Index++) {
+    InitializeListHead (&Udp4Service->PortHashTable[Index]);
+  }
+
+  InitializeListHead (&Udp4Service->WildcardList);
+
   //
   // Create the IpIo for this service context.
   //
@@ -455,6 +462,7 @@ Udp4InitInstance (
   // Init the lists.
   //
   InitializeListHead (&Instance->Link);
+  InitializeListHead (&Instance->PortLink);
   InitializeListHead (&Instance->RcvdDgramQue);
   InitializeListHead (&Instance->DeliveredDgramQue);
 
@@ -1323,6 +1331,59 @@ Udp4MatchDgram (
   return FALSE;
 }
 
+/**
+  This function adds the configured instance into the service's demultiplex
+  index, hashed by the station port or on the wildcard list if the instance
+  accepts any port or is in promiscuous mode.
+
+  @param[in]      Udp4Service    Pointer to the udp service context data.
+  @param[in, out] Instance       Pointer to the configured udp instance.
+
+**/
+VOID
+Udp4AddDemuxEntry (
+  IN     UDP4_SERVICE_DATA   *Udp4Service,
+  IN OUT UDP4_INSTANCE_DATA  *Instance
+  )
+{
+  EFI_UDP4_CONFIG_DATA  *ConfigData;
+
+  ConfigData = &Instance->ConfigData;
+
+  if (ConfigData->AcceptPromiscuous || ConfigData->AcceptAnyPort) {
+    //
+    // The instance doesn't filter on the destination port, it has to be
+    // consulted for every received datagram.
+    //
+    InsertTailList (&Udp4Service->WildcardList, &Instance->PortLink);
+  } else {
+    InsertTailList (
+      &Udp4Service->PortHashTable[UDP4_PORT_HASH (ConfigData->StationPort)],
+      &Instance->PortLink
+      );
+  }
+}
+
+/**
+  This function removes the instance from the service's demultiplex index.
+
+  The removal is a no-op if the instance isn't indexed, so it is safe to
+  call for a never-configured or already-reset instance.
+
+  @param[in, out] Instance       Pointer to the udp instance to remove.
+
+**/
+VOID
+Udp4RemoveDemuxEntry (
+  IN OUT UDP4_INSTANCE_DATA  *Instance
+  )
+{
+  if (!IsListEmpty (&Instance->PortLink)) {
+    RemoveEntryList (&Instance->PortLink);
+    InitializeListHead (&Instance->PortLink);
+  }
+}
+
 /**
   This function removes the Wrap specified by Context and release relevant resources.
 
@@ -1436,38 +1497,48 @@ Udp4EnqueueDgram (
   IN EFI_UDP4_RECEIVE_DATA  *RxData
   )
 {
+  LIST_ENTRY          *Head;
   LIST_ENTRY          *Entry;
   UDP4_INSTANCE_DATA  *Instance;
   UDP4_RXDATA_WRAP    *Wrap;
   UINTN               Enqueued;
+  UINTN               Pass;
 
   Enqueued = 0;
 
-  NET_LIST_FOR_EACH (Entry, &Udp4Service->ChildrenList) {
-    //
-    // Iterate the instances.
-    //
-    Instance = NET_LIST_USER_STRUCT (Entry, UDP4_INSTANCE_DATA, Link);
-
-    if (!Instance->Configured) {
-      continue;
-    }
+  //
+  // Only the instances hashed to the datagram's destination port and the
+  // instances on the wildcard list are candidate receivers, so the other
+  // children are not touched. Udp4MatchDgram still makes the final
+  // decision on the address and port filters.
+  //
+  Head = &Udp4Service->PortHashTable[UDP4_PORT_HASH (RxData->UdpSession.DestinationPort)];
 
-    if (Udp4MatchDgram (Instance, &RxData->UdpSession)) {
+  for (Pass = 0; Pass < 2; Pass++) {
+    NET_LIST_FOR_EACH (Entry, Head) {
       //
-      // Wrap the RxData and put this Wrap into the instances RcvdDgramQue.
+      // Iterate the candidate instances.
       //
-      Wrap = Udp4WrapRxData (Instance, Packet, RxData);
-      if (Wrap == NULL) {
-        continue;
-      }
+      Instance = NET_LIST_USER_STRUCT (Entry, UDP4_INSTANCE_DATA, PortLink);
 
-      NET_GET_REF (Packet);
+      if (Udp4MatchDgram (Instance, &RxData->UdpSession)) {
+        //
+        // Wrap the RxData and put this Wrap into the instances RcvdDgramQue.
+        //
+        Wrap = Udp4WrapRxData (Instance, Packet, RxData);
+        if (Wrap == NULL) {
+          continue;
+        }
 
-      InsertTailList (&Instance->RcvdDgramQue, &Wrap->Link);
+        NET_GET_REF (Packet);
 
-      Enqueued++;
+        InsertTailList (&Instance->RcvdDgramQue, &Wrap->Link);
+
+        Enqueued++;
+      }
     }
+
+    Head = &Udp4Service->WildcardList;
   }
 
   return Enqueued;
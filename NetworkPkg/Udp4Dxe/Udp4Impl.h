@@ -45,6 +45,9 @@ extern UINT16                        mUdp4RandomPort;
 
 #define UDP4_PORT_KNOWN  1024
 
+#define UDP4_PORT_HASH_SIZE  32
+#define UDP4_PORT_HASH(Port)  ((Port) & (UDP4_PORT_HASH_SIZE - 1))
+
 #define UDP4_SERVICE_DATA_SIGNATURE  SIGNATURE_32('U', 'd', 'p', '4')
 
 #define UDP4_SERVICE_DATA_FROM_THIS(a) \
@@ -64,6 +67,15 @@ typedef struct _UDP4_SERVICE_DATA_ {
   UINTN                           ChildrenNumber;
   IP_IO                           *IpIo;
 
+  //
+  // Demultiplex index over the configured children, maintained on
+  // Configure/reset. Instances bound to a station port are hashed by
+  // that port, instances accepting any port or in promiscuous mode are
+  // kept on the wildcard list which is checked for every datagram.
+  //
+  LIST_ENTRY                      PortHashTable[UDP4_PORT_HASH_SIZE];
+  LIST_ENTRY                      WildcardList;
+
   EFI_EVENT                       TimeoutEvent;
 } UDP4_SERVICE_DATA;
 
@@ -80,6 +92,7 @@ typedef struct _UDP4_SERVICE_DATA_ {
 typedef struct _UDP4_INSTANCE_DATA_ {
   UINT32                  Signature;
   LIST_ENTRY              Link;
+  LIST_ENTRY              PortLink;
 
   UDP4_SERVICE_DATA       *Udp4Service;
   EFI_UDP4_PROTOCOL       Udp4Proto;
@@ -484,6 +497,32 @@ Udp4Bind (
   IN OUT EFI_UDP4_CONFIG_DATA  *ConfigData
   );
 
+/**
+  This function adds the configured instance into the service's demultiplex
+  index, hashed by the station port or on the wildcard list if the instance
+  accepts any port or is in promiscuous mode.
+
+  @param[in]      Udp4Service    Pointer to the udp service context data.
+  @param[in, out] Instance       Pointer to the configured udp instance.
+
+**/
+VOID
+Udp4AddDemuxEntry (
+  IN     UDP4_SERVICE_DATA   *Udp4Service,
+  IN OUT UDP4_INSTANCE_DATA  *Instance
+  );
+
+/**
+  This function removes the instance from the service's demultiplex index.
+
+  @param[in, out] Instance       Pointer to the udp instance to remove.
+
+**/
+VOID
+Udp4RemoveDemuxEntry (
+  IN OUT UDP4_INSTANCE_DATA  *Instance
+  );
+
 /**
   This function is used to check whether the NewConfigData has any un-reconfigurable
   parameters changed compared to the OldConfigData.
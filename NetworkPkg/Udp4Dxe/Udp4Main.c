@@ -247,11 +247,18 @@ Udp4Configure (
                             );
 
       Instance->Configured = TRUE;
+
+      //
+      // Add the instance into the receive demultiplex index.
+      //
+      Udp4AddDemuxEntry (Udp4Service, Instance);
     }
   } else {
     //
     // UdpConfigData is NULL, reset the instance.
     //
+    Udp4RemoveDemuxEntry (Instance);
+
     Instance->Configured  = FALSE;
     Instance->IsNoMapping = FALSE;
 
@@ -290,6 +290,7 @@ Udp6CreateService (
 {
   EFI_STATUS       Status;
   IP_IO_OPEN_DATA  OpenData;
+  UINT32           Index;
 
   ZeroMem (Udp6Service, sizeof (UDP6_SERVICE_DATA));
 
@@ -301,6 +302,12 @@ Udp6CreateService (
 
   InitializeListHead (&Udp6Service->ChildrenList);
 
+  for (Index = 0; Index < UDP6_PORT_HASH_SIZE; Index++) {
+    InitializeListHead (&Udp6Service->PortHashTable[Index]);
+  }
+
+  InitializeListHead (&Udp6Service->WildcardList);
+
   //
   // Create the IpIo for this service context.
   //
@@ -476,6 +483,7 @@ Udp6InitInstance (
   // Init the lists.
   //
   InitializeListHead (&Instance->Link);
+  InitializeListHead (&Instance->PortLink);
   InitializeListHead (&Instance->RcvdDgramQue);
   InitializeListHead (&Instance->DeliveredDgramQue);
 
@@ -1327,6 +1335,59 @@ Udp6MatchDgram (
   return FALSE;
 }
 
+/**
+  This function adds the configured instance into the service's demultiplex
+  index, hashed by the station port or on the wildcard list if the instance
+  accepts any port or is in promiscuous mode.
+
+  @param[in]      Udp6Service    Pointer to the udp service context data.
+  @param[in, out] Instance       Pointer to the configured udp instance.
+
+**/
+VOID
+Udp6AddDemuxEntry (
+  IN     UDP6_SERVICE_DATA   *Udp6Service,
+  IN OUT UDP6_INSTANCE_DATA  *Instance
+  )
+{
+  EFI_UDP6_CONFIG_DATA  *ConfigData;
+
+  ConfigData = &Instance->ConfigData;
+
+  if (ConfigData->AcceptPromiscuous || ConfigData->AcceptAnyPort) {
+    //
+    // The instance doesn't filter on the destination port, it has to be
+    // consulted for every received datagram.
+    //
+    InsertTailList (&Udp6Service->WildcardList, &Instance->PortLink);
+  } else {
+    InsertTailList (
+      &Udp6Service->PortHashTable[UDP6_PORT_HASH (ConfigData->StationPort)],
+      &Instance->PortLink
+      );
+  }
+}
+
+/**
+  This function removes the instance from the service's demultiplex index.
+
+  The removal is a no-op if the instance isn't indexed, so it is safe to
+  call for a never-configured or already-reset instance.
+
+  @param[in, out] Instance       Pointer to the udp instance to remove.
+
+**/
+VOID
+Udp6RemoveDemuxEntry (
+  IN OUT UDP6_INSTANCE_DATA  *Instance
+  )
+{
+  if (!IsListEmpty (&Instance->PortLink)) {
+    RemoveEntryList (&Instance->PortLink);
+    InitializeListHead (&Instance->PortLink);
+  }
+}
+
 /**
   This function removes the Wrap specified by Context and release relevant resources.
 
@@ -1440,38 +1501,48 @@ Udp6EnqueueDgram (
   IN EFI_UDP6_RECEIVE_DATA  *RxData
   )
 {
+  LIST_ENTRY          *Head;
   LIST_ENTRY          *Entry;
   UDP6_INSTANCE_DATA  *Instance;
   UDP6_RXDATA_WRAP    *Wrap;
   UINTN               Enqueued;
+  UINTN               Pass;
 
   Enqueued = 0;
 
-  NET_LIST_FOR_EACH (Entry, &Udp6Service->ChildrenList) {
-    //
-    // Iterate the instances.
-    //
-    Instance = NET_LIST_USER_STRUCT (Entry, UDP6_INSTANCE_DATA, Link);
-
-    if (!Instance->Configured) {
-      continue;
-    }
+  //
+  // Only the instances hashed to the datagram's destination port and the
+  // instances on the wildcard list are candidate receivers, so the other
+  // children are not touched. Udp6MatchDgram still makes the final
+  // decision on the address and port filters.
+  //
+  Head = &Udp6Service->PortHashTable[UDP6_PORT_HASH (RxData->UdpSession.DestinationPort)];
 
-    if (Udp6MatchDgram (Instance, &RxData->UdpSession)) {
+  for (Pass = 0; Pass < 2; Pass++) {
+    NET_LIST_FOR_EACH (Entry, Head) {
       //
-      // Wrap the RxData and put this Wrap into the instances RcvdDgramQue.
+      // Iterate the candidate instances.
       //
-      Wrap = Udp6WrapRxData (Instance, Packet, RxData);
-      if (Wrap == NULL) {
-        continue;
-      }
+      Instance = NET_LIST_USER_STRUCT (Entry, UDP6_INSTANCE_DATA, PortLink);
 
-      NET_GET_REF (Packet);
+      if (Udp6MatchDgram (Instance, &RxData->UdpSession)) {
+        //
+        // Wrap the RxData and put this Wrap into the instances RcvdDgramQue.
+        //
+        Wrap = Udp6WrapRxData (Instance, Packet, RxData);
+        if (Wrap == NULL) {
+          continue;
+        }
 
-      InsertTailList (&Instance->RcvdDgramQue, &Wrap->Link);
+        NET_GET_REF (Packet);
 
-      Enqueued++;
+        InsertTailList (&Instance->RcvdDgramQue, &Wrap->Link);
+
+        Enqueued++;
+      }
     }
+
+    Head = &Udp6Service->WildcardList;
   }
 
   return Enqueued;
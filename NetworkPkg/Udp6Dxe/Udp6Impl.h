@@ -43,6 +43,9 @@ extern UINT16                        mUdp6RandomPort;
 #define UDP6_MAX_DATA_SIZE     65507
 #define UDP6_PORT_KNOWN        1024
 
+#define UDP6_PORT_HASH_SIZE  32
+#define UDP6_PORT_HASH(Port)  ((Port) & (UDP6_PORT_HASH_SIZE - 1))
+
 #define UDP6_SERVICE_DATA_SIGNATURE   SIGNATURE_32 ('U', 'd', 'p', '6')
 #define UDP6_INSTANCE_DATA_SIGNATURE  SIGNATURE_32 ('U', 'd', 'p', 'S')
 
@@ -72,12 +75,23 @@ typedef struct _UDP6_SERVICE_DATA {
   LIST_ENTRY                      ChildrenList;
   UINTN                           ChildrenNumber;
   IP_IO                           *IpIo;
+
+  //
+  // Demultiplex index over the configured children, maintained on
+  // Configure/reset. Instances bound to a station port are hashed by
+  // that port, instances accepting any port or in promiscuous mode are
+  // kept on the wildcard list which is checked for every datagram.
+  //
+  LIST_ENTRY                      PortHashTable[UDP6_PORT_HASH_SIZE];
+  LIST_ENTRY                      WildcardList;
+
   EFI_EVENT                       TimeoutEvent;
 } UDP6_SERVICE_DATA;
 
 typedef struct _UDP6_INSTANCE_DATA {
   UINT32                  Signature;
   LIST_ENTRY              Link;
+  LIST_ENTRY              PortLink;
   UDP6_SERVICE_DATA       *Udp6Service;
   EFI_UDP6_PROTOCOL       Udp6Proto;
   EFI_UDP6_CONFIG_DATA    ConfigData;
@@ -449,6 +463,32 @@ Udp6Bind (
   IN EFI_UDP6_CONFIG_DATA  *ConfigData
   );
 
+/**
+  This function adds the configured instance into the service's demultiplex
+  index, hashed by the station port or on the wildcard list if the instance
+  accepts any port or is in promiscuous mode.
+
+  @param[in]      Udp6Service    Pointer to the udp service context data.
+  @param[in, out] Instance       Pointer to the configured udp instance.
+
+**/
+VOID
+Udp6AddDemuxEntry (
+  IN     UDP6_SERVICE_DATA   *Udp6Service,
+  IN OUT UDP6_INSTANCE_DATA  *Instance
+  );
+
+/**
+  This function removes the instance from the service's demultiplex index.
+
+  @param[in, out] Instance       Pointer to the udp instance to remove.
+
+**/
+VOID
+Udp6RemoveDemuxEntry (
+  IN OUT UDP6_INSTANCE_DATA  *Instance
+  );
+
 /**
   This function builds the Ip6 configdata from the Udp6ConfigData.
 
@@ -251,11 +251,18 @@ Udp6Configure (
                             );
 
       Instance->Configured = TRUE;
+
+      //
+      // Add the instance into the receive demultiplex index.
+      //
+      Udp6AddDemuxEntry (Udp6Service, Instance);
     }
   } else {
     //
     // UdpConfigData is NULL, reset the instance.
     //
+    Udp6RemoveDemuxEntry (Instance);
+
     Instance->Configured  = FALSE;
     Instance->IsNoMapping = FALSE;
 
@@ -878,6 +878,141 @@ PxeBcDiscoverBootServer (
   }
 }
 
+/**
+  Record the (server, file) tuple of a successful boot file download.
+
+  The tuple is stored in a non-volatile variable under gEfiCallerIdGuid so
+  the next boot can retry the proven path first. The recorded path is only
+  an accelerator, so any failure to save it is ignored.
+
+  @param[in]  Private           Pointer to PxeBc private data.
+  @param[in]  BootFileSize      Size of the downloaded boot file.
+
+**/
+VOID
+PxeBcSaveLastBootCache (
+  IN PXEBC_PRIVATE_DATA  *Private,
+  IN UINT64              BootFileSize
+  )
+{
+  PXEBC_LAST_BOOT_CACHE  Cache;
+  PXEBC_LAST_BOOT_CACHE  OldCache;
+  UINTN                  Size;
+  EFI_STATUS             Status;
+
+  if ((Private->BootFileName == NULL) ||
+      (AsciiStrSize ((CHAR8 *)Private->BootFileName) > PXEBC_LAST_BOOT_FILE_MAX)) {
+    return;
+  }
+
+  ZeroMem (&Cache, sizeof (Cache));
+  CopyMem (&Cache.ServerIp, &Private->ServerIp.v4, sizeof (EFI_IPv4_ADDRESS));
+  Cache.BootFileSize = BootFileSize;
+  AsciiStrCpyS (Cache.BootFileName, PXEBC_LAST_BOOT_FILE_MAX, (CHAR8 *)Private->BootFileName);
+
+  //
+  // Skip the variable write if the recorded tuple is unchanged, so repeated
+  // boots from a stable configuration don't wear the variable store.
+  //
+  Size   = sizeof (OldCache);
+  Status = gRT->GetVariable (
+                  PXEBC_LAST_BOOT_VARIABLE_NAME,
+                  &gEfiCallerIdGuid,
+                  NULL,
+                  &Size,
+                  &OldCache
+                  );
+  if (!EFI_ERROR (Status) && (Size == sizeof (OldCache)) &&
+      (CompareMem (&OldCache, &Cache, sizeof (Cache)) == 0)) {
+    return;
+  }
+
+  gRT->SetVariable (
+         PXEBC_LAST_BOOT_VARIABLE_NAME,
+         &gEfiCallerIdGuid,
+         EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+         sizeof (Cache),
+         &Cache
+         );
+}
+
+/**
+  Try to reuse the (server, file) tuple recorded by the last successful boot.
+
+  On success the server address, boot file name and boot file size in the
+  private data are taken from the record, so the download can start without
+  a boot server discover round. The boot file name points into the record
+  embedded in the private data and stays valid until the next discovery
+  overwrites it.
+
+  @param[in, out] Private      Pointer to PxeBc private data.
+  @param[out]     BufferSize   Size of the boot file to be downloaded.
+
+  @retval TRUE   The recorded boot path was loaded into the private data.
+  @retval FALSE  No usable recorded boot path is available.
+
+**/
+BOOLEAN
+PxeBcLoadLastBootCache (
+  IN OUT PXEBC_PRIVATE_DATA  *Private,
+  OUT UINT64                 *BufferSize
+  )
+{
+  UINTN       Size;
+  EFI_STATUS  Status;
+
+  Size   = sizeof (Private->LastBootCache);
+  Status = gRT->GetVariable (
+                  PXEBC_LAST_BOOT_VARIABLE_NAME,
+                  &gEfiCallerIdGuid,
+                  NULL,
+                  &Size,
+                  &Private->LastBootCache
+                  );
+  if (EFI_ERROR (Status) || (Size != sizeof (Private->LastBootCache))) {
+    return FALSE;
+  }
+
+  if ((Private->LastBootCache.ServerIp.Addr[0] == 0) ||
+      (Private->LastBootCache.BootFileSize == 0) ||
+      (Private->LastBootCache.BootFileName[0] == '\0') ||
+      (Private->LastBootCache.BootFileName[PXEBC_LAST_BOOT_FILE_MAX - 1] != '\0')) {
+    return FALSE;
+  }
+
+  ZeroMem (&Private->ServerIp, sizeof (EFI_IP_ADDRESS));
+  CopyMem (&Private->ServerIp.v4, &Private->LastBootCache.ServerIp, sizeof (EFI_IPv4_ADDRESS));
+  Private->BootFileName = (UINT8 *)Private->LastBootCache.BootFileName;
+  Private->BootFileSize = (UINTN)Private->LastBootCache.BootFileSize;
+  *BufferSize           = Private->LastBootCache.BootFileSize;
+
+  AsciiPrint ("\n  Trying last known NBP path.");
+  AsciiPrint ("\n  Server IP address is ");
+  PxeBcShowIp4Addr (&Private->ServerIp.v4);
+  AsciiPrint ("\n  NBP filename is %a", Private->BootFileName);
+  AsciiPrint ("\n  NBP filesize is %d Bytes\n", Private->BootFileSize);
+
+  return TRUE;
+}
+
+/**
+  Remove the recorded boot path after it turned out to be stale.
+
+**/
+VOID
+PxeBcClearLastBootCache (
+  VOID
+  )
+{
+  gRT->SetVariable (
+         PXEBC_LAST_BOOT_VARIABLE_NAME,
+         &gEfiCallerIdGuid,
+         EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+         0,
+         NULL
+         );
+}
+
 /**
   Discover all the boot information for boot file.
 
@@ -917,6 +1052,18 @@ PxeBcDiscoverBootFile (
     return Status;
   }
 
+  //
+  // Try the (server, file) tuple recorded by the last successful boot before
+  // entering the boot server prompt/discover round. A stale record is caught
+  // by the download failure in PxeBcLoadBootFile(), which clears the record
+  // and falls back to a full fresh discovery.
+  //
+  Private->BootFromCache = FALSE;
+  if (!Mode->UsingIpv6 && PxeBcLoadLastBootCache (Private, BufferSize)) {
+    Private->BootFromCache = TRUE;
+    return EFI_SUCCESS;
+  }
+
   //
   // Select a boot server from boot server list.
   //
@@ -1166,6 +1313,7 @@ PxeBcLoadBootFile (
     return Status;
   }
 
+ON_RETRY:
   if (Private->BootFileSize == 0) {
     //
     // Discover the boot information about the bootfile if hasn't.
@@ -1237,11 +1385,33 @@ PxeBcLoadBootFile (
                       );
   }
 
+  if (EFI_ERROR (Status) && (Status != EFI_BUFFER_TOO_SMALL) &&
+      (Status != EFI_ABORTED) && Private->BootFromCache) {
+    //
+    // The recorded boot path did not answer or rejected the download.
+    // Drop the stale record and retry with a full fresh discovery.
+    //
+    PxeBcClearLastBootCache ();
+    Private->BootFromCache = FALSE;
+    Private->BootFileSize  = 0;
+    ZeroMem (&Private->ServerIp, sizeof (EFI_IP_ADDRESS));
+    CurrentSize = *BufferSize;
+    goto ON_RETRY;
+  }
+
 ON_EXIT:
   *BufferSize = (UINTN)CurrentSize;
   PxeBcUninstallCallback (Private, NewMakeCallback);
 
   if (Status == EFI_SUCCESS) {
+    if (!PxeBcMode->UsingIpv6 && (Buffer != NULL)) {
+      //
+      // Record the proven (server, file) tuple so the next boot can skip
+      // the boot server discovery round.
+      //
+      PxeBcSaveLastBootCache (Private, CurrentSize);
+    }
+
     AsciiPrint ("\n  NBP file downloaded successfully.\n");
     return EFI_SUCCESS;
   } else if ((Status == EFI_BUFFER_TOO_SMALL) && (Buffer != NULL)) {
@@ -16,6 +16,21 @@
 
 #define PXEBC_IS_SIZE_OVERFLOWED(x)  ((sizeof (UINTN) < sizeof (UINT64)) && ((x) > 0xFFFFFFFF))
 
+#define PXEBC_LAST_BOOT_VARIABLE_NAME  L"PxeBcLastBoot"
+#define PXEBC_LAST_BOOT_FILE_MAX       128
+
+///
+/// The (server, file) tuple proven by the last successful IPv4 boot file
+/// download. It is recorded in a variable under gEfiCallerIdGuid so the
+/// next boot can try the recorded path right after DHCP completes, and
+/// skip the boot server prompt and discover round when it still works.
+///
+typedef struct {
+  EFI_IPv4_ADDRESS    ServerIp;
+  UINT64              BootFileSize;
+  CHAR8               BootFileName[PXEBC_LAST_BOOT_FILE_MAX];
+} PXEBC_LAST_BOOT_CACHE;
+
 /**
   Extract the discover information and boot server entry from the
   cached packets if unspecified.
@@ -88,4 +103,42 @@ PxeBcLoadBootFile (
   IN     VOID                *Buffer         OPTIONAL
   );
 
+/**
+  Record the (server, file) tuple of a successful boot file download.
+
+  @param[in]  Private           Pointer to PxeBc private data.
+  @param[in]  BootFileSize      Size of the downloaded boot file.
+
+**/
+VOID
+PxeBcSaveLastBootCache (
+  IN PXEBC_PRIVATE_DATA  *Private,
+  IN UINT64              BootFileSize
+  );
+
+/**
+  Try to reuse the (server, file) tuple recorded by the last successful boot.
+
+  @param[in, out] Private      Pointer to PxeBc private data.
+  @param[out]     BufferSize   Size of the boot file to be downloaded.
+
+  @retval TRUE   The recorded boot path was loaded into the private data.
+  @retval FALSE  No usable recorded boot path is available.
+
+**/
+BOOLEAN
+PxeBcLoadLastBootCache (
+  IN OUT PXEBC_PRIVATE_DATA  *Private,
+  OUT UINT64                 *BufferSize
+  );
+
+/**
+  Remove the recorded boot path after it turned out to be stale.
+
+**/
+VOID
+PxeBcClearLastBootCache (
+  VOID
+  );
+
 #endif
@@ -164,6 +164,7 @@ struct _PXEBC_PRIVATE_DATA {
   BOOLEAN                                      IsOfferSorted;
   BOOLEAN                                      IsProxyRecved;
   BOOLEAN                                      IsDoDiscover;
+  BOOLEAN                                      BootFromCache;
 
   EFI_IP_ADDRESS                               TmpStationIp;
   EFI_IP_ADDRESS                               StationIp;
@@ -179,6 +180,7 @@ struct _PXEBC_PRIVATE_DATA {
   UINT8                                        *BootFileName;
   UINTN                                        BootFileSize;
   UINTN                                        BlockSize;
+  PXEBC_LAST_BOOT_CACHE                        LastBootCache;
 
   PXEBC_DHCP_PACKET_CACHE                      ProxyOffer;
   PXEBC_DHCP_PACKET_CACHE                      DhcpAck;
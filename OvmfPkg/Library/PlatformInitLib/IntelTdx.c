@@ -19,6 +19,7 @@
 #include <Library/QemuFwCfgLib.h>
 #include <Library/PeiServicesLib.h>
 #include <Library/TdxLib.h>
+#include <Library/TdxMailboxLib.h>
 #include <Library/SynchronizationLib.h>
 #include <WorkArea.h>
 #include <ConfidentialComputingGuestAttr.h>
@@ -26,6 +27,12 @@
 #define ALIGNED_2MB_MASK                0x1fffff
 #define EFI_RESOURCE_MEMORY_UNACCEPTED  7
 
+//
+// Chunk size in which accept-page work is handed out to the vCPUs. See
+// MpAcceptMemoryResourceRange().
+//
+#define ACCEPT_CHUNK_SIZE  SIZE_32MB
+
 /**
   This function will be called to accept pages. Only BSP accepts pages.
 
@@ -138,6 +145,123 @@ BspAcceptMemoryResourceRange (
   return Status;
 }
 
+/**
+  This function will be called to accept pages with all the vCPUs.
+
+  The BSP accepts the unaligned head and tail of the range by itself, then
+  publishes the 2MB-aligned middle in the Td mailbox, carved into chunks of
+  ACCEPT_CHUNK_SIZE: vCPU n accepts chunk n and every CpusNum-th chunk after
+  it. The APs are parked on the mailbox in SEC and pick the command up from
+  there; the BSP joins in with its own share of the chunks (it is vCPU 0)
+  and collects the APs' error reports when the rendezvous ends.
+
+  @param[in] PhysicalAddress   Start physical adress
+  @param[in] PhysicalEnd       End physical address
+
+  @retval    EFI_SUCCESS       Accept memory successfully
+  @retval    Others            Other errors as indicated
+**/
+EFI_STATUS
+EFIAPI
+MpAcceptMemoryResourceRange (
+  IN EFI_PHYSICAL_ADDRESS  PhysicalAddress,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalEnd
+  )
+{
+  EFI_STATUS                  Status;
+  UINT32                      CpusNum;
+  UINT32                      AcceptPageSize;
+  UINT32                      Index;
+  UINT64                      Stride;
+  EFI_PHYSICAL_ADDRESS        Start2M;
+  EFI_PHYSICAL_ADDRESS        End2M;
+  EFI_PHYSICAL_ADDRESS        ChunkStart;
+  EFI_PHYSICAL_ADDRESS        ChunkEnd;
+  volatile MP_WAKEUP_MAILBOX  *MailBox;
+
+  CpusNum = GetCpusNum ();
+
+  //
+  // A single vCPU, or a range not worth the rendezvous, is accepted by the
+  // BSP alone.
+  //
+  if ((CpusNum == 1) || (PhysicalEnd - PhysicalAddress <= ACCEPT_CHUNK_SIZE)) {
+    return BspAcceptMemoryResourceRange (PhysicalAddress, PhysicalEnd);
+  }
+
+  AcceptPageSize = FixedPcdGet32 (PcdTdxAcceptPageSize);
+  Start2M        = ALIGN_VALUE (PhysicalAddress, SIZE_2MB);
+  End2M          = PhysicalEnd & ~(UINT64)ALIGNED_2MB_MASK;
+
+  DEBUG ((
+    DEBUG_INFO,
+    "MpAccept: 0x%llx - 0x%llx (CpusNum: %d)\n",
+    PhysicalAddress,
+    PhysicalEnd - PhysicalAddress,
+    CpusNum
+    ));
+
+  //
+  // The unaligned head and tail of the range are accepted by the BSP alone,
+  // the vCPUs share only whole 2MB-aligned chunks.
+  //
+  Status = BspAcceptMemoryResourceRange (PhysicalAddress, Start2M);
+  if (!EFI_ERROR (Status)) {
+    Status = BspAcceptMemoryResourceRange (End2M, PhysicalEnd);
+  }
+
+  if (EFI_ERROR (Status) || (Start2M >= End2M)) {
+    return Status;
+  }
+
+  MailBox = (volatile MP_WAKEUP_MAILBOX *)GetTdxMailBox ();
+  ZeroMem ((VOID *)MailBox->Tallies, sizeof (MailBox->Tallies));
+  ZeroMem ((VOID *)MailBox->Errors, sizeof (MailBox->Errors));
+
+  MpSendWakeupCommand (
+    MpProtectedModeWakeupCommandAcceptPages,
+    0,
+    Start2M,
+    End2M,
+    ACCEPT_CHUNK_SIZE,
+    AcceptPageSize
+    );
+
+  //
+  // Release the APs, then accept the BSP's own share of the chunks.
+  //
+  MpSerializeStart ();
+
+  Stride = MultU64x32 (ACCEPT_CHUNK_SIZE, CpusNum);
+  for (ChunkStart = Start2M; ChunkStart < End2M; ChunkStart += Stride) {
+    ChunkEnd = MIN (ChunkStart + ACCEPT_CHUNK_SIZE, End2M);
+    Status   = TdAcceptPages (
+                 ChunkStart,
+                 DivU64x32 (ChunkEnd - ChunkStart, AcceptPageSize),
+                 AcceptPageSize
+                 );
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  MpSerializeEnd ();
+
+  for (Index = 1; Index < CpusNum; Index++) {
+    if (MailBox->Errors[Index] != 0) {
+      DEBUG ((
+        DEBUG_ERROR,
+        "Error(%d) of accepting pages is found on vCPU-%d\n",
+        MailBox->Errors[Index],
+        Index
+        ));
+      Status = EFI_DEVICE_ERROR;
+    }
+  }
+
+  return Status;
+}
+
 /**
   Check the value whether in the valid list.
 
@@ -395,7 +519,7 @@ ProcessHobList (
 
         PhysicalEnd = Hob.ResourceDescriptor->PhysicalStart + Hob.ResourceDescriptor->ResourceLength;
 
-        Status = BspAcceptMemoryResourceRange (
+        Status = MpAcceptMemoryResourceRange (
                    Hob.ResourceDescriptor->PhysicalStart,
                    PhysicalEnd
                    );
@@ -29,6 +29,13 @@ STATIC BOOLEAN  mQemuFwCfgDmaSupported;
 
 STATIC EDKII_IOMMU_PROTOCOL  *mIoMmuProtocol;
 
+//
+// One-time allocated and mapped FW_CFG_DMA_ACCESS structure, shared by all
+// transfers when SEV or TDX is enabled -- see InternalQemuFwCfgDmaBytes().
+//
+STATIC VOID  *mFwCfgDmaAccessBuffer;
+STATIC VOID  *mFwCfgDmaAccessMapping;
+
 /**
   Returns a boolean indicating if the firmware configuration interface
   is available or not.
@@ -147,8 +154,9 @@ InternalQemuFwCfgDmaIsAvailable (
 
 /**
   Function is used for allocating a bi-directional FW_CFG_DMA_ACCESS used
-  between Host and device to exchange the information. The buffer must be free'd
-  using FreeFwCfgDmaAccessBuffer ().
+  between Host and device to exchange the information. The buffer is allocated
+  once and stays mapped for the lifetime of boot services; the IoMmu driver
+  tears down all mappings when ExitBootServices() is signaled.
 
 **/
 STATIC
@@ -240,50 +248,6 @@ AllocFwCfgDmaAccessBuffer (
   *MapInfo = Mapping;
 }
 
-/**
-  Function is to used for freeing the Access buffer allocated using
-  AllocFwCfgDmaAccessBuffer()
-
-**/
-STATIC
-VOID
-FreeFwCfgDmaAccessBuffer (
-  IN  VOID  *Access,
-  IN  VOID  *Mapping
-  )
-{
-  UINTN       NumPages;
-  EFI_STATUS  Status;
-
-  NumPages = EFI_SIZE_TO_PAGES (sizeof (FW_CFG_DMA_ACCESS));
-
-  Status = mIoMmuProtocol->Unmap (mIoMmuProtocol, Mapping);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((
-      DEBUG_ERROR,
-      "%a:%a failed to UnMap() Mapping 0x%Lx\n",
-      gEfiCallerBaseName,
-      __FUNCTION__,
-      (UINT64)(UINTN)Mapping
-      ));
-    ASSERT (FALSE);
-    CpuDeadLoop ();
-  }
-
-  Status = mIoMmuProtocol->FreeBuffer (mIoMmuProtocol, NumPages, Access);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((
-      DEBUG_ERROR,
-      "%a:%a failed to Free() 0x%Lx\n",
-      gEfiCallerBaseName,
-      __FUNCTION__,
-      (UINT64)(UINTN)Access
-      ));
-    ASSERT (FALSE);
-    CpuDeadLoop ();
-  }
-}
-
 /**
   Function is used for mapping host address to device address. The buffer must
   be unmapped with UnmapDmaDataBuffer ().
@@ -394,7 +358,7 @@ InternalQemuFwCfgDmaBytes (
   volatile FW_CFG_DMA_ACCESS  *Access;
   UINT32                      AccessHigh, AccessLow;
   UINT32                      Status;
-  VOID                        *AccessMapping, *DataMapping;
+  VOID                        *DataMapping;
   VOID                        *DataBuffer;
 
   ASSERT (
@@ -406,25 +370,32 @@ InternalQemuFwCfgDmaBytes (
     return;
   }
 
-  Access        = &LocalAccess;
-  AccessMapping = NULL;
-  DataMapping   = NULL;
-  DataBuffer    = Buffer;
+  Access      = &LocalAccess;
+  DataMapping = NULL;
+  DataBuffer  = Buffer;
 
   //
   // When SEV or TDX is enabled, map Buffer to DMA address before issuing the DMA
   // request
   //
   if (MemEncryptSevIsEnabled () || MemEncryptTdxIsEnabled ()) {
-    VOID                  *AccessBuffer;
     EFI_PHYSICAL_ADDRESS  DataBufferAddress;
 
     //
-    // Allocate DMA Access buffer
+    // Allocate and map the DMA Access buffer on first use; reuse it for every
+    // subsequent transfer. The library serializes fw_cfg access (selecting an
+    // item and reading it are stateful operations anyway), and flipping the
+    // control structure's page visibility back and forth on each call would
+    // cost two memory encryption mask transitions per transfer.
     //
-    AllocFwCfgDmaAccessBuffer (&AccessBuffer, &AccessMapping);
+    if (mFwCfgDmaAccessBuffer == NULL) {
+      AllocFwCfgDmaAccessBuffer (
+        &mFwCfgDmaAccessBuffer,
+        &mFwCfgDmaAccessMapping
+        );
+    }
 
-    Access = AccessBuffer;
+    Access = mFwCfgDmaAccessBuffer;
 
     //
     // Map actual data buffer
@@ -479,14 +450,8 @@ InternalQemuFwCfgDmaBytes (
   MemoryFence ();
 
   //
-  // If Access buffer was dynamically allocated then free it.
-  //
-  if (AccessMapping != NULL) {
-    FreeFwCfgDmaAccessBuffer ((VOID *)Access, AccessMapping);
-  }
-
-  //
-  // If DataBuffer was mapped then unmap it.
+  // If DataBuffer was mapped then unmap it. The shared Access buffer is kept
+  // mapped for reuse by the next transfer.
   //
   if (DataMapping != NULL) {
     UnmapFwCfgDmaDataBuffer (DataMapping);
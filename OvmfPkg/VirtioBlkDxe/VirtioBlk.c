@@ -239,21 +239,16 @@ SynchronousRequest (
   IN              BOOLEAN   RequestIsWrite
   )
 {
-  UINT32                   BlockSize;
-  volatile VIRTIO_BLK_REQ  Request;
-  volatile UINT8           *HostStatus;
-  VOID                     *HostStatusBuffer;
-  DESC_INDICES             Indices;
-  VOID                     *RequestMapping;
-  VOID                     *StatusMapping;
-  VOID                     *BufferMapping;
-  EFI_PHYSICAL_ADDRESS     BufferDeviceAddress;
-  EFI_PHYSICAL_ADDRESS     HostStatusDeviceAddress;
-  EFI_PHYSICAL_ADDRESS     RequestDeviceAddress;
-  EFI_STATUS               Status;
-  EFI_STATUS               UnmapStatus;
-
-  BlockSize = Dev->BlockIoMedia.BlockSize;
+  UINT32                          BlockSize;
+  volatile VBLK_REQUEST_BUFFER    *RequestBuffer;
+  DESC_INDICES                    Indices;
+  VOID                            *BufferMapping;
+  EFI_PHYSICAL_ADDRESS            BufferDeviceAddress;
+  EFI_STATUS                      Status;
+  EFI_STATUS                      UnmapStatus;
+
+  BlockSize     = Dev->BlockIoMedia.BlockSize;
+  RequestBuffer = Dev->RequestBuffer;
 
   //
   // Set BufferMapping and BufferDeviceAddress to suppress incorrect
@@ -277,44 +272,15 @@ SynchronousRequest (
   // Prepare virtio-blk request header, setting zero size for flush.
   // IO Priority is homogeneously 0.
   //
-  Request.Type = RequestIsWrite ?
-                 (BufferSize == 0 ? VIRTIO_BLK_T_FLUSH : VIRTIO_BLK_T_OUT) :
-                 VIRTIO_BLK_T_IN;
-  Request.IoPrio = 0;
-  Request.Sector = MultU64x32 (Lba, BlockSize / 512);
-
-  //
-  // Host status is bi-directional (we preset with a value and expect the
-  // device to update it). Allocate a host status buffer which can be mapped
-  // to access equally by both processor and the device.
-  //
-  Status = Dev->VirtIo->AllocateSharedPages (
-                          Dev->VirtIo,
-                          EFI_SIZE_TO_PAGES (sizeof *HostStatus),
-                          &HostStatusBuffer
-                          );
-  if (EFI_ERROR (Status)) {
-    return EFI_DEVICE_ERROR;
-  }
-
-  HostStatus = HostStatusBuffer;
-
-  //
-  // Map virtio-blk request header (must be done after request header is
-  // populated)
+  // The request area was allocated and mapped bi-directionally in
+  // VirtioBlkInit(), hence the header can be populated in place and no
+  // per-request mapping is necessary.
   //
-  Status = VirtioMapAllBytesInSharedBuffer (
-             Dev->VirtIo,
-             VirtioOperationBusMasterRead,
-             (VOID *)&Request,
-             sizeof Request,
-             &RequestDeviceAddress,
-             &RequestMapping
-             );
-  if (EFI_ERROR (Status)) {
-    Status = EFI_DEVICE_ERROR;
-    goto FreeHostStatusBuffer;
-  }
+  RequestBuffer->Header.Type = RequestIsWrite ?
+                               (BufferSize == 0 ? VIRTIO_BLK_T_FLUSH : VIRTIO_BLK_T_OUT) :
+                               VIRTIO_BLK_T_IN;
+  RequestBuffer->Header.IoPrio = 0;
+  RequestBuffer->Header.Sector = MultU64x32 (Lba, BlockSize / 512);
 
   //
   // Map data buffer
@@ -331,32 +297,14 @@ SynchronousRequest (
                &BufferMapping
                );
     if (EFI_ERROR (Status)) {
-      Status = EFI_DEVICE_ERROR;
-      goto UnmapRequestBuffer;
+      return EFI_DEVICE_ERROR;
     }
   }
 
   //
   // preset a host status for ourselves that we do not accept as success
   //
-  *HostStatus = VIRTIO_BLK_S_IOERR;
-
-  //
-  // Map the Status Buffer with VirtioOperationBusMasterCommonBuffer so that
-  // both processor and device can access it.
-  //
-  Status = VirtioMapAllBytesInSharedBuffer (
-             Dev->VirtIo,
-             VirtioOperationBusMasterCommonBuffer,
-             HostStatusBuffer,
-             sizeof *HostStatus,
-             &HostStatusDeviceAddress,
-             &StatusMapping
-             );
-  if (EFI_ERROR (Status)) {
-    Status = EFI_DEVICE_ERROR;
-    goto UnmapDataBuffer;
-  }
+  RequestBuffer->HostStatus = VIRTIO_BLK_S_IOERR;
 
   VirtioPrepare (&Dev->Ring, &Indices);
 
@@ -371,8 +319,8 @@ SynchronousRequest (
   //
   VirtioAppendDesc (
     &Dev->Ring,
-    RequestDeviceAddress,
-    sizeof Request,
+    Dev->RequestDeviceAddress,
+    sizeof RequestBuffer->Header,
     VRING_DESC_F_NEXT,
     &Indices
     );
@@ -408,8 +356,8 @@ SynchronousRequest (
   //
   VirtioAppendDesc (
     &Dev->Ring,
-    HostStatusDeviceAddress,
-    sizeof *HostStatus,
+    Dev->HostStatusDeviceAddress,
+    sizeof RequestBuffer->HostStatus,
     VRING_DESC_F_WRITE,
     &Indices
     );
@@ -424,16 +372,13 @@ SynchronousRequest (
          &Indices,
          NULL
          ) == EFI_SUCCESS) &&
-      (*HostStatus == VIRTIO_BLK_S_OK))
+      (RequestBuffer->HostStatus == VIRTIO_BLK_S_OK))
   {
     Status = EFI_SUCCESS;
   } else {
     Status = EFI_DEVICE_ERROR;
   }
 
-  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, StatusMapping);
-
-UnmapDataBuffer:
   if (BufferSize > 0) {
     UnmapStatus = Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, BufferMapping);
     if (EFI_ERROR (UnmapStatus) && !RequestIsWrite && !EFI_ERROR (Status)) {
@@ -444,16 +389,6 @@ UnmapDataBuffer:
     }
   }
 
-UnmapRequestBuffer:
-  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, RequestMapping);
-
-FreeHostStatusBuffer:
-  Dev->VirtIo->FreeSharedPages (
-                 Dev->VirtIo,
-                 EFI_SIZE_TO_PAGES (sizeof *HostStatus),
-                 HostStatusBuffer
-                 );
-
   return Status;
 }
 
@@ -871,18 +806,52 @@ VirtioBlkInit (
     goto ReleaseQueue;
   }
 
+  //
+  // The virtio-blk request header and host status byte are shared with the
+  // device on every request. Allocate and map them once, up front;
+  // SynchronousRequest() reuses them for the whole lifetime of the device.
+  // The host status is bi-directional (we preset it with a value and expect
+  // the device to update it), and the header is populated in place right
+  // before each request, hence the area is mapped for common buffer
+  // operation. If anything fails from here on, we must release the request
+  // area as well.
+  //
+  Status = Dev->VirtIo->AllocateSharedPages (
+                          Dev->VirtIo,
+                          EFI_SIZE_TO_PAGES (sizeof *Dev->RequestBuffer),
+                          (VOID **)&Dev->RequestBuffer
+                          );
+  if (EFI_ERROR (Status)) {
+    goto UnmapQueue;
+  }
+
+  Status = VirtioMapAllBytesInSharedBuffer (
+             Dev->VirtIo,
+             VirtioOperationBusMasterCommonBuffer,
+             (VOID *)Dev->RequestBuffer,
+             sizeof *Dev->RequestBuffer,
+             &Dev->RequestDeviceAddress,
+             &Dev->RequestBufferMap
+             );
+  if (EFI_ERROR (Status)) {
+    goto FreeRequestBuffer;
+  }
+
+  Dev->HostStatusDeviceAddress = Dev->RequestDeviceAddress +
+                                 OFFSET_OF (VBLK_REQUEST_BUFFER, HostStatus);
+
   //
   // Additional steps for MMIO: align the queue appropriately, and set the
   // size. If anything fails from here on, we must unmap the ring resources.
   //
   Status = Dev->VirtIo->SetQueueNum (Dev->VirtIo, QueueSize);
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UnmapRequestBuffer;
   }
 
   Status = Dev->VirtIo->SetQueueAlign (Dev->VirtIo, EFI_PAGE_SIZE);
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UnmapRequestBuffer;
   }
 
   //
@@ -894,7 +863,7 @@ VirtioBlkInit (
                           RingBaseShift
                           );
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UnmapRequestBuffer;
   }
 
   //
@@ -904,7 +873,7 @@ VirtioBlkInit (
     Features &= ~(UINT64)(VIRTIO_F_VERSION_1 | VIRTIO_F_IOMMU_PLATFORM);
     Status    = Dev->VirtIo->SetGuestFeatures (Dev->VirtIo, Features);
     if (EFI_ERROR (Status)) {
-      goto UnmapQueue;
+      goto UnmapRequestBuffer;
     }
   }
 
@@ -914,7 +883,7 @@ VirtioBlkInit (
   NextDevStat |= VSTAT_DRIVER_OK;
   Status       = Dev->VirtIo->SetDeviceStatus (Dev->VirtIo, NextDevStat);
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UnmapRequestBuffer;
   }
 
   //
@@ -972,6 +941,16 @@ VirtioBlkInit (
 
   return EFI_SUCCESS;
 
+UnmapRequestBuffer:
+  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RequestBufferMap);
+
+FreeRequestBuffer:
+  Dev->VirtIo->FreeSharedPages (
+                 Dev->VirtIo,
+                 EFI_SIZE_TO_PAGES (sizeof *Dev->RequestBuffer),
+                 (VOID *)Dev->RequestBuffer
+                 );
+
 UnmapQueue:
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RingMap);
 
@@ -1011,6 +990,13 @@ VirtioBlkUninit (
   //
   Dev->VirtIo->SetDeviceStatus (Dev->VirtIo, 0);
 
+  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RequestBufferMap);
+  Dev->VirtIo->FreeSharedPages (
+                 Dev->VirtIo,
+                 EFI_SIZE_TO_PAGES (sizeof *Dev->RequestBuffer),
+                 (VOID *)Dev->RequestBuffer
+                 );
+
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RingMap);
   VirtioRingUninit (Dev->VirtIo, &Dev->Ring);
 
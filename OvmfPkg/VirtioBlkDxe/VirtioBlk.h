@@ -17,9 +17,21 @@
 #include <Protocol/DriverBinding.h>
 
 #include <IndustryStandard/Virtio.h>
+#include <IndustryStandard/VirtioBlk.h>
 
 #define VBLK_SIG  SIGNATURE_32 ('V', 'B', 'L', 'K')
 
+//
+// Bi-directional request area shared with the device. The request header is
+// read, and the host status is written, by the device; both are accessed by
+// the processor as well. The area is allocated and mapped once, in
+// VirtioBlkInit(), and reused by every request.
+//
+typedef struct {
+  VIRTIO_BLK_REQ    Header;
+  UINT8             HostStatus;
+} VBLK_REQUEST_BUFFER;
+
 typedef struct {
   //
   // Parts of this structure are initialized / torn down in various functions
@@ -28,13 +40,17 @@ typedef struct {
   //
   //                     field                    init function       init dpth
   //                     ---------------------    ------------------  ---------
-  UINT32                    Signature;         // DriverBindingStart  0
-  VIRTIO_DEVICE_PROTOCOL    *VirtIo;           // DriverBindingStart  0
-  EFI_EVENT                 ExitBoot;          // DriverBindingStart  0
-  VRING                     Ring;              // VirtioRingInit      2
-  EFI_BLOCK_IO_PROTOCOL     BlockIo;           // VirtioBlkInit       1
-  EFI_BLOCK_IO_MEDIA        BlockIoMedia;      // VirtioBlkInit       1
-  VOID                      *RingMap;          // VirtioRingMap       2
+  UINT32                          Signature;               // DriverBindingStart  0
+  VIRTIO_DEVICE_PROTOCOL          *VirtIo;                 // DriverBindingStart  0
+  EFI_EVENT                       ExitBoot;                // DriverBindingStart  0
+  VRING                           Ring;                    // VirtioRingInit      2
+  EFI_BLOCK_IO_PROTOCOL           BlockIo;                 // VirtioBlkInit       1
+  EFI_BLOCK_IO_MEDIA              BlockIoMedia;            // VirtioBlkInit       1
+  VOID                            *RingMap;                // VirtioRingMap       2
+  volatile VBLK_REQUEST_BUFFER    *RequestBuffer;          // VirtioBlkInit       1
+  VOID                            *RequestBufferMap;       // VirtioBlkInit       1
+  EFI_PHYSICAL_ADDRESS            RequestDeviceAddress;    // VirtioBlkInit       1
+  EFI_PHYSICAL_ADDRESS            HostStatusDeviceAddress; // VirtioBlkInit       1
 } VBLK_DEV;
 
 #define VIRTIO_BLK_FROM_BLOCK_IO(BlockIoPointer) \
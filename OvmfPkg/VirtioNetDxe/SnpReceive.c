@@ -175,11 +175,20 @@ RecycleDesc:
   MemoryFence ();
   *Dev->RxRing.Avail.Idx = AvailIdx;
 
+  //
+  // virtio-0.9.5, 2.4.1.4 Notifying the Device -- the host suppresses
+  // notifications via the used ring flags while it doesn't need a kick; with
+  // the receive queue kept populated by recycling, this drops a VM exit per
+  // received frame. The host re-checks the available ring before re-enabling
+  // the suppression flag, so the recycled buffer is never stranded.
+  //
   MemoryFence ();
-  NotifyStatus = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_RX);
-  if (!EFI_ERROR (Status)) {
-    // earlier error takes precedence
-    Status = NotifyStatus;
+  if ((*Dev->RxRing.Used.Flags & VRING_USED_F_NO_NOTIFY) == 0) {
+    NotifyStatus = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_RX);
+    if (!EFI_ERROR (Status)) {
+      // earlier error takes precedence
+      Status = NotifyStatus;
+    }
   }
 
 Exit:
@@ -173,8 +173,19 @@ VirtioNetTransmit (
   MemoryFence ();
   *Dev->TxRing.Avail.Idx = AvailIdx;
 
+  //
+  // virtio-0.9.5, 2.4.1.4 Notifying the Device -- while the host is busy
+  // draining the queue, it suppresses notifications via the used ring flags;
+  // it is bound to re-check the available ring before re-enabling them. Honor
+  // the suppression, it coalesces notifications (VM exits) across the frames
+  // that the caller queues back-to-back in one poll cycle.
+  //
   MemoryFence ();
-  Status = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_TX);
+  if ((*Dev->TxRing.Used.Flags & VRING_USED_F_NO_NOTIFY) == 0) {
+    Status = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_TX);
+  } else {
+    Status = EFI_SUCCESS;
+  }
 
 Exit:
   gBS->RestoreTPL (OldTpl);
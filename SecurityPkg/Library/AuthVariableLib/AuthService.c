@@ -56,6 +56,17 @@ EFI_SIGNATURE_ITEM  mSupportSigItem[] = {
   { EFI_CERT_X509_SHA512_GUID,    0, 80            }
 };
 
+//
+// Position of the KEK database certificate that verified the previous KEK
+// based write.  It is only a probe order hint for repeated writes signed by
+// the same authority: every write is still fully verified with Pkcs7Verify,
+// and a hint stale after a KEK update merely costs one failing verification
+// attempt before the regular walk of the KEK database.
+//
+UINTN    mLastKekCertOffset = 0;
+UINTN    mLastKekCertSize   = 0;
+BOOLEAN  mLastKekCertValid  = FALSE;
+
 /**
   Finds variable in storage blocks of volatile and non-volatile storage areas.
 
@@ -2063,6 +2074,25 @@ VerifyTimeBasedPayload (
       return Status;
     }
 
+    //
+    // Probe the certificate that verified the previous KEK based write first,
+    // so repeated writes signed by the same authority do not pay a failing
+    // Pkcs7Verify attempt per preceding KEK database entry.
+    //
+    if (mLastKekCertValid && ((mLastKekCertOffset + mLastKekCertSize) <= DataSize)) {
+      VerifyStatus = Pkcs7Verify (
+                       SigData,
+                       SigDataSize,
+                       (UINT8 *)Data + mLastKekCertOffset,
+                       mLastKekCertSize,
+                       NewData,
+                       NewDataSize
+                       );
+      if (VerifyStatus) {
+        goto Exit;
+      }
+    }
+
     //
     // Ready to verify Pkcs7 SignedData. Go through KEK Signature Database to find out X.509 CertList.
     //
@@ -2091,6 +2121,13 @@ VerifyTimeBasedPayload (
                            NewDataSize
                            );
           if (VerifyStatus) {
+            //
+            // Remember the successful certificate as the probe order hint
+            // for the next KEK based write.
+            //
+            mLastKekCertOffset = (UINTN)TrustedCert - (UINTN)Data;
+            mLastKekCertSize   = TrustedCertSize;
+            mLastKekCertValid  = TRUE;
             goto Exit;
           }
 
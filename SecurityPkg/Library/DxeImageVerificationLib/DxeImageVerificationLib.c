@@ -71,6 +71,45 @@ HASH_TABLE  mHash[] = {
 
 EFI_STRING  mHashTypeStr;
 
+//
+// Hash algorithm of the digest currently held in mImageDigest, or HASHALG_MAX
+// when mImageDigest is not valid for the image being verified. Lets an image
+// carrying several signatures that share one digest algorithm be hashed once
+// instead of once per signature.
+//
+UINT32  mImageDigestHashAlg = HASHALG_MAX;
+
+//
+// Signing time extracted from the timestamp countersignature of the
+// Authenticode signature mTimestampAuthData points at, so checking several
+// revoked signers of one signature does not re-verify the same timestamp
+// token against every dbt certificate. Reset for every new image.
+//
+UINT8     *mTimestampAuthData    = NULL;
+UINTN     mTimestampAuthDataSize = 0;
+BOOLEAN   mTimestampValid        = FALSE;
+EFI_TIME  mTimestampSigningTime;
+
+///
+/// Cache of one image security database variable, valid for the duration of
+/// one verification request. A single request may search the same database
+/// several times (dbx in particular can be large), so the variable content is
+/// read through the variable services once and reused until the request
+/// completes.
+///
+typedef struct {
+  CHAR16     *VariableName;
+  BOOLEAN    Loaded;
+  UINT8      *Data;
+  UINTN      DataSize;
+} IMAGE_SECURITY_DATABASE_CACHE;
+
+IMAGE_SECURITY_DATABASE_CACHE  mSecurityDatabaseCache[] = {
+  { EFI_IMAGE_SECURITY_DATABASE,  FALSE, NULL, 0 },
+  { EFI_IMAGE_SECURITY_DATABASE1, FALSE, NULL, 0 },
+  { EFI_IMAGE_SECURITY_DATABASE2, FALSE, NULL, 0 }
+};
+
 /**
   SecureBoot Hook for processing image verification.
 
@@ -314,6 +353,16 @@ HashPeImage (
     return FALSE;
   }
 
+  //
+  // Return directly when mImageDigest already holds the digest of the image
+  // being verified, computed with the same algorithm by an earlier signature.
+  //
+  if (HashAlg == mImageDigestHashAlg) {
+    return TRUE;
+  }
+
+  mImageDigestHashAlg = HASHALG_MAX;
+
   //
   // Initialize context of hash.
   //
@@ -592,6 +641,9 @@ HashPeImage (
   }
 
   Status = mHash[HashAlg].HashFinal (HashCtx, mImageDigest);
+  if (Status) {
+    mImageDigestHashAlg = HashAlg;
+  }
 
 Done:
   if (HashCtx != NULL) {
@@ -965,6 +1017,116 @@ Done:
   return Status;
 }
 
+/**
+  Get the content of one of the image security database variables (db/dbx/dbt).
+
+  The content is read through the variable services once and then served from
+  a module cache until FreeImageSecurityDatabaseCache() is called, since one
+  verification request may search the same database several times. The
+  returned buffer is owned by the cache: the caller must not modify or free it.
+
+  @param[in]  VariableName        Name of the database variable. Must be one of
+                                  EFI_IMAGE_SECURITY_DATABASE,
+                                  EFI_IMAGE_SECURITY_DATABASE1 and
+                                  EFI_IMAGE_SECURITY_DATABASE2.
+  @param[out] Data                On return, pointer to the database content.
+  @param[out] DataSize            On return, size of the database content in bytes.
+
+  @retval EFI_SUCCESS             The database content is returned.
+  @retval EFI_NOT_FOUND           The database variable does not exist.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to cache the database content.
+  @retval Others                  Error occurred in reading the database variable.
+
+**/
+EFI_STATUS
+GetImageSecurityDatabase (
+  IN  CHAR16  *VariableName,
+  OUT UINT8   **Data,
+  OUT UINTN   *DataSize
+  )
+{
+  EFI_STATUS                     Status;
+  IMAGE_SECURITY_DATABASE_CACHE  *CacheEntry;
+  UINTN                          Index;
+
+  CacheEntry = NULL;
+  for (Index = 0; Index < ARRAY_SIZE (mSecurityDatabaseCache); Index++) {
+    if (StrCmp (VariableName, mSecurityDatabaseCache[Index].VariableName) == 0) {
+      CacheEntry = &mSecurityDatabaseCache[Index];
+      break;
+    }
+  }
+
+  ASSERT (CacheEntry != NULL);
+  if (CacheEntry == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (!CacheEntry->Loaded) {
+    CacheEntry->DataSize = 0;
+    Status               = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &CacheEntry->DataSize, NULL);
+    if (Status == EFI_NOT_FOUND) {
+      //
+      // Remember the absence too, so later lookups in this request do not
+      // probe the variable services again.
+      //
+      CacheEntry->Loaded = TRUE;
+    } else {
+      if (Status != EFI_BUFFER_TOO_SMALL) {
+        return Status;
+      }
+
+      CacheEntry->Data = (UINT8 *)AllocateZeroPool (CacheEntry->DataSize);
+      if (CacheEntry->Data == NULL) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+
+      Status = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &CacheEntry->DataSize, CacheEntry->Data);
+      if (EFI_ERROR (Status)) {
+        FreePool (CacheEntry->Data);
+        CacheEntry->Data = NULL;
+        return Status;
+      }
+
+      CacheEntry->Loaded = TRUE;
+    }
+  }
+
+  if (CacheEntry->Data == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  *Data     = CacheEntry->Data;
+  *DataSize = CacheEntry->DataSize;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Release the cached content of the image security database variables.
+
+  Called when a verification request completes, so that the next request
+  observes any update made to the database variables in the meantime.
+
+**/
+VOID
+FreeImageSecurityDatabaseCache (
+  VOID
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < ARRAY_SIZE (mSecurityDatabaseCache); Index++) {
+    if (mSecurityDatabaseCache[Index].Data != NULL) {
+      FreePool (mSecurityDatabaseCache[Index].Data);
+      mSecurityDatabaseCache[Index].Data = NULL;
+    }
+
+    mSecurityDatabaseCache[Index].Loaded   = FALSE;
+    mSecurityDatabaseCache[Index].DataSize = 0;
+  }
+}
+
 /**
   Check whether signature is in specified database.
 
@@ -999,10 +1161,8 @@ IsSignatureFoundInDatabase (
   // Read signature database variable.
   //
   *IsFound = FALSE;
-  Data     = NULL;
-  DataSize = 0;
-  Status   = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  if (Status != EFI_BUFFER_TOO_SMALL) {
+  Status   = GetImageSecurityDatabase (VariableName, &Data, &DataSize);
+  if (EFI_ERROR (Status)) {
     if (Status == EFI_NOT_FOUND) {
       //
       // No database, no need to search.
@@ -1013,16 +1173,6 @@ IsSignatureFoundInDatabase (
     return Status;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Status = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
-
   //
   // Enumerate all signature data in SigDB to check if signature exists for executable.
   //
@@ -1059,11 +1209,6 @@ IsSignatureFoundInDatabase (
     CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
   }
 
-Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
   return Status;
 }
 
@@ -1172,25 +1317,31 @@ PassTimestampCheck (
   }
 
   //
-  // RevocationTime is non-zero, the certificate should be considered to be revoked from that time and onwards.
-  // Using the dbt to get the trusted TSA certificates.
+  // Reuse the signing time already extracted from this signature's timestamp
+  // token by an earlier revocation check; which dbt certificate verified the
+  // token does not change the time it carries.
   //
-  DbtDataSize = 0;
-  Status      = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE2, &gEfiImageSecurityDatabaseGuid, NULL, &DbtDataSize, NULL);
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    goto Done;
-  }
+  if ((AuthData == mTimestampAuthData) && (AuthDataSize == mTimestampAuthDataSize)) {
+    if (mTimestampValid) {
+      VerifyStatus = IsValidSignatureByTimestamp (&mTimestampSigningTime, RevocationTime);
+    }
 
-  DbtData = (UINT8 *)AllocateZeroPool (DbtDataSize);
-  if (DbtData == NULL) {
-    goto Done;
+    return VerifyStatus;
   }
 
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE2, &gEfiImageSecurityDatabaseGuid, NULL, &DbtDataSize, (VOID *)DbtData);
+  //
+  // RevocationTime is non-zero, the certificate should be considered to be revoked from that time and onwards.
+  // Using the dbt to get the trusted TSA certificates.
+  //
+  Status = GetImageSecurityDatabase (EFI_IMAGE_SECURITY_DATABASE2, &DbtData, &DbtDataSize);
   if (EFI_ERROR (Status)) {
     goto Done;
   }
 
+  mTimestampAuthData     = AuthData;
+  mTimestampAuthDataSize = AuthDataSize;
+  mTimestampValid        = FALSE;
+
   CertList = (EFI_SIGNATURE_LIST *)DbtData;
   while ((DbtDataSize > 0) && (DbtDataSize >= CertList->SignatureListSize)) {
     if (CompareGuid (&CertList->SignatureType, &gEfiCertX509Guid)) {
@@ -1206,13 +1357,18 @@ PassTimestampCheck (
         // Get the signing time if the timestamp signature is valid.
         //
         if (ImageTimestampVerify (AuthData, AuthDataSize, RootCert, RootCertSize, &SigningTime)) {
+          //
+          // Cache the signing time: it is a property of the timestamp token
+          // itself, so trying further dbt certificates cannot yield another.
+          //
+          mTimestampValid = TRUE;
+          CopyMem (&mTimestampSigningTime, &SigningTime, sizeof (EFI_TIME));
+
           //
           // The signer signature is valid only when the signing time is earlier than revocation time.
           //
-          if (IsValidSignatureByTimestamp (&SigningTime, RevocationTime)) {
-            VerifyStatus = TRUE;
-            goto Done;
-          }
+          VerifyStatus = IsValidSignatureByTimestamp (&SigningTime, RevocationTime);
+          goto Done;
         }
 
         Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
@@ -1224,10 +1380,6 @@ PassTimestampCheck (
   }
 
 Done:
-  if (DbtData != NULL) {
-    FreePool (DbtData);
-  }
-
   return VerifyStatus;
 }
 
@@ -1288,10 +1440,8 @@ IsForbiddenByDbx (
   //
   // The image will not be forbidden if dbx can't be got.
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
+  Status = GetImageSecurityDatabase (EFI_IMAGE_SECURITY_DATABASE1, &Data, &DataSize);
+  if (EFI_ERROR (Status)) {
     if (Status == EFI_NOT_FOUND) {
       //
       // Evidently not in dbx if the database doesn't exist.
@@ -1302,16 +1452,6 @@ IsForbiddenByDbx (
     return IsForbidden;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return IsForbidden;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
-
   //
   // Verify image signature with RAW X509 certificates in DBX database.
   // If passed, the image will be forbidden.
@@ -1418,10 +1558,6 @@ IsForbiddenByDbx (
   IsForbidden = FALSE;
 
 Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
   Pkcs7FreeSigners (CertBuffer);
   Pkcs7FreeSigners (TrustedCert);
 
@@ -1464,6 +1600,7 @@ IsAllowedByDb (
   CertData     = NULL;
   RootCert     = NULL;
   DbxData      = NULL;
+  DbxDataSize  = 0;
   RootCertSize = 0;
   VerifyStatus = FALSE;
 
@@ -1471,21 +1608,9 @@ IsAllowedByDb (
   // Fetch 'db' content. If 'db' doesn't exist or encounters problem to get the
   // data, return not-allowed-by-db (FALSE).
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    return VerifyStatus;
-  }
-
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return VerifyStatus;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
+  Status = GetImageSecurityDatabase (EFI_IMAGE_SECURITY_DATABASE, &Data, &DataSize);
   if (EFI_ERROR (Status)) {
-    goto Done;
+    return VerifyStatus;
   }
 
   //
@@ -1493,30 +1618,9 @@ IsAllowedByDb (
   // If any other errors occurred, no need to check 'db' but just return
   // not-allowed-by-db (FALSE) to avoid bypass.
   //
-  DbxDataSize = 0;
-  Status      = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    if (Status != EFI_NOT_FOUND) {
-      goto Done;
-    }
-
-    //
-    // 'dbx' does not exist. Continue to check 'db'.
-    //
-  } else {
-    //
-    // 'dbx' exists. Get its content.
-    //
-    DbxData = (UINT8 *)AllocateZeroPool (DbxDataSize);
-    if (DbxData == NULL) {
-      goto Done;
-    }
-
-    Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, (VOID *)DbxData);
-    if (EFI_ERROR (Status)) {
-      goto Done;
-    }
+  Status = GetImageSecurityDatabase (EFI_IMAGE_SECURITY_DATABASE1, &DbxData, &DbxDataSize);
+  if (EFI_ERROR (Status) && (Status != EFI_NOT_FOUND)) {
+    goto Done;
   }
 
   //
@@ -1595,14 +1699,6 @@ Done:
     SecureBootHook (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, CertList->SignatureSize, CertData);
   }
 
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
-  if (DbxData != NULL) {
-    FreePool (DbxData);
-  }
-
   return VerifyStatus;
 }
 
@@ -1770,6 +1866,16 @@ DxeImageVerificationHandler (
   mImageBase = (UINT8 *)FileBuffer;
   mImageSize = FileSize;
 
+  //
+  // A new image is being verified: whatever digest is left over from the
+  // previous request does not apply to it, nor does any signing time cached
+  // from the previous image's signatures.
+  //
+  mImageDigestHashAlg    = HASHALG_MAX;
+  mTimestampAuthData     = NULL;
+  mTimestampAuthDataSize = 0;
+  mTimestampValid        = FALSE;
+
   ZeroMem (&ImageContext, sizeof (ImageContext));
   ImageContext.Handle    = (VOID *)FileBuffer;
   ImageContext.ImageRead = (PE_COFF_LOADER_READ_FILE)DxeImageVerificationLibImageRead;
@@ -1866,6 +1972,7 @@ DxeImageVerificationHandler (
       //
       // Image Hash is in allowed database (DB).
       //
+      FreeImageSecurityDatabaseCache ();
       return EFI_SUCCESS;
     }
 
@@ -2001,6 +2108,7 @@ DxeImageVerificationHandler (
   }
 
   if (IsVerified) {
+    FreeImageSecurityDatabaseCache ();
     return EFI_SUCCESS;
   }
 
@@ -2039,6 +2147,8 @@ Failed:
     FreePool (SignatureList);
   }
 
+  FreeImageSecurityDatabaseCache ();
+
   if (Policy == DEFER_EXECUTE_ON_SECURITY_VIOLATION) {
     return EFI_SECURITY_VIOLATION;
   }
@@ -9,6 +9,13 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #ifndef _HASH_LIB_BASE_CRYPTO_ROUTER_COMMON_H_
 #define _HASH_LIB_BASE_CRYPTO_ROUTER_COMMON_H_
 
+//
+// Size of the chunks that HashUpdate() feeds to every active hash bank in
+// turn. One chunk fits comfortably in the L2 cache, so a large buffer is
+// read from memory only once no matter how many banks are enabled.
+//
+#define HASH_ROUTER_CHUNK_SIZE  SIZE_64KB
+
 /**
   The function get hash mask info from algorithm.
 
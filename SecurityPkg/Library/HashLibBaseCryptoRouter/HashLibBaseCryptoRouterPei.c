@@ -187,6 +187,9 @@ HashUpdate (
   HASH_HANDLE         *HashCtx;
   UINTN               Index;
   UINT32              HashMask;
+  UINT32              Tpm2HashMask;
+  UINT8               *Buffer;
+  UINTN               ChunkLen;
 
   HashInterfaceHob = InternalGetHashInterfaceHob (&gEfiCallerIdGuid);
   if (HashInterfaceHob == NULL) {
@@ -201,11 +204,26 @@ HashUpdate (
 
   HashCtx = (HASH_HANDLE *)HashHandle;
 
-  for (Index = 0; Index < HashInterfaceHob->HashInterfaceCount; Index++) {
-    HashMask = Tpm2GetHashMaskFromAlgo (&HashInterfaceHob->HashInterface[Index].HashGuid);
-    if ((HashMask & PcdGet32 (PcdTpm2HashMask)) != 0) {
-      HashInterfaceHob->HashInterface[Index].HashUpdate (HashCtx[Index], DataToHash, DataToHashLen);
+  //
+  // Feed the data to the active hash banks one cache-sized chunk at a time,
+  // so the buffer is read from memory once and every bank hashes each chunk
+  // while it is still cache-resident. Measured firmware volumes can be
+  // several megabytes; hashing the full buffer per bank would stream it from
+  // memory again for every enabled bank.
+  //
+  Tpm2HashMask = PcdGet32 (PcdTpm2HashMask);
+  Buffer       = (UINT8 *)DataToHash;
+  while (DataToHashLen > 0) {
+    ChunkLen = MIN (DataToHashLen, HASH_ROUTER_CHUNK_SIZE);
+    for (Index = 0; Index < HashInterfaceHob->HashInterfaceCount; Index++) {
+      HashMask = Tpm2GetHashMaskFromAlgo (&HashInterfaceHob->HashInterface[Index].HashGuid);
+      if ((HashMask & Tpm2HashMask) != 0) {
+        HashInterfaceHob->HashInterface[Index].HashUpdate (HashCtx[Index], Buffer, ChunkLen);
+      }
     }
+
+    Buffer        += ChunkLen;
+    DataToHashLen -= ChunkLen;
   }
 
   return EFI_SUCCESS;
@@ -117,14 +117,17 @@ RdRandGenerateEntropy (
   }
 
   //
-  // Populate the remained data as request.
+  // Populate the remained data as request. Skip the condensation round
+  // entirely when the requested length is a whole number of blocks.
   //
-  Status = RdRandGetSeed128 (Seed);
-  if (EFI_ERROR (Status)) {
-    return Status;
-  }
+  if ((Length % 16) != 0) {
+    Status = RdRandGetSeed128 (Seed);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
 
-  CopyMem (Ptr, Seed, (Length % 16));
+    CopyMem (Ptr, Seed, (Length % 16));
+  }
 
   return Status;
 }
@@ -360,6 +360,11 @@ BuildOpalDeviceInfo (
       );
     TempDevInfo->Length        = DevInfoLength;
     TempDevInfo->OpalBaseComId = TmpDev->OpalDisk.OpalBaseComId;
+    CopyMem (
+      &TempDevInfo->SupportedAttributes,
+      &TmpDev->OpalDisk.SupportedAttributes,
+      sizeof (OPAL_DISK_SUPPORT_ATTRIBUTE)
+      );
     CopyMem (
       TempDevInfo->Password,
       TmpDev->OpalDisk.Password,
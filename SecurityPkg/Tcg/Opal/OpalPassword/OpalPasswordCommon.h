@@ -24,13 +24,19 @@ typedef struct {
 } OPAL_PCI_DEVICE;
 
 typedef struct {
-  UINT32                      Length;
-  OPAL_PCI_DEVICE             Device;
-  UINT8                       PasswordLength;
-  UINT8                       Password[OPAL_MAX_PASSWORD_SIZE];
-  UINT16                      OpalBaseComId;
-  UINT32                      DevicePathLength;
-  EFI_DEVICE_PATH_PROTOCOL    DevicePath[];
+  UINT32                         Length;
+  OPAL_PCI_DEVICE                Device;
+  UINT8                          PasswordLength;
+  UINT8                          Password[OPAL_MAX_PASSWORD_SIZE];
+  UINT16                         OpalBaseComId;
+  //
+  // The support attributes known by the DXE driver at LockBox save time.
+  // They are static for a device, so the S3 resume unlock can reuse them
+  // instead of re-running Level 0 Discovery for them on every drive.
+  //
+  OPAL_DISK_SUPPORT_ATTRIBUTE    SupportedAttributes;
+  UINT32                         DevicePathLength;
+  EFI_DEVICE_PATH_PROTOCOL       DevicePath[];
 } OPAL_DEVICE_LOCKBOX_DATA;
 
 #define OPAL_DEVICE_LOCKBOX_GUID  { 0x56a77f0d, 0x6f05, 0x4d47, { 0xb9, 0x11, 0x4f, 0xd, 0xec, 0x5c, 0x58, 0x61 } }
@@ -222,28 +222,26 @@ IsOpalDeviceLocked (
   )
 {
   OPAL_SESSION                    Session;
-  OPAL_DISK_SUPPORT_ATTRIBUTE     SupportedAttributes;
   TCG_LOCKING_FEATURE_DESCRIPTOR  LockingFeature;
-  UINT16                          OpalBaseComId;
   TCG_RESULT                      Ret;
 
-  Session.Sscp    = &OpalDev->Sscp;
-  Session.MediaId = 0;
-
-  Ret = OpalGetSupportedAttributesInfo (&Session, &SupportedAttributes, &OpalBaseComId);
-  if (Ret != TcgResultSuccess) {
-    return FALSE;
-  }
+  //
+  // The support attributes and base ComID are static for a device and were
+  // cached in the LockBox by the DXE driver, so only the dynamic locking
+  // state needs a Level 0 Discovery here.
+  //
+  Session.Sscp          = &OpalDev->Sscp;
+  Session.MediaId       = 0;
+  Session.OpalBaseComId = OpalDev->Device->OpalBaseComId;
 
-  Session.OpalBaseComId = OpalBaseComId;
-  *BlockSidSupported    = SupportedAttributes.BlockSid == 1 ? TRUE : FALSE;
+  *BlockSidSupported = OpalDev->Device->SupportedAttributes.BlockSid == 1 ? TRUE : FALSE;
 
   Ret = OpalGetLockingInfo (&Session, &LockingFeature);
   if (Ret != TcgResultSuccess) {
     return FALSE;
   }
 
-  return OpalDeviceLocked (&SupportedAttributes, &LockingFeature);
+  return OpalDeviceLocked (&OpalDev->Device->SupportedAttributes, &LockingFeature);
 }
 
 /**
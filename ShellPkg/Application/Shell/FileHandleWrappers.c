@@ -1827,8 +1827,39 @@ typedef struct {
   EFI_FILE_FLUSH           Flush;
   BOOLEAN                  Unicode;
   EFI_FILE_PROTOCOL        *Orig;
+  UINT8                    *WriteBuffer;
+  UINTN                    WriteCapacity;
+  UINTN                    WriteCount;
 } EFI_FILE_PROTOCOL_FILE;
 
+/**
+  Flush the data buffered for write-behind to the original file.
+
+  Writes are coalesced in WriteBuffer so that redirected console output
+  reaches the file system in large chunks instead of one write per
+  OutputString() call.
+
+  @param[in] This       The pointer to the EFI_FILE_PROTOCOL_FILE object.
+
+  @retval EFI_SUCCESS   The buffered data was written, or none was pending.
+**/
+STATIC
+EFI_STATUS
+FileInterfaceFileFlushWriteBuffer (
+  IN EFI_FILE_PROTOCOL_FILE  *This
+  )
+{
+  UINTN  Size;
+
+  if ((This->WriteBuffer == NULL) || (This->WriteCount == 0)) {
+    return (EFI_SUCCESS);
+  }
+
+  Size             = This->WriteCount;
+  This->WriteCount = 0;
+  return (This->Orig->Write (This->Orig, &Size, This->WriteBuffer));
+}
+
 /**
   Set a files current position
 
@@ -1846,6 +1877,13 @@ FileInterfaceFileSetPosition (
   IN UINT64             Position
   )
 {
+  EFI_STATUS  Status;
+
+  Status = FileInterfaceFileFlushWriteBuffer ((EFI_FILE_PROTOCOL_FILE *)This);
+  if (EFI_ERROR (Status)) {
+    return (Status);
+  }
+
   return ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->SetPosition (((EFI_FILE_PROTOCOL_FILE *)This)->Orig, Position);
 }
 
@@ -1866,6 +1904,13 @@ FileInterfaceFileGetPosition (
   OUT UINT64            *Position
   )
 {
+  EFI_STATUS  Status;
+
+  Status = FileInterfaceFileFlushWriteBuffer ((EFI_FILE_PROTOCOL_FILE *)This);
+  if (EFI_ERROR (Status)) {
+    return (Status);
+  }
+
   return ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->GetPosition (((EFI_FILE_PROTOCOL_FILE *)This)->Orig, Position);
 }
 
@@ -1896,6 +1941,13 @@ FileInterfaceFileGetInfo (
   OUT VOID              *Buffer
   )
 {
+  EFI_STATUS  Status;
+
+  Status = FileInterfaceFileFlushWriteBuffer ((EFI_FILE_PROTOCOL_FILE *)This);
+  if (EFI_ERROR (Status)) {
+    return (Status);
+  }
+
   return ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->GetInfo (((EFI_FILE_PROTOCOL_FILE *)This)->Orig, InformationType, BufferSize, Buffer);
 }
 
@@ -1925,6 +1977,13 @@ FileInterfaceFileSetInfo (
   IN VOID               *Buffer
   )
 {
+  EFI_STATUS  Status;
+
+  Status = FileInterfaceFileFlushWriteBuffer ((EFI_FILE_PROTOCOL_FILE *)This);
+  if (EFI_ERROR (Status)) {
+    return (Status);
+  }
+
   return ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->SetInfo (((EFI_FILE_PROTOCOL_FILE *)This)->Orig, InformationType, BufferSize, Buffer);
 }
 
@@ -1949,6 +2008,13 @@ FileInterfaceFileFlush (
   IN EFI_FILE_PROTOCOL  *This
   )
 {
+  EFI_STATUS  Status;
+
+  Status = FileInterfaceFileFlushWriteBuffer ((EFI_FILE_PROTOCOL_FILE *)This);
+  if (EFI_ERROR (Status)) {
+    return (Status);
+  }
+
   return ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->Flush (((EFI_FILE_PROTOCOL_FILE *)This)->Orig);
 }
 
@@ -1980,6 +2046,11 @@ FileInterfaceFileRead (
   CHAR16      *UscStrBuffer;
   UINTN       Size;
 
+  Status = FileInterfaceFileFlushWriteBuffer ((EFI_FILE_PROTOCOL_FILE *)This);
+  if (EFI_ERROR (Status)) {
+    return (Status);
+  }
+
   if (((EFI_FILE_PROTOCOL_FILE *)This)->Unicode) {
     //
     // Unicode
@@ -2085,6 +2156,10 @@ FileInterfaceFileDelete (
 {
   EFI_STATUS  Status;
 
+  //
+  // The file is going away; discard any unwritten buffered data.
+  //
+  SHELL_FREE_NON_NULL (((EFI_FILE_PROTOCOL_FILE *)This)->WriteBuffer);
   Status = ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->Delete (((EFI_FILE_PROTOCOL_FILE *)This)->Orig);
   FreePool (This);
   return (Status);
@@ -2103,11 +2178,69 @@ FileInterfaceFileClose (
   IN EFI_FILE_PROTOCOL  *This
   )
 {
+  EFI_STATUS  FlushStatus;
   EFI_STATUS  Status;
 
-  Status = ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->Close (((EFI_FILE_PROTOCOL_FILE *)This)->Orig);
+  FlushStatus = FileInterfaceFileFlushWriteBuffer ((EFI_FILE_PROTOCOL_FILE *)This);
+  SHELL_FREE_NON_NULL (((EFI_FILE_PROTOCOL_FILE *)This)->WriteBuffer);
+  Status      = ((EFI_FILE_PROTOCOL_FILE *)This)->Orig->Close (((EFI_FILE_PROTOCOL_FILE *)This)->Orig);
   FreePool (This);
-  return (Status);
+  return (EFI_ERROR (FlushStatus) ? FlushStatus : Status);
+}
+
+/**
+  Append data to the write-behind buffer, flushing to the original file
+  handle as the buffer fills.
+
+  Writes larger than the buffer capacity, or writes arriving when no buffer
+  could be allocated, go straight to the original file handle (after any
+  buffered data has been flushed to preserve ordering).
+
+  @param[in] File              The pointer to the EFI_FILE_PROTOCOL_FILE object.
+  @param[in, out] BufferSize   Size in bytes of Buffer.
+  @param[in] Buffer            The pointer to the buffer to write.
+
+  @retval EFI_SUCCESS   The data was buffered or written.
+**/
+STATIC
+EFI_STATUS
+FileInterfaceFileBufferedWrite (
+  IN     EFI_FILE_PROTOCOL_FILE  *File,
+  IN OUT UINTN                   *BufferSize,
+  IN     VOID                    *Buffer
+  )
+{
+  EFI_STATUS  Status;
+
+  if ((File->WriteBuffer == NULL) && (File->WriteCapacity != 0)) {
+    File->WriteBuffer = AllocatePool (File->WriteCapacity);
+    if (File->WriteBuffer == NULL) {
+      //
+      // Degrade to unbuffered writes rather than failing the write.
+      //
+      File->WriteCapacity = 0;
+    }
+  }
+
+  if ((File->WriteCapacity == 0) || (*BufferSize >= File->WriteCapacity)) {
+    Status = FileInterfaceFileFlushWriteBuffer (File);
+    if (EFI_ERROR (Status)) {
+      return (Status);
+    }
+
+    return (File->Orig->Write (File->Orig, BufferSize, Buffer));
+  }
+
+  if (File->WriteCount + *BufferSize > File->WriteCapacity) {
+    Status = FileInterfaceFileFlushWriteBuffer (File);
+    if (EFI_ERROR (Status)) {
+      return (Status);
+    }
+  }
+
+  CopyMem (File->WriteBuffer + File->WriteCount, Buffer, *BufferSize);
+  File->WriteCount += *BufferSize;
+  return (EFI_SUCCESS);
 }
 
 /**
@@ -2138,15 +2271,19 @@ FileInterfaceFileWrite (
     //
     // Unicode
     //
-    return (((EFI_FILE_PROTOCOL_FILE *)This)->Orig->Write (((EFI_FILE_PROTOCOL_FILE *)This)->Orig, BufferSize, Buffer));
+    return (FileInterfaceFileBufferedWrite ((EFI_FILE_PROTOCOL_FILE *)This, BufferSize, Buffer));
   } else {
     //
     // Ascii
     //
     AsciiBuffer = AllocateZeroPool (*BufferSize);
+    if (AsciiBuffer == NULL) {
+      return (EFI_OUT_OF_RESOURCES);
+    }
+
     AsciiSPrint (AsciiBuffer, *BufferSize, "%S", Buffer);
     Size   = AsciiStrSize (AsciiBuffer) - 1; // (we dont need the null terminator)
-    Status = (((EFI_FILE_PROTOCOL_FILE *)This)->Orig->Write (((EFI_FILE_PROTOCOL_FILE *)This)->Orig, &Size, AsciiBuffer));
+    Status = FileInterfaceFileBufferedWrite ((EFI_FILE_PROTOCOL_FILE *)This, &Size, AsciiBuffer);
     FreePool (AsciiBuffer);
     return (Status);
   }
@@ -2177,18 +2314,21 @@ CreateFileInterfaceFile (
   }
 
   CopyMem (NewOne, Template, sizeof (EFI_FILE_PROTOCOL_FILE));
-  NewOne->Orig        = (EFI_FILE_PROTOCOL *)Template;
-  NewOne->Unicode     = Unicode;
-  NewOne->Open        = FileInterfaceFileOpen;
-  NewOne->Close       = FileInterfaceFileClose;
-  NewOne->Delete      = FileInterfaceFileDelete;
-  NewOne->Read        = FileInterfaceFileRead;
-  NewOne->Write       = FileInterfaceFileWrite;
-  NewOne->GetPosition = FileInterfaceFileGetPosition;
-  NewOne->SetPosition = FileInterfaceFileSetPosition;
-  NewOne->GetInfo     = FileInterfaceFileGetInfo;
-  NewOne->SetInfo     = FileInterfaceFileSetInfo;
-  NewOne->Flush       = FileInterfaceFileFlush;
+  NewOne->Orig          = (EFI_FILE_PROTOCOL *)Template;
+  NewOne->Unicode       = Unicode;
+  NewOne->WriteBuffer   = NULL;
+  NewOne->WriteCapacity = PcdGet32 (PcdShellFileWriteBufferSize);
+  NewOne->WriteCount    = 0;
+  NewOne->Open          = FileInterfaceFileOpen;
+  NewOne->Close         = FileInterfaceFileClose;
+  NewOne->Delete        = FileInterfaceFileDelete;
+  NewOne->Read          = FileInterfaceFileRead;
+  NewOne->Write         = FileInterfaceFileWrite;
+  NewOne->GetPosition   = FileInterfaceFileGetPosition;
+  NewOne->SetPosition   = FileInterfaceFileSetPosition;
+  NewOne->GetInfo       = FileInterfaceFileGetInfo;
+  NewOne->SetInfo       = FileInterfaceFileSetInfo;
+  NewOne->Flush         = FileInterfaceFileFlush;
 
   return ((EFI_FILE_PROTOCOL *)NewOne);
 }
@@ -1174,8 +1174,11 @@ UpdateStdInStdOutStdErr (
           Status = WriteFileTag (TempHandle);
         }
 
-        if (!ErrUnicode && !EFI_ERROR (Status)) {
-          TempHandle = CreateFileInterfaceFile (TempHandle, FALSE);
+        if (!EFI_ERROR (Status)) {
+          //
+          // Wrap the handle for ASCII conversion and/or write buffering.
+          //
+          TempHandle = CreateFileInterfaceFile (TempHandle, ErrUnicode);
           ASSERT (TempHandle != NULL);
         }
 
@@ -1221,8 +1224,11 @@ UpdateStdInStdOutStdErr (
             }
           }
 
-          if (!OutUnicode && !EFI_ERROR (Status)) {
-            TempHandle = CreateFileInterfaceFile (TempHandle, FALSE);
+          if (!EFI_ERROR (Status)) {
+            //
+            // Wrap the handle for ASCII conversion and/or write buffering.
+            //
+            TempHandle = CreateFileInterfaceFile (TempHandle, OutUnicode);
             ASSERT (TempHandle != NULL);
           }
 
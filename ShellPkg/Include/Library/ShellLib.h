@@ -640,6 +640,34 @@ ShellOpenFileMetaArg (
   IN OUT EFI_SHELL_FILE_INFO  **ListHead
   );
 
+/**
+  Finds a group of files based on a path, without opening them.
+
+  This function uses the Arg to find all the matching files. Each matched
+  file has an EFI_SHELL_FILE_INFO structure holding the file information,
+  but no open file handle, placed on the list ListHead. Enumerating a large
+  directory this way is much cheaper than ShellOpenFileMetaArg() since no
+  file is individually opened; use it when only the file information is
+  needed. This function supports wildcards and will process '?' and '*' as
+  such. The list must be freed with a call to ShellCloseFileMetaArg().
+
+  If you are NOT appending to an existing list *ListHead must be NULL.  If
+  *ListHead is NULL then it must be callee freed.
+
+  @param[in] Arg                 The pointer to path string.
+  @param[in, out] ListHead       Head of linked list of results.
+
+  @retval EFI_SUCCESS           The operation was sucessful and the list head
+                                contains the list of matched files.
+  @retval != EFI_SUCCESS        The operation failed.
+**/
+EFI_STATUS
+EFIAPI
+ShellFindFilesMetaArg (
+  IN CHAR16                   *Arg,
+  IN OUT EFI_SHELL_FILE_INFO  **ListHead
+  );
+
 /**
   Free the linked list returned from ShellOpenFileMetaArg.
 
@@ -488,7 +488,11 @@ PrintLsOutput (
 
   PathCleanUpDirectories (CorrectedPath);
 
-  Status = ShellOpenFileMetaArg ((CHAR16 *)CorrectedPath, EFI_FILE_MODE_READ, &ListHead);
+  //
+  // Only the file information is needed for the listing, so find the files
+  // without opening each one of them.
+  //
+  Status = ShellFindFilesMetaArg ((CHAR16 *)CorrectedPath, &ListHead);
   if (!EFI_ERROR (Status)) {
     if ((ListHead == NULL) || IsListEmpty (&ListHead->Link)) {
       SHELL_FREE_NON_NULL (CorrectedPath);
@@ -600,7 +604,7 @@ PrintLsOutput (
 
   if (Rec && (ShellStatus != SHELL_ABORTED)) {
     //
-    // Re-Open all the files under the starting path for directories that didnt necessarily match our file filter
+    // Re-enumerate all the files under the starting path for directories that didnt necessarily match our file filter
     //
     ShellCloseFileMetaArg (&ListHead);
     CorrectedPath[0] = CHAR_NULL;
@@ -616,7 +620,7 @@ PrintLsOutput (
     }
 
     CorrectedPath = StrnCatGrow (&CorrectedPath, &LongestPath, L"*", 0);
-    Status        = ShellOpenFileMetaArg ((CHAR16 *)CorrectedPath, EFI_FILE_MODE_READ, &ListHead);
+    Status        = ShellFindFilesMetaArg ((CHAR16 *)CorrectedPath, &ListHead);
 
     if (!EFI_ERROR (Status)) {
       for ( Node = (EFI_SHELL_FILE_INFO *)GetFirstNode (&ListHead->Link)
@@ -1740,6 +1740,79 @@ ShellOpenFileMetaArg (
   return (EFI_UNSUPPORTED);
 }
 
+/**
+  Finds a group of files based on a path, without opening them.
+
+  This function uses the Arg to find all the matching files. Each matched
+  file has an EFI_SHELL_FILE_INFO structure holding the file information,
+  but no open file handle, placed on the list ListHead. Enumerating a large
+  directory this way is much cheaper than ShellOpenFileMetaArg() since no
+  file is individually opened; use it when only the file information is
+  needed. This function supports wildcards and will process '?' and '*' as
+  such. The list must be freed with a call to ShellCloseFileMetaArg().
+
+  If you are NOT appending to an existing list *ListHead must be NULL.  If
+  *ListHead is NULL then it must be callee freed.
+
+  @param[in] Arg                 The pointer to path string.
+  @param[in, out] ListHead       Head of linked list of results.
+
+  @retval EFI_SUCCESS           The operation was sucessful and the list head
+                                contains the list of matched files.
+  @retval != EFI_SUCCESS        The operation failed.
+**/
+EFI_STATUS
+EFIAPI
+ShellFindFilesMetaArg (
+  IN CHAR16                   *Arg,
+  IN OUT EFI_SHELL_FILE_INFO  **ListHead
+  )
+{
+  EFI_STATUS  Status;
+  CHAR16      *CleanFilePathStr;
+
+  //
+  // ASSERT that Arg and ListHead are not NULL
+  //
+  ASSERT (Arg      != NULL);
+  ASSERT (ListHead != NULL);
+
+  //
+  // Check for UEFI Shell 2.0 protocols
+  //
+  if (gEfiShellProtocol != NULL) {
+    CleanFilePathStr = NULL;
+
+    Status = InternalShellStripQuotes (Arg, &CleanFilePathStr);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Status = gEfiShellProtocol->FindFiles (
+                                  CleanFilePathStr,
+                                  ListHead
+                                  );
+    if (!EFI_ERROR (Status)) {
+      Status = gEfiShellProtocol->RemoveDupInFileList (ListHead);
+    }
+
+    if ((*ListHead != NULL) && IsListEmpty (&(*ListHead)->Link)) {
+      FreePool (*ListHead);
+      *ListHead = NULL;
+      Status    = EFI_NOT_FOUND;
+    }
+
+    FreePool (CleanFilePathStr);
+    return (Status);
+  }
+
+  //
+  // The EFI shell's FileMetaArg opens every matched file anyway, so there is
+  // nothing to save there; fall back to the open-and-record path.
+  //
+  return (ShellOpenFileMetaArg (Arg, EFI_FILE_MODE_READ, ListHead));
+}
+
 /**
   Free the linked list returned from ShellOpenFileMetaArg.
 
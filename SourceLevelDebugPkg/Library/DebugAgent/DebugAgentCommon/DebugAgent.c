@@ -372,6 +372,7 @@ DebugAgentReadBuffer (
   )
 {
   UINTN   Index;
+  UINTN   Received;
   UINT32  Begin;
   UINT32  TimeoutTicker;
   UINT32  TimerRound;
@@ -399,9 +400,15 @@ DebugAgentReadBuffer (
   Index = 0;
   while (Index < NumberOfBytes) {
     if (DebugPortPollBuffer (Handle)) {
-      DebugPortReadBuffer (Handle, Buffer + Index, 1, 0);
-      Index++;
-      continue;
+      //
+      // Read all the data already pending in the debug port in one call,
+      // to avoid paying the transport library call overhead per byte.
+      //
+      Received = DebugPortReadBuffer (Handle, Buffer + Index, NumberOfBytes - Index, 0);
+      if (Received > 0) {
+        Index += Received;
+        continue;
+      }
     }
 
     if (Timeout != 0) {
@@ -95,11 +95,27 @@ DebugPortReadBuffer (
   IN UINTN              Timeout
   )
 {
-  if ((NumberOfBytes != 1) || (Buffer == NULL) || (Timeout != 0)) {
+  UINTN  Index;
+
+  if ((NumberOfBytes == 0) || (Buffer == NULL) || (Timeout != 0)) {
     return 0;
   }
 
-  return SerialPortRead (Buffer, 1);
+  //
+  // Only drain the data already pending in the serial port, so that this
+  // function never blocks waiting for the wire. Callers poll with their
+  // own timeout policy.
+  //
+  Index = 0;
+  while ((Index < NumberOfBytes) && SerialPortPoll ()) {
+    if (SerialPortRead (Buffer + Index, 1) != 1) {
+      break;
+    }
+
+    Index++;
+  }
+
+  return Index;
 }
 
 /**
@@ -796,8 +796,9 @@ DebugPortReadBuffer (
   USB_DEBUG_PORT_HANDLE  *UsbDebugPortHandle;
   RETURN_STATUS          Status;
   UINT8                  Index;
+  UINTN                  BytesToRead;
 
-  if ((NumberOfBytes != 1) || (Buffer == NULL) || (Timeout != 0)) {
+  if ((NumberOfBytes == 0) || (Buffer == NULL) || (Timeout != 0)) {
     return 0;
   }
 
@@ -821,21 +822,24 @@ DebugPortReadBuffer (
   //
   // Read data from buffer
   //
-  if (UsbDebugPortHandle->DataCount < 1) {
+  if ((UsbDebugPortHandle->DataCount < 1) ||
+      (UsbDebugPortHandle->DataCount > sizeof (UsbDebugPortHandle->Data)))
+  {
     return 0;
-  } else {
-    *Buffer = UsbDebugPortHandle->Data[0];
-    for (Index = 0; Index < UsbDebugPortHandle->DataCount - 1; Index++) {
-      if ((Index + 1) >= USB_DEBUG_PORT_MAX_PACKET_SIZE) {
-        return 0;
-      }
+  }
 
-      UsbDebugPortHandle->Data[Index] = UsbDebugPortHandle->Data[Index + 1];
-    }
+  BytesToRead = MIN (NumberOfBytes, (UINTN)UsbDebugPortHandle->DataCount);
+  CopyMem (Buffer, UsbDebugPortHandle->Data, BytesToRead);
 
-    UsbDebugPortHandle->DataCount = (UINT8)(UsbDebugPortHandle->DataCount - 1);
-    return 1;
+  //
+  // Move the unconsumed data to the head of the buffer
+  //
+  for (Index = 0; Index < UsbDebugPortHandle->DataCount - BytesToRead; Index++) {
+    UsbDebugPortHandle->Data[Index] = UsbDebugPortHandle->Data[Index + BytesToRead];
   }
+
+  UsbDebugPortHandle->DataCount = (UINT8)(UsbDebugPortHandle->DataCount - BytesToRead);
+  return BytesToRead;
 }
 
 /**
@@ -883,8 +883,9 @@ DebugPortReadBuffer (
   USB3_DEBUG_PORT_HANDLE  *UsbDebugPortHandle;
   UINT8                   Index;
   UINT8                   *Data;
+  UINTN                   BytesToRead;
 
-  if ((NumberOfBytes != 1) || (Buffer == NULL) || (Timeout != 0)) {
+  if ((NumberOfBytes == 0) || (Buffer == NULL) || (Timeout != 0)) {
     return 0;
   }
 
@@ -918,22 +919,24 @@ DebugPortReadBuffer (
   //
   // Read data from buffer
   //
-  if (UsbDebugPortHandle->DataCount < 1) {
+  if ((UsbDebugPortHandle->DataCount < 1) ||
+      (UsbDebugPortHandle->DataCount > XHCI_DEBUG_DEVICE_MAX_PACKET_SIZE))
+  {
     return 0;
-  } else {
-    *Buffer = Data[0];
-
-    for (Index = 0; Index < UsbDebugPortHandle->DataCount - 1; Index++) {
-      if ((Index + 1) >= XHCI_DEBUG_DEVICE_MAX_PACKET_SIZE) {
-        return 0;
-      }
+  }
 
-      Data[Index] = Data[Index + 1];
-    }
+  BytesToRead = MIN (NumberOfBytes, (UINTN)UsbDebugPortHandle->DataCount);
+  CopyMem (Buffer, Data, BytesToRead);
 
-    UsbDebugPortHandle->DataCount = (UINT8)(UsbDebugPortHandle->DataCount - 1);
-    return 1;
+  //
+  // Move the unconsumed data to the head of the buffer
+  //
+  for (Index = 0; Index < UsbDebugPortHandle->DataCount - BytesToRead; Index++) {
+    Data[Index] = Data[Index + BytesToRead];
   }
+
+  UsbDebugPortHandle->DataCount = (UINT8)(UsbDebugPortHandle->DataCount - BytesToRead);
+  return BytesToRead;
 }
 
 /**
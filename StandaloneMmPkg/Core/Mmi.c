@@ -8,6 +8,8 @@
 **/
 
 #include "StandaloneMmCore.h"
+#include <Library/TimerLib.h>
+#include <Guid/MmiHandlerStatistics.h>
 
 //
 // MM_HANDLER_STATE_NOTIFIER
@@ -19,26 +21,64 @@
 
 #define MMI_ENTRY_SIGNATURE  SIGNATURE_32('m','m','i','e')
 
-typedef struct {
+//
+// Number of hash buckets used for MMI entry lookup.  Must be a power of two.
+//
+#define MMI_ENTRY_HASH_BUCKETS  32
+
+typedef struct _MMI_ENTRY MMI_ENTRY;
+
+struct _MMI_ENTRY {
   UINTN         Signature;
-  LIST_ENTRY    AllEntries; // All entries
+  LIST_ENTRY    AllEntries;   // All entries
+  MMI_ENTRY     *NextInBucket; // Hash chain of entries in the same bucket
 
-  EFI_GUID      HandlerType; // Type of interrupt
-  LIST_ENTRY    MmiHandlers; // All handlers
-} MMI_ENTRY;
+  EFI_GUID      HandlerType;  // Type of interrupt
+  LIST_ENTRY    MmiHandlers;  // All handlers
+};
 
 #define MMI_HANDLER_SIGNATURE  SIGNATURE_32('m','m','i','h')
 
 typedef struct {
   UINTN                         Signature;
-  LIST_ENTRY                    Link;        // Link on MMI_ENTRY.MmiHandlers
-  EFI_MM_HANDLER_ENTRY_POINT    Handler;     // The mm handler's entry point
+  LIST_ENTRY                    Link;            // Link on MMI_ENTRY.MmiHandlers
+  EFI_MM_HANDLER_ENTRY_POINT    Handler;         // The mm handler's entry point
   MMI_ENTRY                     *MmiEntry;
+  UINT64                        InvocationCount; // Number of times the handler has run
+  UINT64                        TotalTicks;      // Cumulative time in the handler
+  UINT64                        MaxTicks;        // Longest single dispatch
 } MMI_HANDLER;
 
 LIST_ENTRY  mRootMmiHandlerList = INITIALIZE_LIST_HEAD_VARIABLE (mRootMmiHandlerList);
 LIST_ENTRY  mMmiEntryList       = INITIALIZE_LIST_HEAD_VARIABLE (mMmiEntryList);
 
+//
+// Hash table over the MMI entries so that dispatch does not pay a linear
+// GUID comparison walk per event when many handler types are registered.
+//
+STATIC MMI_ENTRY  *mMmiEntryHashTable[MMI_ENTRY_HASH_BUCKETS];
+
+/**
+  Returns the hash bucket index for a handler type GUID.
+
+  @param  HandlerType            The type of the interrupt
+
+  @return Index into mMmiEntryHashTable
+
+**/
+STATIC
+UINTN
+MmCoreMmiEntryHash (
+  IN CONST EFI_GUID  *HandlerType
+  )
+{
+  //
+  // EFI GUIDs are effectively random in Data1; folding in Data2 guards
+  // against GUID families that share a common first word.
+  //
+  return (HandlerType->Data1 ^ HandlerType->Data2) & (MMI_ENTRY_HASH_BUCKETS - 1);
+}
+
 /**
   Finds the MMI entry for the requested handler type.
 
@@ -55,24 +95,21 @@ MmCoreFindMmiEntry (
   IN BOOLEAN   Create
   )
 {
-  LIST_ENTRY  *Link;
-  MMI_ENTRY   *Item;
-  MMI_ENTRY   *MmiEntry;
+  UINTN      Bucket;
+  MMI_ENTRY  *MmiEntry;
 
   //
-  // Search the MMI entry list for the matching GUID
+  // Search the hash bucket for the matching GUID
   //
-  MmiEntry = NULL;
-  for (Link = mMmiEntryList.ForwardLink;
-       Link != &mMmiEntryList;
-       Link = Link->ForwardLink)
+  Bucket = MmCoreMmiEntryHash (HandlerType);
+  for (MmiEntry = mMmiEntryHashTable[Bucket];
+       MmiEntry != NULL;
+       MmiEntry = MmiEntry->NextInBucket)
   {
-    Item = CR (Link, MMI_ENTRY, AllEntries, MMI_ENTRY_SIGNATURE);
-    if (CompareGuid (&Item->HandlerType, HandlerType)) {
+    if (CompareGuid (&MmiEntry->HandlerType, HandlerType)) {
       //
       // This is the MMI entry
       //
-      MmiEntry = Item;
       break;
     }
   }
@@ -92,9 +129,11 @@ MmCoreFindMmiEntry (
       InitializeListHead (&MmiEntry->MmiHandlers);
 
       //
-      // Add it to MMI entry list
+      // Add it to the MMI entry list and its hash bucket
       //
       InsertTailList (&mMmiEntryList, &MmiEntry->AllEntries);
+      MmiEntry->NextInBucket     = mMmiEntryHashTable[Bucket];
+      mMmiEntryHashTable[Bucket] = MmiEntry;
     }
   }
 
@@ -130,7 +169,11 @@ MmiManage (
   MMI_HANDLER  *MmiHandler;
   BOOLEAN      SuccessReturn;
   EFI_STATUS   Status;
+  UINT64       StartTick;
+  UINT64       EndTick;
+  UINT64       ElapsedTicks;
 
+  StartTick     = 0;
   Status        = EFI_NOT_FOUND;
   SuccessReturn = FALSE;
   if (HandlerType == NULL) {
@@ -157,6 +200,10 @@ MmiManage (
   for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
     MmiHandler = CR (Link, MMI_HANDLER, Link, MMI_HANDLER_SIGNATURE);
 
+    if (FeaturePcdGet (PcdMmiHandlerProfileEnable)) {
+      StartTick = GetPerformanceCounter ();
+    }
+
     Status = MmiHandler->Handler (
                            (EFI_HANDLE)MmiHandler,
                            Context,
@@ -164,6 +211,21 @@ MmiManage (
                            CommBufferSize
                            );
 
+    MmiHandler->InvocationCount++;
+    if (FeaturePcdGet (PcdMmiHandlerProfileEnable)) {
+      //
+      // The performance counter may count down on some platforms, so take
+      // the magnitude of the difference.
+      //
+      EndTick      = GetPerformanceCounter ();
+      ElapsedTicks = (EndTick >= StartTick) ? (EndTick - StartTick) : (StartTick - EndTick);
+
+      MmiHandler->TotalTicks += ElapsedTicks;
+      if (ElapsedTicks > MmiHandler->MaxTicks) {
+        MmiHandler->MaxTicks = ElapsedTicks;
+      }
+    }
+
     switch (Status) {
       case EFI_INTERRUPT_PENDING:
         //
@@ -298,6 +360,7 @@ MmiHandlerUnRegister (
 {
   MMI_HANDLER  *MmiHandler;
   MMI_ENTRY    *MmiEntry;
+  MMI_ENTRY    **Bucket;
 
   MmiHandler = (MMI_HANDLER *)DispatchHandle;
 
@@ -324,7 +387,15 @@ MmiHandlerUnRegister (
   if (IsListEmpty (&MmiEntry->MmiHandlers)) {
     //
     // No handler registered for this interrupt now, remove the MMI_ENTRY
+    // from the entry list and its hash bucket
     //
+    Bucket = &mMmiEntryHashTable[MmCoreMmiEntryHash (&MmiEntry->HandlerType)];
+    while (*Bucket != MmiEntry) {
+      ASSERT (*Bucket != NULL);
+      Bucket = &(*Bucket)->NextInBucket;
+    }
+
+    *Bucket = MmiEntry->NextInBucket;
     RemoveEntryList (&MmiEntry->AllEntries);
 
     FreePool (MmiEntry);
@@ -332,3 +403,116 @@ MmiHandlerUnRegister (
 
   return EFI_SUCCESS;
 }
+
+/**
+  Fills one MMI handler statistics entry.
+
+  @param  StatsEntry     The entry to fill.
+  @param  HandlerType    Handler type GUID, or NULL for a root MMI handler.
+  @param  MmiHandler     The handler the statistics are taken from.
+
+**/
+STATIC
+VOID
+MmiHandlerStatisticsFillEntry (
+  OUT MMI_HANDLER_STATISTICS_ENTRY  *StatsEntry,
+  IN  CONST EFI_GUID                *HandlerType OPTIONAL,
+  IN  CONST MMI_HANDLER             *MmiHandler
+  )
+{
+  if (HandlerType != NULL) {
+    CopyGuid (&StatsEntry->HandlerType, HandlerType);
+  } else {
+    ZeroMem (&StatsEntry->HandlerType, sizeof (StatsEntry->HandlerType));
+  }
+
+  StatsEntry->Handler         = (UINT64)(UINTN)MmiHandler->Handler;
+  StatsEntry->InvocationCount = MmiHandler->InvocationCount;
+  StatsEntry->TotalTicks      = MmiHandler->TotalTicks;
+  StatsEntry->MaxTicks        = MmiHandler->MaxTicks;
+}
+
+/**
+  Communicate-based callback that reports per-handler dispatch statistics.
+
+  The communication buffer holds an MMI_HANDLER_STATISTICS structure.  On
+  return its HandlerCount is the total number of registered handlers and as
+  many entries as the buffer can hold are filled in, so a caller that passed
+  a too-small buffer can retry with the reported count.
+
+  @param  DispatchHandle  The unique handle assigned to this handler by MmiHandlerRegister().
+  @param  Context         Points to an optional handler context which was specified when the handler was registered.
+  @param  CommBuffer      A pointer to a collection of data in memory that will
+                          be conveyed from a non-MM environment into an MM environment.
+  @param  CommBufferSize  The size of the CommBuffer.
+
+  @retval EFI_SUCCESS     The statistics were reported.
+
+**/
+EFI_STATUS
+EFIAPI
+MmiHandlerStatisticsHandler (
+  IN     EFI_HANDLE  DispatchHandle,
+  IN     CONST VOID  *Context         OPTIONAL,
+  IN OUT VOID        *CommBuffer      OPTIONAL,
+  IN OUT UINTN       *CommBufferSize  OPTIONAL
+  )
+{
+  MMI_HANDLER_STATISTICS  *Stats;
+  MMI_HANDLER             *MmiHandler;
+  MMI_ENTRY               *MmiEntry;
+  LIST_ENTRY              *EntryLink;
+  LIST_ENTRY              *HandlerLink;
+  UINTN                   Capacity;
+  UINTN                   Total;
+
+  if ((CommBuffer == NULL) || (CommBufferSize == NULL) ||
+      (*CommBufferSize < OFFSET_OF (MMI_HANDLER_STATISTICS, Entry)))
+  {
+    return EFI_SUCCESS;
+  }
+
+  Stats    = (MMI_HANDLER_STATISTICS *)CommBuffer;
+  Capacity = (*CommBufferSize - OFFSET_OF (MMI_HANDLER_STATISTICS, Entry)) / sizeof (MMI_HANDLER_STATISTICS_ENTRY);
+  Total    = 0;
+
+  //
+  // Root MMI handlers
+  //
+  for (HandlerLink = mRootMmiHandlerList.ForwardLink;
+       HandlerLink != &mRootMmiHandlerList;
+       HandlerLink = HandlerLink->ForwardLink)
+  {
+    MmiHandler = CR (HandlerLink, MMI_HANDLER, Link, MMI_HANDLER_SIGNATURE);
+    if (Total < Capacity) {
+      MmiHandlerStatisticsFillEntry (&Stats->Entry[Total], NULL, MmiHandler);
+    }
+
+    Total++;
+  }
+
+  //
+  // GUIDed MMI handlers
+  //
+  for (EntryLink = mMmiEntryList.ForwardLink;
+       EntryLink != &mMmiEntryList;
+       EntryLink = EntryLink->ForwardLink)
+  {
+    MmiEntry = CR (EntryLink, MMI_ENTRY, AllEntries, MMI_ENTRY_SIGNATURE);
+    for (HandlerLink = MmiEntry->MmiHandlers.ForwardLink;
+         HandlerLink != &MmiEntry->MmiHandlers;
+         HandlerLink = HandlerLink->ForwardLink)
+    {
+      MmiHandler = CR (HandlerLink, MMI_HANDLER, Link, MMI_HANDLER_SIGNATURE);
+      if (Total < Capacity) {
+        MmiHandlerStatisticsFillEntry (&Stats->Entry[Total], &MmiEntry->HandlerType, MmiHandler);
+      }
+
+      Total++;
+    }
+  }
+
+  Stats->HandlerCount = Total;
+
+  return EFI_SUCCESS;
+}
@@ -84,11 +84,12 @@ EFI_MM_SYSTEM_TABLE  gMmCoreMmst = {
 // Table of MMI Handlers that are registered by the MM Core when it is initialized
 //
 MM_CORE_MMI_HANDLERS  mMmCoreMmiHandlers[] = {
-  { MmReadyToLockHandler,     &gEfiDxeMmReadyToLockProtocolGuid, NULL, TRUE  },
-  { MmEndOfDxeHandler,        &gEfiEndOfDxeEventGroupGuid,       NULL, FALSE },
-  { MmExitBootServiceHandler, &gEfiEventExitBootServicesGuid,    NULL, FALSE },
-  { MmReadyToBootHandler,     &gEfiEventReadyToBootGuid,         NULL, FALSE },
-  { NULL,                     NULL,                              NULL, FALSE },
+  { MmReadyToLockHandler,        &gEfiDxeMmReadyToLockProtocolGuid, NULL, TRUE  },
+  { MmEndOfDxeHandler,           &gEfiEndOfDxeEventGroupGuid,       NULL, FALSE },
+  { MmExitBootServiceHandler,    &gEfiEventExitBootServicesGuid,    NULL, FALSE },
+  { MmReadyToBootHandler,        &gEfiEventReadyToBootGuid,         NULL, FALSE },
+  { MmiHandlerStatisticsHandler, &gMmiHandlerStatisticsGuid,        NULL, FALSE },
+  { NULL,                        NULL,                              NULL, FALSE },
 };
 
 EFI_SYSTEM_TABLE      *mEfiSystemTable;
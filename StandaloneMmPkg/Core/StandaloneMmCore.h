@@ -705,6 +705,27 @@ MmEndOfDxeHandler (
   IN OUT UINTN       *CommBufferSize  OPTIONAL
   );
 
+/**
+  Communicate-based callback that reports per-handler dispatch statistics.
+
+  @param  DispatchHandle  The unique handle assigned to this handler by MmiHandlerRegister().
+  @param  Context         Points to an optional handler context which was specified when the handler was registered.
+  @param  CommBuffer      A pointer to a collection of data in memory that will
+                          be conveyed from a non-MM environment into an MM environment.
+  @param  CommBufferSize  The size of the CommBuffer.
+
+  @retval EFI_SUCCESS     The statistics were reported.
+
+**/
+EFI_STATUS
+EFIAPI
+MmiHandlerStatisticsHandler (
+  IN     EFI_HANDLE  DispatchHandle,
+  IN     CONST VOID  *Context         OPTIONAL,
+  IN OUT VOID        *CommBuffer      OPTIONAL,
+  IN OUT UINTN       *CommBufferSize  OPTIONAL
+  );
+
 /**
   Place holder function until all the MM System Table Service are available.
 
@@ -0,0 +1,59 @@
+/** @file
+  MMI handler statistics report provided by the Standalone MM Core.
+
+  Sending an MM communicate request with this GUID returns one entry for
+  every registered MMI handler: the handler type GUID it was registered
+  with, its entry point, how often it has been dispatched and, when
+  PcdMmiHandlerProfileEnable is TRUE, the cumulative and worst-case time
+  spent in it in performance counter ticks.
+
+  Copyright (c) 2016 - 2021, Arm Limited. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef MMI_HANDLER_STATISTICS_H_
+#define MMI_HANDLER_STATISTICS_H_
+
+#define MMI_HANDLER_STATISTICS_GUID \
+  { 0x3c43d1a6, 0x2f98, 0x4a64, { 0x8f, 0x5d, 0x17, 0xb7, 0xa9, 0xe7, 0x64, 0x2e } }
+
+typedef struct {
+  ///
+  /// Handler type GUID the handler was registered with.
+  /// Zero GUID for root MMI handlers.
+  ///
+  EFI_GUID    HandlerType;
+  ///
+  /// Entry point address of the handler.
+  ///
+  UINT64      Handler;
+  ///
+  /// Number of times the handler has been dispatched.
+  ///
+  UINT64      InvocationCount;
+  ///
+  /// Cumulative time spent in the handler, in performance counter ticks.
+  /// Zero unless PcdMmiHandlerProfileEnable is TRUE.
+  ///
+  UINT64      TotalTicks;
+  ///
+  /// Longest single dispatch of the handler, in performance counter ticks.
+  /// Zero unless PcdMmiHandlerProfileEnable is TRUE.
+  ///
+  UINT64      MaxTicks;
+} MMI_HANDLER_STATISTICS_ENTRY;
+
+typedef struct {
+  ///
+  /// On input, the number of entries the buffer following this header can
+  /// hold.  On output, the total number of registered handlers; only the
+  /// first MIN(input, output) entries are filled in.
+  ///
+  UINT64                          HandlerCount;
+  MMI_HANDLER_STATISTICS_ENTRY    Entry[1];
+} MMI_HANDLER_STATISTICS;
+
+extern EFI_GUID  gMmiHandlerStatisticsGuid;
+
+#endif
@@ -253,6 +253,19 @@ SetDataSelectors (
   UINT16  Selector
   );
 
+/**
+  Invalidates the TLB entry for the page that contains the specified linear
+  address on the current processor.
+
+  @param  Address  Linear address covered by the TLB entry to invalidate.
+
+**/
+VOID
+EFIAPI
+CpuInvalidateTlbPage (
+  UINTN  Address
+  );
+
 /**
   Update GCD memory space attributes according to current page table setup.
 **/
@@ -60,6 +60,14 @@
 #define MAX_DEBUG_MESSAGE_LENGTH  0x100
 #define IA32_PF_EC_ID             BIT4
 
+//
+// Maximum number of 4KB pages for which the TLB is invalidated one page at a
+// time (INVLPG) after an attribute change. Larger ranges reload CR3 instead,
+// because the per-page invalidations would cost more than repopulating the
+// whole TLB.
+//
+#define MAX_TLB_FLUSH_PAGE_COUNT  64
+
 typedef enum {
   PageNone,
   Page4K,
@@ -915,9 +923,10 @@ AssignMemoryPageAttributes (
   IN  PAGE_TABLE_LIB_ALLOCATE_PAGES  AllocatePagesFunc OPTIONAL
   )
 {
-  RETURN_STATUS  Status;
-  BOOLEAN        IsModified;
-  BOOLEAN        IsSplitted;
+  RETURN_STATUS     Status;
+  BOOLEAN           IsModified;
+  BOOLEAN           IsSplitted;
+  PHYSICAL_ADDRESS  Address;
 
   //  DEBUG((DEBUG_INFO, "AssignMemoryPageAttributes: 0x%lx - 0x%lx (0x%lx)\n", BaseAddress, Length, Attributes));
   Status = ConvertMemoryPageAttributes (PagingContext, BaseAddress, Length, Attributes, PageActionAssign, AllocatePagesFunc, &IsSplitted, &IsModified);
@@ -930,7 +939,21 @@ AssignMemoryPageAttributes (
       // TLB flush in MWAIT loop mode, there's no need to flush TLB for them
       // here.
       //
-      CpuFlushTlb ();
+      if (!IsSplitted && (Length <= MAX_TLB_FLUSH_PAGE_COUNT * SIZE_4KB)) {
+        //
+        // Invalidate only the modified range when it is small, so frequent
+        // per-section attribute updates (e.g. DXE image protection) do not
+        // throw away the whole TLB each time. This must not be done when a
+        // page was split: the old large-page translation covers addresses
+        // outside the modified range and both translations must never be
+        // live at once, so a full flush is required in that case.
+        //
+        for (Address = BaseAddress; Address < BaseAddress + Length; Address += SIZE_4KB) {
+          CpuInvalidateTlbPage ((UINTN)Address);
+        }
+      } else {
+        CpuFlushTlb ();
+      }
     }
   }
 
@@ -0,0 +1,101 @@
+/** @file
+  Public include file for the CPU Performance Counter Library.
+
+  The library programs the architectural performance monitoring facility
+  (CPUID leaf 0AH) to count events on the calling logical processor. All
+  state lives in per-processor MSRs, so the library is usable from DXE and
+  SMM alike, but a counter must be started, sampled and stopped on the same
+  logical processor.
+
+  Copyright (c) 2026, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef CPU_PERF_COUNTER_LIB_H_
+#define CPU_PERF_COUNTER_LIB_H_
+
+typedef enum {
+  //
+  // Events backed by the fixed-function counters.
+  //
+  CpuPerfCounterInstructionsRetired = 0,
+  CpuPerfCounterUnhaltedCoreCycles,
+  CpuPerfCounterUnhaltedReferenceCycles,
+  //
+  // Architectural events backed by general-purpose counter 0.
+  //
+  CpuPerfCounterLastLevelCacheReferences,
+  CpuPerfCounterLastLevelCacheMisses,
+  CpuPerfCounterTypeMax
+} CPU_PERF_COUNTER_TYPE;
+
+/**
+  Start counting the specified event on the calling logical processor.
+
+  The counter is cleared before it is enabled, so the first sample after a
+  successful start is the event count accumulated since this call. Ring 0
+  events only are counted, which in firmware covers all execution.
+
+  @param[in]  Type  Event to count.
+
+  @retval RETURN_SUCCESS            The counter is counting.
+  @retval RETURN_INVALID_PARAMETER  Type is not a valid event.
+  @retval RETURN_UNSUPPORTED        The processor does not implement
+                                    architectural performance monitoring, or
+                                    does not implement the specified event.
+
+**/
+RETURN_STATUS
+EFIAPI
+CpuPerfCounterStart (
+  IN CPU_PERF_COUNTER_TYPE  Type
+  );
+
+/**
+  Sample the specified event counter on the calling logical processor.
+
+  The counter keeps counting; callers measuring a code region sample it at
+  the region boundaries and subtract. The returned value is zero-extended
+  from the counter width reported by CPUID leaf 0AH.
+
+  @param[in]   Type   Event to sample.
+  @param[out]  Count  Event count accumulated since CpuPerfCounterStart().
+
+  @retval RETURN_SUCCESS            Count is valid.
+  @retval RETURN_INVALID_PARAMETER  Type is not a valid event, or Count is
+                                    NULL.
+  @retval RETURN_UNSUPPORTED        The processor does not implement
+                                    architectural performance monitoring, or
+                                    does not implement the specified event.
+
+**/
+RETURN_STATUS
+EFIAPI
+CpuPerfCounterSample (
+  IN  CPU_PERF_COUNTER_TYPE  Type,
+  OUT UINT64                 *Count
+  );
+
+/**
+  Stop counting the specified event on the calling logical processor.
+
+  The accumulated count remains readable with CpuPerfCounterSample() until
+  the counter is started again.
+
+  @param[in]  Type  Event to stop.
+
+  @retval RETURN_SUCCESS            The counter is stopped.
+  @retval RETURN_INVALID_PARAMETER  Type is not a valid event.
+  @retval RETURN_UNSUPPORTED        The processor does not implement
+                                    architectural performance monitoring, or
+                                    does not implement the specified event.
+
+**/
+RETURN_STATUS
+EFIAPI
+CpuPerfCounterStop (
+  IN CPU_PERF_COUNTER_TYPE  Type
+  );
+
+#endif
@@ -0,0 +1,286 @@
+/** @file
+  CPU Performance Counter Library based on architectural performance
+  monitoring (CPUID leaf 0AH).
+
+  Instructions retired and the two cycle events use the fixed-function
+  counters. The last-level cache events are architectural events programmed
+  on general-purpose counter 0, so only one of them can be active at a time.
+  All accesses are plain MSR reads and writes against the calling logical
+  processor, which keeps the library stateless and usable from SMM.
+
+  Copyright (c) 2026, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include <Library/BaseLib.h>
+#include <Library/CpuPerfCounterLib.h>
+#include <Register/Intel/Cpuid.h>
+#include <Register/Intel/ArchitecturalMsr.h>
+
+typedef struct {
+  BOOLEAN    FixedCounter;     ///< TRUE for fixed-function counter events.
+  UINT32     CounterIndex;     ///< Fixed-function counter index, if fixed.
+  UINT32     AvailabilityBit;  ///< Event availability bit in CPUID.0AH:EBX.
+  UINT8      EventSelect;      ///< PERFEVTSEL event code, if general-purpose.
+  UINT8      UnitMask;         ///< PERFEVTSEL unit mask, if general-purpose.
+} CPU_PERF_COUNTER_EVENT;
+
+CONST CPU_PERF_COUNTER_EVENT  mCpuPerfCounterEvents[CpuPerfCounterTypeMax] = {
+  { TRUE,  0, 1, 0x00, 0x00 },  // CpuPerfCounterInstructionsRetired
+  { TRUE,  1, 0, 0x00, 0x00 },  // CpuPerfCounterUnhaltedCoreCycles
+  { TRUE,  2, 2, 0x00, 0x00 },  // CpuPerfCounterUnhaltedReferenceCycles
+  { FALSE, 0, 3, 0x2E, 0x4F },  // CpuPerfCounterLastLevelCacheReferences
+  { FALSE, 0, 4, 0x2E, 0x41 }   // CpuPerfCounterLastLevelCacheMisses
+};
+
+/**
+  Check whether the calling processor implements the specified event and
+  return the performance monitoring capabilities.
+
+  @param[in]   Type  Event to check.
+  @param[out]  Eax   CPUID.0AH:EAX on output. May be NULL.
+  @param[out]  Edx   CPUID.0AH:EDX on output. May be NULL.
+
+  @retval RETURN_SUCCESS            The event is implemented.
+  @retval RETURN_INVALID_PARAMETER  Type is not a valid event.
+  @retval RETURN_UNSUPPORTED        The processor does not implement
+                                    architectural performance monitoring, or
+                                    does not implement the specified event.
+
+**/
+RETURN_STATUS
+CpuPerfCounterCheckEvent (
+  IN  CPU_PERF_COUNTER_TYPE                           Type,
+  OUT CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING_EAX  *Eax   OPTIONAL,
+  OUT CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING_EDX  *Edx   OPTIONAL
+  )
+{
+  CONST CPU_PERF_COUNTER_EVENT                    *Event;
+  CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING_EAX  LocalEax;
+  CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING_EBX  LocalEbx;
+  CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING_EDX  LocalEdx;
+  UINT32                                          MaxLeaf;
+
+  if ((UINT32)Type >= CpuPerfCounterTypeMax) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  AsmCpuid (CPUID_SIGNATURE, &MaxLeaf, NULL, NULL, NULL);
+  if (MaxLeaf < CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  AsmCpuid (
+    CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING,
+    &LocalEax.Uint32,
+    &LocalEbx.Uint32,
+    NULL,
+    &LocalEdx.Uint32
+    );
+  if (LocalEax.Bits.ArchPerfMonVerID == 0) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  Event = &mCpuPerfCounterEvents[Type];
+  if (Event->FixedCounter) {
+    //
+    // Fixed-function counters are enumerated from version 2 onwards.
+    //
+    if ((LocalEax.Bits.ArchPerfMonVerID < 2) ||
+        (LocalEdx.Bits.FixedFunctionPerformanceCounters <= Event->CounterIndex))
+    {
+      return RETURN_UNSUPPORTED;
+    }
+  } else {
+    //
+    // A set availability bit means the event is NOT implemented.
+    //
+    if ((LocalEax.Bits.PerformanceMonitorCounters == 0) ||
+        (LocalEax.Bits.EbxBitVectorLength <= Event->AvailabilityBit) ||
+        ((LocalEbx.Uint32 & (1u << Event->AvailabilityBit)) != 0))
+    {
+      return RETURN_UNSUPPORTED;
+    }
+  }
+
+  if (Eax != NULL) {
+    *Eax = LocalEax;
+  }
+
+  if (Edx != NULL) {
+    *Edx = LocalEdx;
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Start counting the specified event on the calling logical processor.
+
+  The counter is cleared before it is enabled, so the first sample after a
+  successful start is the event count accumulated since this call. Ring 0
+  events only are counted, which in firmware covers all execution.
+
+  @param[in]  Type  Event to count.
+
+  @retval RETURN_SUCCESS            The counter is counting.
+  @retval RETURN_INVALID_PARAMETER  Type is not a valid event.
+  @retval RETURN_UNSUPPORTED        The processor does not implement
+                                    architectural performance monitoring, or
+                                    does not implement the specified event.
+
+**/
+RETURN_STATUS
+EFIAPI
+CpuPerfCounterStart (
+  IN CPU_PERF_COUNTER_TYPE  Type
+  )
+{
+  CONST CPU_PERF_COUNTER_EVENT        *Event;
+  MSR_IA32_PERF_GLOBAL_CTRL_REGISTER  GlobalCtrl;
+  MSR_IA32_FIXED_CTR_CTRL_REGISTER    FixedCtrl;
+  MSR_IA32_PERFEVTSEL_REGISTER        EvtSel;
+  RETURN_STATUS                       Status;
+
+  Status = CpuPerfCounterCheckEvent (Type, NULL, NULL);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  Event             = &mCpuPerfCounterEvents[Type];
+  GlobalCtrl.Uint64 = AsmReadMsr64 (MSR_IA32_PERF_GLOBAL_CTRL);
+  if (Event->FixedCounter) {
+    //
+    // Disable the counter while it is cleared and reprogrammed, then enable
+    // ring 0 counting only.
+    //
+    GlobalCtrl.Bits.EN_FIXED_CTRn &= ~(1u << Event->CounterIndex);
+    AsmWriteMsr64 (MSR_IA32_PERF_GLOBAL_CTRL, GlobalCtrl.Uint64);
+
+    FixedCtrl.Uint64  = AsmReadMsr64 (MSR_IA32_FIXED_CTR_CTRL);
+    FixedCtrl.Uint64 &= ~LShiftU64 (0xF, Event->CounterIndex * 4);
+    FixedCtrl.Uint64 |= LShiftU64 (1, Event->CounterIndex * 4);
+    AsmWriteMsr64 (MSR_IA32_FIXED_CTR_CTRL, FixedCtrl.Uint64);
+    AsmWriteMsr64 (MSR_IA32_FIXED_CTR0 + Event->CounterIndex, 0);
+
+    GlobalCtrl.Bits.EN_FIXED_CTRn |= (1u << Event->CounterIndex);
+  } else {
+    GlobalCtrl.Bits.EN_PMCn &= ~1u;
+    AsmWriteMsr64 (MSR_IA32_PERF_GLOBAL_CTRL, GlobalCtrl.Uint64);
+
+    EvtSel.Uint64           = 0;
+    EvtSel.Bits.EventSelect = Event->EventSelect;
+    EvtSel.Bits.UMASK       = Event->UnitMask;
+    EvtSel.Bits.OS          = 1;
+    EvtSel.Bits.EN          = 1;
+    AsmWriteMsr64 (MSR_IA32_PMC0, 0);
+    AsmWriteMsr64 (MSR_IA32_PERFEVTSEL0, EvtSel.Uint64);
+
+    GlobalCtrl.Bits.EN_PMCn |= 1u;
+  }
+
+  AsmWriteMsr64 (MSR_IA32_PERF_GLOBAL_CTRL, GlobalCtrl.Uint64);
+  return RETURN_SUCCESS;
+}
+
+/**
+  Sample the specified event counter on the calling logical processor.
+
+  The counter keeps counting; callers measuring a code region sample it at
+  the region boundaries and subtract. The returned value is zero-extended
+  from the counter width reported by CPUID leaf 0AH.
+
+  @param[in]   Type   Event to sample.
+  @param[out]  Count  Event count accumulated since CpuPerfCounterStart().
+
+  @retval RETURN_SUCCESS            Count is valid.
+  @retval RETURN_INVALID_PARAMETER  Type is not a valid event, or Count is
+                                    NULL.
+  @retval RETURN_UNSUPPORTED        The processor does not implement
+                                    architectural performance monitoring, or
+                                    does not implement the specified event.
+
+**/
+RETURN_STATUS
+EFIAPI
+CpuPerfCounterSample (
+  IN  CPU_PERF_COUNTER_TYPE  Type,
+  OUT UINT64                 *Count
+  )
+{
+  CONST CPU_PERF_COUNTER_EVENT                    *Event;
+  CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING_EAX  Eax;
+  CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING_EDX  Edx;
+  RETURN_STATUS                                   Status;
+  UINT64                                          Value;
+  UINT32                                          Width;
+
+  if (Count == NULL) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  Status = CpuPerfCounterCheckEvent (Type, &Eax, &Edx);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  Event = &mCpuPerfCounterEvents[Type];
+  if (Event->FixedCounter) {
+    Value = AsmReadMsr64 (MSR_IA32_FIXED_CTR0 + Event->CounterIndex);
+    Width = Edx.Bits.FixedFunctionPerformanceCounterWidth;
+  } else {
+    Value = AsmReadMsr64 (MSR_IA32_PMC0);
+    Width = Eax.Bits.PerformanceMonitorCounterWidth;
+  }
+
+  if (Width < 64) {
+    Value &= LShiftU64 (1, Width) - 1;
+  }
+
+  *Count = Value;
+  return RETURN_SUCCESS;
+}
+
+/**
+  Stop counting the specified event on the calling logical processor.
+
+  The accumulated count remains readable with CpuPerfCounterSample() until
+  the counter is started again.
+
+  @param[in]  Type  Event to stop.
+
+  @retval RETURN_SUCCESS            The counter is stopped.
+  @retval RETURN_INVALID_PARAMETER  Type is not a valid event.
+  @retval RETURN_UNSUPPORTED        The processor does not implement
+                                    architectural performance monitoring, or
+                                    does not implement the specified event.
+
+**/
+RETURN_STATUS
+EFIAPI
+CpuPerfCounterStop (
+  IN CPU_PERF_COUNTER_TYPE  Type
+  )
+{
+  CONST CPU_PERF_COUNTER_EVENT        *Event;
+  MSR_IA32_PERF_GLOBAL_CTRL_REGISTER  GlobalCtrl;
+  RETURN_STATUS                       Status;
+
+  Status = CpuPerfCounterCheckEvent (Type, NULL, NULL);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  Event             = &mCpuPerfCounterEvents[Type];
+  GlobalCtrl.Uint64 = AsmReadMsr64 (MSR_IA32_PERF_GLOBAL_CTRL);
+  if (Event->FixedCounter) {
+    GlobalCtrl.Bits.EN_FIXED_CTRn &= ~(1u << Event->CounterIndex);
+  } else {
+    GlobalCtrl.Bits.EN_PMCn &= ~1u;
+  }
+
+  AsmWriteMsr64 (MSR_IA32_PERF_GLOBAL_CTRL, GlobalCtrl.Uint64);
+  return RETURN_SUCCESS;
+}
@@ -530,7 +530,7 @@ SendInitSipiSipi (
   IcrLow.Bits.Level        = 1;
   SendIpi (IcrLow.Uint32, ApicId);
   if (!StandardSignatureIsAuthenticAMD ()) {
-    MicroSecondDelay (200);
+    MicroSecondDelay (PcdGet32 (PcdCpuSecondSipiDelayInMicroSeconds));
     SendIpi (IcrLow.Uint32, ApicId);
   }
 }
@@ -566,7 +566,7 @@ SendInitSipiSipiAllExcludingSelf (
   IcrLow.Bits.DestinationShorthand = LOCAL_APIC_DESTINATION_SHORTHAND_ALL_EXCLUDING_SELF;
   SendIpi (IcrLow.Uint32, 0);
   if (!StandardSignatureIsAuthenticAMD ()) {
-    MicroSecondDelay (200);
+    MicroSecondDelay (PcdGet32 (PcdCpuSecondSipiDelayInMicroSeconds));
     SendIpi (IcrLow.Uint32, 0);
   }
 }
@@ -769,7 +769,7 @@ SendInitSipiSipi (
   IcrLow.Bits.Level        = 1;
   SendIpi (IcrLow.Uint32, ApicId);
   if (!StandardSignatureIsAuthenticAMD ()) {
-    MicroSecondDelay (200);
+    MicroSecondDelay (PcdGet32 (PcdCpuSecondSipiDelayInMicroSeconds));
     SendIpi (IcrLow.Uint32, ApicId);
   }
 }
@@ -805,7 +805,7 @@ SendInitSipiSipiAllExcludingSelf (
   IcrLow.Bits.DestinationShorthand = LOCAL_APIC_DESTINATION_SHORTHAND_ALL_EXCLUDING_SELF;
   SendIpi (IcrLow.Uint32, 0);
   if (!StandardSignatureIsAuthenticAMD ()) {
-    MicroSecondDelay (200);
+    MicroSecondDelay (PcdGet32 (PcdCpuSecondSipiDelayInMicroSeconds));
     SendIpi (IcrLow.Uint32, 0);
   }
 }
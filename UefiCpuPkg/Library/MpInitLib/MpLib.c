@@ -616,6 +616,7 @@ ApWakeupFunction (
 {
   CPU_MP_DATA       *CpuMpData;
   UINTN             ProcessorNumber;
+  BOOLEAN           ProcessorNumberValid;
   EFI_AP_PROCEDURE  Procedure;
   VOID              *Parameter;
   UINT32            BistData;
@@ -640,11 +641,18 @@ ApWakeupFunction (
   DisableLvtInterrupts ();
   SyncLocalApicTimerSetting (CpuMpData);
 
-  CurrentApicMode = GetApicMode ();
+  CurrentApicMode      = GetApicMode ();
+  ProcessorNumberValid = FALSE;
   while (TRUE) {
     if (CpuMpData->InitFlag == ApInitConfig) {
       ProcessorNumber = ApIndex;
       //
+      // ApIndex reflects check-in order only. The BSP re-numbers the
+      // processors by APIC ID once enumeration completes, so the number
+      // must be resolved again on the next wakeup.
+      //
+      ProcessorNumberValid = FALSE;
+      //
       // This is first time AP wakeup, get BIST information from AP stack
       //
       ApTopOfStack = CpuMpData->Buffer + (ProcessorNumber + 1) * CpuMpData->CpuApStackSize;
@@ -661,7 +669,18 @@ ApWakeupFunction (
       //
       // Execute AP function if AP is ready
       //
-      GetProcessorNumber (CpuMpData, &ProcessorNumber);
+      // The handle number assigned to this AP only changes when the BSP
+      // sorts the processors by APIC ID at the end of enumeration, or on a
+      // BSP/AP exchange; both cases invalidate the cached number below.
+      // Resolving it once per INIT-SIPI-SIPI wakeup, instead of repeating
+      // the linear APIC ID search on every pass through this loop, keeps
+      // AP wakeup cost constant on large core-count systems.
+      //
+      if (!ProcessorNumberValid) {
+        GetProcessorNumber (CpuMpData, &ProcessorNumber);
+        ProcessorNumberValid = TRUE;
+      }
+
       //
       // Clear AP start-up signal when AP waken up
       //
@@ -266,6 +266,28 @@ MtrrGetDefaultMemoryType (
   return MtrrGetDefaultMemoryTypeWorker (NULL);
 }
 
+/**
+  Check whether the processor supports self-snooping.
+
+  A self-snooping processor manages conflicting memory types by snooping its
+  own cache structure, which makes the cache flush in the MTRR programming
+  sequence unnecessary.
+
+  @retval TRUE   Self-snooping is supported.
+  @retval FALSE  Self-snooping is not supported.
+
+**/
+BOOLEAN
+MtrrLibIsSelfSnoopSupported (
+  VOID
+  )
+{
+  CPUID_VERSION_INFO_EDX  Edx;
+
+  AsmCpuid (CPUID_VERSION_INFO, NULL, NULL, NULL, &Edx.Uint32);
+  return (BOOLEAN)(Edx.Bits.SS == 1);
+}
+
 /**
   Preparation before programming MTRR.
 
@@ -290,7 +312,16 @@ MtrrLibPreMtrrChange (
   //
   // Enter no fill cache mode, CD=1(Bit30), NW=0 (Bit29)
   //
-  AsmDisableCache ();
+  // The WBINVD in AsmDisableCache() is only required on processors without
+  // self-snooping; with self-snooping the memory type change sequence does
+  // not need the cache flush, so enter no fill mode by writing CR0 directly
+  // and keep the cache contents.
+  //
+  if (MtrrLibIsSelfSnoopSupported ()) {
+    AsmWriteCr0 ((AsmReadCr0 () | BIT30) & ~(UINTN)BIT29);
+  } else {
+    AsmDisableCache ();
+  }
 
   //
   // Save original CR4 value and clear PGE flag (Bit 7)
@@ -333,7 +364,14 @@ MtrrLibPostMtrrChangeEnableCache (
   //
   // Enable Normal Mode caching CD=NW=0, CD(Bit30), NW(Bit29)
   //
-  AsmEnableCache ();
+  // Skip the WBINVD in AsmEnableCache() on self-snooping processors for the
+  // same reason it is skipped when entering no fill mode above.
+  //
+  if (MtrrLibIsSelfSnoopSupported ()) {
+    AsmWriteCr0 (AsmReadCr0 () & ~(UINTN)(BIT30 | BIT29));
+  } else {
+    AsmEnableCache ();
+  }
 
   //
   // Restore original CR4 value
@@ -10,6 +10,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include "PiSmmCpuDxeSmm.h"
 
+#include <Guid/SmiHandlerProfile.h>
+
 //
 // Slots for all MTRR( FIXED MTRR + VARIABLE MTRR + MTRR_LIB_IA32_MTRR_DEF_TYPE)
 //
@@ -24,6 +26,13 @@ SMM_CPU_SYNC_MODE            mCpuSmmSyncMode;
 BOOLEAN                      mMachineCheckSupported = FALSE;
 MM_COMPLETION                mSmmStartupThisApToken;
 
+//
+// SmiHandlerProfile protocol for reporting SMI CPU rendezvous time.
+// Located lazily on the first SMI after SmmCore installs it.
+//
+SMI_HANDLER_PROFILE_PROTOCOL  *mSmiHandlerProfile       = NULL;
+BOOLEAN                       mSmiHandlerProfileLocated = FALSE;
+
 extern UINTN  mSmmShadowStackSize;
 
 /**
@@ -129,11 +138,35 @@ WaitForAllAPs (
   IN      UINTN  NumberOfAPs
   )
 {
-  UINTN  BspIndex;
+  UINTN            BspIndex;
+  UINT32           Value;
+  volatile UINT32  *Run;
 
   BspIndex = mSmmMpSyncData->BspIndex;
-  while (NumberOfAPs-- > 0) {
-    WaitForSemaphore (mSmmMpSyncData->CpuData[BspIndex].Run);
+  Run      = mSmmMpSyncData->CpuData[BspIndex].Run;
+  while (NumberOfAPs > 0) {
+    //
+    // Every AP signals the BSP through this single semaphore, so consume all
+    // pending releases in one exchange instead of decrementing once per AP.
+    // This keeps the number of atomic operations the BSP issues on the
+    // contended cache line bounded by the number of drains rather than the
+    // number of APs, which matters on large core-count parts where each
+    // decrement otherwise competes with the APs' own compare exchange loops.
+    //
+    Value = *Run;
+    if ((Value == 0) ||
+        (InterlockedCompareExchange32 ((UINT32 *)Run, Value, 0) != Value))
+    {
+      CpuPause ();
+      continue;
+    }
+
+    //
+    // The sync protocol guarantees each AP releases this semaphore exactly
+    // once per phase, so the drained amount can never exceed the wait count.
+    //
+    ASSERT (Value <= NumberOfAPs);
+    NumberOfAPs -= Value;
   }
 }
 
@@ -480,9 +513,12 @@ BSPHandler (
   UINTN          ApCount;
   BOOLEAN        ClearTopLevelSmiResult;
   UINTN          PresentCount;
+  UINT64         RendezvousStartTsc;
+  UINT64         RendezvousCycles;
 
   ASSERT (CpuIndex == mSmmMpSyncData->BspIndex);
-  ApCount = 0;
+  ApCount          = 0;
+  RendezvousCycles = 0;
 
   //
   // Flag BSP's presence
@@ -519,6 +555,7 @@ BSPHandler (
     //
     // Wait for APs to arrive
     //
+    RendezvousStartTsc = AsmReadTsc ();
     SmmWaitForApArrival ();
 
     //
@@ -531,6 +568,7 @@ BSPHandler (
     // Wait for all APs to get ready for programming MTRRs
     //
     WaitForAllAPs (ApCount);
+    RendezvousCycles = AsmReadTsc () - RendezvousStartTsc;
 
     if (SmmCpuFeaturesNeedConfigureMtrrs ()) {
       //
@@ -582,6 +620,19 @@ BSPHandler (
   //
   PerformPreTasks ();
 
+  //
+  // Report the CPU rendezvous time of this SMI to the SMM Core SMI latency
+  // ring buffer, if the SmiHandlerProfile protocol supports it.
+  //
+  if (!mSmiHandlerProfileLocated) {
+    gSmst->SmmLocateProtocol (&gSmiHandlerProfileGuid, NULL, (VOID **)&mSmiHandlerProfile);
+    mSmiHandlerProfileLocated = TRUE;
+  }
+
+  if ((mSmiHandlerProfile != NULL) && (mSmiHandlerProfile->RecordSmiRendezvous != NULL)) {
+    mSmiHandlerProfile->RecordSmiRendezvous (mSmiHandlerProfile, RendezvousCycles);
+  }
+
   //
   // Invoke SMM Foundation EntryPoint with the processor information context.
   //
@@ -1381,7 +1432,12 @@ InternalSmmStartupAllAPs (
   }
 
   if (Token != NULL) {
-    ProcToken = GetFreeToken ((UINT32)mMaxNumberOfCpus);
+    //
+    // Charge the token with the number of APs that will actually run the
+    // procedure, so the excluded processors do not have to be counted out
+    // one atomic decrement at a time below.
+    //
+    ProcToken = GetFreeToken ((UINT32)CpuCount);
     *Token    = (MM_COMPLETION)ProcToken->SpinLock;
   } else {
     ProcToken = NULL;
@@ -1422,13 +1478,6 @@ InternalSmmStartupAllAPs (
       if (CPUStatus != NULL) {
         CPUStatus[Index] = EFI_NOT_STARTED;
       }
-
-      //
-      // Decrease the count to mark this processor(AP or BSP) as finished.
-      //
-      if (ProcToken != NULL) {
-        WaitForSemaphore (&ProcToken->RunningApCount);
-      }
     }
   }
 
@@ -31,6 +31,11 @@
 #define WAIT_TIME    6000000    ///< Wait Time = 6 seconds = 6000000 microseconds
 #define WAIT_PERIOD  10         ///< Wait Period = 10 microseconds
 
+///
+/// Number of status polls to spin on before falling back to timed polling
+///
+#define FAST_WAIT_COUNT  1024
+
 ///
 /// Flash cycle Type
 ///
@@ -616,14 +616,20 @@ SendSpiCmd (
     SpiDataCount = ByteCount;
     if ((FlashCycleType == FlashCycleRead) || (FlashCycleType == FlashCycleWrite)) {
       //
-      // Trim at 256 byte boundary per operation,
+      // Trim the operation at the closest boundary requirement,
       // - SC SPI controller requires trimming at 4KB boundary
       // - Some SPI chips require trimming at 256 byte boundary for write operation
-      // - Trimming has limited performance impact as we can read / write at most 64 byte
-      //   per operation
+      // Read cycles are only trimmed at the 4KB boundary, so an unaligned
+      // read can still fill the 64 byte FIFO on every cycle.
       //
-      if (HardwareSpiAddr + ByteCount > ((HardwareSpiAddr + BIT8) &~(BIT8 - 1))) {
-        SpiDataCount = (((UINT32)(HardwareSpiAddr) + BIT8) &~(BIT8 - 1)) - (UINT32)(HardwareSpiAddr);
+      if (FlashCycleType == FlashCycleWrite) {
+        if (HardwareSpiAddr + ByteCount > ((HardwareSpiAddr + BIT8) &~(BIT8 - 1))) {
+          SpiDataCount = (((UINT32)(HardwareSpiAddr) + BIT8) &~(BIT8 - 1)) - (UINT32)(HardwareSpiAddr);
+        }
+      } else {
+        if (HardwareSpiAddr + ByteCount > ((HardwareSpiAddr + SIZE_4KB) &~(SIZE_4KB - 1))) {
+          SpiDataCount = (((UINT32)(HardwareSpiAddr) + SIZE_4KB) &~(SIZE_4KB - 1)) - (UINT32)(HardwareSpiAddr);
+        }
       }
 
       //
@@ -798,7 +804,16 @@ WaitForSpiCycleComplete (
       }
     }
 
-    MicroSecondDelay (WAIT_PERIOD);
+    //
+    // A data cycle of at most 64 bytes completes within a few microseconds,
+    // so spin on the status first and only fall back to timed polling for
+    // the long running cycles (erase, a busy flash part).
+    //
+    if (WaitTicks < FAST_WAIT_COUNT) {
+      CpuPause ();
+    } else {
+      MicroSecondDelay (WAIT_PERIOD);
+    }
   }
 
   return FALSE;
@@ -0,0 +1,80 @@
+/** @file
+  Provides a microbenchmark harness for unit tests.
+
+  A benchmark runs a caller provided body function for a number of warm-up
+  iterations that are not measured, and then for a number of measured
+  iterations that are each timed individually with the performance counter
+  provided by TimerLib. The accumulated statistics are logged through the
+  unit test framework, so they appear in the report next to the functional
+  results of the test session, and are optionally returned to the caller so
+  a test case can gate on them.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __UNIT_TEST_BENCHMARK_LIB_H__
+#define __UNIT_TEST_BENCHMARK_LIB_H__
+
+#include <Library/UnitTestLib.h>
+
+///
+/// Statistics collected over the measured iterations of one benchmark.
+/// All times are in nanoseconds as reported by TimerLib.
+///
+typedef struct {
+  UINT64    Iterations;
+  UINT64    TotalNs;
+  UINT64    MinNs;
+  UINT64    MaxNs;
+  UINT64    MeanNs;
+} UNIT_TEST_BENCHMARK_RESULT;
+
+/**
+  The body of a benchmark. It is invoked once per iteration and its
+  execution time is what the benchmark measures.
+
+  @param[in]  Context    [Optional] An optional parameter that enables
+                         benchmark body reuse with varied parameters.
+**/
+typedef
+VOID
+(EFIAPI *UNIT_TEST_BENCHMARK_BODY)(
+  IN UNIT_TEST_CONTEXT  Context
+  );
+
+/**
+  Run a benchmark body and collect timing statistics.
+
+  Body is called WarmUpIterations times without measurement to populate
+  caches and let lazy initialization complete, and then Iterations times
+  with each call timed with the TimerLib performance counter. The
+  statistics are logged with UT_LOG_INFO() and returned in Result if
+  Result is not NULL.
+
+  @param[in]   Name              NULL terminated ASCII string naming the
+                                 benchmark in the log output.
+  @param[in]   Body              The function to measure.
+  @param[in]   Context           [Optional] Passed through to Body.
+  @param[in]   WarmUpIterations  Number of unmeasured warm-up calls of Body.
+  @param[in]   Iterations        Number of measured calls of Body.
+  @param[out]  Result            [Optional] Returns the collected statistics.
+
+  @retval  EFI_SUCCESS            The benchmark was run and its statistics
+                                  were logged.
+  @retval  EFI_INVALID_PARAMETER  Name or Body is NULL, or Iterations is 0.
+
+**/
+EFI_STATUS
+EFIAPI
+UnitTestRunBenchmark (
+  IN  CONST CHAR8                 *Name,
+  IN  UNIT_TEST_BENCHMARK_BODY    Body,
+  IN  UNIT_TEST_CONTEXT           Context  OPTIONAL,
+  IN  UINTN                       WarmUpIterations,
+  IN  UINTN                       Iterations,
+  OUT UNIT_TEST_BENCHMARK_RESULT  *Result  OPTIONAL
+  );
+
+#endif
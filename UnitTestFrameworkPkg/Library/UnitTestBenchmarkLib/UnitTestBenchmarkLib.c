@@ -0,0 +1,126 @@
+/** @file
+  Microbenchmark harness built on top of the unit test framework.
+
+  Timing is taken from the platform TimerLib performance counter. Each
+  measured iteration is timed individually so that minimum, maximum and
+  mean latencies can be reported, not just an overall throughput figure.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/DebugLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
+
+/**
+  Run a benchmark body and collect timing statistics.
+
+  Body is called WarmUpIterations times without measurement to populate
+  caches and let lazy initialization complete, and then Iterations times
+  with each call timed with the TimerLib performance counter. The
+  statistics are logged with UT_LOG_INFO() and returned in Result if
+  Result is not NULL.
+
+  @param[in]   Name              NULL terminated ASCII string naming the
+                                 benchmark in the log output.
+  @param[in]   Body              The function to measure.
+  @param[in]   Context           [Optional] Passed through to Body.
+  @param[in]   WarmUpIterations  Number of unmeasured warm-up calls of Body.
+  @param[in]   Iterations        Number of measured calls of Body.
+  @param[out]  Result            [Optional] Returns the collected statistics.
+
+  @retval  EFI_SUCCESS            The benchmark was run and its statistics
+                                  were logged.
+  @retval  EFI_INVALID_PARAMETER  Name or Body is NULL, or Iterations is 0.
+
+**/
+EFI_STATUS
+EFIAPI
+UnitTestRunBenchmark (
+  IN  CONST CHAR8                 *Name,
+  IN  UNIT_TEST_BENCHMARK_BODY    Body,
+  IN  UNIT_TEST_CONTEXT           Context  OPTIONAL,
+  IN  UINTN                       WarmUpIterations,
+  IN  UINTN                       Iterations,
+  OUT UNIT_TEST_BENCHMARK_RESULT  *Result  OPTIONAL
+  )
+{
+  UNIT_TEST_BENCHMARK_RESULT  Stats;
+  UINT64                      CounterStart;
+  UINT64                      CounterEnd;
+  UINT64                      Start;
+  UINT64                      End;
+  UINT64                      Ticks;
+  UINT64                      ElapsedNs;
+  BOOLEAN                     CountsDown;
+  UINTN                       Index;
+
+  if ((Name == NULL) || (Body == NULL) || (Iterations == 0)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Warm up unmeasured, so cold caches and lazy initialization inside the
+  // body do not pollute the measured iterations.
+  //
+  for (Index = 0; Index < WarmUpIterations; Index++) {
+    Body (Context);
+  }
+
+  //
+  // The performance counter may count up or down depending on the platform
+  // TimerLib instance. Determine the direction once up front.
+  //
+  GetPerformanceCounterProperties (&CounterStart, &CounterEnd);
+  CountsDown = (BOOLEAN)(CounterStart > CounterEnd);
+
+  Stats.Iterations = (UINT64)Iterations;
+  Stats.TotalNs    = 0;
+  Stats.MinNs      = MAX_UINT64;
+  Stats.MaxNs      = 0;
+
+  for (Index = 0; Index < Iterations; Index++) {
+    Start = GetPerformanceCounter ();
+    Body (Context);
+    End = GetPerformanceCounter ();
+
+    if (CountsDown) {
+      Ticks = Start - End;
+    } else {
+      Ticks = End - Start;
+    }
+
+    ElapsedNs      = GetTimeInNanoSecond (Ticks);
+    Stats.TotalNs += ElapsedNs;
+    if (ElapsedNs < Stats.MinNs) {
+      Stats.MinNs = ElapsedNs;
+    }
+
+    if (ElapsedNs > Stats.MaxNs) {
+      Stats.MaxNs = ElapsedNs;
+    }
+  }
+
+  Stats.MeanNs = DivU64x64Remainder (Stats.TotalNs, Stats.Iterations, NULL);
+
+  UT_LOG_INFO (
+    "BENCHMARK %a: iterations %ld min %ld ns mean %ld ns max %ld ns total %ld ns\n",
+    Name,
+    Stats.Iterations,
+    Stats.MinNs,
+    Stats.MeanNs,
+    Stats.MaxNs,
+    Stats.TotalNs
+    );
+
+  if (Result != NULL) {
+    *Result = Stats;
+  }
+
+  return EFI_SUCCESS;
+}
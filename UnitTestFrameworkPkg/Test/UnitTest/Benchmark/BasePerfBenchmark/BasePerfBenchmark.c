@@ -0,0 +1,557 @@
+/** @file
+  Microbenchmark suite for commonly used MdePkg primitives. It uses
+  UnitTestBenchmarkLib so the timing statistics appear in the regular unit
+  test report, and it can run both in the UEFI Shell and as a host
+  application.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PrintLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
+
+#define UNIT_TEST_NAME     "Base Perf Benchmark"
+#define UNIT_TEST_VERSION  "0.1"
+
+//
+// Iteration counts shared by all benchmarks in this suite. The warm-up runs
+// are not measured.
+//
+#define BENCHMARK_WARM_UP_ITERATIONS  16
+#define BENCHMARK_ITERATIONS          1000
+
+//
+// Buffer sizes the memory benchmarks are run at, covering a small copy, a
+// cache-line scale copy, and a page sized copy.
+//
+STATIC CONST UINTN  mBufferSizes[] = { 16, 256, 4096 };
+
+#define BENCHMARK_MAX_BUFFER_SIZE  4096
+
+///
+/// Global buffers used by benchmark bodies. The results of the measured
+/// operations are stored in globals so the compiler cannot discard the
+/// operations as dead code.
+///
+STATIC UINT8             mSourceBuffer[BENCHMARK_MAX_BUFFER_SIZE];
+STATIC UINT8             mDestinationBuffer[BENCHMARK_MAX_BUFFER_SIZE];
+STATIC CHAR16            mPrintBuffer[0x100];
+STATIC volatile BOOLEAN  mCompareGuidResult;
+
+//
+// Multi-KB Unicode strings used by the string primitive benchmarks.
+// mUcs2StringA carries a needle near its end so StrStr() has to scan most
+// of the haystack; mUcs2StringB is an identical copy for StrCmp().
+//
+#define BENCHMARK_UCS2_STRING_LENGTH  2048
+#define BENCHMARK_STR_STR_NEEDLE      L"=StrStrNeedle"
+
+STATIC CHAR16          mUcs2StringA[BENCHMARK_UCS2_STRING_LENGTH];
+STATIC CHAR16          mUcs2StringB[BENCHMARK_UCS2_STRING_LENGTH];
+STATIC volatile UINTN  mStringResult;
+
+STATIC EFI_GUID  mGuidA = {
+  0x8a7f1d5c, 0x4b6e, 0x49d2, { 0x92, 0x5a, 0x6c, 0x2e, 0xd4, 0x8f, 0x1b, 0x03 }
+};
+STATIC EFI_GUID  mGuidB = {
+  0x8a7f1d5c, 0x4b6e, 0x49d2, { 0x92, 0x5a, 0x6c, 0x2e, 0xd4, 0x8f, 0x1b, 0x04 }
+};
+
+/**
+  Fill the Unicode strings used by the string primitive benchmarks.
+**/
+STATIC
+VOID
+InitializeUcs2Strings (
+  VOID
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < BENCHMARK_UCS2_STRING_LENGTH - 1; Index++) {
+    mUcs2StringA[Index] = (CHAR16)(L'A' + (Index % 26));
+  }
+
+  mUcs2StringA[BENCHMARK_UCS2_STRING_LENGTH - 1] = L'\0';
+
+  //
+  // Plant the needle near the end of the haystack so StrStr() scans most
+  // of the string before it matches.
+  //
+  CopyMem (
+    &mUcs2StringA[BENCHMARK_UCS2_STRING_LENGTH - 16],
+    BENCHMARK_STR_STR_NEEDLE,
+    sizeof (BENCHMARK_STR_STR_NEEDLE)
+    );
+  CopyMem (mUcs2StringB, mUcs2StringA, sizeof (mUcs2StringB));
+}
+
+/**
+  Benchmark body that copies Context bytes between two global buffers.
+
+  @param[in]  Context    The number of bytes to copy, cast to a pointer.
+**/
+VOID
+EFIAPI
+CopyMemBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CopyMem (mDestinationBuffer, mSourceBuffer, (UINTN)Context);
+}
+
+/**
+  Benchmark body that fills Context bytes of a global buffer.
+
+  @param[in]  Context    The number of bytes to fill, cast to a pointer.
+**/
+VOID
+EFIAPI
+SetMemBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  SetMem (mDestinationBuffer, (UINTN)Context, 0xA5);
+}
+
+/**
+  Benchmark body that compares two GUIDs differing only in their last byte,
+  which is the worst case for CompareGuid().
+
+  @param[in]  Context    Not used.
+**/
+VOID
+EFIAPI
+CompareGuidBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  mCompareGuidResult = CompareGuid (&mGuidA, &mGuidB);
+}
+
+/**
+  Benchmark body that formats a representative Unicode string with decimal,
+  hexadecimal, string, and GUID conversions.
+
+  @param[in]  Context    Not used.
+**/
+VOID
+EFIAPI
+UnicodeSPrintBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UnicodeSPrint (
+    mPrintBuffer,
+    sizeof (mPrintBuffer),
+    L"Item %d at 0x%08x named %s with ID %g",
+    47,
+    0x12345678,
+    L"BenchmarkItem",
+    &mGuidA
+    );
+}
+
+/**
+  Benchmark body that allocates and immediately frees a 256 byte pool buffer,
+  measuring the round trip cost of the pool allocator.
+
+  @param[in]  Context    Not used.
+**/
+VOID
+EFIAPI
+AllocatePoolBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  VOID  *Buffer;
+
+  Buffer = AllocatePool (256);
+  if (Buffer != NULL) {
+    FreePool (Buffer);
+  }
+}
+
+/**
+  Benchmark body that takes the length of a multi-KB Unicode string.
+
+  @param[in]  Context    Not used.
+**/
+VOID
+EFIAPI
+StrLenBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  mStringResult = StrLen (mUcs2StringA);
+}
+
+/**
+  Benchmark body that compares two identical multi-KB Unicode strings,
+  which is the worst case for StrCmp().
+
+  @param[in]  Context    Not used.
+**/
+VOID
+EFIAPI
+StrCmpBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  mStringResult = (UINTN)StrCmp (mUcs2StringA, mUcs2StringB);
+}
+
+/**
+  Benchmark body that searches a multi-KB Unicode string for a needle
+  planted near its end.
+
+  @param[in]  Context    Not used.
+**/
+VOID
+EFIAPI
+StrStrBody (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  mStringResult = (UINTN)StrStr (mUcs2StringA, BENCHMARK_STR_STR_NEEDLE);
+}
+
+/**
+  Benchmark CopyMem() at each of the sizes in mBufferSizes.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkCopyMem (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Index;
+  CHAR8  Name[32];
+
+  for (Index = 0; Index < ARRAY_SIZE (mBufferSizes); Index++) {
+    AsciiSPrint (Name, sizeof (Name), "CopyMem/%d", mBufferSizes[Index]);
+    UT_ASSERT_NOT_EFI_ERROR (
+      UnitTestRunBenchmark (
+        Name,
+        CopyMemBody,
+        (UNIT_TEST_CONTEXT)mBufferSizes[Index],
+        BENCHMARK_WARM_UP_ITERATIONS,
+        BENCHMARK_ITERATIONS,
+        NULL
+        )
+      );
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Benchmark SetMem() at each of the sizes in mBufferSizes.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkSetMem (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Index;
+  CHAR8  Name[32];
+
+  for (Index = 0; Index < ARRAY_SIZE (mBufferSizes); Index++) {
+    AsciiSPrint (Name, sizeof (Name), "SetMem/%d", mBufferSizes[Index]);
+    UT_ASSERT_NOT_EFI_ERROR (
+      UnitTestRunBenchmark (
+        Name,
+        SetMemBody,
+        (UNIT_TEST_CONTEXT)mBufferSizes[Index],
+        BENCHMARK_WARM_UP_ITERATIONS,
+        BENCHMARK_ITERATIONS,
+        NULL
+        )
+      );
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Benchmark CompareGuid() with two nearly equal GUIDs.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkCompareGuid (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UT_ASSERT_NOT_EFI_ERROR (
+    UnitTestRunBenchmark (
+      "CompareGuid",
+      CompareGuidBody,
+      NULL,
+      BENCHMARK_WARM_UP_ITERATIONS,
+      BENCHMARK_ITERATIONS,
+      NULL
+      )
+    );
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Benchmark UnicodeSPrint() with a representative format string.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkUnicodeSPrint (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UT_ASSERT_NOT_EFI_ERROR (
+    UnitTestRunBenchmark (
+      "UnicodeSPrint",
+      UnicodeSPrintBody,
+      NULL,
+      BENCHMARK_WARM_UP_ITERATIONS,
+      BENCHMARK_ITERATIONS,
+      NULL
+      )
+    );
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Benchmark an AllocatePool()/FreePool() round trip.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkAllocatePool (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UT_ASSERT_NOT_EFI_ERROR (
+    UnitTestRunBenchmark (
+      "AllocatePool/FreePool 256",
+      AllocatePoolBody,
+      NULL,
+      BENCHMARK_WARM_UP_ITERATIONS,
+      BENCHMARK_ITERATIONS,
+      NULL
+      )
+    );
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Benchmark StrLen(), StrCmp(), and StrStr() on multi-KB Unicode strings.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkUcs2String (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  InitializeUcs2Strings ();
+
+  UT_ASSERT_NOT_EFI_ERROR (
+    UnitTestRunBenchmark (
+      "StrLen/2K",
+      StrLenBody,
+      NULL,
+      BENCHMARK_WARM_UP_ITERATIONS,
+      BENCHMARK_ITERATIONS,
+      NULL
+      )
+    );
+
+  UT_ASSERT_NOT_EFI_ERROR (
+    UnitTestRunBenchmark (
+      "StrCmp/2K",
+      StrCmpBody,
+      NULL,
+      BENCHMARK_WARM_UP_ITERATIONS,
+      BENCHMARK_ITERATIONS,
+      NULL
+      )
+    );
+
+  UT_ASSERT_NOT_EFI_ERROR (
+    UnitTestRunBenchmark (
+      "StrStr/2K",
+      StrStrBody,
+      NULL,
+      BENCHMARK_WARM_UP_ITERATIONS,
+      BENCHMARK_ITERATIONS,
+      NULL
+      )
+    );
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  benchmarks and run the benchmarks.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+EFI_STATUS
+EFIAPI
+UefiTestMain (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      BenchmarkSuite;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_NAME, UNIT_TEST_VERSION));
+
+  //
+  // Start setting up the test framework for running the benchmarks.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_NAME, gEfiCallerBaseName, UNIT_TEST_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the benchmark suite.
+  //
+  Status = CreateUnitTestSuite (&BenchmarkSuite, Framework, "MdePkg Primitive Benchmarks", "Benchmark.MdePkg", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for BenchmarkSuite\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  AddTestCase (BenchmarkSuite, "Benchmark CopyMem()", "CopyMem", BenchmarkCopyMem, NULL, NULL, NULL);
+  AddTestCase (BenchmarkSuite, "Benchmark SetMem()", "SetMem", BenchmarkSetMem, NULL, NULL, NULL);
+  AddTestCase (BenchmarkSuite, "Benchmark CompareGuid()", "CompareGuid", BenchmarkCompareGuid, NULL, NULL, NULL);
+  AddTestCase (BenchmarkSuite, "Benchmark UnicodeSPrint()", "UnicodeSPrint", BenchmarkUnicodeSPrint, NULL, NULL, NULL);
+  AddTestCase (BenchmarkSuite, "Benchmark AllocatePool()/FreePool()", "AllocatePool", BenchmarkAllocatePool, NULL, NULL, NULL);
+  AddTestCase (BenchmarkSuite, "Benchmark UCS-2 string primitives", "Ucs2String", BenchmarkUcs2String, NULL, NULL, NULL);
+
+  //
+  // Execute the benchmarks.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard UEFI entry point for target based benchmark execution from DXE, SMM,
+  UEFI Shell.
+**/
+EFI_STATUS
+EFIAPI
+DxeEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  return UefiTestMain ();
+}
+
+/**
+  Standard POSIX C entry point for host based benchmark execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UefiTestMain ();
+}